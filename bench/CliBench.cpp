@@ -0,0 +1,140 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 客户端服务的基准测试：分别以同步模型和回调模型启动节点，多个客户端线程持续发送读写请求，统计 QPS 与延迟分布。
+// 用法: cli_bench [客户端线程数] [每轮秒数] [读请求百分比]
+
+#include "protos/GossipCli.grpc.pb.h"
+#include "server/GossipNode.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace gossip::server;
+
+namespace {
+
+    /// Stream buffer that drops all output, used to silence node logs while measuring.
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override {
+            return c;
+        }
+    };
+
+    struct Result {
+        double qps;
+        double p50_us;
+        double p99_us;
+        long failed;
+    };
+
+    Result run(GossipOptions::ServiceMode mode, int port, int clients, int seconds, int read_percent) {
+
+        GossipOptions options;
+        options.cli_service_mode = mode;
+        auto address = "127.0.0.1:" + std::to_string(port);
+        GossipNode node("bench", address, "127.0.0.1:" + std::to_string(port + 1), "", options);
+
+        constexpr int kKeys = 1000;
+        for (int i = 0; i < kKeys; i++)
+            node.insertOrUpdateMessage("key" + std::to_string(i), "value" + std::to_string(i));
+
+        std::atomic<bool> stop = false;
+        std::atomic<long> failed = 0;
+        std::vector<std::vector<long>> latencies(clients);
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < clients; i++) {
+            threads.emplace_back([&, i] {
+                // 每个线程使用独立的 channel，避免共享同一条连接
+                grpc::ChannelArguments args;
+                args.SetInt("bench.channel", i);
+                auto stub = pf_gossip_cli::GossipClient::NewStub(
+                        grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args));
+
+                std::default_random_engine e(i);
+                std::uniform_int_distribution<int> key(0, kKeys - 1), ratio(0, 99);
+
+                while (!stop) {
+                    grpc::ClientContext context;
+                    grpc::Status status;
+                    auto start = std::chrono::steady_clock::now();
+
+                    if (ratio(e) < read_percent) {
+                        pf_gossip_cli::Key request;
+                        pf_gossip::Message response;
+                        request.set_content("key" + std::to_string(key(e)));
+                        status = stub->getMessage(&context, request, &response);
+                    } else {
+                        pf_gossip::Message request;
+                        pf_gossip_cli::Echo response;
+                        request.set_key("key" + std::to_string(key(e)));
+                        request.set_value("bench");
+                        status = stub->addMessage(&context, request, &response);
+                    }
+
+                    auto end = std::chrono::steady_clock::now();
+                    if (!status.ok()) {
+                        failed++;
+                        continue;
+                    }
+                    latencies[i].emplace_back(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+                }
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::seconds(seconds));
+        stop = true;
+        for (auto &th: threads)
+            th.join();
+
+        std::vector<long> all;
+        for (auto &l: latencies)
+            all.insert(all.end(), l.begin(), l.end());
+        std::sort(all.begin(), all.end());
+
+        if (all.empty())
+            return {0, 0, 0, failed};
+
+        auto percentile = [&all](double p) {
+            return static_cast<double>(all[static_cast<size_t>(p * static_cast<double>(all.size() - 1))]) / 1000;
+        };
+        return {static_cast<double>(all.size()) / seconds, percentile(0.5), percentile(0.99), failed};
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int clients = argc > 1 ? std::stoi(argv[1]) : 8;
+    int seconds = argc > 2 ? std::stoi(argv[2]) : 3;
+    int read_percent = argc > 3 ? std::stoi(argv[3]) : 90;
+
+    NullBuffer null;
+    auto origin = std::cout.rdbuf();
+
+    std::cout.rdbuf(&null);
+    auto sync = run(GossipOptions::ServiceMode::Sync, 19901, clients, seconds, read_percent);
+    auto callback = run(GossipOptions::ServiceMode::Callback, 19903, clients, seconds, read_percent);
+    std::cout.rdbuf(origin);
+
+    std::cout << "clients: " << clients << ", reads: " << read_percent << "%, cores: "
+              << std::thread::hardware_concurrency() << std::endl;
+    std::cout << "mode\tqps\tp50(us)\tp99(us)\tfailed" << std::endl;
+    for (auto &[name, result]: {std::pair{"sync", sync}, std::pair{"callback", callback}}) {
+        std::cout << name << "\t" << static_cast<long>(result.qps) << "\t" << result.p50_us << "\t"
+                  << result.p99_us << "\t" << result.failed << std::endl;
+    }
+
+    return 0;
+}
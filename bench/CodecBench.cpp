@@ -0,0 +1,99 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 全量 slot 传输的基准测试：比较先构造 SlotUpdate 再序列化、接收后复制到 SlotValues 的旧路径，
+// 与直接从快照编码、接收后移动键值对的新路径，两条路径都包含编码、解析和合并到另一个 slot。
+// 用法: codec_bench [键值对数量] [value 长度] [轮数]
+
+#include "server/GossipSlotCodec.h"
+
+#include <grpcpp/impl/codegen/proto_utils.h>
+
+#include <chrono>
+#include <iostream>
+
+using namespace gossip::server;
+
+namespace {
+
+    /// Parse wire bytes of a ByteBuffer as SlotUpdate.
+    pf_gossip::SlotUpdate parse(const grpc::ByteBuffer &buffer) {
+        grpc::ByteBuffer copy(buffer);
+        pf_gossip::SlotUpdate update;
+        grpc::SerializationTraits<pf_gossip::SlotUpdate>::Deserialize(&copy, &update);
+        return update;
+    }
+
+    double legacy(const GossipSlot &source, int rounds) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) {
+            auto snapshot = source.snapshot();
+            pf_gossip::SlotUpdate update;
+            update.set_name(source.name());
+            update.set_version(snapshot->version);
+            snapshot->forEach([&update](const std::string &key, const SlotEntry &entry) {
+                auto message = update.add_messages();
+                message->set_key(key);
+                message->set_value(entry.value);
+                message->set_version(entry.version);
+            });
+            grpc::ByteBuffer buffer;
+            bool own;
+            grpc::SerializationTraits<pf_gossip::SlotUpdate>::Serialize(update, &buffer, &own);
+
+            auto request = parse(buffer);
+            SlotValues values;
+            for (auto &message: request.messages())
+                values.emplace(message.key(), SlotEntry{message.value(), message.version()});
+            const SlotValues &ref = values;
+
+            GossipSlot target(source.name());
+            target.compareAndMergeSlot(ref, request.version());
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / rounds;
+    }
+
+    double codec(const GossipSlot &source, int rounds) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) {
+            auto snapshot = source.snapshot();
+            pf_gossip::SlotUpdate header;
+            header.set_name(source.name());
+            header.set_version(snapshot->version);
+            auto buffer = GossipSlotCodec::encode(header, *snapshot);
+
+            auto request = parse(buffer);
+            auto values = GossipSlotCodec::decode(&request);
+
+            GossipSlot target(source.name());
+            target.compareAndMergeSlot(std::move(values), request.version());
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / rounds;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int keys = argc > 1 ? std::stoi(argv[1]) : 10000;
+    int value_size = argc > 2 ? std::stoi(argv[2]) : 100;
+    int rounds = argc > 3 ? std::stoi(argv[3]) : 50;
+
+    GossipSlot source("bench");
+    for (int i = 0; i < keys; i++)
+        source.insertOrUpdate("key" + std::to_string(i), std::string(value_size, 'v'));
+
+    // 预热
+    legacy(source, 2);
+    codec(source, 2);
+
+    std::cout << "keys: " << keys << ", value: " << value_size << " bytes" << std::endl;
+    std::cout << "path\tus/round" << std::endl;
+    std::cout << "legacy\t" << legacy(source, rounds) << std::endl;
+    std::cout << "codec\t" << codec(source, rounds) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 反熵收敛的基准测试：N 个节点连接成一条链，每个节点写入一个键值对但是不进行谣言传播（相当于谣言全部丢失），
+// 只依靠心跳中交换的 slot 版本向量，或者 push-pull 的 syncSlots 进行同步，统计所有节点都持有全部 slot 所需的时间
+// 与轮数。
+// 用法: converge_bench [节点数量] [间隔(ms)] [heartbeat|sync]
+
+#include "server/GossipNode.h"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace gossip::server;
+
+namespace {
+
+    /// Stream buffer that drops all output, used to silence node logs while measuring.
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override {
+            return c;
+        }
+    };
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int count = argc > 1 ? std::stoi(argv[1]) : 8;
+    int interval = argc > 2 ? std::stoi(argv[2]) : 100;
+    std::string mode = argc > 3 ? argv[3] : "sync";
+
+    NullBuffer null;
+    auto origin = std::cout.rdbuf();
+    std::cout.rdbuf(&null);
+
+    // 只使用一种反熵方式
+    GossipOptions options;
+    if (mode == "heartbeat") {
+        options.heartbeat_interval_ms = interval;
+        options.sync_interval_ms = 0;
+    } else {
+        options.heartbeat_interval_ms = 3600 * 1000;
+        options.sync_interval_ms = interval;
+    }
+    // 写入一直留在缓冲区中，不会通过谣言传播
+    options.rumor_window_ms = 3600 * 1000;
+    options.rumor_max_writes = SIZE_MAX;
+
+    auto address = [](int port) { return "127.0.0.1:" + std::to_string(port); };
+
+    // 节点不会被析构，进程结束时直接退出
+    std::vector<GossipNode *> nodes;
+    for (int i = 0; i < count; i++) {
+        nodes.emplace_back(new GossipNode("N" + std::to_string(i), address(20000 + 2 * i), address(20001 + 2 * i), "",
+                                          options));
+        if (i > 0)
+            nodes[i]->startConnection(address(20001 + 2 * (i - 1)));
+        nodes[i]->insertOrUpdateMessage("key", "value" + std::to_string(i));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto node: nodes)
+        std::thread([node] { node->run(); }).detach();
+
+    // 每个节点都能找到所有节点写入的键值对时视为收敛
+    auto converged = [&] {
+        for (auto node: nodes) {
+            if (node->searchMessage("key", false).message_size() != count)
+                return false;
+        }
+        return true;
+    };
+
+    double elapsed = 0;
+    while (!converged() && elapsed < 60000) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::cout.rdbuf(origin);
+    std::cout << "nodes: " << count << ", " << mode << ": " << interval << "ms" << std::endl;
+    std::cout << "converge(ms)\t" << elapsed << std::endl;
+    std::cout << "rounds\t" << elapsed / interval << std::endl;
+
+    std::_Exit(0);  // 节点没有提供关闭 peer 的接口，直接退出
+}
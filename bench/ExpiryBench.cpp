@@ -0,0 +1,156 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 键值对 TTL 的基准测试：一个 slot 中一部分键值对带有 TTL，每个 tick 找出已经过期的键值对并转换为墓碑。
+// 统计通过时间轮找出过期键值对的耗时，与之比较的是每个 tick 扫描整个 slot 的耗时；转换为墓碑的耗时两种方式相同，单独统计。
+// 时间轮最早的一个 tick 取出的是读取检查期间已经过期的键值对。
+// 过期之前检查读取是否恰好隐藏了已经过期的键值对；对方节点只接收一次全量更新并各自过期，最后比较两边的墓碑是否相同。
+// 用法: expiry_bench [键值对数量] [带 TTL 的比例(%)] [最大 TTL(ms)] [tick(ms)]
+
+#include "server/GossipExpiryWheel.h"
+#include "server/GossipSlotCodec.h"
+
+#include <grpcpp/impl/codegen/proto_utils.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <unordered_map>
+
+using namespace gossip::server;
+
+namespace {
+
+    double since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /// Turn expired entries taken from a wheel into tombstones, return the number of expired K-V pairs.
+    size_t expire(std::vector<GossipExpiryWheel::Entry> entries, int64_t now) {
+        std::unordered_map<GossipSlot *, std::vector<std::pair<std::string, SlotVersion>>> groups;
+        for (auto &entry: entries)
+            groups[entry.slot].emplace_back(std::move(entry.key), entry.version);
+
+        size_t count = 0;
+        for (auto &[slot, keys]: groups)
+            count += slot->expire(keys, now);
+        return count;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int keys = argc > 1 ? std::stoi(argv[1]) : 100000;
+    int percent = argc > 2 ? std::stoi(argv[2]) : 10;
+    int max_ttl = argc > 3 ? std::stoi(argv[3]) : 5000;
+    int tick = argc > 4 ? std::stoi(argv[4]) : 10;
+
+    GossipSlot source("bench"), target("bench");
+    GossipExpiryWheel source_wheel{std::chrono::milliseconds(tick)}, target_wheel{std::chrono::milliseconds(tick)};
+
+    // 不带 TTL 的键值对先通过一次全量更新同步到对方节点
+    SlotValues initial;
+    auto version = GossipClock::now();
+    for (int i = 0; i < keys; i++)
+        initial.emplace("key" + std::to_string(i), SlotEntry{std::string(100, 'v'), version});
+    source.compareAndMergeSlot(initial, version);
+    target.compareAndMergeSlot(std::move(initial), version);
+
+    // 一部分键值对带着 TTL 重新写入，对方节点接收增量，过期时间由版本与 TTL 算出
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> ttl(100, max_ttl), chance(0, 99);
+    SlotBatch batch;
+    for (int i = 0; i < keys; i++) {
+        if (chance(random) < percent)
+            batch.push_back({"key" + std::to_string(i), std::string(100, 'w'), false, ttl(random)});
+    }
+    SlotVersion base;
+    version = source.applyBatch(batch, &base);
+    for (auto &operation: batch)
+        source_wheel.add(&source, operation.key, version, SlotEntry::expiration(version, operation.ttl_ms));
+
+    pf_gossip::SlotUpdate header;
+    header.set_name(source.name());
+    header.set_version(version);
+    header.set_delta(true);
+    header.set_base_version(base);
+    auto buffer = GossipSlotCodec::encode(header, *source.snapshot(), [base](const std::string &,
+                                                                             const SlotEntry &entry) {
+        return entry.version > base;
+    });
+    pf_gossip::SlotUpdate request;
+    grpc::SerializationTraits<pf_gossip::SlotUpdate>::Deserialize(&buffer, &request);
+    auto values = GossipSlotCodec::decode(&request);
+    for (auto &[key, entry]: values) {
+        if (entry.expires != 0)
+            target_wheel.add(&target, key, entry.version, entry.expires);
+    }
+    target.compareAndMergeSlot(std::move(values), request.version(), true, request.base_version());
+
+    // 过期之前读取：已经过期的键值对必须读不到，没有过期的键值对必须读到
+    std::this_thread::sleep_for(std::chrono::milliseconds(max_ttl / 4));
+    size_t wrong_reads = 0;
+    source.snapshot()->forEach([&](const std::string &key, const SlotEntry &entry) {
+        // 在读取期间过期的键值对不计入
+        auto before = GossipClock::millis();
+        bool visible = target.find(key).second != 0;
+        auto after = GossipClock::millis();
+        if (entry.expires > before && entry.expires <= after)
+            return;
+        if (visible == entry.expired(before))
+            wrong_reads++;
+    });
+
+    // 时间轮与墓碑都以传入的时间为准，逐个 tick 推进时间，不需要真的等待。三种操作分开计时，互不影响缓存
+    auto begin = GossipClock::millis();
+    std::vector<std::vector<GossipExpiryWheel::Entry>> taken;
+    auto start = std::chrono::steady_clock::now();
+    for (auto now = begin; source_wheel.size() > 0; now += tick)
+        taken.emplace_back(source_wheel.advance(now));
+    auto wheel = since(start);
+    auto ticks = static_cast<int>(taken.size());
+
+    // 没有时间轮时，每个 tick 都要扫描整个 slot
+    size_t scan_found = 0;
+    auto snapshot = source.snapshot();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ticks; i++) {
+        auto now = begin + static_cast<int64_t>(i) * tick;
+        snapshot->forEach([&](const std::string &, const SlotEntry &entry) {
+            scan_found += entry.expires > now - tick && entry.expired(now);
+        });
+    }
+    auto scan = since(start);
+    snapshot.reset();
+
+    size_t expired = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ticks; i++)
+        expired += expire(std::move(taken[i]), begin + static_cast<int64_t>(i) * tick);
+    auto tombstone = since(start);
+    for (auto now = begin; target_wheel.size() > 0; now += tick)
+        expire(target_wheel.advance(now), now);
+
+    // 两边各自过期，墓碑的版本应该完全相同
+    size_t mismatched = 0;
+    auto replica = target.snapshot();
+    source.snapshot()->forEach([&](const std::string &key, const SlotEntry &entry) {
+        auto other = replica->lookup(key);
+        if (!other || other->deleted != entry.deleted || other->version != entry.version)
+            mismatched++;
+    });
+
+    std::cout << "keys: " << keys << ", with ttl: " << batch.size() << ", max ttl(ms): " << max_ttl << ", tick(ms): "
+              << tick << ", ticks: " << ticks << std::endl;
+    std::cout << "wheel(ms)\t" << wheel << ", per tick " << wheel / ticks << std::endl;
+    std::cout << "full scan(ms)\t" << scan << ", per tick " << scan / ticks << ", found " << scan_found << std::endl;
+    std::cout << "tombstone(ms)\t" << tombstone << ", expired " << expired << std::endl;
+    std::cout << "wrong reads\t" << wrong_reads << std::endl;
+    std::cout << "tombstones\t" << source.tombstones() << "/" << target.tombstones() << ", mismatched " << mismatched
+              << ", root hash " << (source.digest({0}).first == target.digest({0}).first ? "equal" : "different")
+              << std::endl;
+    return 0;
+}
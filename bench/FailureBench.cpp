@@ -0,0 +1,165 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// SWIM 故障检测的基准测试：N - 1 个节点在本进程中运行，另一个节点在子进程中运行，所有节点都只连接到第一个节点，
+// 其余的成员关系通过捎带传播。所有节点互相可见后：
+//   kill 模式杀死子进程，统计第一个节点与所有节点判定其死亡所需的时间；
+//   pause 模式暂停子进程一段时间后恢复，模拟 GC 停顿或短暂的网络抖动，统计期间判定其死亡的节点数量。
+// swim 表示关闭 phi-accrual 的门限，只使用 SWIM 的探测与怀疑超时。
+// 用法: failure_bench [节点数量] [探测间隔(ms)] [kill|pause] [phi|swim] [暂停时间(探测间隔的倍数)]
+
+#include "server/GossipNode.h"
+
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace gossip::server;
+
+namespace {
+
+    /// Stream buffer that drops all output, used to silence node logs while measuring.
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override {
+            return c;
+        }
+    };
+
+    std::string address(int port) {
+        return "127.0.0.1:" + std::to_string(port);
+    }
+
+    double since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int count = argc > 1 ? std::stoi(argv[1]) : 8;
+    size_t interval = argc > 2 ? std::stoul(argv[2]) : 200;
+    std::string mode = argc > 3 ? argv[3] : "kill";
+    std::string detector = argc > 4 ? argv[4] : "phi";
+    size_t pause = interval * (argc > 5 ? std::stoul(argv[5]) : 5);
+
+    GossipOptions options;
+    options.probe_interval_ms = interval;
+    options.probe_timeout_ms = interval * 3 / 10;
+    options.suspect_timeout_ms = interval * 3;
+    if (detector == "swim") {
+        options.phi_suspect_threshold = 0;
+        options.phi_dead_threshold = 0;
+    }
+
+    auto victim = "N" + std::to_string(count - 1);
+
+    // 在创建任何 grpc 对象之前 fork，子进程运行被杀死的节点
+    auto pid = fork();
+    if (pid == 0) {
+        NullBuffer null;
+        std::cout.rdbuf(&null);
+        std::cerr.rdbuf(&null);
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        GossipNode node(victim, address(21000 + 2 * (count - 1)), address(21001 + 2 * (count - 1)), "", options);
+        node.startConnection(address(21001));
+        node.run();
+        return 0;
+    }
+
+    NullBuffer null;
+    // 节点在输出结果时仍在运行，结果直接写到原来的缓冲区
+    std::ostream out(std::cout.rdbuf());
+    std::cout.rdbuf(&null);
+    std::cerr.rdbuf(&null);
+
+    // 节点不会被析构，进程结束时直接退出
+    std::vector<GossipNode *> nodes;
+    for (int i = 0; i < count - 1; i++) {
+        nodes.emplace_back(new GossipNode("N" + std::to_string(i), address(21000 + 2 * i), address(21001 + 2 * i), "",
+                                          options));
+        if (i > 0)
+            nodes[i]->startConnection(address(21001));
+    }
+    for (auto node: nodes)
+        std::thread([node] { node->run(); }).detach();
+
+    // 等待所有节点互相可见
+    auto visible = [&] {
+        for (int i = 0; i < count - 1; i++) {
+            for (int j = 0; j < count; j++) {
+                if (i != j && nodes[i]->memberState("N" + std::to_string(j)) != pf_gossip::ALIVE)
+                    return false;
+            }
+        }
+        return true;
+    };
+    auto start = std::chrono::steady_clock::now();
+    while (!visible() && since(start) < 30000)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    auto join = since(start);
+
+    auto deadCount = [&] {
+        int dead = 0;
+        for (auto node: nodes) {
+            if (node->memberState(victim) == pf_gossip::DEAD)
+                dead++;
+        }
+        return dead;
+    };
+
+    if (mode == "pause") {
+        // 暂停期间以及恢复后一段时间内，统计曾经判定其死亡的节点数量
+        kill(pid, SIGSTOP);
+        start = std::chrono::steady_clock::now();
+        int evicted = 0;
+        auto watch = [&](double until) {
+            while (since(start) < until) {
+                evicted = std::max(evicted, deadCount());
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        };
+        watch(static_cast<double>(pause));
+        kill(pid, SIGCONT);
+        watch(static_cast<double>(pause + interval * 10));
+
+        out << "nodes: " << count << ", probe interval: " << interval << "ms, detector: " << detector
+            << std::endl;
+        out << "join(ms)\t" << join << std::endl;
+        out << "pause(ms)\t" << pause << std::endl;
+        out << "evicted by\t" << evicted << " of " << count - 1 << std::endl;
+
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+        std::_Exit(0);
+    }
+
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+
+    start = std::chrono::steady_clock::now();
+    double first = -1, all = -1;
+    while (since(start) < 30000) {
+        int dead = deadCount();
+        if (dead > 0 && first < 0)
+            first = since(start);
+        if (dead == count - 1) {
+            all = since(start);
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    out << "nodes: " << count << ", probe interval: " << interval << "ms, detector: " << detector
+        << std::endl;
+    out << "join(ms)\t" << join << std::endl;
+    out << "first dead(ms)\t" << first << std::endl;
+    out << "all dead(ms)\t" << all << std::endl;
+
+    std::_Exit(0);  // 节点没有提供关闭 peer 的接口，直接退出
+}
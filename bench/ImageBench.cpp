@@ -0,0 +1,132 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// slot 镜像冷启动的基准测试：写入若干个 slot 的镜像后重新映射，统计写入、映射、在冷 slot 上读取与加载到内存的耗时；
+// 与之比较的是重启后从对方节点接收每个 slot 的全量更新，统计编码后的字节数以及解析、合并的耗时。
+// 最后修改一部分 slot，统计冷启动之后只需要获取的增量字节数。
+// 用法: image_bench [slot 数量] [每个 slot 的键值对数量] [value 长度] [镜像文件]
+
+#include "server/GossipSlotCodec.h"
+#include "server/GossipSlotImage.h"
+
+#include <grpcpp/impl/codegen/proto_utils.h>
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <list>
+#include <random>
+
+using namespace gossip::server;
+
+namespace {
+
+    double since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int slot_count = argc > 1 ? std::stoi(argv[1]) : 64;
+    int keys = argc > 2 ? std::stoi(argv[2]) : 10000;
+    size_t value_size = argc > 3 ? std::stoul(argv[3]) : 100;
+    std::string path = argc > 4 ? argv[4] : (std::filesystem::temp_directory_path() / "gossip_image_bench").string();
+
+    std::list<GossipSlot> sources;
+    std::vector<const GossipSlot *> pointers;
+    for (int s = 0; s < slot_count; s++) {
+        auto &slot = sources.emplace_back("node" + std::to_string(s));
+        SlotValues values;
+        auto version = GossipClock::now();
+        for (int i = 0; i < keys; i++)
+            values.emplace("key" + std::to_string(i), SlotEntry{std::string(value_size, 'v'), version});
+        slot.compareAndMergeSlot(std::move(values), version);
+        pointers.emplace_back(&slot);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto bytes = GossipSlotImage::write(path, pointers);
+    auto write = since(start);
+
+    // 冷启动：映射镜像，所有 slot 都从镜像读取
+    start = std::chrono::steady_clock::now();
+    auto image = GossipSlotImage::open(path);
+    std::list<GossipSlot> restored;
+    for (size_t i = 0; i < image->slots(); i++)
+        restored.emplace_back(std::string(image->name(i))).attach(image, i);
+    auto map = since(start);
+
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> key(0, keys - 1);
+    std::vector<GossipSlot *> cold;
+    for (auto &slot: restored)
+        cold.emplace_back(&slot);
+    std::uniform_int_distribution<size_t> pick(0, cold.size() - 1);
+    const int reads = 200000;
+    long found = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < reads; i++)
+        found += cold[pick(random)]->find("key" + std::to_string(key(random))).second != 0;
+    auto read = since(start) * 1e6 / reads;
+
+    start = std::chrono::steady_clock::now();
+    size_t loaded = 0;
+    for (auto &slot: restored)
+        loaded += slot.snapshot()->size();
+    auto warm = since(start);
+
+    // 没有镜像时，每个 slot 都需要从对方节点接收一次全量更新
+    size_t full_bytes = 0;
+    double full = 0;
+    for (auto &source: sources) {
+        auto snapshot = source.snapshot();
+        pf_gossip::SlotUpdate header;
+        header.set_name(source.name());
+        header.set_version(snapshot->version);
+        auto buffer = GossipSlotCodec::encode(header, *snapshot);
+        full_bytes += buffer.Length();
+
+        start = std::chrono::steady_clock::now();
+        pf_gossip::SlotUpdate request;
+        grpc::SerializationTraits<pf_gossip::SlotUpdate>::Deserialize(&buffer, &request);
+        GossipSlot target(source.name());
+        target.compareAndMergeSlot(GossipSlotCodec::decode(&request), request.version());
+        full += since(start);
+    }
+
+    // 镜像写入之后十分之一的 slot 发生了变化，只有这些 slot 需要发送增量
+    size_t delta_bytes = 0;
+    int changed = 0;
+    for (auto &source: sources) {
+        if (changed++ % 10 != 0)
+            continue;
+        auto base = source.version();
+        for (int i = 0; i < 100; i++)
+            source.insertOrUpdate("key" + std::to_string(key(random)), "changed");
+
+        auto snapshot = source.snapshot();
+        pf_gossip::SlotUpdate header;
+        header.set_name(source.name());
+        header.set_version(snapshot->version);
+        header.set_delta(true);
+        header.set_base_version(base);
+        delta_bytes += GossipSlotCodec::encode(header, *snapshot, [base](const std::string &, const SlotEntry &entry) {
+            return entry.version > base;
+        }).Length();
+    }
+
+    std::cout << "slots: " << slot_count << ", keys per slot: " << keys << ", value size: " << value_size
+              << std::endl;
+    std::cout << "image write(ms)\t" << write << ", " << bytes << " bytes" << std::endl;
+    std::cout << "image map(ms)\t" << map << std::endl;
+    std::cout << "cold read(ns)\t" << read << ", found " << found << "/" << reads << std::endl;
+    std::cout << "load all(ms)\t" << warm << ", " << loaded << " keys" << std::endl;
+    std::cout << "full pulls(ms)\t" << full << ", " << full_bytes << " bytes" << std::endl;
+    std::cout << "deltas after warm start\t" << delta_bytes << " bytes" << std::endl;
+
+    std::filesystem::remove(path);
+    return 0;
+}
@@ -0,0 +1,112 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 批量导入的基准测试：节点 A 连接了节点 B，客户端向 A 写入 N 个键值对，分别使用逐条立即传播的 addMessage、
+// 逐条但合并传播的 addMessage 与批量的 addMessages，统计写入耗时，以及 B 收到全部键值对所需的时间。
+// 用法: load_bench [键值对数量] [每批数量]
+
+#include "protos/GossipCli.grpc.pb.h"
+#include "server/GossipNode.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace gossip::server;
+
+namespace {
+
+    /// Stream buffer that drops all output, used to silence node logs while measuring.
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override {
+            return c;
+        }
+    };
+
+    struct Result {
+        double write_ms;
+        double converge_ms;
+    };
+
+    double since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    Result run(int port, int keys, int batch_size, size_t rumor_window_ms) {
+
+        auto address = [](int p) { return "127.0.0.1:" + std::to_string(p); };
+        GossipOptions options;
+        options.rumor_window_ms = rumor_window_ms;
+
+        // 节点需要运行守护任务来刷新缓冲的写入，节点不会被析构，进程结束时直接退出
+        auto &a = *new GossipNode("A", address(port), address(port + 1), "", options);
+        auto &b = *new GossipNode("B", address(port + 2), address(port + 3), "", options);
+        b.startConnection(address(port + 1));
+        std::thread([&a] { a.run(); }).detach();
+        std::thread([&b] { b.run(); }).detach();
+
+        auto stub = pf_gossip_cli::GossipClient::NewStub(
+                grpc::CreateChannel(address(port), grpc::InsecureChannelCredentials()));
+
+        auto start = std::chrono::steady_clock::now();
+        if (batch_size <= 1) {
+            for (int i = 0; i < keys; i++) {
+                grpc::ClientContext context;
+                pf_gossip::Message request;
+                pf_gossip_cli::Echo response;
+                request.set_key("key" + std::to_string(i));
+                request.set_value("value");
+                stub->addMessage(&context, request, &response);
+            }
+        } else {
+            for (int i = 0; i < keys; i += batch_size) {
+                grpc::ClientContext context;
+                pf_gossip_cli::WriteBatch request;
+                pf_gossip_cli::WriteResult response;
+                for (int j = i; j < std::min(keys, i + batch_size); j++) {
+                    auto operation = request.add_operations();
+                    operation->set_key("key" + std::to_string(j));
+                    operation->set_value("value");
+                }
+                stub->addMessages(&context, request, &response);
+            }
+        }
+        auto write_ms = since(start);
+
+        // 等待 B 收到所有键值对，B 自己的 slot 为空，所以内存占用等于所有键值对的长度之和
+        size_t expected = 0;
+        for (int i = 0; i < keys; i++)
+            expected += ("key" + std::to_string(i)).size() + 5;
+        while (since(start) < 60000 && b.getNodeStatus()["mem_use"] != expected)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return {write_ms, since(start)};
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int keys = argc > 1 ? std::stoi(argv[1]) : 10000;
+    int batch_size = argc > 2 ? std::stoi(argv[2]) : 500;
+
+    NullBuffer null;
+    auto origin = std::cout.rdbuf();
+
+    std::cout.rdbuf(&null);
+    auto single = run(19931, keys, 1, 0);
+    auto coalesced = run(19941, keys, 1, 10);
+    auto batch = run(19961, keys, batch_size, 10);
+    std::cout.rdbuf(origin);
+
+    std::cout << "keys: " << keys << ", batch: " << batch_size << std::endl;
+    std::cout << "mode\twrite(ms)\tconverge(ms)" << std::endl;
+    std::cout << "single\t" << single.write_ms << "\t" << single.converge_ms << std::endl;
+    std::cout << "coalesced\t" << coalesced.write_ms << "\t" << coalesced.converge_ms << std::endl;
+    std::cout << "batch\t" << batch.write_ms << "\t" << batch.converge_ms << std::endl;
+
+    std::_Exit(0);  // 节点没有提供关闭 peer 的接口，直接退出
+}
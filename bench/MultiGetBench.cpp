@@ -0,0 +1,86 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 批量读取的基准测试：一次刷新读取 N 个键值对，分别使用逐条的 getMessage 与批量的 getMessages，统计每次刷新的耗时。
+// 用法: multi_get_bench [每次读取的键数量] [刷新次数]
+
+#include "protos/GossipCli.grpc.pb.h"
+#include "server/GossipNode.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <chrono>
+#include <iostream>
+
+using namespace gossip::server;
+
+namespace {
+
+    /// Stream buffer that drops all output, used to silence node logs while measuring.
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override {
+            return c;
+        }
+    };
+
+    template<class Func>
+    double measure(int refreshes, Func &&refresh) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < refreshes; i++)
+            refresh();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count() / refreshes;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int keys = argc > 1 ? std::stoi(argv[1]) : 200;
+    int refreshes = argc > 2 ? std::stoi(argv[2]) : 50;
+
+    NullBuffer null;
+    auto origin = std::cout.rdbuf();
+    std::cout.rdbuf(&null);
+
+    GossipNode node("bench", "127.0.0.1:19951", "127.0.0.1:19952");
+    for (int i = 0; i < keys; i++)
+        node.insertOrUpdateMessage("key" + std::to_string(i), "value" + std::to_string(i));
+
+    auto stub = pf_gossip_cli::GossipClient::NewStub(
+            grpc::CreateChannel("127.0.0.1:19951", grpc::InsecureChannelCredentials()));
+
+    long found = 0;
+    auto single = measure(refreshes, [&] {
+        for (int i = 0; i < keys; i++) {
+            grpc::ClientContext context;
+            pf_gossip_cli::Key request;
+            pf_gossip::Message response;
+            request.set_content("key" + std::to_string(i));
+            if (stub->getMessage(&context, request, &response).ok())
+                found += !response.value().empty();
+        }
+    });
+
+    auto multi = measure(refreshes, [&] {
+        grpc::ClientContext context;
+        pf_gossip_cli::KeyList request;
+        pf_gossip::SearchResult response;
+        for (int i = 0; i < keys; i++)
+            request.add_keys()->set_key("key" + std::to_string(i));
+        if (stub->getMessages(&context, request, &response).ok()) {
+            for (auto &message: response.message())
+                found += message.version() != 0;
+        }
+    });
+
+    std::cout.rdbuf(origin);
+    std::cout << "keys: " << keys << ", found: " << found << "/" << 2L * keys * refreshes << std::endl;
+    std::cout << "mode\tms/refresh" << std::endl;
+    std::cout << "single\t" << single << std::endl;
+    std::cout << "multi\t" << multi << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 节点间异步 rpc 的内存分配计数：两个节点在同一进程中运行，每一轮 gossip 包含一次心跳和一次写入传播，
+// 统计稳定状态下整个进程（包括对方节点的处理和 grpc 内部）每轮的堆分配次数。
+// 用法: peer_alloc_bench [轮数]
+
+#include "server/GossipNode.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+
+namespace {
+
+    std::atomic<bool> counting = false;
+    std::atomic<long> allocations = 0;
+
+    /// Stream buffer that drops all output, used to silence node logs while measuring.
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override {
+            return c;
+        }
+    };
+
+}
+
+void *operator new(size_t size) {
+    if (counting.load(std::memory_order_relaxed))
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+using namespace gossip::server;
+
+int main(int argc, char *argv[]) {
+
+    int rounds = argc > 1 ? std::stoi(argv[1]) : 2000;
+
+    NullBuffer null;
+    auto origin = std::cout.rdbuf();
+    std::cout.rdbuf(&null);
+
+    // 每一轮的写入立即传播，不进行合并
+    GossipOptions options;
+    options.rumor_window_ms = 0;
+    GossipNode a("A", "127.0.0.1:19921", "127.0.0.1:19922", "", options);
+    GossipNode b("B", "127.0.0.1:19923", "127.0.0.1:19924");
+    b.startConnection("127.0.0.1:19922");
+
+    std::string keys[16];
+    for (int i = 0; i < 16; i++)
+        keys[i] = "key" + std::to_string(i);
+
+    // 预热，让连接建立并且让各种缓存达到稳定状态
+    for (int i = 0; i < 200; i++) {
+        a.startHeartBeat();
+        a.insertOrUpdateMessage(keys[i % 16], "value");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    counting = true;
+    for (int i = 0; i < rounds; i++) {
+        a.startHeartBeat();
+        a.insertOrUpdateMessage(keys[i % 16], "value");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    counting = false;
+
+    std::cout.rdbuf(origin);
+    std::cout << "rounds: " << rounds << ", allocations: " << allocations << ", per round: "
+              << static_cast<double>(allocations) / rounds << std::endl;
+
+    std::_Exit(0);  // 节点没有提供关闭 peer 的接口，直接退出
+}
@@ -0,0 +1,176 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 有序扫描的基准测试：一个 slot 中有一个前缀下的 N 个键值对和其它键值对，读取这个前缀下的全部键值对。
+// 在 slot 上比较有序索引的扫描与没有索引时的做法（遍历整个 slot，过滤前缀后排序）；
+// 在节点上比较一次流式的 scanPrefix 与已知全部键时分批的 getMessages。
+// 最后统计写入新键与覆盖已有键时维护索引的额外耗时。
+// 用法: scan_bench [前缀下的键数量] [其它键数量] [写入次数]
+
+#include "protos/GossipCli.grpc.pb.h"
+#include "server/GossipNode.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace gossip::server;
+
+namespace {
+
+    /// Stream buffer that drops all output, used to silence node logs while measuring.
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override {
+            return c;
+        }
+    };
+
+    double since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::string key(const std::string &prefix, int i) {
+        std::ostringstream os;
+        os << prefix << std::setw(8) << std::setfill('0') << i;
+        return os.str();
+    }
+
+    /// Fill a slot with keys of a namespace and other keys, in batches.
+    template<class Write>
+    void fill(int keys, int others, Write &&write) {
+        SlotBatch batch;
+        auto flush = [&] {
+            write(batch);
+            batch.clear();
+        };
+        for (int i = 0; i < keys; i++) {
+            batch.push_back({key("svc/", i), std::string(64, 'v'), false, 0});
+            if (batch.size() == 1000)
+                flush();
+        }
+        for (int i = 0; i < others; i++) {
+            batch.push_back({key("other/", i), std::string(64, 'v'), false, 0});
+            if (batch.size() == 1000)
+                flush();
+        }
+        flush();
+    }
+
+    /// Measure the time of writing keys one by one to a slot.
+    double writes(GossipSlot &slot, const std::string &prefix, int count) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; i++)
+            slot.insertOrUpdate(key(prefix, i), "w");
+        return since(start) * 1000 / count;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int keys = argc > 1 ? std::stoi(argv[1]) : 100000;
+    int others = argc > 2 ? std::stoi(argv[2]) : 100000;
+    int count = argc > 3 ? std::stoi(argv[3]) : 20000;
+
+    // slot 上的扫描
+    GossipSlot slot("bench");
+    fill(keys, others, [&](const SlotBatch &batch) { slot.applyBatch(batch); });
+
+    auto start = std::chrono::steady_clock::now();
+    auto snapshot = slot.indexedSnapshot();
+    auto build = since(start);
+
+    size_t scanned = 0;
+    start = std::chrono::steady_clock::now();
+    SlotScanner scanner(snapshot, "svc/", SlotIndex::prefixEnd("svc/"));
+    while (scanner.next())
+        scanned += !scanner.entry().value.empty();
+    auto scan = since(start);
+
+    // 没有索引时只能遍历整个 slot，再按键排序
+    start = std::chrono::steady_clock::now();
+    std::vector<std::pair<const std::string *, const SlotEntry *>> filtered;
+    snapshot->forEach([&](const std::string &k, const SlotEntry &entry) {
+        if (k.compare(0, 4, "svc/") == 0)
+            filtered.emplace_back(&k, &entry);
+    });
+    std::sort(filtered.begin(), filtered.end(), [](auto &a, auto &b) { return *a.first < *b.first; });
+    auto full = since(start);
+    snapshot.reset();
+
+    // 节点上的 rpc
+    NullBuffer null;
+    auto origin = std::cout.rdbuf();
+    std::cout.rdbuf(&null);
+
+    GossipNode node("bench", "127.0.0.1:19961", "127.0.0.1:19962");
+    fill(keys, others, [&](const SlotBatch &batch) { node.writeMessages(batch); });
+
+    auto stub = pf_gossip_cli::GossipClient::NewStub(
+            grpc::CreateChannel("127.0.0.1:19961", grpc::InsecureChannelCredentials()));
+
+    // 第一次扫描建立索引，单独计时
+    auto stream = [&] {
+        grpc::ClientContext context;
+        pf_gossip_cli::PrefixScan request;
+        request.set_prefix("svc/");
+        auto reader = stub->scanPrefix(&context, request);
+        size_t found = 0;
+        pf_gossip_cli::ScanResult chunk;
+        while (reader->Read(&chunk))
+            found += chunk.message_size();
+        return reader->Finish().ok() ? found : 0;
+    };
+    start = std::chrono::steady_clock::now();
+    auto streamed_first = stream();
+    auto rpc_first = since(start);
+    start = std::chrono::steady_clock::now();
+    auto streamed = stream();
+    auto rpc_scan = since(start);
+
+    // 一次读取全部键的响应会超过 grpc 默认的消息大小限制，按扫描的分段大小分批读取
+    start = std::chrono::steady_clock::now();
+    size_t got = 0;
+    auto chunk = static_cast<int>(node.options().scan_chunk_size);
+    for (int i = 0; i < keys; i += chunk) {
+        grpc::ClientContext context;
+        pf_gossip_cli::KeyList request;
+        pf_gossip::SearchResult response;
+        for (int j = i; j < keys && j < i + chunk; j++)
+            request.add_keys()->set_key(key("svc/", j));
+        if (stub->getMessages(&context, request, &response).ok()) {
+            for (auto &message: response.message())
+                got += message.version() != 0;
+        }
+    }
+    auto rpc_get = since(start);
+    std::cout.rdbuf(origin);
+
+    // 写入时维护索引的耗时：新键需要插入索引，覆盖已有键不改变索引
+    GossipSlot plain("plain"), indexed("indexed");
+    fill(keys, others, [&](const SlotBatch &batch) {
+        plain.applyBatch(batch);
+        indexed.applyBatch(batch);
+    });
+    indexed.indexedSnapshot();
+    auto plain_insert = writes(plain, "new/", count);
+    auto indexed_insert = writes(indexed, "new/", count);
+    auto plain_update = writes(plain, "svc/", count);
+    auto indexed_update = writes(indexed, "svc/", count);
+
+    std::cout << "keys: " << keys << ", other keys: " << others << std::endl;
+    std::cout << "slot\tindex build(ms) " << build << ", scan(ms) " << scan << ", found " << scanned
+              << ", full scan and sort(ms) " << full << ", found " << filtered.size() << std::endl;
+    std::cout << "rpc\tscanPrefix first(ms) " << rpc_first << ", found " << streamed_first << ", scanPrefix(ms) "
+              << rpc_scan << ", found " << streamed << ", getMessages(ms) " << rpc_get << ", found " << got
+              << std::endl;
+    std::cout << "write(us)\tinsert " << plain_insert << " -> " << indexed_insert << " with index, update "
+              << plain_update << " -> " << indexed_update << " with index" << std::endl;
+    return 0;
+}
@@ -0,0 +1,80 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 调度器的基准测试：从另一个线程加入 N 个随机延迟的一次性任务，统计任务实际执行时间相对于截止时间的延迟；
+// 以及调度器空闲时 post 的任务从加入到开始执行的唤醒延迟。
+// 用法: scheduler_bench [任务数量] [最大延迟(ms)]
+
+#include "server/GossipScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace gossip::server;
+using Clock = GossipScheduler::Clock;
+
+namespace {
+
+    void report(const char *name, std::vector<double> &samples) {
+        std::sort(samples.begin(), samples.end());
+        auto at = [&](double q) { return samples[static_cast<size_t>(q * (samples.size() - 1))]; };
+        std::cout << name << "\t" << at(0.5) << "\t" << at(0.99) << "\t" << samples.back() << std::endl;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int tasks = argc > 1 ? std::stoi(argv[1]) : 20000;
+    int max_delay = argc > 2 ? std::stoi(argv[2]) : 200;
+
+    GossipScheduler scheduler;
+    std::thread runner([&] { scheduler.run(); });
+
+    // 随机延迟的一次性任务
+    std::vector<double> lateness(tasks);
+    std::atomic<int> done{0};
+    std::default_random_engine e(42);
+    std::uniform_int_distribution<int> u(0, max_delay * 1000);
+    for (int i = 0; i < tasks; i++) {
+        auto delay = std::chrono::microseconds(u(e));
+        auto deadline = Clock::now() + delay;
+        scheduler.schedule(delay, [&, i, deadline] {
+            lateness[i] = std::chrono::duration<double, std::micro>(Clock::now() - deadline).count();
+            done++;
+        });
+    }
+    while (done < tasks)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // 空闲时唤醒
+    int posts = 1000;
+    std::vector<double> wakeup(posts);
+    for (int i = 0; i < posts; i++) {
+        std::atomic<bool> ran{false};
+        auto start = Clock::now();
+        scheduler.post([&, i, start] {
+            wakeup[i] = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+            ran = true;
+        });
+        while (!ran)
+            std::this_thread::yield();
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+
+    scheduler.stop();
+    runner.join();
+
+    std::cout << "tasks: " << tasks << ", max delay: " << max_delay << "ms" << std::endl;
+    std::cout << "latency(us)\tp50\tp99\tmax" << std::endl;
+    report("timer", lateness);
+    report("post", wakeup);
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 全局键索引的基准测试：集群中有 N 个 slot，每个 slot 有各自的键，另有一部分键同时存在于多个 slot 中。
+// 分别统计通过键索引搜索与逐个 slot 查找的耗时，两种方式的结果应该相同；
+// 最后统计写入新键与全量合并时维护键索引的额外耗时。
+// 用法: search_bench [每个 slot 的键数量] [搜索次数]
+
+#include "server/GossipSlotRegistry.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using namespace gossip::server;
+
+namespace {
+
+    double since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /// K-V pairs of a slot: its own keys and keys shared by every tenth slot.
+    SlotValues values(int slot, int keys, SlotVersion version) {
+        SlotValues values;
+        for (int i = 0; i < keys; i++)
+            values.emplace("n" + std::to_string(slot) + "/key" + std::to_string(i), SlotEntry{"v", version});
+        if (slot % 10 == 0) {
+            for (int i = 0; i < keys / 10; i++)
+                values.emplace("shared/key" + std::to_string(i), SlotEntry{"v", version});
+        }
+        return values;
+    }
+
+    /// Search a key in every slot, the way before key index.
+    size_t scanAll(const GossipSlotRegistry &registry, const std::string &key) {
+        size_t hits = 0;
+        registry.forEach([&](const std::string &, GossipSlot &slot) {
+            hits += slot.find(key).second != 0;
+        });
+        return hits;
+    }
+
+    size_t searchIndex(const GossipSlotRegistry &registry, const std::string &key) {
+        size_t hits = 0;
+        for (auto slot: registry.keys().find(key))
+            hits += slot->find(key).second != 0;
+        return hits;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int keys = argc > 1 ? std::stoi(argv[1]) : 1000;
+    int searches = argc > 2 ? std::stoi(argv[2]) : 20000;
+
+    std::cout << "slots\tindex(us/search)\tscan(us/search)\thits(index/scan)" << std::endl;
+    for (int slots: {10, 100, 1000}) {
+        GossipSlotRegistry registry;
+        auto version = GossipClock::now();
+        for (int i = 0; i < slots; i++)
+            registry.findOrCreate("n" + std::to_string(i)).first->compareAndMergeSlot(values(i, keys, version),
+                                                                                       version);
+
+        // 一半搜索命中一个 slot 的键，四分之一命中共享的键，四分之一不存在
+        std::mt19937 random(42);
+        std::uniform_int_distribution<int> slot(0, slots - 1), key(0, keys - 1), kind(0, 3);
+        std::vector<std::string> queries;
+        for (int i = 0; i < searches; i++) {
+            switch (kind(random)) {
+                case 0:
+                    queries.emplace_back("shared/key" + std::to_string(key(random) / 10));
+                    break;
+                case 1:
+                    queries.emplace_back("missing/key" + std::to_string(key(random)));
+                    break;
+                default:
+                    queries.emplace_back("n" + std::to_string(slot(random)) + "/key" + std::to_string(key(random)));
+            }
+        }
+
+        size_t index_hits = 0, scan_hits = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (auto &query: queries)
+            index_hits += searchIndex(registry, query);
+        auto index = since(start);
+
+        start = std::chrono::steady_clock::now();
+        for (auto &query: queries)
+            scan_hits += scanAll(registry, query);
+        auto scan = since(start);
+
+        std::cout << slots << "\t" << index * 1000 / searches << "\t" << scan * 1000 / searches << "\t" << index_hits
+                  << "/" << scan_hits << std::endl;
+    }
+
+    // 维护键索引的耗时：只有新增与删除的键需要修改索引
+    GossipKeyIndex keys_index;
+    GossipSlot plain("plain"), indexed("indexed", &keys_index);
+    auto version = GossipClock::now();
+    auto merge = [&](GossipSlot &slot) {
+        auto start = std::chrono::steady_clock::now();
+        slot.compareAndMergeSlot(values(0, keys * 100, version), version);
+        return since(start);
+    };
+    auto plain_merge = merge(plain), indexed_merge = merge(indexed);
+
+    auto writes = [&](GossipSlot &slot, const std::string &prefix) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < searches; i++)
+            slot.insertOrUpdate(prefix + std::to_string(i), "w");
+        return since(start) * 1000 / searches;
+    };
+    auto plain_insert = writes(plain, "new/"), indexed_insert = writes(indexed, "new/");
+    auto plain_update = writes(plain, "n0/key"), indexed_update = writes(indexed, "n0/key");
+
+    std::cout << "full merge of " << keys * 100 << " keys(ms)\t" << plain_merge << " -> " << indexed_merge
+              << " with index" << std::endl;
+    std::cout << "write(us)\tinsert " << plain_insert << " -> " << indexed_insert << " with index, update "
+              << plain_update << " -> " << indexed_update << " with index, indexed keys " << keys_index.size()
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,127 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// GossipSlot 并发读取的微基准测试：多个线程持续读取的同时，另一个线程不断合并增量更新。
+// 用法: slot_bench [最大读线程数] [每轮秒数] [键数量]
+
+#include "server/GossipSlot.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace gossip::server;
+
+namespace {
+
+    /// A slot protected by one exclusive mutex, used as the baseline of GossipSlot.
+    class MutexSlot {
+    public:
+        void merge(const SlotValues &values) {
+            std::lock_guard<std::mutex> lg(mtx_);
+            for (auto &[key, entry]: values)
+                map_[key] = entry;
+        }
+
+        std::pair<std::string, SlotVersion> find(const std::string &key) {
+            std::lock_guard<std::mutex> lg(mtx_);
+            auto it = map_.find(key);
+            if (it == map_.end())
+                return {"", 0};
+            return {it->second.value, it->second.version};
+        }
+
+    private:
+        std::mutex mtx_;
+        SlotValues map_;
+    };
+
+    struct Result {
+        double reads_per_second;
+        double merges_per_second;
+    };
+
+    template<class Slot, class Merge>
+    Result run(Slot &slot, Merge merge, const std::vector<std::string> &keys, int readers, int seconds) {
+        std::atomic<bool> stop = false;
+        std::atomic<long> reads = 0, merges = 0;
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < readers; i++) {
+            threads.emplace_back([&, i] {
+                std::default_random_engine e(i);
+                std::uniform_int_distribution<size_t> u(0, keys.size() - 1);
+                long count = 0;
+                while (!stop) {
+                    slot.find(keys[u(e)]);
+                    count++;
+                }
+                reads += count;
+            });
+        }
+
+        // 合并线程模拟持续到达的 pull 请求，每次合并 100 个键值对
+        threads.emplace_back([&] {
+            std::default_random_engine e(readers);
+            std::uniform_int_distribution<size_t> u(0, keys.size() - 1);
+            SlotVersion version = 1;
+            while (!stop) {
+                SlotValues values;
+                for (int i = 0; i < 100; i++)
+                    values.emplace(keys[u(e)], SlotEntry{"merged", ++version});
+                merge(slot, std::move(values), version);
+                merges++;
+            }
+        });
+
+        std::this_thread::sleep_for(std::chrono::seconds(seconds));
+        stop = true;
+        for (auto &th: threads)
+            th.join();
+
+        return {static_cast<double>(reads) / seconds, static_cast<double>(merges) / seconds};
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int max_readers = argc > 1 ? std::stoi(argv[1]) : static_cast<int>(std::thread::hardware_concurrency());
+    int seconds = argc > 2 ? std::stoi(argv[2]) : 1;
+    int key_nums = argc > 3 ? std::stoi(argv[3]) : 50000;
+
+    std::vector<std::string> keys;
+    SlotValues values;
+    for (int i = 0; i < key_nums; i++) {
+        keys.emplace_back("key" + std::to_string(i));
+        values.emplace(keys.back(), SlotEntry{"value" + std::to_string(i), 1});
+    }
+
+    std::cout << "keys: " << key_nums << ", cores: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << "readers\tslot reads/s\tmutex reads/s\tslot merges/s\tmutex merges/s" << std::endl;
+
+    for (int readers = 1; readers <= std::max(1, max_readers); readers *= 2) {
+        GossipSlot slot("bench");
+        slot.compareAndMergeSlot(values, 1);
+        auto s = run(slot, [](GossipSlot &slot, SlotValues v, SlotVersion version) {
+            slot.compareAndMergeSlot(std::move(v), version, true, 0);
+        }, keys, readers, seconds);
+
+        MutexSlot mutex;
+        mutex.merge(values);
+        auto m = run(mutex, [](MutexSlot &slot, SlotValues v, SlotVersion) {
+            slot.merge(v);
+        }, keys, readers, seconds);
+
+        std::cout << readers << "\t" << static_cast<long>(s.reads_per_second) << "\t"
+                  << static_cast<long>(m.reads_per_second) << "\t" << static_cast<long>(s.merges_per_second) << "\t"
+                  << static_cast<long>(m.merges_per_second) << std::endl;
+    }
+
+    return 0;
+}
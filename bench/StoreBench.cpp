@@ -0,0 +1,110 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 本地 slot 持久化的基准测试：多个线程并发写入本地 slot，分别不持久化以及使用 sync、batched、async 三种持久化模式，
+// 统计写入吞吐量。之后使用同一个数据目录创建新的节点，统计从快照与日志恢复本地 slot 的耗时。
+// 用法: store_bench [写入线程数] [每个线程的写入次数] [值的大小] [数据目录]
+
+#include "server/GossipNode.h"
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace gossip::server;
+
+namespace {
+
+    /// Stream buffer that drops all output, used to silence node logs while measuring.
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override {
+            return c;
+        }
+    };
+
+    double since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int threads = argc > 1 ? std::stoi(argv[1]) : 8;
+    int writes = argc > 2 ? std::stoi(argv[2]) : 2000;
+    size_t value_size = argc > 3 ? std::stoul(argv[3]) : 100;
+    std::string dir = argc > 4 ? argv[4] : (std::filesystem::temp_directory_path() / "gossip_store_bench").string();
+
+    NullBuffer null;
+    auto origin = std::cout.rdbuf();
+    std::cout.rdbuf(&null);
+
+    std::filesystem::remove_all(dir);
+    std::string value(value_size, 'v');
+
+    std::vector<std::pair<std::string, GossipOptions::Durability>> modes = {
+            {"sync",    GossipOptions::Durability::Sync},
+            {"batched", GossipOptions::Durability::Batched},
+            {"async",   GossipOptions::Durability::Async},
+    };
+
+    struct Result {
+        std::string mode;
+        double throughput;
+        double per_sync;
+    };
+    std::vector<Result> results;
+    auto measure = [&](const std::string &mode, GossipOptions options) {
+        // 节点不开放端口，也不会被析构，进程结束时直接退出
+        auto node = new GossipNode("bench-" + mode, "", "", "", options);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back([node, t, writes, &value] {
+                for (int i = 0; i < writes; i++)
+                    node->insertOrUpdateMessage("key" + std::to_string(t) + "-" + std::to_string(i % 1000), value);
+            });
+        }
+        for (auto &worker: workers)
+            worker.join();
+        auto elapsed = since(start);
+        // 每次 fsync 平均覆盖的写入数量，体现组提交的效果
+        auto status = node->getNodeStatus();
+        double per_sync = status.contains("wal") ? static_cast<double>(threads) * writes /
+                                                   std::max<uint64_t>(status["wal"]["syncs"].get<uint64_t>(), 1) : 0;
+        results.push_back({mode, static_cast<double>(threads) * writes / elapsed * 1000, per_sync});
+    };
+
+    measure("none", {});
+    for (auto &[mode, durability]: modes) {
+        GossipOptions options;
+        options.data_dir = dir;
+        options.durability = durability;
+        measure(mode, options);
+    }
+
+    // async 模式的最后一批记录在一个批量周期内写入
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    GossipOptions options;
+    options.data_dir = dir;
+    auto start = std::chrono::steady_clock::now();
+    auto recovered = new GossipNode("bench-sync", "", "", "", options);
+    auto recovery = since(start);
+    auto keys = recovered->localSlot()->snapshot()->size();
+
+    std::cout.rdbuf(origin);
+    std::cout << "threads: " << threads << ", writes per thread: " << writes << ", value size: " << value_size
+              << std::endl;
+    std::cout << "mode\twrites/s\twrites/fsync" << std::endl;
+    for (auto &result: results)
+        std::cout << result.mode << "\t" << static_cast<long>(result.throughput) << "\t" << result.per_sync << std::endl;
+    std::cout << "recovery(ms)\t" << recovery << ", keys: " << keys << std::endl;
+
+    std::filesystem::remove_all(dir);
+    std::_Exit(0);  // 节点没有开放端口，析构时无法关闭服务，直接退出
+}
@@ -0,0 +1,127 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+// 删除密集负载的同步基准测试：一个 slot 每一轮删除并写入若干个键，对方节点每一轮同步一次。
+// 删除留下墓碑时对方只需要接收增量，统计增量的字节数与合并耗时；与之比较的是删除无法增量传播时，
+// 每一轮都需要发送的全量更新。墓碑在对方确认之后定期回收，统计回收耗时与墓碑数量的上限。
+// 用法: tombstone_bench [键值对数量] [轮数] [每轮删除数量] [每轮写入数量] [回收间隔轮数]
+
+#include "server/GossipSlotCodec.h"
+
+#include <grpcpp/impl/codegen/proto_utils.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using namespace gossip::server;
+
+namespace {
+
+    double since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /// Decode an encoded update and merge it into a slot.
+    void merge(GossipSlot *target, grpc::ByteBuffer *buffer) {
+        pf_gossip::SlotUpdate request;
+        grpc::SerializationTraits<pf_gossip::SlotUpdate>::Deserialize(buffer, &request);
+        target->compareAndMergeSlot(GossipSlotCodec::decode(&request), request.version(), request.delta(),
+                                    request.base_version());
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+
+    int keys = argc > 1 ? std::stoi(argv[1]) : 100000;
+    int rounds = argc > 2 ? std::stoi(argv[2]) : 50;
+    int deletes = argc > 3 ? std::stoi(argv[3]) : 200;
+    int writes = argc > 4 ? std::stoi(argv[4]) : 200;
+    int gc_every = argc > 5 ? std::stoi(argv[5]) : 10;
+
+    GossipSlot source("bench"), target("bench");
+    for (int i = 0; i < keys; i++)
+        source.insertOrUpdate("key" + std::to_string(i), std::string(100, 'v'));
+
+    pf_gossip::SlotUpdate header;
+    header.set_name(source.name());
+    header.set_version(source.version());
+    auto initial = GossipSlotCodec::encode(header, *source.snapshot());
+    merge(&target, &initial);
+
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> pick(0, keys - 1);
+    size_t delta_bytes = 0, full_bytes = 0, max_tombstones = 0, collected = 0;
+    double delta_merge = 0, full_merge = 0, gc = 0;
+    int full_rounds = 0;
+
+    for (int round = 0; round < rounds; round++) {
+        auto base = source.version();
+        for (int i = 0; i < deletes; i++)
+            source.remove("key" + std::to_string(pick(random)));
+        for (int i = 0; i < writes; i++)
+            source.insertOrUpdate("key" + std::to_string(pick(random)), std::string(100, 'w'));
+        max_tombstones = std::max(max_tombstones, source.tombstones());
+
+        auto snapshot = source.snapshot();
+
+        // 删除无法增量传播时，每一轮都要发送整个 slot
+        pf_gossip::SlotUpdate full;
+        full.set_name(source.name());
+        full.set_version(snapshot->version);
+        auto full_update = GossipSlotCodec::encode(full, *snapshot);
+        full_bytes += full_update.Length();
+        GossipSlot scratch("bench");
+        auto start = std::chrono::steady_clock::now();
+        merge(&scratch, &full_update);
+        full_merge += since(start);
+
+        // 对方持有 base 版本，并且之后没有回收墓碑时只需要增量
+        bool delta = base >= source.fullSyncVersion();
+        full_rounds += !delta;
+        pf_gossip::SlotUpdate update;
+        update.set_name(source.name());
+        update.set_version(snapshot->version);
+        update.set_delta(delta);
+        update.set_base_version(delta ? base : 0);
+        auto since_version = delta ? base : 0;
+        auto buffer = GossipSlotCodec::encode(update, *snapshot, [since_version](const std::string &,
+                                                                                 const SlotEntry &entry) {
+            return entry.version > since_version;
+        });
+        delta_bytes += buffer.Length();
+        start = std::chrono::steady_clock::now();
+        merge(&target, &buffer);
+        delta_merge += since(start);
+
+        // 对方确认了当前版本之后，两边都回收墓碑
+        if (gc_every > 0 && (round + 1) % gc_every == 0) {
+            start = std::chrono::steady_clock::now();
+            collected += source.collect(target.version());
+            target.collect(target.version());
+            gc += since(start);
+        }
+    }
+
+    // 两边的键值对应该完全相同
+    size_t mismatched = 0;
+    source.snapshot()->forEach([&](const std::string &key, const SlotEntry &entry) {
+        auto [value, version] = target.find(key);
+        if (!entry.deleted && (value != entry.value || version != entry.version))
+            mismatched++;
+        if (entry.deleted && version != 0)
+            mismatched++;
+    });
+
+    std::cout << "keys: " << keys << ", rounds: " << rounds << ", deletes per round: " << deletes
+              << ", writes per round: " << writes << std::endl;
+    std::cout << "with tombstones\t" << delta_bytes << " bytes, merge(ms) " << delta_merge << ", full rounds "
+              << full_rounds << std::endl;
+    std::cout << "full updates\t" << full_bytes << " bytes, merge(ms) " << full_merge << std::endl;
+    std::cout << "gc(ms)\t" << gc << ", collected " << collected << ", max tombstones " << max_tombstones
+              << ", left " << source.tombstones() << std::endl;
+    std::cout << "mismatched\t" << mismatched << std::endl;
+    return 0;
+}
@@ -34,7 +34,7 @@ namespace gossip::client {
     }
 
     GossipClient::Result<bool>
-    GossipClient::insertOrUpdateMessage(const std::string &key, const std::string &value) try {
+    GossipClient::insertOrUpdateMessage(const std::string &key, const std::string &value, int64_t ttl_ms) try {
 
         grpc::ClientContext context;
         context.AddMetadata("token",token_);
@@ -42,6 +42,7 @@ namespace gossip::client {
         pf_gossip::Message request;
         request.set_key(key);
         request.set_value(value);
+        request.set_ttl_ms(ttl_ms);
         pf_gossip_cli::Echo echo;
 
         auto status = stub_->addMessage(&context, request, &echo);
@@ -55,6 +56,24 @@ namespace gossip::client {
         return Result<bool>(false, exception.what());
     }
 
+    GossipClient::Result<int> GossipClient::writeMessages(const pf_gossip_cli::WriteBatch &batch) try {
+
+        grpc::ClientContext context;
+        context.AddMetadata("token",token_);
+
+        pf_gossip_cli::WriteResult result;
+
+        auto status = stub_->addMessages(&context, batch, &result);
+
+        if (!status.ok()) {
+            return Result<int>(false, status.error_message());
+        }
+        return Result<int>(true, result.message(), result.applied());
+
+    } catch (std::exception &exception) {
+        return Result<int>(false, exception.what());
+    }
+
     GossipClient::Result<std::string> GossipClient::getMessage(const std::string &key) try {
 
         grpc::ClientContext context;
@@ -75,6 +94,82 @@ namespace gossip::client {
         return Result<std::string>(false, exception.what());
     }
 
+    GossipClient::Result<pf_gossip::SearchResult> GossipClient::getMessages(const pf_gossip_cli::KeyList &keys) try {
+
+        grpc::ClientContext context;
+        context.AddMetadata("token",token_);
+
+        pf_gossip::SearchResult response;
+
+        auto status = stub_->getMessages(&context, keys, &response);
+
+        if (!status.ok()) {
+            return Result<pf_gossip::SearchResult>(false, status.error_message());
+        }
+        return Result<pf_gossip::SearchResult>(true, "", response);
+
+    } catch (std::exception &exception) {
+        return Result<pf_gossip::SearchResult>(false, exception.what());
+    }
+
+    GossipClient::Result<pf_gossip_cli::ScanResult>
+    GossipClient::scanPrefix(const std::string &prefix, const std::string &owner, int limit,
+                             const std::string &continuation) try {
+
+        grpc::ClientContext context;
+        context.AddMetadata("token",token_);
+
+        pf_gossip_cli::PrefixScan request;
+        request.set_prefix(prefix);
+        request.set_owner(owner);
+        request.set_limit(limit);
+        request.set_continuation(continuation);
+
+        auto reader = stub_->scanPrefix(&context, request);
+        return readScan(reader.get());
+
+    } catch (std::exception &exception) {
+        return Result<pf_gossip_cli::ScanResult>(false, exception.what());
+    }
+
+    GossipClient::Result<pf_gossip_cli::ScanResult>
+    GossipClient::scanRange(const std::string &start, const std::string &end, const std::string &owner, int limit,
+                            const std::string &continuation) try {
+
+        grpc::ClientContext context;
+        context.AddMetadata("token",token_);
+
+        pf_gossip_cli::RangeScan request;
+        request.set_start(start);
+        request.set_end(end);
+        request.set_owner(owner);
+        request.set_limit(limit);
+        request.set_continuation(continuation);
+
+        auto reader = stub_->scanRange(&context, request);
+        return readScan(reader.get());
+
+    } catch (std::exception &exception) {
+        return Result<pf_gossip_cli::ScanResult>(false, exception.what());
+    }
+
+    GossipClient::Result<pf_gossip_cli::ScanResult>
+    GossipClient::readScan(grpc::ClientReaderInterface<pf_gossip_cli::ScanResult> *reader) {
+
+        pf_gossip_cli::ScanResult response, chunk;
+        while (reader->Read(&chunk)) {
+            response.MergeFrom(chunk);
+            chunk.Clear();
+        }
+
+        auto status = reader->Finish();
+
+        if (!status.ok()) {
+            return Result<pf_gossip_cli::ScanResult>(false, status.error_message());
+        }
+        return Result<pf_gossip_cli::ScanResult>(true, "", response);
+    }
+
     GossipClient::Result<bool> GossipClient::deleteMessage(const std::string &key) try {
 
         grpc::ClientContext context;
@@ -70,12 +70,20 @@ namespace gossip::client {
         /// \param token Token to connect to gossip node
         explicit GossipClient(std::string address, std::string token);
 
-        /// Insert or update a message to connected gossip node. The message will use arrived time as version,
-        /// so this operation will not fail because of version check.
+        /// Insert or update a message to connected gossip node. The message will use a hybrid logical clock
+        /// reading of its arrival as version, so this operation will not fail because of version check.
         /// \param key The key of message
         /// \param value The value of message
+        /// \param ttl_ms TTL of message in milliseconds, the message is deleted on all nodes after it. 0 means
+        /// never expire
         /// \return Insert result
-        Result<bool> insertOrUpdateMessage(const std::string &key, const std::string &value);
+        Result<bool> insertOrUpdateMessage(const std::string &key, const std::string &value, int64_t ttl_ms = 0);
+
+        /// Insert, update or delete many messages with one request. Operations are applied in order, share one
+        /// version and are propagated to other nodes as one gossip message.
+        /// \param batch Operations to apply
+        /// \return The number of operations that changed the node
+        Result<int> writeMessages(const pf_gossip_cli::WriteBatch &batch);
 
         /// Get the value of message by key. This operation will only search local slot.
         /// \param key The key of message
@@ -83,6 +91,33 @@ namespace gossip::client {
         /// @note Use getMessageFromAllNode if you want to search message from all gossip nodes.
         Result<std::string> getMessage(const std::string &key);
 
+        /// Get the values of many messages with one request. A key can be qualified by its owner slot, keys
+        /// without owner are found in the slot of connected node.
+        /// \param keys Keys to find
+        /// \return Found messages in the order of keys. The version of a message not found is 0
+        Result<pf_gossip::SearchResult> getMessages(const pf_gossip_cli::KeyList &keys);
+
+        /// Get messages whose keys start with a prefix from one slot, in the order of keys. The messages are
+        /// streamed in chunks by connected node and merged into one result.
+        /// \param prefix The prefix of keys
+        /// \param owner Slot to scan, empty means the slot of connected node
+        /// \param limit Max number of messages, 0 means no limit
+        /// \param continuation Continuation of last scan, empty means start from the first key
+        /// \return Found messages. Its continuation is set if limit is reached before the last key
+        Result<pf_gossip_cli::ScanResult> scanPrefix(const std::string &prefix, const std::string &owner = "",
+                                                     int limit = 0, const std::string &continuation = "");
+
+        /// Get messages whose keys are in [start, end) from one slot, in the order of keys.
+        /// \param start First key, inclusive
+        /// \param end Last key, exclusive. Empty means no upper bound
+        /// \param owner Slot to scan, empty means the slot of connected node
+        /// \param limit Max number of messages, 0 means no limit
+        /// \param continuation Continuation of last scan, empty means start from the first key
+        /// \return Found messages. Its continuation is set if limit is reached before the last key
+        Result<pf_gossip_cli::ScanResult> scanRange(const std::string &start, const std::string &end,
+                                                    const std::string &owner = "", int limit = 0,
+                                                    const std::string &continuation = "");
+
         /// Get the value of message by key. This operation will start search operation in all slots.
         /// If param latest is set true, this operation will get latest version of value.
         /// \param key The key of message
@@ -127,6 +162,11 @@ namespace gossip::client {
             return gpr_timespec{second, 0, GPR_TIMESPAN};
         }
 
+        /// Read all chunks of a scan stream.
+        /// \param reader The grpc stream
+        /// \return Merged result of scan
+        static Result<pf_gossip_cli::ScanResult> readScan(grpc::ClientReaderInterface<pf_gossip_cli::ScanResult> *reader);
+
     private:
 
         std::string address_;
@@ -6,25 +6,28 @@
 #include "Gossip.grpc.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/channel_interface.h>
-#include <grpcpp/impl/codegen/client_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
-#include <grpcpp/impl/codegen/rpc_service_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
 namespace pf_gossip {
 
 static const char* Gossip_method_names[] = {
   "/pf_gossip.Gossip/search",
   "/pf_gossip.Gossip/pull",
+  "/pf_gossip.Gossip/syncDigest",
+  "/pf_gossip.Gossip/syncSlots",
   "/pf_gossip.Gossip/echo",
+  "/pf_gossip.Gossip/ping",
   "/pf_gossip.Gossip/EstablishConnection",
   "/pf_gossip.Gossip/heartBeat",
   "/pf_gossip.Gossip/newNodeNotify",
@@ -40,11 +43,14 @@ std::unique_ptr< Gossip::Stub> Gossip::NewStub(const std::shared_ptr< ::grpc::Ch
 Gossip::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_search_(Gossip_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_pull_(Gossip_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_echo_(Gossip_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_EstablishConnection_(Gossip_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_heartBeat_(Gossip_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_newNodeNotify_(Gossip_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_deleteNodeNotify_(Gossip_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_syncDigest_(Gossip_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_syncSlots_(Gossip_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_echo_(Gossip_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ping_(Gossip_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_EstablishConnection_(Gossip_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_heartBeat_(Gossip_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_newNodeNotify_(Gossip_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_deleteNodeNotify_(Gossip_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status Gossip::Stub::search(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::pf_gossip::SearchResult* response) {
@@ -93,6 +99,52 @@ void Gossip::Stub::async::pull(::grpc::ClientContext* context, const ::pf_gossip
   return result;
 }
 
+::grpc::Status Gossip::Stub::syncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::pf_gossip::DigestResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::pf_gossip::DigestRequest, ::pf_gossip::DigestResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_syncDigest_, context, request, response);
+}
+
+void Gossip::Stub::async::syncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest* request, ::pf_gossip::DigestResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::pf_gossip::DigestRequest, ::pf_gossip::DigestResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_syncDigest_, context, request, response, std::move(f));
+}
+
+void Gossip::Stub::async::syncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest* request, ::pf_gossip::DigestResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_syncDigest_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip::DigestResponse>* Gossip::Stub::PrepareAsyncsyncDigestRaw(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::pf_gossip::DigestResponse, ::pf_gossip::DigestRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_syncDigest_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip::DigestResponse>* Gossip::Stub::AsyncsyncDigestRaw(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncsyncDigestRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status Gossip::Stub::syncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::pf_gossip::SyncResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::pf_gossip::SyncRequest, ::pf_gossip::SyncResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_syncSlots_, context, request, response);
+}
+
+void Gossip::Stub::async::syncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest* request, ::pf_gossip::SyncResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::pf_gossip::SyncRequest, ::pf_gossip::SyncResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_syncSlots_, context, request, response, std::move(f));
+}
+
+void Gossip::Stub::async::syncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest* request, ::pf_gossip::SyncResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_syncSlots_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip::SyncResponse>* Gossip::Stub::PrepareAsyncsyncSlotsRaw(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::pf_gossip::SyncResponse, ::pf_gossip::SyncRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_syncSlots_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip::SyncResponse>* Gossip::Stub::AsyncsyncSlotsRaw(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncsyncSlotsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status Gossip::Stub::echo(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::pf_gossip::Message* response) {
   return ::grpc::internal::BlockingUnaryCall< ::pf_gossip::Message, ::pf_gossip::Message, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_echo_, context, request, response);
 }
@@ -116,6 +168,29 @@ void Gossip::Stub::async::echo(::grpc::ClientContext* context, const ::pf_gossip
   return result;
 }
 
+::grpc::Status Gossip::Stub::ping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::pf_gossip::PingResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::pf_gossip::PingRequest, ::pf_gossip::PingResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ping_, context, request, response);
+}
+
+void Gossip::Stub::async::ping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest* request, ::pf_gossip::PingResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::pf_gossip::PingRequest, ::pf_gossip::PingResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ping_, context, request, response, std::move(f));
+}
+
+void Gossip::Stub::async::ping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest* request, ::pf_gossip::PingResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ping_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip::PingResponse>* Gossip::Stub::PrepareAsyncpingRaw(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::pf_gossip::PingResponse, ::pf_gossip::PingRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ping_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip::PingResponse>* Gossip::Stub::AsyncpingRaw(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncpingRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status Gossip::Stub::EstablishConnection(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::pf_gossip::GossipNodeInfo* response) {
   return ::grpc::internal::BlockingUnaryCall< ::pf_gossip::GossipNodeInfo, ::pf_gossip::GossipNodeInfo, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_EstablishConnection_, context, request, response);
 }
@@ -232,6 +307,26 @@ Gossip::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       Gossip_method_names[2],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Gossip::Service, ::pf_gossip::DigestRequest, ::pf_gossip::DigestResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Gossip::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::pf_gossip::DigestRequest* req,
+             ::pf_gossip::DigestResponse* resp) {
+               return service->syncDigest(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Gossip_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Gossip::Service, ::pf_gossip::SyncRequest, ::pf_gossip::SyncResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Gossip::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::pf_gossip::SyncRequest* req,
+             ::pf_gossip::SyncResponse* resp) {
+               return service->syncSlots(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Gossip_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< Gossip::Service, ::pf_gossip::Message, ::pf_gossip::Message, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](Gossip::Service* service,
              ::grpc::ServerContext* ctx,
@@ -240,7 +335,17 @@ Gossip::Service::Service() {
                return service->echo(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      Gossip_method_names[3],
+      Gossip_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Gossip::Service, ::pf_gossip::PingRequest, ::pf_gossip::PingResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Gossip::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::pf_gossip::PingRequest* req,
+             ::pf_gossip::PingResponse* resp) {
+               return service->ping(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Gossip_method_names[6],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< Gossip::Service, ::pf_gossip::GossipNodeInfo, ::pf_gossip::GossipNodeInfo, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](Gossip::Service* service,
@@ -250,7 +355,7 @@ Gossip::Service::Service() {
                return service->EstablishConnection(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      Gossip_method_names[4],
+      Gossip_method_names[7],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< Gossip::Service, ::pf_gossip::NodeVersions, ::pf_gossip::NodeVersions, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](Gossip::Service* service,
@@ -260,7 +365,7 @@ Gossip::Service::Service() {
                return service->heartBeat(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      Gossip_method_names[5],
+      Gossip_method_names[8],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< Gossip::Service, ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](Gossip::Service* service,
@@ -270,7 +375,7 @@ Gossip::Service::Service() {
                return service->newNodeNotify(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      Gossip_method_names[6],
+      Gossip_method_names[9],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< Gossip::Service, ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](Gossip::Service* service,
@@ -298,6 +403,20 @@ Gossip::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status Gossip::Service::syncDigest(::grpc::ServerContext* context, const ::pf_gossip::DigestRequest* request, ::pf_gossip::DigestResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Gossip::Service::syncSlots(::grpc::ServerContext* context, const ::pf_gossip::SyncRequest* request, ::pf_gossip::SyncResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status Gossip::Service::echo(::grpc::ServerContext* context, const ::pf_gossip::Message* request, ::pf_gossip::Message* response) {
   (void) context;
   (void) request;
@@ -305,6 +424,13 @@ Gossip::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status Gossip::Service::ping(::grpc::ServerContext* context, const ::pf_gossip::PingRequest* request, ::pf_gossip::PingResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status Gossip::Service::EstablishConnection(::grpc::ServerContext* context, const ::pf_gossip::GossipNodeInfo* request, ::pf_gossip::GossipNodeInfo* response) {
   (void) context;
   (void) request;
@@ -7,23 +7,23 @@
 #include "Gossip.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_generic_service.h>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/client_context.h>
-#include <grpcpp/impl/codegen/completion_queue.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/codegen/proto_utils.h>
-#include <grpcpp/impl/codegen/rpc_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
 #include <grpcpp/impl/codegen/status.h>
-#include <grpcpp/impl/codegen/stub_options.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 namespace pf_gossip {
 
@@ -52,6 +52,22 @@ class Gossip final {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::updateResult>>(PrepareAsyncpullRaw(context, request, cq));
     }
     // 向对方发送部分slot的信息
+    virtual ::grpc::Status syncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::pf_gossip::DigestResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::DigestResponse>> AsyncsyncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::DigestResponse>>(AsyncsyncDigestRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::DigestResponse>> PrepareAsyncsyncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::DigestResponse>>(PrepareAsyncsyncDigestRaw(context, request, cq));
+    }
+    // 逐层比较 merkle 树，找到不一致的键值对范围
+    virtual ::grpc::Status syncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::pf_gossip::SyncResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SyncResponse>> AsyncsyncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SyncResponse>>(AsyncsyncSlotsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SyncResponse>> PrepareAsyncsyncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SyncResponse>>(PrepareAsyncsyncSlotsRaw(context, request, cq));
+    }
+    // push-pull 反熵，一次往返交换双方落后的 slot
     virtual ::grpc::Status echo(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::pf_gossip::Message* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::Message>> Asyncecho(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::Message>>(AsyncechoRaw(context, request, cq));
@@ -59,6 +75,14 @@ class Gossip final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::Message>> PrepareAsyncecho(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::Message>>(PrepareAsyncechoRaw(context, request, cq));
     }
+    virtual ::grpc::Status ping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::pf_gossip::PingResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::PingResponse>> Asyncping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::PingResponse>>(AsyncpingRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::PingResponse>> PrepareAsyncping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::PingResponse>>(PrepareAsyncpingRaw(context, request, cq));
+    }
+    // SWIM 故障检测的直接与间接探测
     // gossip节点状态接口
     virtual ::grpc::Status EstablishConnection(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::pf_gossip::GossipNodeInfo* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::GossipNodeInfo>> AsyncEstablishConnection(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::grpc::CompletionQueue* cq) {
@@ -101,8 +125,17 @@ class Gossip final {
       virtual void pull(::grpc::ClientContext* context, const ::pf_gossip::SlotUpdate* request, ::pf_gossip::updateResult* response, std::function<void(::grpc::Status)>) = 0;
       virtual void pull(::grpc::ClientContext* context, const ::pf_gossip::SlotUpdate* request, ::pf_gossip::updateResult* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // 向对方发送部分slot的信息
+      virtual void syncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest* request, ::pf_gossip::DigestResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void syncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest* request, ::pf_gossip::DigestResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // 逐层比较 merkle 树，找到不一致的键值对范围
+      virtual void syncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest* request, ::pf_gossip::SyncResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void syncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest* request, ::pf_gossip::SyncResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // push-pull 反熵，一次往返交换双方落后的 slot
       virtual void echo(::grpc::ClientContext* context, const ::pf_gossip::Message* request, ::pf_gossip::Message* response, std::function<void(::grpc::Status)>) = 0;
       virtual void echo(::grpc::ClientContext* context, const ::pf_gossip::Message* request, ::pf_gossip::Message* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void ping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest* request, ::pf_gossip::PingResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest* request, ::pf_gossip::PingResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // SWIM 故障检测的直接与间接探测
       // gossip节点状态接口
       virtual void EstablishConnection(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo* request, ::pf_gossip::GossipNodeInfo* response, std::function<void(::grpc::Status)>) = 0;
       virtual void EstablishConnection(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo* request, ::pf_gossip::GossipNodeInfo* response, ::grpc::ClientUnaryReactor* reactor) = 0;
@@ -124,8 +157,14 @@ class Gossip final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>* PrepareAsyncsearchRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::updateResult>* AsyncpullRaw(::grpc::ClientContext* context, const ::pf_gossip::SlotUpdate& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::updateResult>* PrepareAsyncpullRaw(::grpc::ClientContext* context, const ::pf_gossip::SlotUpdate& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::DigestResponse>* AsyncsyncDigestRaw(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::DigestResponse>* PrepareAsyncsyncDigestRaw(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SyncResponse>* AsyncsyncSlotsRaw(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SyncResponse>* PrepareAsyncsyncSlotsRaw(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::Message>* AsyncechoRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::Message>* PrepareAsyncechoRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::PingResponse>* AsyncpingRaw(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::PingResponse>* PrepareAsyncpingRaw(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::GossipNodeInfo>* AsyncEstablishConnectionRaw(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::GossipNodeInfo>* PrepareAsyncEstablishConnectionRaw(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::NodeVersions>* AsyncheartBeatRaw(::grpc::ClientContext* context, const ::pf_gossip::NodeVersions& request, ::grpc::CompletionQueue* cq) = 0;
@@ -152,6 +191,20 @@ class Gossip final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::updateResult>> PrepareAsyncpull(::grpc::ClientContext* context, const ::pf_gossip::SlotUpdate& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::updateResult>>(PrepareAsyncpullRaw(context, request, cq));
     }
+    ::grpc::Status syncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::pf_gossip::DigestResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::DigestResponse>> AsyncsyncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::DigestResponse>>(AsyncsyncDigestRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::DigestResponse>> PrepareAsyncsyncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::DigestResponse>>(PrepareAsyncsyncDigestRaw(context, request, cq));
+    }
+    ::grpc::Status syncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::pf_gossip::SyncResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SyncResponse>> AsyncsyncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SyncResponse>>(AsyncsyncSlotsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SyncResponse>> PrepareAsyncsyncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SyncResponse>>(PrepareAsyncsyncSlotsRaw(context, request, cq));
+    }
     ::grpc::Status echo(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::pf_gossip::Message* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>> Asyncecho(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>>(AsyncechoRaw(context, request, cq));
@@ -159,6 +212,13 @@ class Gossip final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>> PrepareAsyncecho(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>>(PrepareAsyncechoRaw(context, request, cq));
     }
+    ::grpc::Status ping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::pf_gossip::PingResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::PingResponse>> Asyncping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::PingResponse>>(AsyncpingRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::PingResponse>> PrepareAsyncping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::PingResponse>>(PrepareAsyncpingRaw(context, request, cq));
+    }
     ::grpc::Status EstablishConnection(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::pf_gossip::GossipNodeInfo* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::GossipNodeInfo>> AsyncEstablishConnection(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::GossipNodeInfo>>(AsyncEstablishConnectionRaw(context, request, cq));
@@ -194,8 +254,14 @@ class Gossip final {
       void search(::grpc::ClientContext* context, const ::pf_gossip::Message* request, ::pf_gossip::SearchResult* response, ::grpc::ClientUnaryReactor* reactor) override;
       void pull(::grpc::ClientContext* context, const ::pf_gossip::SlotUpdate* request, ::pf_gossip::updateResult* response, std::function<void(::grpc::Status)>) override;
       void pull(::grpc::ClientContext* context, const ::pf_gossip::SlotUpdate* request, ::pf_gossip::updateResult* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void syncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest* request, ::pf_gossip::DigestResponse* response, std::function<void(::grpc::Status)>) override;
+      void syncDigest(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest* request, ::pf_gossip::DigestResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void syncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest* request, ::pf_gossip::SyncResponse* response, std::function<void(::grpc::Status)>) override;
+      void syncSlots(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest* request, ::pf_gossip::SyncResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void echo(::grpc::ClientContext* context, const ::pf_gossip::Message* request, ::pf_gossip::Message* response, std::function<void(::grpc::Status)>) override;
       void echo(::grpc::ClientContext* context, const ::pf_gossip::Message* request, ::pf_gossip::Message* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest* request, ::pf_gossip::PingResponse* response, std::function<void(::grpc::Status)>) override;
+      void ping(::grpc::ClientContext* context, const ::pf_gossip::PingRequest* request, ::pf_gossip::PingResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void EstablishConnection(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo* request, ::pf_gossip::GossipNodeInfo* response, std::function<void(::grpc::Status)>) override;
       void EstablishConnection(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo* request, ::pf_gossip::GossipNodeInfo* response, ::grpc::ClientUnaryReactor* reactor) override;
       void heartBeat(::grpc::ClientContext* context, const ::pf_gossip::NodeVersions* request, ::pf_gossip::NodeVersions* response, std::function<void(::grpc::Status)>) override;
@@ -219,8 +285,14 @@ class Gossip final {
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>* PrepareAsyncsearchRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::updateResult>* AsyncpullRaw(::grpc::ClientContext* context, const ::pf_gossip::SlotUpdate& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::updateResult>* PrepareAsyncpullRaw(::grpc::ClientContext* context, const ::pf_gossip::SlotUpdate& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip::DigestResponse>* AsyncsyncDigestRaw(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip::DigestResponse>* PrepareAsyncsyncDigestRaw(::grpc::ClientContext* context, const ::pf_gossip::DigestRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip::SyncResponse>* AsyncsyncSlotsRaw(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip::SyncResponse>* PrepareAsyncsyncSlotsRaw(::grpc::ClientContext* context, const ::pf_gossip::SyncRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>* AsyncechoRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>* PrepareAsyncechoRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip::PingResponse>* AsyncpingRaw(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip::PingResponse>* PrepareAsyncpingRaw(::grpc::ClientContext* context, const ::pf_gossip::PingRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::GossipNodeInfo>* AsyncEstablishConnectionRaw(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::GossipNodeInfo>* PrepareAsyncEstablishConnectionRaw(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::NodeVersions>* AsyncheartBeatRaw(::grpc::ClientContext* context, const ::pf_gossip::NodeVersions& request, ::grpc::CompletionQueue* cq) override;
@@ -231,7 +303,10 @@ class Gossip final {
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::updateResult>* PrepareAsyncdeleteNodeNotifyRaw(::grpc::ClientContext* context, const ::pf_gossip::GossipNodeInfo& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_search_;
     const ::grpc::internal::RpcMethod rpcmethod_pull_;
+    const ::grpc::internal::RpcMethod rpcmethod_syncDigest_;
+    const ::grpc::internal::RpcMethod rpcmethod_syncSlots_;
     const ::grpc::internal::RpcMethod rpcmethod_echo_;
+    const ::grpc::internal::RpcMethod rpcmethod_ping_;
     const ::grpc::internal::RpcMethod rpcmethod_EstablishConnection_;
     const ::grpc::internal::RpcMethod rpcmethod_heartBeat_;
     const ::grpc::internal::RpcMethod rpcmethod_newNodeNotify_;
@@ -248,7 +323,13 @@ class Gossip final {
     // 分布式搜索，遍历节点并且保证最新版本
     virtual ::grpc::Status pull(::grpc::ServerContext* context, const ::pf_gossip::SlotUpdate* request, ::pf_gossip::updateResult* response);
     // 向对方发送部分slot的信息
+    virtual ::grpc::Status syncDigest(::grpc::ServerContext* context, const ::pf_gossip::DigestRequest* request, ::pf_gossip::DigestResponse* response);
+    // 逐层比较 merkle 树，找到不一致的键值对范围
+    virtual ::grpc::Status syncSlots(::grpc::ServerContext* context, const ::pf_gossip::SyncRequest* request, ::pf_gossip::SyncResponse* response);
+    // push-pull 反熵，一次往返交换双方落后的 slot
     virtual ::grpc::Status echo(::grpc::ServerContext* context, const ::pf_gossip::Message* request, ::pf_gossip::Message* response);
+    virtual ::grpc::Status ping(::grpc::ServerContext* context, const ::pf_gossip::PingRequest* request, ::pf_gossip::PingResponse* response);
+    // SWIM 故障检测的直接与间接探测
     // gossip节点状态接口
     virtual ::grpc::Status EstablishConnection(::grpc::ServerContext* context, const ::pf_gossip::GossipNodeInfo* request, ::pf_gossip::GossipNodeInfo* response);
     virtual ::grpc::Status heartBeat(::grpc::ServerContext* context, const ::pf_gossip::NodeVersions* request, ::pf_gossip::NodeVersions* response);
@@ -299,12 +380,52 @@ class Gossip final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_syncDigest : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_syncDigest() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_syncDigest() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncDigest(::grpc::ServerContext* /*context*/, const ::pf_gossip::DigestRequest* /*request*/, ::pf_gossip::DigestResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsyncDigest(::grpc::ServerContext* context, ::pf_gossip::DigestRequest* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::DigestResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_syncSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_syncSlots() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_syncSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncSlots(::grpc::ServerContext* /*context*/, const ::pf_gossip::SyncRequest* /*request*/, ::pf_gossip::SyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsyncSlots(::grpc::ServerContext* context, ::pf_gossip::SyncRequest* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::SyncResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_echo : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_echo() {
-      ::grpc::Service::MarkMethodAsync(2);
+      ::grpc::Service::MarkMethodAsync(4);
     }
     ~WithAsyncMethod_echo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -315,7 +436,27 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void Requestecho(::grpc::ServerContext* context, ::pf_gossip::Message* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::Message>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ping : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ping() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_ping() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ping(::grpc::ServerContext* /*context*/, const ::pf_gossip::PingRequest* /*request*/, ::pf_gossip::PingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestping(::grpc::ServerContext* context, ::pf_gossip::PingRequest* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::PingResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -324,7 +465,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_EstablishConnection() {
-      ::grpc::Service::MarkMethodAsync(3);
+      ::grpc::Service::MarkMethodAsync(6);
     }
     ~WithAsyncMethod_EstablishConnection() override {
       BaseClassMustBeDerivedFromService(this);
@@ -335,7 +476,7 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestEstablishConnection(::grpc::ServerContext* context, ::pf_gossip::GossipNodeInfo* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::GossipNodeInfo>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -344,7 +485,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_heartBeat() {
-      ::grpc::Service::MarkMethodAsync(4);
+      ::grpc::Service::MarkMethodAsync(7);
     }
     ~WithAsyncMethod_heartBeat() override {
       BaseClassMustBeDerivedFromService(this);
@@ -355,7 +496,7 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestheartBeat(::grpc::ServerContext* context, ::pf_gossip::NodeVersions* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::NodeVersions>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -364,7 +505,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_newNodeNotify() {
-      ::grpc::Service::MarkMethodAsync(5);
+      ::grpc::Service::MarkMethodAsync(8);
     }
     ~WithAsyncMethod_newNodeNotify() override {
       BaseClassMustBeDerivedFromService(this);
@@ -375,7 +516,7 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestnewNodeNotify(::grpc::ServerContext* context, ::pf_gossip::GossipNodeInfo* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::updateResult>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -384,7 +525,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_deleteNodeNotify() {
-      ::grpc::Service::MarkMethodAsync(6);
+      ::grpc::Service::MarkMethodAsync(9);
     }
     ~WithAsyncMethod_deleteNodeNotify() override {
       BaseClassMustBeDerivedFromService(this);
@@ -395,10 +536,10 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestdeleteNodeNotify(::grpc::ServerContext* context, ::pf_gossip::GossipNodeInfo* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::updateResult>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_search<WithAsyncMethod_pull<WithAsyncMethod_echo<WithAsyncMethod_EstablishConnection<WithAsyncMethod_heartBeat<WithAsyncMethod_newNodeNotify<WithAsyncMethod_deleteNodeNotify<Service > > > > > > > AsyncService;
+  typedef WithAsyncMethod_search<WithAsyncMethod_pull<WithAsyncMethod_syncDigest<WithAsyncMethod_syncSlots<WithAsyncMethod_echo<WithAsyncMethod_ping<WithAsyncMethod_EstablishConnection<WithAsyncMethod_heartBeat<WithAsyncMethod_newNodeNotify<WithAsyncMethod_deleteNodeNotify<Service > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_search : public BaseClass {
    private:
@@ -454,18 +595,72 @@ class Gossip final {
       ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip::SlotUpdate* /*request*/, ::pf_gossip::updateResult* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_syncDigest : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_syncDigest() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip::DigestRequest, ::pf_gossip::DigestResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::pf_gossip::DigestRequest* request, ::pf_gossip::DigestResponse* response) { return this->syncDigest(context, request, response); }));}
+    void SetMessageAllocatorFor_syncDigest(
+        ::grpc::MessageAllocator< ::pf_gossip::DigestRequest, ::pf_gossip::DigestResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip::DigestRequest, ::pf_gossip::DigestResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_syncDigest() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncDigest(::grpc::ServerContext* /*context*/, const ::pf_gossip::DigestRequest* /*request*/, ::pf_gossip::DigestResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* syncDigest(
+      ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip::DigestRequest* /*request*/, ::pf_gossip::DigestResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_syncSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_syncSlots() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip::SyncRequest, ::pf_gossip::SyncResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::pf_gossip::SyncRequest* request, ::pf_gossip::SyncResponse* response) { return this->syncSlots(context, request, response); }));}
+    void SetMessageAllocatorFor_syncSlots(
+        ::grpc::MessageAllocator< ::pf_gossip::SyncRequest, ::pf_gossip::SyncResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip::SyncRequest, ::pf_gossip::SyncResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_syncSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncSlots(::grpc::ServerContext* /*context*/, const ::pf_gossip::SyncRequest* /*request*/, ::pf_gossip::SyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* syncSlots(
+      ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip::SyncRequest* /*request*/, ::pf_gossip::SyncResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_echo : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_echo() {
-      ::grpc::Service::MarkMethodCallback(2,
+      ::grpc::Service::MarkMethodCallback(4,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip::Message, ::pf_gossip::Message>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip::Message* request, ::pf_gossip::Message* response) { return this->echo(context, request, response); }));}
     void SetMessageAllocatorFor_echo(
         ::grpc::MessageAllocator< ::pf_gossip::Message, ::pf_gossip::Message>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip::Message, ::pf_gossip::Message>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -481,18 +676,45 @@ class Gossip final {
       ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip::Message* /*request*/, ::pf_gossip::Message* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_ping : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ping() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip::PingRequest, ::pf_gossip::PingResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::pf_gossip::PingRequest* request, ::pf_gossip::PingResponse* response) { return this->ping(context, request, response); }));}
+    void SetMessageAllocatorFor_ping(
+        ::grpc::MessageAllocator< ::pf_gossip::PingRequest, ::pf_gossip::PingResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip::PingRequest, ::pf_gossip::PingResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ping() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ping(::grpc::ServerContext* /*context*/, const ::pf_gossip::PingRequest* /*request*/, ::pf_gossip::PingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ping(
+      ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip::PingRequest* /*request*/, ::pf_gossip::PingResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_EstablishConnection : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_EstablishConnection() {
-      ::grpc::Service::MarkMethodCallback(3,
+      ::grpc::Service::MarkMethodCallback(6,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip::GossipNodeInfo, ::pf_gossip::GossipNodeInfo>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip::GossipNodeInfo* request, ::pf_gossip::GossipNodeInfo* response) { return this->EstablishConnection(context, request, response); }));}
     void SetMessageAllocatorFor_EstablishConnection(
         ::grpc::MessageAllocator< ::pf_gossip::GossipNodeInfo, ::pf_gossip::GossipNodeInfo>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip::GossipNodeInfo, ::pf_gossip::GossipNodeInfo>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -513,13 +735,13 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_heartBeat() {
-      ::grpc::Service::MarkMethodCallback(4,
+      ::grpc::Service::MarkMethodCallback(7,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip::NodeVersions, ::pf_gossip::NodeVersions>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip::NodeVersions* request, ::pf_gossip::NodeVersions* response) { return this->heartBeat(context, request, response); }));}
     void SetMessageAllocatorFor_heartBeat(
         ::grpc::MessageAllocator< ::pf_gossip::NodeVersions, ::pf_gossip::NodeVersions>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip::NodeVersions, ::pf_gossip::NodeVersions>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -540,13 +762,13 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_newNodeNotify() {
-      ::grpc::Service::MarkMethodCallback(5,
+      ::grpc::Service::MarkMethodCallback(8,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip::GossipNodeInfo* request, ::pf_gossip::updateResult* response) { return this->newNodeNotify(context, request, response); }));}
     void SetMessageAllocatorFor_newNodeNotify(
         ::grpc::MessageAllocator< ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -567,13 +789,13 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_deleteNodeNotify() {
-      ::grpc::Service::MarkMethodCallback(6,
+      ::grpc::Service::MarkMethodCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip::GossipNodeInfo* request, ::pf_gossip::updateResult* response) { return this->deleteNodeNotify(context, request, response); }));}
     void SetMessageAllocatorFor_deleteNodeNotify(
         ::grpc::MessageAllocator< ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -588,7 +810,7 @@ class Gossip final {
     virtual ::grpc::ServerUnaryReactor* deleteNodeNotify(
       ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip::GossipNodeInfo* /*request*/, ::pf_gossip::updateResult* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_search<WithCallbackMethod_pull<WithCallbackMethod_echo<WithCallbackMethod_EstablishConnection<WithCallbackMethod_heartBeat<WithCallbackMethod_newNodeNotify<WithCallbackMethod_deleteNodeNotify<Service > > > > > > > CallbackService;
+  typedef WithCallbackMethod_search<WithCallbackMethod_pull<WithCallbackMethod_syncDigest<WithCallbackMethod_syncSlots<WithCallbackMethod_echo<WithCallbackMethod_ping<WithCallbackMethod_EstablishConnection<WithCallbackMethod_heartBeat<WithCallbackMethod_newNodeNotify<WithCallbackMethod_deleteNodeNotify<Service > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_search : public BaseClass {
@@ -625,12 +847,46 @@ class Gossip final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_syncDigest : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_syncDigest() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_syncDigest() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncDigest(::grpc::ServerContext* /*context*/, const ::pf_gossip::DigestRequest* /*request*/, ::pf_gossip::DigestResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_syncSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_syncSlots() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_syncSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncSlots(::grpc::ServerContext* /*context*/, const ::pf_gossip::SyncRequest* /*request*/, ::pf_gossip::SyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_echo : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_echo() {
-      ::grpc::Service::MarkMethodGeneric(2);
+      ::grpc::Service::MarkMethodGeneric(4);
     }
     ~WithGenericMethod_echo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -642,12 +898,29 @@ class Gossip final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_ping : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ping() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_ping() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ping(::grpc::ServerContext* /*context*/, const ::pf_gossip::PingRequest* /*request*/, ::pf_gossip::PingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_EstablishConnection : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_EstablishConnection() {
-      ::grpc::Service::MarkMethodGeneric(3);
+      ::grpc::Service::MarkMethodGeneric(6);
     }
     ~WithGenericMethod_EstablishConnection() override {
       BaseClassMustBeDerivedFromService(this);
@@ -664,7 +937,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_heartBeat() {
-      ::grpc::Service::MarkMethodGeneric(4);
+      ::grpc::Service::MarkMethodGeneric(7);
     }
     ~WithGenericMethod_heartBeat() override {
       BaseClassMustBeDerivedFromService(this);
@@ -681,7 +954,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_newNodeNotify() {
-      ::grpc::Service::MarkMethodGeneric(5);
+      ::grpc::Service::MarkMethodGeneric(8);
     }
     ~WithGenericMethod_newNodeNotify() override {
       BaseClassMustBeDerivedFromService(this);
@@ -698,7 +971,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_deleteNodeNotify() {
-      ::grpc::Service::MarkMethodGeneric(6);
+      ::grpc::Service::MarkMethodGeneric(9);
     }
     ~WithGenericMethod_deleteNodeNotify() override {
       BaseClassMustBeDerivedFromService(this);
@@ -750,12 +1023,52 @@ class Gossip final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_syncDigest : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_syncDigest() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_syncDigest() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncDigest(::grpc::ServerContext* /*context*/, const ::pf_gossip::DigestRequest* /*request*/, ::pf_gossip::DigestResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsyncDigest(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_syncSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_syncSlots() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_syncSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncSlots(::grpc::ServerContext* /*context*/, const ::pf_gossip::SyncRequest* /*request*/, ::pf_gossip::SyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsyncSlots(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_echo : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_echo() {
-      ::grpc::Service::MarkMethodRaw(2);
+      ::grpc::Service::MarkMethodRaw(4);
     }
     ~WithRawMethod_echo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -766,7 +1079,27 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void Requestecho(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ping : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ping() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_ping() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ping(::grpc::ServerContext* /*context*/, const ::pf_gossip::PingRequest* /*request*/, ::pf_gossip::PingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestping(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -775,7 +1108,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_EstablishConnection() {
-      ::grpc::Service::MarkMethodRaw(3);
+      ::grpc::Service::MarkMethodRaw(6);
     }
     ~WithRawMethod_EstablishConnection() override {
       BaseClassMustBeDerivedFromService(this);
@@ -786,7 +1119,7 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestEstablishConnection(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -795,7 +1128,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_heartBeat() {
-      ::grpc::Service::MarkMethodRaw(4);
+      ::grpc::Service::MarkMethodRaw(7);
     }
     ~WithRawMethod_heartBeat() override {
       BaseClassMustBeDerivedFromService(this);
@@ -806,7 +1139,7 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestheartBeat(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -815,7 +1148,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_newNodeNotify() {
-      ::grpc::Service::MarkMethodRaw(5);
+      ::grpc::Service::MarkMethodRaw(8);
     }
     ~WithRawMethod_newNodeNotify() override {
       BaseClassMustBeDerivedFromService(this);
@@ -826,7 +1159,7 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestnewNodeNotify(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -835,7 +1168,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_deleteNodeNotify() {
-      ::grpc::Service::MarkMethodRaw(6);
+      ::grpc::Service::MarkMethodRaw(9);
     }
     ~WithRawMethod_deleteNodeNotify() override {
       BaseClassMustBeDerivedFromService(this);
@@ -846,7 +1179,7 @@ class Gossip final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestdeleteNodeNotify(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -894,12 +1227,56 @@ class Gossip final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_syncDigest : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_syncDigest() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->syncDigest(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_syncDigest() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncDigest(::grpc::ServerContext* /*context*/, const ::pf_gossip::DigestRequest* /*request*/, ::pf_gossip::DigestResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* syncDigest(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_syncSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_syncSlots() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->syncSlots(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_syncSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status syncSlots(::grpc::ServerContext* /*context*/, const ::pf_gossip::SyncRequest* /*request*/, ::pf_gossip::SyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* syncSlots(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_echo : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_echo() {
-      ::grpc::Service::MarkMethodRawCallback(2,
+      ::grpc::Service::MarkMethodRawCallback(4,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->echo(context, request, response); }));
@@ -916,12 +1293,34 @@ class Gossip final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_ping : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ping() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ping(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ping() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ping(::grpc::ServerContext* /*context*/, const ::pf_gossip::PingRequest* /*request*/, ::pf_gossip::PingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ping(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_EstablishConnection : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_EstablishConnection() {
-      ::grpc::Service::MarkMethodRawCallback(3,
+      ::grpc::Service::MarkMethodRawCallback(6,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->EstablishConnection(context, request, response); }));
@@ -943,7 +1342,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_heartBeat() {
-      ::grpc::Service::MarkMethodRawCallback(4,
+      ::grpc::Service::MarkMethodRawCallback(7,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->heartBeat(context, request, response); }));
@@ -965,7 +1364,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_newNodeNotify() {
-      ::grpc::Service::MarkMethodRawCallback(5,
+      ::grpc::Service::MarkMethodRawCallback(8,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->newNodeNotify(context, request, response); }));
@@ -987,7 +1386,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_deleteNodeNotify() {
-      ::grpc::Service::MarkMethodRawCallback(6,
+      ::grpc::Service::MarkMethodRawCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->deleteNodeNotify(context, request, response); }));
@@ -1058,12 +1457,66 @@ class Gossip final {
     virtual ::grpc::Status Streamedpull(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip::SlotUpdate,::pf_gossip::updateResult>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_syncDigest : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_syncDigest() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::pf_gossip::DigestRequest, ::pf_gossip::DigestResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::pf_gossip::DigestRequest, ::pf_gossip::DigestResponse>* streamer) {
+                       return this->StreamedsyncDigest(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_syncDigest() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status syncDigest(::grpc::ServerContext* /*context*/, const ::pf_gossip::DigestRequest* /*request*/, ::pf_gossip::DigestResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedsyncDigest(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip::DigestRequest,::pf_gossip::DigestResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_syncSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_syncSlots() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::pf_gossip::SyncRequest, ::pf_gossip::SyncResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::pf_gossip::SyncRequest, ::pf_gossip::SyncResponse>* streamer) {
+                       return this->StreamedsyncSlots(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_syncSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status syncSlots(::grpc::ServerContext* /*context*/, const ::pf_gossip::SyncRequest* /*request*/, ::pf_gossip::SyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedsyncSlots(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip::SyncRequest,::pf_gossip::SyncResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_echo : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_echo() {
-      ::grpc::Service::MarkMethodStreamed(2,
+      ::grpc::Service::MarkMethodStreamed(4,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip::Message, ::pf_gossip::Message>(
             [this](::grpc::ServerContext* context,
@@ -1085,12 +1538,39 @@ class Gossip final {
     virtual ::grpc::Status Streamedecho(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip::Message,::pf_gossip::Message>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_ping : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ping() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::pf_gossip::PingRequest, ::pf_gossip::PingResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::pf_gossip::PingRequest, ::pf_gossip::PingResponse>* streamer) {
+                       return this->Streamedping(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ping() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ping(::grpc::ServerContext* /*context*/, const ::pf_gossip::PingRequest* /*request*/, ::pf_gossip::PingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedping(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip::PingRequest,::pf_gossip::PingResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_EstablishConnection : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_EstablishConnection() {
-      ::grpc::Service::MarkMethodStreamed(3,
+      ::grpc::Service::MarkMethodStreamed(6,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip::GossipNodeInfo, ::pf_gossip::GossipNodeInfo>(
             [this](::grpc::ServerContext* context,
@@ -1117,7 +1597,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_heartBeat() {
-      ::grpc::Service::MarkMethodStreamed(4,
+      ::grpc::Service::MarkMethodStreamed(7,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip::NodeVersions, ::pf_gossip::NodeVersions>(
             [this](::grpc::ServerContext* context,
@@ -1144,7 +1624,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_newNodeNotify() {
-      ::grpc::Service::MarkMethodStreamed(5,
+      ::grpc::Service::MarkMethodStreamed(8,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult>(
             [this](::grpc::ServerContext* context,
@@ -1171,7 +1651,7 @@ class Gossip final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_deleteNodeNotify() {
-      ::grpc::Service::MarkMethodStreamed(6,
+      ::grpc::Service::MarkMethodStreamed(9,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip::GossipNodeInfo, ::pf_gossip::updateResult>(
             [this](::grpc::ServerContext* context,
@@ -1192,9 +1672,9 @@ class Gossip final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreameddeleteNodeNotify(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip::GossipNodeInfo,::pf_gossip::updateResult>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_search<WithStreamedUnaryMethod_pull<WithStreamedUnaryMethod_echo<WithStreamedUnaryMethod_EstablishConnection<WithStreamedUnaryMethod_heartBeat<WithStreamedUnaryMethod_newNodeNotify<WithStreamedUnaryMethod_deleteNodeNotify<Service > > > > > > > StreamedUnaryService;
+  typedef WithStreamedUnaryMethod_search<WithStreamedUnaryMethod_pull<WithStreamedUnaryMethod_syncDigest<WithStreamedUnaryMethod_syncSlots<WithStreamedUnaryMethod_echo<WithStreamedUnaryMethod_ping<WithStreamedUnaryMethod_EstablishConnection<WithStreamedUnaryMethod_heartBeat<WithStreamedUnaryMethod_newNodeNotify<WithStreamedUnaryMethod_deleteNodeNotify<Service > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_search<WithStreamedUnaryMethod_pull<WithStreamedUnaryMethod_echo<WithStreamedUnaryMethod_EstablishConnection<WithStreamedUnaryMethod_heartBeat<WithStreamedUnaryMethod_newNodeNotify<WithStreamedUnaryMethod_deleteNodeNotify<Service > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_search<WithStreamedUnaryMethod_pull<WithStreamedUnaryMethod_syncDigest<WithStreamedUnaryMethod_syncSlots<WithStreamedUnaryMethod_echo<WithStreamedUnaryMethod_ping<WithStreamedUnaryMethod_EstablishConnection<WithStreamedUnaryMethod_heartBeat<WithStreamedUnaryMethod_newNodeNotify<WithStreamedUnaryMethod_deleteNodeNotify<Service > > > > > > > > > > StreamedService;
 };
 
 }  // namespace pf_gossip
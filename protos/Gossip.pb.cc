@@ -25,6 +25,9 @@ PROTOBUF_CONSTEXPR Message::Message(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_)*/int64_t{0}
+  , /*decltype(_impl_.ttl_ms_)*/int64_t{0}
+  , /*decltype(_impl_.deleted_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct MessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR MessageDefaultTypeInternal()
@@ -82,8 +85,12 @@ PROTOBUF_CONSTEXPR SlotUpdate::SlotUpdate(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.messages_)*/{}
   , /*decltype(_impl_.pass_nodes_)*/{}
+  , /*decltype(_impl_.leaves_)*/{}
+  , /*decltype(_impl_._leaves_cached_byte_size_)*/{0}
   , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.version_)*/int64_t{0}
+  , /*decltype(_impl_.base_version_)*/int64_t{0}
+  , /*decltype(_impl_.delta_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct SlotUpdateDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SlotUpdateDefaultTypeInternal()
@@ -94,6 +101,50 @@ struct SlotUpdateDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SlotUpdateDefaultTypeInternal _SlotUpdate_default_instance_;
+PROTOBUF_CONSTEXPR MerkleNode::MerkleNode(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MerkleNodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MerkleNodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MerkleNodeDefaultTypeInternal() {}
+  union {
+    MerkleNode _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MerkleNodeDefaultTypeInternal _MerkleNode_default_instance_;
+PROTOBUF_CONSTEXPR DigestRequest::DigestRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nodes_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DigestRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DigestRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DigestRequestDefaultTypeInternal() {}
+  union {
+    DigestRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DigestRequestDefaultTypeInternal _DigestRequest_default_instance_;
+PROTOBUF_CONSTEXPR DigestResponse::DigestResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.differs_)*/{}
+  , /*decltype(_impl_._differs_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.version_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DigestResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DigestResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DigestResponseDefaultTypeInternal() {}
+  union {
+    DigestResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DigestResponseDefaultTypeInternal _DigestResponse_default_instance_;
 PROTOBUF_CONSTEXPR GossipNodeInfo::GossipNodeInfo(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.pass_nodes_)*/{}
@@ -110,11 +161,44 @@ struct GossipNodeInfoDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GossipNodeInfoDefaultTypeInternal _GossipNodeInfo_default_instance_;
+PROTOBUF_CONSTEXPR SlotVersionEntry::SlotVersionEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SlotVersionEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SlotVersionEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SlotVersionEntryDefaultTypeInternal() {}
+  union {
+    SlotVersionEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SlotVersionEntryDefaultTypeInternal _SlotVersionEntry_default_instance_;
+PROTOBUF_CONSTEXPR MemberUpdate::MemberUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.incarnation_)*/int64_t{0}
+  , /*decltype(_impl_.state_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MemberUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MemberUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MemberUpdateDefaultTypeInternal() {}
+  union {
+    MemberUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MemberUpdateDefaultTypeInternal _MemberUpdate_default_instance_;
 PROTOBUF_CONSTEXPR NodeVersions::NodeVersions(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.node_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+    /*decltype(_impl_.slots_)*/{}
+  , /*decltype(_impl_.members_)*/{}
+  , /*decltype(_impl_.node_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.slot_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.slot_version_)*/int64_t{0}
+  , /*decltype(_impl_.full_slots_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct NodeVersionsDefaultTypeInternal {
   PROTOBUF_CONSTEXPR NodeVersionsDefaultTypeInternal()
@@ -125,9 +209,70 @@ struct NodeVersionsDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeVersionsDefaultTypeInternal _NodeVersions_default_instance_;
+PROTOBUF_CONSTEXPR SyncRequest::SyncRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slots_)*/{}
+  , /*decltype(_impl_.updates_)*/{}
+  , /*decltype(_impl_.members_)*/{}
+  , /*decltype(_impl_.node_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncRequestDefaultTypeInternal() {}
+  union {
+    SyncRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncRequestDefaultTypeInternal _SyncRequest_default_instance_;
+PROTOBUF_CONSTEXPR SyncResponse::SyncResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slots_)*/{}
+  , /*decltype(_impl_.updates_)*/{}
+  , /*decltype(_impl_.members_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncResponseDefaultTypeInternal() {}
+  union {
+    SyncResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncResponseDefaultTypeInternal _SyncResponse_default_instance_;
+PROTOBUF_CONSTEXPR PingRequest::PingRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.members_)*/{}
+  , /*decltype(_impl_.node_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timeout_ms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PingRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PingRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PingRequestDefaultTypeInternal() {}
+  union {
+    PingRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PingRequestDefaultTypeInternal _PingRequest_default_instance_;
+PROTOBUF_CONSTEXPR PingResponse::PingResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.members_)*/{}
+  , /*decltype(_impl_.ack_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PingResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PingResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PingResponseDefaultTypeInternal() {}
+  union {
+    PingResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PingResponseDefaultTypeInternal _PingResponse_default_instance_;
 }  // namespace pf_gossip
-static ::_pb::Metadata file_level_metadata_Gossip_2eproto[7];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Gossip_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_Gossip_2eproto[16];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_Gossip_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Gossip_2eproto = nullptr;
 
 const uint32_t TableStruct_Gossip_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -139,6 +284,9 @@ const uint32_t TableStruct_Gossip_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::pf_gossip::Message, _impl_.key_),
   PROTOBUF_FIELD_OFFSET(::pf_gossip::Message, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::Message, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::Message, _impl_.deleted_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::Message, _impl_.ttl_ms_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::pf_gossip::SearchResult_Message, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -174,6 +322,34 @@ const uint32_t TableStruct_Gossip_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::pf_gossip::SlotUpdate, _impl_.version_),
   PROTOBUF_FIELD_OFFSET(::pf_gossip::SlotUpdate, _impl_.messages_),
   PROTOBUF_FIELD_OFFSET(::pf_gossip::SlotUpdate, _impl_.pass_nodes_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SlotUpdate, _impl_.delta_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SlotUpdate, _impl_.base_version_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SlotUpdate, _impl_.leaves_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::MerkleNode, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::MerkleNode, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::MerkleNode, _impl_.hash_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::DigestRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::DigestRequest, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::DigestRequest, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::DigestRequest, _impl_.nodes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::DigestResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::DigestResponse, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::DigestResponse, _impl_.differs_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::pf_gossip::GossipNodeInfo, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -185,6 +361,24 @@ const uint32_t TableStruct_Gossip_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::pf_gossip::GossipNodeInfo, _impl_.address_),
   PROTOBUF_FIELD_OFFSET(::pf_gossip::GossipNodeInfo, _impl_.pass_nodes_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SlotVersionEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SlotVersionEntry, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SlotVersionEntry, _impl_.version_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::MemberUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::MemberUpdate, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::MemberUpdate, _impl_.address_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::MemberUpdate, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::MemberUpdate, _impl_.incarnation_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::pf_gossip::NodeVersions, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -193,15 +387,64 @@ const uint32_t TableStruct_Gossip_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::pf_gossip::NodeVersions, _impl_.node_name_),
   PROTOBUF_FIELD_OFFSET(::pf_gossip::NodeVersions, _impl_.slot_name_),
   PROTOBUF_FIELD_OFFSET(::pf_gossip::NodeVersions, _impl_.slot_version_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::NodeVersions, _impl_.slots_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::NodeVersions, _impl_.members_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::NodeVersions, _impl_.full_slots_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SyncRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SyncRequest, _impl_.node_name_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SyncRequest, _impl_.slots_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SyncRequest, _impl_.updates_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SyncRequest, _impl_.members_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SyncResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SyncResponse, _impl_.slots_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SyncResponse, _impl_.updates_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::SyncResponse, _impl_.members_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::PingRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::PingRequest, _impl_.node_name_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::PingRequest, _impl_.target_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::PingRequest, _impl_.timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::PingRequest, _impl_.members_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::PingResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::PingResponse, _impl_.ack_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip::PingResponse, _impl_.members_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::pf_gossip::Message)},
-  { 8, -1, -1, sizeof(::pf_gossip::SearchResult_Message)},
-  { 18, -1, -1, sizeof(::pf_gossip::SearchResult)},
-  { 25, -1, -1, sizeof(::pf_gossip::updateResult)},
-  { 33, -1, -1, sizeof(::pf_gossip::SlotUpdate)},
-  { 43, -1, -1, sizeof(::pf_gossip::GossipNodeInfo)},
-  { 53, -1, -1, sizeof(::pf_gossip::NodeVersions)},
+  { 11, -1, -1, sizeof(::pf_gossip::SearchResult_Message)},
+  { 21, -1, -1, sizeof(::pf_gossip::SearchResult)},
+  { 28, -1, -1, sizeof(::pf_gossip::updateResult)},
+  { 36, -1, -1, sizeof(::pf_gossip::SlotUpdate)},
+  { 49, -1, -1, sizeof(::pf_gossip::MerkleNode)},
+  { 57, -1, -1, sizeof(::pf_gossip::DigestRequest)},
+  { 66, -1, -1, sizeof(::pf_gossip::DigestResponse)},
+  { 74, -1, -1, sizeof(::pf_gossip::GossipNodeInfo)},
+  { 84, -1, -1, sizeof(::pf_gossip::SlotVersionEntry)},
+  { 92, -1, -1, sizeof(::pf_gossip::MemberUpdate)},
+  { 102, -1, -1, sizeof(::pf_gossip::NodeVersions)},
+  { 114, -1, -1, sizeof(::pf_gossip::SyncRequest)},
+  { 124, -1, -1, sizeof(::pf_gossip::SyncResponse)},
+  { 133, -1, -1, sizeof(::pf_gossip::PingRequest)},
+  { 143, -1, -1, sizeof(::pf_gossip::PingResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -210,42 +453,82 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::pf_gossip::_SearchResult_default_instance_._instance,
   &::pf_gossip::_updateResult_default_instance_._instance,
   &::pf_gossip::_SlotUpdate_default_instance_._instance,
+  &::pf_gossip::_MerkleNode_default_instance_._instance,
+  &::pf_gossip::_DigestRequest_default_instance_._instance,
+  &::pf_gossip::_DigestResponse_default_instance_._instance,
   &::pf_gossip::_GossipNodeInfo_default_instance_._instance,
+  &::pf_gossip::_SlotVersionEntry_default_instance_._instance,
+  &::pf_gossip::_MemberUpdate_default_instance_._instance,
   &::pf_gossip::_NodeVersions_default_instance_._instance,
+  &::pf_gossip::_SyncRequest_default_instance_._instance,
+  &::pf_gossip::_SyncResponse_default_instance_._instance,
+  &::pf_gossip::_PingRequest_default_instance_._instance,
+  &::pf_gossip::_PingResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_Gossip_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\014Gossip.proto\022\tpf_gossip\"%\n\007Message\022\013\n\003"
-  "key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t\"\207\001\n\014SearchResul"
-  "t\0220\n\007message\030\001 \003(\0132\037.pf_gossip.SearchRes"
-  "ult.Message\032E\n\007Message\022\013\n\003key\030\001 \001(\t\022\r\n\005v"
-  "alue\030\002 \001(\t\022\r\n\005owner\030\003 \001(\t\022\017\n\007version\030\004 \001"
-  "(\003\"0\n\014updateResult\022\017\n\007succeed\030\001 \001(\005\022\017\n\007v"
-  "ersion\030\002 \001(\003\"e\n\nSlotUpdate\022\014\n\004name\030\001 \001(\t"
-  "\022\017\n\007version\030\002 \001(\003\022$\n\010messages\030\003 \003(\0132\022.pf"
-  "_gossip.Message\022\022\n\npass_nodes\030\004 \003(\t\"T\n\016G"
-  "ossipNodeInfo\022\014\n\004name\030\001 \001(\t\022\017\n\007version\030\002"
-  " \001(\003\022\017\n\007address\030\003 \001(\t\022\022\n\npass_nodes\030\004 \003("
-  "\t\"J\n\014NodeVersions\022\021\n\tnode_name\030\001 \001(\t\022\021\n\t"
-  "slot_name\030\002 \001(\t\022\024\n\014slot_version\030\003 \001(\0032\300\003"
-  "\n\006Gossip\0225\n\006search\022\022.pf_gossip.Message\032\027"
-  ".pf_gossip.SearchResult\0226\n\004pull\022\025.pf_gos"
-  "sip.SlotUpdate\032\027.pf_gossip.updateResult\022"
-  ".\n\004echo\022\022.pf_gossip.Message\032\022.pf_gossip."
-  "Message\022K\n\023EstablishConnection\022\031.pf_goss"
-  "ip.GossipNodeInfo\032\031.pf_gossip.GossipNode"
-  "Info\022=\n\theartBeat\022\027.pf_gossip.NodeVersio"
-  "ns\032\027.pf_gossip.NodeVersions\022C\n\rnewNodeNo"
-  "tify\022\031.pf_gossip.GossipNodeInfo\032\027.pf_gos"
-  "sip.updateResult\022F\n\020deleteNodeNotify\022\031.p"
-  "f_gossip.GossipNodeInfo\032\027.pf_gossip.upda"
-  "teResultb\006proto3"
+  "\n\014Gossip.proto\022\tpf_gossip\"W\n\007Message\022\013\n\003"
+  "key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t\022\017\n\007version\030\003 \001("
+  "\003\022\017\n\007deleted\030\004 \001(\010\022\016\n\006ttl_ms\030\005 \001(\003\"\207\001\n\014S"
+  "earchResult\0220\n\007message\030\001 \003(\0132\037.pf_gossip"
+  ".SearchResult.Message\032E\n\007Message\022\013\n\003key\030"
+  "\001 \001(\t\022\r\n\005value\030\002 \001(\t\022\r\n\005owner\030\003 \001(\t\022\017\n\007v"
+  "ersion\030\004 \001(\003\"0\n\014updateResult\022\017\n\007succeed\030"
+  "\001 \001(\005\022\017\n\007version\030\002 \001(\003\"\232\001\n\nSlotUpdate\022\014\n"
+  "\004name\030\001 \001(\t\022\017\n\007version\030\002 \001(\003\022$\n\010messages"
+  "\030\003 \003(\0132\022.pf_gossip.Message\022\022\n\npass_nodes"
+  "\030\004 \003(\t\022\r\n\005delta\030\005 \001(\010\022\024\n\014base_version\030\006 "
+  "\001(\003\022\016\n\006leaves\030\007 \003(\005\")\n\nMerkleNode\022\r\n\005ind"
+  "ex\030\001 \001(\005\022\014\n\004hash\030\002 \001(\004\"T\n\rDigestRequest\022"
+  "\014\n\004name\030\001 \001(\t\022\017\n\007version\030\002 \001(\003\022$\n\005nodes\030"
+  "\003 \003(\0132\025.pf_gossip.MerkleNode\"2\n\016DigestRe"
+  "sponse\022\017\n\007version\030\001 \001(\003\022\017\n\007differs\030\002 \003(\005"
+  "\"T\n\016GossipNodeInfo\022\014\n\004name\030\001 \001(\t\022\017\n\007vers"
+  "ion\030\002 \001(\003\022\017\n\007address\030\003 \001(\t\022\022\n\npass_nodes"
+  "\030\004 \003(\t\"1\n\020SlotVersionEntry\022\014\n\004name\030\001 \001(\t"
+  "\022\017\n\007version\030\002 \001(\003\"i\n\014MemberUpdate\022\014\n\004nam"
+  "e\030\001 \001(\t\022\017\n\007address\030\002 \001(\t\022%\n\005state\030\003 \001(\0162"
+  "\026.pf_gossip.MemberState\022\023\n\013incarnation\030\004"
+  " \001(\003\"\264\001\n\014NodeVersions\022\021\n\tnode_name\030\001 \001(\t"
+  "\022\021\n\tslot_name\030\002 \001(\t\022\024\n\014slot_version\030\003 \001("
+  "\003\022*\n\005slots\030\004 \003(\0132\033.pf_gossip.SlotVersion"
+  "Entry\022(\n\007members\030\005 \003(\0132\027.pf_gossip.Membe"
+  "rUpdate\022\022\n\nfull_slots\030\006 \001(\010\"\207\001\n\013SyncRequ"
+  "est\022\021\n\tnode_name\030\001 \001(\t\022*\n\005slots\030\002 \003(\0132\033."
+  "pf_gossip.SlotVersionEntry\022\017\n\007updates\030\003 "
+  "\003(\014\022(\n\007members\030\004 \003(\0132\027.pf_gossip.MemberU"
+  "pdate\"u\n\014SyncResponse\022*\n\005slots\030\001 \003(\0132\033.p"
+  "f_gossip.SlotVersionEntry\022\017\n\007updates\030\002 \003"
+  "(\014\022(\n\007members\030\003 \003(\0132\027.pf_gossip.MemberUp"
+  "date\"n\n\013PingRequest\022\021\n\tnode_name\030\001 \001(\t\022\016"
+  "\n\006target\030\002 \001(\t\022\022\n\ntimeout_ms\030\003 \001(\003\022(\n\007me"
+  "mbers\030\004 \003(\0132\027.pf_gossip.MemberUpdate\"E\n\014"
+  "PingResponse\022\013\n\003ack\030\001 \001(\010\022(\n\007members\030\002 \003"
+  "(\0132\027.pf_gossip.MemberUpdate*/\n\013MemberSta"
+  "te\022\t\n\005ALIVE\020\000\022\013\n\007SUSPECT\020\001\022\010\n\004DEAD\020\0022\372\004\n"
+  "\006Gossip\0225\n\006search\022\022.pf_gossip.Message\032\027."
+  "pf_gossip.SearchResult\0226\n\004pull\022\025.pf_goss"
+  "ip.SlotUpdate\032\027.pf_gossip.updateResult\022A"
+  "\n\nsyncDigest\022\030.pf_gossip.DigestRequest\032\031"
+  ".pf_gossip.DigestResponse\022<\n\tsyncSlots\022\026"
+  ".pf_gossip.SyncRequest\032\027.pf_gossip.SyncR"
+  "esponse\022.\n\004echo\022\022.pf_gossip.Message\032\022.pf"
+  "_gossip.Message\0227\n\004ping\022\026.pf_gossip.Ping"
+  "Request\032\027.pf_gossip.PingResponse\022K\n\023Esta"
+  "blishConnection\022\031.pf_gossip.GossipNodeIn"
+  "fo\032\031.pf_gossip.GossipNodeInfo\022=\n\theartBe"
+  "at\022\027.pf_gossip.NodeVersions\032\027.pf_gossip."
+  "NodeVersions\022C\n\rnewNodeNotify\022\031.pf_gossi"
+  "p.GossipNodeInfo\032\027.pf_gossip.updateResul"
+  "t\022F\n\020deleteNodeNotify\022\031.pf_gossip.Gossip"
+  "NodeInfo\032\027.pf_gossip.updateResultb\006proto"
+  "3"
   ;
 static ::_pbi::once_flag descriptor_table_Gossip_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_Gossip_2eproto = {
-    false, false, 976, descriptor_table_protodef_Gossip_2eproto,
+    false, false, 2201, descriptor_table_protodef_Gossip_2eproto,
     "Gossip.proto",
-    &descriptor_table_Gossip_2eproto_once, nullptr, 0, 7,
+    &descriptor_table_Gossip_2eproto_once, nullptr, 0, 16,
     schemas, file_default_instances, TableStruct_Gossip_2eproto::offsets,
     file_level_metadata_Gossip_2eproto, file_level_enum_descriptors_Gossip_2eproto,
     file_level_service_descriptors_Gossip_2eproto,
@@ -257,6 +540,21 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Gossip_2
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Gossip_2eproto(&descriptor_table_Gossip_2eproto);
 namespace pf_gossip {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MemberState_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_Gossip_2eproto);
+  return file_level_enum_descriptors_Gossip_2eproto[0];
+}
+bool MemberState_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -276,6 +574,9 @@ Message::Message(const Message& from)
   new (&_impl_) Impl_{
       decltype(_impl_.key_){}
     , decltype(_impl_.value_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.ttl_ms_){}
+    , decltype(_impl_.deleted_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -295,6 +596,9 @@ Message::Message(const Message& from)
     _this->_impl_.value_.Set(from._internal_value(), 
       _this->GetArenaForAllocation());
   }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.deleted_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.deleted_));
   // @@protoc_insertion_point(copy_constructor:pf_gossip.Message)
 }
 
@@ -305,6 +609,9 @@ inline void Message::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.key_){}
     , decltype(_impl_.value_){}
+    , decltype(_impl_.version_){int64_t{0}}
+    , decltype(_impl_.ttl_ms_){int64_t{0}}
+    , decltype(_impl_.deleted_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.key_.InitDefault();
@@ -344,6 +651,9 @@ void Message::Clear() {
 
   _impl_.key_.ClearToEmpty();
   _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.deleted_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.deleted_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -373,6 +683,30 @@ const char* Message::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
         } else
           goto handle_unusual;
         continue;
+      // int64 version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool deleted = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.deleted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 ttl_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.ttl_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -422,6 +756,24 @@ uint8_t* Message::_InternalSerialize(
         2, this->_internal_value(), target);
   }
 
+  // int64 version = 3;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_version(), target);
+  }
+
+  // bool deleted = 4;
+  if (this->_internal_deleted() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_deleted(), target);
+  }
+
+  // int64 ttl_ms = 5;
+  if (this->_internal_ttl_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_ttl_ms(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -452,6 +804,21 @@ size_t Message::ByteSizeLong() const {
         this->_internal_value());
   }
 
+  // int64 version = 3;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_version());
+  }
+
+  // int64 ttl_ms = 5;
+  if (this->_internal_ttl_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ttl_ms());
+  }
+
+  // bool deleted = 4;
+  if (this->_internal_deleted() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -476,6 +843,15 @@ void Message::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOB
   if (!from._internal_value().empty()) {
     _this->_internal_set_value(from._internal_value());
   }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_ttl_ms() != 0) {
+    _this->_internal_set_ttl_ms(from._internal_ttl_ms());
+  }
+  if (from._internal_deleted() != 0) {
+    _this->_internal_set_deleted(from._internal_deleted());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -503,6 +879,12 @@ void Message::InternalSwap(Message* other) {
       &_impl_.value_, lhs_arena,
       &other->_impl_.value_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message, _impl_.deleted_)
+      + sizeof(Message::_impl_.deleted_)
+      - PROTOBUF_FIELD_OFFSET(Message, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Message::GetMetadata() const {
@@ -1255,8 +1637,12 @@ SlotUpdate::SlotUpdate(const SlotUpdate& from)
   new (&_impl_) Impl_{
       decltype(_impl_.messages_){from._impl_.messages_}
     , decltype(_impl_.pass_nodes_){from._impl_.pass_nodes_}
+    , decltype(_impl_.leaves_){from._impl_.leaves_}
+    , /*decltype(_impl_._leaves_cached_byte_size_)*/{0}
     , decltype(_impl_.name_){}
     , decltype(_impl_.version_){}
+    , decltype(_impl_.base_version_){}
+    , decltype(_impl_.delta_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1268,7 +1654,9 @@ SlotUpdate::SlotUpdate(const SlotUpdate& from)
     _this->_impl_.name_.Set(from._internal_name(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.version_ = from._impl_.version_;
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.delta_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.delta_));
   // @@protoc_insertion_point(copy_constructor:pf_gossip.SlotUpdate)
 }
 
@@ -1279,8 +1667,12 @@ inline void SlotUpdate::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.messages_){arena}
     , decltype(_impl_.pass_nodes_){arena}
+    , decltype(_impl_.leaves_){arena}
+    , /*decltype(_impl_._leaves_cached_byte_size_)*/{0}
     , decltype(_impl_.name_){}
     , decltype(_impl_.version_){int64_t{0}}
+    , decltype(_impl_.base_version_){int64_t{0}}
+    , decltype(_impl_.delta_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.name_.InitDefault();
@@ -1302,6 +1694,7 @@ inline void SlotUpdate::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.messages_.~RepeatedPtrField();
   _impl_.pass_nodes_.~RepeatedPtrField();
+  _impl_.leaves_.~RepeatedField();
   _impl_.name_.Destroy();
 }
 
@@ -1317,8 +1710,11 @@ void SlotUpdate::Clear() {
 
   _impl_.messages_.Clear();
   _impl_.pass_nodes_.Clear();
+  _impl_.leaves_.Clear();
   _impl_.name_.ClearToEmpty();
-  _impl_.version_ = int64_t{0};
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.delta_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.delta_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1374,6 +1770,33 @@ const char* SlotUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ct
         } else
           goto handle_unusual;
         continue;
+      // bool delta = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 base_version = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.base_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 leaves = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_leaves(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_leaves(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1437,6 +1860,27 @@ uint8_t* SlotUpdate::_InternalSerialize(
     target = stream->WriteString(4, s, target);
   }
 
+  // bool delta = 5;
+  if (this->_internal_delta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_delta(), target);
+  }
+
+  // int64 base_version = 6;
+  if (this->_internal_base_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_base_version(), target);
+  }
+
+  // repeated int32 leaves = 7;
+  {
+    int byte_size = _impl_._leaves_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          7, _internal_leaves(), byte_size, target);
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1468,6 +1912,20 @@ size_t SlotUpdate::ByteSizeLong() const {
       _impl_.pass_nodes_.Get(i));
   }
 
+  // repeated int32 leaves = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.leaves_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._leaves_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   // string name = 1;
   if (!this->_internal_name().empty()) {
     total_size += 1 +
@@ -1480,6 +1938,16 @@ size_t SlotUpdate::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_version());
   }
 
+  // int64 base_version = 6;
+  if (this->_internal_base_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_base_version());
+  }
+
+  // bool delta = 5;
+  if (this->_internal_delta() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1500,12 +1968,19 @@ void SlotUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PRO
 
   _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
   _this->_impl_.pass_nodes_.MergeFrom(from._impl_.pass_nodes_);
+  _this->_impl_.leaves_.MergeFrom(from._impl_.leaves_);
   if (!from._internal_name().empty()) {
     _this->_internal_set_name(from._internal_name());
   }
   if (from._internal_version() != 0) {
     _this->_internal_set_version(from._internal_version());
   }
+  if (from._internal_base_version() != 0) {
+    _this->_internal_set_base_version(from._internal_base_version());
+  }
+  if (from._internal_delta() != 0) {
+    _this->_internal_set_delta(from._internal_delta());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1527,11 +2002,17 @@ void SlotUpdate::InternalSwap(SlotUpdate* other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.messages_.InternalSwap(&other->_impl_.messages_);
   _impl_.pass_nodes_.InternalSwap(&other->_impl_.pass_nodes_);
+  _impl_.leaves_.InternalSwap(&other->_impl_.leaves_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.name_, lhs_arena,
       &other->_impl_.name_, rhs_arena
   );
-  swap(_impl_.version_, other->_impl_.version_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SlotUpdate, _impl_.delta_)
+      + sizeof(SlotUpdate::_impl_.delta_)
+      - PROTOBUF_FIELD_OFFSET(SlotUpdate, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SlotUpdate::GetMetadata() const {
@@ -1542,70 +2023,44 @@ void SlotUpdate::InternalSwap(SlotUpdate* other) {
 
 // ===================================================================
 
-class GossipNodeInfo::_Internal {
+class MerkleNode::_Internal {
  public:
 };
 
-GossipNodeInfo::GossipNodeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+MerkleNode::MerkleNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:pf_gossip.GossipNodeInfo)
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.MerkleNode)
 }
-GossipNodeInfo::GossipNodeInfo(const GossipNodeInfo& from)
+MerkleNode::MerkleNode(const MerkleNode& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  GossipNodeInfo* const _this = this; (void)_this;
+  MerkleNode* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.pass_nodes_){from._impl_.pass_nodes_}
-    , decltype(_impl_.name_){}
-    , decltype(_impl_.address_){}
-    , decltype(_impl_.version_){}
+      decltype(_impl_.hash_){}
+    , decltype(_impl_.index_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_name().empty()) {
-    _this->_impl_.name_.Set(from._internal_name(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.address_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.address_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_address().empty()) {
-    _this->_impl_.address_.Set(from._internal_address(), 
-      _this->GetArenaForAllocation());
-  }
-  _this->_impl_.version_ = from._impl_.version_;
-  // @@protoc_insertion_point(copy_constructor:pf_gossip.GossipNodeInfo)
+  ::memcpy(&_impl_.hash_, &from._impl_.hash_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.index_) -
+    reinterpret_cast<char*>(&_impl_.hash_)) + sizeof(_impl_.index_));
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.MerkleNode)
 }
 
-inline void GossipNodeInfo::SharedCtor(
+inline void MerkleNode::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.pass_nodes_){arena}
-    , decltype(_impl_.name_){}
-    , decltype(_impl_.address_){}
-    , decltype(_impl_.version_){int64_t{0}}
+      decltype(_impl_.hash_){uint64_t{0u}}
+    , decltype(_impl_.index_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.address_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.address_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-GossipNodeInfo::~GossipNodeInfo() {
-  // @@protoc_insertion_point(destructor:pf_gossip.GossipNodeInfo)
+MerkleNode::~MerkleNode() {
+  // @@protoc_insertion_point(destructor:pf_gossip.MerkleNode)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1613,47 +2068,268 @@ GossipNodeInfo::~GossipNodeInfo() {
   SharedDtor();
 }
 
-inline void GossipNodeInfo::SharedDtor() {
+inline void MerkleNode::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.pass_nodes_.~RepeatedPtrField();
-  _impl_.name_.Destroy();
-  _impl_.address_.Destroy();
 }
 
-void GossipNodeInfo::SetCachedSize(int size) const {
+void MerkleNode::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void GossipNodeInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:pf_gossip.GossipNodeInfo)
+void MerkleNode::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.MerkleNode)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.pass_nodes_.Clear();
-  _impl_.name_.ClearToEmpty();
-  _impl_.address_.ClearToEmpty();
-  _impl_.version_ = int64_t{0};
+  ::memset(&_impl_.hash_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.index_) -
+      reinterpret_cast<char*>(&_impl_.hash_)) + sizeof(_impl_.index_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GossipNodeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* MerkleNode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string name = 1;
+      // int32 index = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.GossipNodeInfo.name"));
         } else
           goto handle_unusual;
         continue;
-      // int64 version = 2;
+      // uint64 hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MerkleNode::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.MerkleNode)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 index = 1;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_index(), target);
+  }
+
+  // uint64 hash = 2;
+  if (this->_internal_hash() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.MerkleNode)
+  return target;
+}
+
+size_t MerkleNode::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.MerkleNode)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 hash = 2;
+  if (this->_internal_hash() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_hash());
+  }
+
+  // int32 index = 1;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MerkleNode::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MerkleNode::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MerkleNode::GetClassData() const { return &_class_data_; }
+
+
+void MerkleNode::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MerkleNode*>(&to_msg);
+  auto& from = static_cast<const MerkleNode&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.MerkleNode)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_hash() != 0) {
+    _this->_internal_set_hash(from._internal_hash());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MerkleNode::CopyFrom(const MerkleNode& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.MerkleNode)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MerkleNode::IsInitialized() const {
+  return true;
+}
+
+void MerkleNode::InternalSwap(MerkleNode* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MerkleNode, _impl_.index_)
+      + sizeof(MerkleNode::_impl_.index_)
+      - PROTOBUF_FIELD_OFFSET(MerkleNode, _impl_.hash_)>(
+          reinterpret_cast<char*>(&_impl_.hash_),
+          reinterpret_cast<char*>(&other->_impl_.hash_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MerkleNode::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
+      file_level_metadata_Gossip_2eproto[5]);
+}
+
+// ===================================================================
+
+class DigestRequest::_Internal {
+ public:
+};
+
+DigestRequest::DigestRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.DigestRequest)
+}
+DigestRequest::DigestRequest(const DigestRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DigestRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){from._impl_.nodes_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.DigestRequest)
+}
+
+inline void DigestRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.version_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DigestRequest::~DigestRequest() {
+  // @@protoc_insertion_point(destructor:pf_gossip.DigestRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DigestRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodes_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void DigestRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DigestRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.DigestRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nodes_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.version_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DigestRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.DigestRequest.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 version = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
           _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
@@ -1661,26 +2337,2328 @@ const char* GossipNodeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext
         } else
           goto handle_unusual;
         continue;
-      // string address = 3;
+      // repeated .pf_gossip.MerkleNode nodes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_nodes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DigestRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.DigestRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.DigestRequest.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // int64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  // repeated .pf_gossip.MerkleNode nodes = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_nodes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_nodes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.DigestRequest)
+  return target;
+}
+
+size_t DigestRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.DigestRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip.MerkleNode nodes = 3;
+  total_size += 1UL * this->_internal_nodes_size();
+  for (const auto& msg : this->_impl_.nodes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // int64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DigestRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DigestRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DigestRequest::GetClassData() const { return &_class_data_; }
+
+
+void DigestRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DigestRequest*>(&to_msg);
+  auto& from = static_cast<const DigestRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.DigestRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.nodes_.MergeFrom(from._impl_.nodes_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DigestRequest::CopyFrom(const DigestRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.DigestRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DigestRequest::IsInitialized() const {
+  return true;
+}
+
+void DigestRequest::InternalSwap(DigestRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.nodes_.InternalSwap(&other->_impl_.nodes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.version_, other->_impl_.version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DigestRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
+      file_level_metadata_Gossip_2eproto[6]);
+}
+
+// ===================================================================
+
+class DigestResponse::_Internal {
+ public:
+};
+
+DigestResponse::DigestResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.DigestResponse)
+}
+DigestResponse::DigestResponse(const DigestResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DigestResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.differs_){from._impl_.differs_}
+    , /*decltype(_impl_._differs_cached_byte_size_)*/{0}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.DigestResponse)
+}
+
+inline void DigestResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.differs_){arena}
+    , /*decltype(_impl_._differs_cached_byte_size_)*/{0}
+    , decltype(_impl_.version_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+DigestResponse::~DigestResponse() {
+  // @@protoc_insertion_point(destructor:pf_gossip.DigestResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DigestResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.differs_.~RepeatedField();
+}
+
+void DigestResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DigestResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.DigestResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.differs_.Clear();
+  _impl_.version_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DigestResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 differs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_differs(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_differs(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DigestResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.DigestResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 version = 1;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_version(), target);
+  }
+
+  // repeated int32 differs = 2;
+  {
+    int byte_size = _impl_._differs_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_differs(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.DigestResponse)
+  return target;
+}
+
+size_t DigestResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.DigestResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 differs = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.differs_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._differs_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // int64 version = 1;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DigestResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DigestResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DigestResponse::GetClassData() const { return &_class_data_; }
+
+
+void DigestResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DigestResponse*>(&to_msg);
+  auto& from = static_cast<const DigestResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.DigestResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.differs_.MergeFrom(from._impl_.differs_);
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DigestResponse::CopyFrom(const DigestResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.DigestResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DigestResponse::IsInitialized() const {
+  return true;
+}
+
+void DigestResponse::InternalSwap(DigestResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.differs_.InternalSwap(&other->_impl_.differs_);
+  swap(_impl_.version_, other->_impl_.version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DigestResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
+      file_level_metadata_Gossip_2eproto[7]);
+}
+
+// ===================================================================
+
+class GossipNodeInfo::_Internal {
+ public:
+};
+
+GossipNodeInfo::GossipNodeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.GossipNodeInfo)
+}
+GossipNodeInfo::GossipNodeInfo(const GossipNodeInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GossipNodeInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pass_nodes_){from._impl_.pass_nodes_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.address_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_address().empty()) {
+    _this->_impl_.address_.Set(from._internal_address(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.GossipNodeInfo)
+}
+
+inline void GossipNodeInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pass_nodes_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.address_){}
+    , decltype(_impl_.version_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GossipNodeInfo::~GossipNodeInfo() {
+  // @@protoc_insertion_point(destructor:pf_gossip.GossipNodeInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GossipNodeInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pass_nodes_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.address_.Destroy();
+}
+
+void GossipNodeInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GossipNodeInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.GossipNodeInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pass_nodes_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.address_.ClearToEmpty();
+  _impl_.version_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GossipNodeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.GossipNodeInfo.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string address = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.GossipNodeInfo.address"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string pass_nodes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_pass_nodes();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.GossipNodeInfo.pass_nodes"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GossipNodeInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.GossipNodeInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.GossipNodeInfo.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // int64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  // string address = 3;
+  if (!this->_internal_address().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_address().data(), static_cast<int>(this->_internal_address().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.GossipNodeInfo.address");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_address(), target);
+  }
+
+  // repeated string pass_nodes = 4;
+  for (int i = 0, n = this->_internal_pass_nodes_size(); i < n; i++) {
+    const auto& s = this->_internal_pass_nodes(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.GossipNodeInfo.pass_nodes");
+    target = stream->WriteString(4, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.GossipNodeInfo)
+  return target;
+}
+
+size_t GossipNodeInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.GossipNodeInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string pass_nodes = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.pass_nodes_.size());
+  for (int i = 0, n = _impl_.pass_nodes_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.pass_nodes_.Get(i));
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string address = 3;
+  if (!this->_internal_address().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_address());
+  }
+
+  // int64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GossipNodeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GossipNodeInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GossipNodeInfo::GetClassData() const { return &_class_data_; }
+
+
+void GossipNodeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GossipNodeInfo*>(&to_msg);
+  auto& from = static_cast<const GossipNodeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.GossipNodeInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.pass_nodes_.MergeFrom(from._impl_.pass_nodes_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_address().empty()) {
+    _this->_internal_set_address(from._internal_address());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GossipNodeInfo::CopyFrom(const GossipNodeInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.GossipNodeInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GossipNodeInfo::IsInitialized() const {
+  return true;
+}
+
+void GossipNodeInfo::InternalSwap(GossipNodeInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.pass_nodes_.InternalSwap(&other->_impl_.pass_nodes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.address_, lhs_arena,
+      &other->_impl_.address_, rhs_arena
+  );
+  swap(_impl_.version_, other->_impl_.version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GossipNodeInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
+      file_level_metadata_Gossip_2eproto[8]);
+}
+
+// ===================================================================
+
+class SlotVersionEntry::_Internal {
+ public:
+};
+
+SlotVersionEntry::SlotVersionEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.SlotVersionEntry)
+}
+SlotVersionEntry::SlotVersionEntry(const SlotVersionEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SlotVersionEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.SlotVersionEntry)
+}
+
+inline void SlotVersionEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.version_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SlotVersionEntry::~SlotVersionEntry() {
+  // @@protoc_insertion_point(destructor:pf_gossip.SlotVersionEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SlotVersionEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void SlotVersionEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SlotVersionEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.SlotVersionEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.version_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SlotVersionEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.SlotVersionEntry.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SlotVersionEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.SlotVersionEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.SlotVersionEntry.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // int64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.SlotVersionEntry)
+  return target;
+}
+
+size_t SlotVersionEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.SlotVersionEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // int64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SlotVersionEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SlotVersionEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SlotVersionEntry::GetClassData() const { return &_class_data_; }
+
+
+void SlotVersionEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SlotVersionEntry*>(&to_msg);
+  auto& from = static_cast<const SlotVersionEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.SlotVersionEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SlotVersionEntry::CopyFrom(const SlotVersionEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.SlotVersionEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SlotVersionEntry::IsInitialized() const {
+  return true;
+}
+
+void SlotVersionEntry::InternalSwap(SlotVersionEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.version_, other->_impl_.version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SlotVersionEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
+      file_level_metadata_Gossip_2eproto[9]);
+}
+
+// ===================================================================
+
+class MemberUpdate::_Internal {
+ public:
+};
+
+MemberUpdate::MemberUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.MemberUpdate)
+}
+MemberUpdate::MemberUpdate(const MemberUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MemberUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.address_){}
+    , decltype(_impl_.incarnation_){}
+    , decltype(_impl_.state_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_address().empty()) {
+    _this->_impl_.address_.Set(from._internal_address(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.incarnation_, &from._impl_.incarnation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.state_) -
+    reinterpret_cast<char*>(&_impl_.incarnation_)) + sizeof(_impl_.state_));
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.MemberUpdate)
+}
+
+inline void MemberUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.address_){}
+    , decltype(_impl_.incarnation_){int64_t{0}}
+    , decltype(_impl_.state_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MemberUpdate::~MemberUpdate() {
+  // @@protoc_insertion_point(destructor:pf_gossip.MemberUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MemberUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.address_.Destroy();
+}
+
+void MemberUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MemberUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.MemberUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.address_.ClearToEmpty();
+  ::memset(&_impl_.incarnation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.state_) -
+      reinterpret_cast<char*>(&_impl_.incarnation_)) + sizeof(_impl_.state_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MemberUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.MemberUpdate.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string address = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.MemberUpdate.address"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .pf_gossip.MemberState state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_state(static_cast<::pf_gossip::MemberState>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 incarnation = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.incarnation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MemberUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.MemberUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.MemberUpdate.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // string address = 2;
+  if (!this->_internal_address().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_address().data(), static_cast<int>(this->_internal_address().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.MemberUpdate.address");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_address(), target);
+  }
+
+  // .pf_gossip.MemberState state = 3;
+  if (this->_internal_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_state(), target);
+  }
+
+  // int64 incarnation = 4;
+  if (this->_internal_incarnation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_incarnation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.MemberUpdate)
+  return target;
+}
+
+size_t MemberUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.MemberUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string address = 2;
+  if (!this->_internal_address().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_address());
+  }
+
+  // int64 incarnation = 4;
+  if (this->_internal_incarnation() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_incarnation());
+  }
+
+  // .pf_gossip.MemberState state = 3;
+  if (this->_internal_state() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MemberUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MemberUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MemberUpdate::GetClassData() const { return &_class_data_; }
+
+
+void MemberUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MemberUpdate*>(&to_msg);
+  auto& from = static_cast<const MemberUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.MemberUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_address().empty()) {
+    _this->_internal_set_address(from._internal_address());
+  }
+  if (from._internal_incarnation() != 0) {
+    _this->_internal_set_incarnation(from._internal_incarnation());
+  }
+  if (from._internal_state() != 0) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MemberUpdate::CopyFrom(const MemberUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.MemberUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MemberUpdate::IsInitialized() const {
+  return true;
+}
+
+void MemberUpdate::InternalSwap(MemberUpdate* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.address_, lhs_arena,
+      &other->_impl_.address_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MemberUpdate, _impl_.state_)
+      + sizeof(MemberUpdate::_impl_.state_)
+      - PROTOBUF_FIELD_OFFSET(MemberUpdate, _impl_.incarnation_)>(
+          reinterpret_cast<char*>(&_impl_.incarnation_),
+          reinterpret_cast<char*>(&other->_impl_.incarnation_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MemberUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
+      file_level_metadata_Gossip_2eproto[10]);
+}
+
+// ===================================================================
+
+class NodeVersions::_Internal {
+ public:
+};
+
+NodeVersions::NodeVersions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.NodeVersions)
+}
+NodeVersions::NodeVersions(const NodeVersions& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeVersions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){from._impl_.slots_}
+    , decltype(_impl_.members_){from._impl_.members_}
+    , decltype(_impl_.node_name_){}
+    , decltype(_impl_.slot_name_){}
+    , decltype(_impl_.slot_version_){}
+    , decltype(_impl_.full_slots_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node_name().empty()) {
+    _this->_impl_.node_name_.Set(from._internal_node_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.slot_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.slot_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_slot_name().empty()) {
+    _this->_impl_.slot_name_.Set(from._internal_slot_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.slot_version_, &from._impl_.slot_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.full_slots_) -
+    reinterpret_cast<char*>(&_impl_.slot_version_)) + sizeof(_impl_.full_slots_));
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.NodeVersions)
+}
+
+inline void NodeVersions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){arena}
+    , decltype(_impl_.members_){arena}
+    , decltype(_impl_.node_name_){}
+    , decltype(_impl_.slot_name_){}
+    , decltype(_impl_.slot_version_){int64_t{0}}
+    , decltype(_impl_.full_slots_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.slot_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.slot_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NodeVersions::~NodeVersions() {
+  // @@protoc_insertion_point(destructor:pf_gossip.NodeVersions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NodeVersions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slots_.~RepeatedPtrField();
+  _impl_.members_.~RepeatedPtrField();
+  _impl_.node_name_.Destroy();
+  _impl_.slot_name_.Destroy();
+}
+
+void NodeVersions::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NodeVersions::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.NodeVersions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slots_.Clear();
+  _impl_.members_.Clear();
+  _impl_.node_name_.ClearToEmpty();
+  _impl_.slot_name_.ClearToEmpty();
+  ::memset(&_impl_.slot_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.full_slots_) -
+      reinterpret_cast<char*>(&_impl_.slot_version_)) + sizeof(_impl_.full_slots_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NodeVersions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string node_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_node_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.NodeVersions.node_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string slot_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_slot_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.NodeVersions.slot_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 slot_version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.slot_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .pf_gossip.SlotVersionEntry slots = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_slots(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .pf_gossip.MemberUpdate members = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_members(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool full_slots = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.full_slots_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeVersions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.NodeVersions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string node_name = 1;
+  if (!this->_internal_node_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node_name().data(), static_cast<int>(this->_internal_node_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.NodeVersions.node_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_node_name(), target);
+  }
+
+  // string slot_name = 2;
+  if (!this->_internal_slot_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_slot_name().data(), static_cast<int>(this->_internal_slot_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.NodeVersions.slot_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_slot_name(), target);
+  }
+
+  // int64 slot_version = 3;
+  if (this->_internal_slot_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_slot_version(), target);
+  }
+
+  // repeated .pf_gossip.SlotVersionEntry slots = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_slots_size()); i < n; i++) {
+    const auto& repfield = this->_internal_slots(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .pf_gossip.MemberUpdate members = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_members_size()); i < n; i++) {
+    const auto& repfield = this->_internal_members(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool full_slots = 6;
+  if (this->_internal_full_slots() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_full_slots(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.NodeVersions)
+  return target;
+}
+
+size_t NodeVersions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.NodeVersions)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip.SlotVersionEntry slots = 4;
+  total_size += 1UL * this->_internal_slots_size();
+  for (const auto& msg : this->_impl_.slots_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .pf_gossip.MemberUpdate members = 5;
+  total_size += 1UL * this->_internal_members_size();
+  for (const auto& msg : this->_impl_.members_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string node_name = 1;
+  if (!this->_internal_node_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node_name());
+  }
+
+  // string slot_name = 2;
+  if (!this->_internal_slot_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_slot_name());
+  }
+
+  // int64 slot_version = 3;
+  if (this->_internal_slot_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_slot_version());
+  }
+
+  // bool full_slots = 6;
+  if (this->_internal_full_slots() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeVersions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeVersions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeVersions::GetClassData() const { return &_class_data_; }
+
+
+void NodeVersions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeVersions*>(&to_msg);
+  auto& from = static_cast<const NodeVersions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.NodeVersions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slots_.MergeFrom(from._impl_.slots_);
+  _this->_impl_.members_.MergeFrom(from._impl_.members_);
+  if (!from._internal_node_name().empty()) {
+    _this->_internal_set_node_name(from._internal_node_name());
+  }
+  if (!from._internal_slot_name().empty()) {
+    _this->_internal_set_slot_name(from._internal_slot_name());
+  }
+  if (from._internal_slot_version() != 0) {
+    _this->_internal_set_slot_version(from._internal_slot_version());
+  }
+  if (from._internal_full_slots() != 0) {
+    _this->_internal_set_full_slots(from._internal_full_slots());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NodeVersions::CopyFrom(const NodeVersions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.NodeVersions)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NodeVersions::IsInitialized() const {
+  return true;
+}
+
+void NodeVersions::InternalSwap(NodeVersions* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.slots_.InternalSwap(&other->_impl_.slots_);
+  _impl_.members_.InternalSwap(&other->_impl_.members_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_name_, lhs_arena,
+      &other->_impl_.node_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.slot_name_, lhs_arena,
+      &other->_impl_.slot_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeVersions, _impl_.full_slots_)
+      + sizeof(NodeVersions::_impl_.full_slots_)
+      - PROTOBUF_FIELD_OFFSET(NodeVersions, _impl_.slot_version_)>(
+          reinterpret_cast<char*>(&_impl_.slot_version_),
+          reinterpret_cast<char*>(&other->_impl_.slot_version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NodeVersions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
+      file_level_metadata_Gossip_2eproto[11]);
+}
+
+// ===================================================================
+
+class SyncRequest::_Internal {
+ public:
+};
+
+SyncRequest::SyncRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.SyncRequest)
+}
+SyncRequest::SyncRequest(const SyncRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){from._impl_.slots_}
+    , decltype(_impl_.updates_){from._impl_.updates_}
+    , decltype(_impl_.members_){from._impl_.members_}
+    , decltype(_impl_.node_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node_name().empty()) {
+    _this->_impl_.node_name_.Set(from._internal_node_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.SyncRequest)
+}
+
+inline void SyncRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){arena}
+    , decltype(_impl_.updates_){arena}
+    , decltype(_impl_.members_){arena}
+    , decltype(_impl_.node_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncRequest::~SyncRequest() {
+  // @@protoc_insertion_point(destructor:pf_gossip.SyncRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slots_.~RepeatedPtrField();
+  _impl_.updates_.~RepeatedPtrField();
+  _impl_.members_.~RepeatedPtrField();
+  _impl_.node_name_.Destroy();
+}
+
+void SyncRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.SyncRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slots_.Clear();
+  _impl_.updates_.Clear();
+  _impl_.members_.Clear();
+  _impl_.node_name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string node_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_node_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.SyncRequest.node_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .pf_gossip.SlotVersionEntry slots = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_slots(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes updates = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_updates();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .pf_gossip.MemberUpdate members = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_members(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.SyncRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string node_name = 1;
+  if (!this->_internal_node_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node_name().data(), static_cast<int>(this->_internal_node_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip.SyncRequest.node_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_node_name(), target);
+  }
+
+  // repeated .pf_gossip.SlotVersionEntry slots = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_slots_size()); i < n; i++) {
+    const auto& repfield = this->_internal_slots(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated bytes updates = 3;
+  for (int i = 0, n = this->_internal_updates_size(); i < n; i++) {
+    const auto& s = this->_internal_updates(i);
+    target = stream->WriteBytes(3, s, target);
+  }
+
+  // repeated .pf_gossip.MemberUpdate members = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_members_size()); i < n; i++) {
+    const auto& repfield = this->_internal_members(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.SyncRequest)
+  return target;
+}
+
+size_t SyncRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.SyncRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip.SlotVersionEntry slots = 2;
+  total_size += 1UL * this->_internal_slots_size();
+  for (const auto& msg : this->_impl_.slots_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated bytes updates = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.updates_.size());
+  for (int i = 0, n = _impl_.updates_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.updates_.Get(i));
+  }
+
+  // repeated .pf_gossip.MemberUpdate members = 4;
+  total_size += 1UL * this->_internal_members_size();
+  for (const auto& msg : this->_impl_.members_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string node_name = 1;
+  if (!this->_internal_node_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node_name());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncRequest::GetClassData() const { return &_class_data_; }
+
+
+void SyncRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncRequest*>(&to_msg);
+  auto& from = static_cast<const SyncRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.SyncRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slots_.MergeFrom(from._impl_.slots_);
+  _this->_impl_.updates_.MergeFrom(from._impl_.updates_);
+  _this->_impl_.members_.MergeFrom(from._impl_.members_);
+  if (!from._internal_node_name().empty()) {
+    _this->_internal_set_node_name(from._internal_node_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncRequest::CopyFrom(const SyncRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.SyncRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncRequest::IsInitialized() const {
+  return true;
+}
+
+void SyncRequest::InternalSwap(SyncRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.slots_.InternalSwap(&other->_impl_.slots_);
+  _impl_.updates_.InternalSwap(&other->_impl_.updates_);
+  _impl_.members_.InternalSwap(&other->_impl_.members_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_name_, lhs_arena,
+      &other->_impl_.node_name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
+      file_level_metadata_Gossip_2eproto[12]);
+}
+
+// ===================================================================
+
+class SyncResponse::_Internal {
+ public:
+};
+
+SyncResponse::SyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.SyncResponse)
+}
+SyncResponse::SyncResponse(const SyncResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){from._impl_.slots_}
+    , decltype(_impl_.updates_){from._impl_.updates_}
+    , decltype(_impl_.members_){from._impl_.members_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.SyncResponse)
+}
+
+inline void SyncResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){arena}
+    , decltype(_impl_.updates_){arena}
+    , decltype(_impl_.members_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SyncResponse::~SyncResponse() {
+  // @@protoc_insertion_point(destructor:pf_gossip.SyncResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slots_.~RepeatedPtrField();
+  _impl_.updates_.~RepeatedPtrField();
+  _impl_.members_.~RepeatedPtrField();
+}
+
+void SyncResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.SyncResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slots_.Clear();
+  _impl_.updates_.Clear();
+  _impl_.members_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .pf_gossip.SlotVersionEntry slots = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_slots(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes updates = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_updates();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .pf_gossip.MemberUpdate members = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_members(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.SyncResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip.SlotVersionEntry slots = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_slots_size()); i < n; i++) {
+    const auto& repfield = this->_internal_slots(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated bytes updates = 2;
+  for (int i = 0, n = this->_internal_updates_size(); i < n; i++) {
+    const auto& s = this->_internal_updates(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  // repeated .pf_gossip.MemberUpdate members = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_members_size()); i < n; i++) {
+    const auto& repfield = this->_internal_members(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.SyncResponse)
+  return target;
+}
+
+size_t SyncResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.SyncResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip.SlotVersionEntry slots = 1;
+  total_size += 1UL * this->_internal_slots_size();
+  for (const auto& msg : this->_impl_.slots_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated bytes updates = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.updates_.size());
+  for (int i = 0, n = _impl_.updates_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.updates_.Get(i));
+  }
+
+  // repeated .pf_gossip.MemberUpdate members = 3;
+  total_size += 1UL * this->_internal_members_size();
+  for (const auto& msg : this->_impl_.members_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncResponse::GetClassData() const { return &_class_data_; }
+
+
+void SyncResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncResponse*>(&to_msg);
+  auto& from = static_cast<const SyncResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.SyncResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slots_.MergeFrom(from._impl_.slots_);
+  _this->_impl_.updates_.MergeFrom(from._impl_.updates_);
+  _this->_impl_.members_.MergeFrom(from._impl_.members_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncResponse::CopyFrom(const SyncResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.SyncResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncResponse::IsInitialized() const {
+  return true;
+}
+
+void SyncResponse::InternalSwap(SyncResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.slots_.InternalSwap(&other->_impl_.slots_);
+  _impl_.updates_.InternalSwap(&other->_impl_.updates_);
+  _impl_.members_.InternalSwap(&other->_impl_.members_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
+      file_level_metadata_Gossip_2eproto[13]);
+}
+
+// ===================================================================
+
+class PingRequest::_Internal {
+ public:
+};
+
+PingRequest::PingRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.PingRequest)
+}
+PingRequest::PingRequest(const PingRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PingRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.members_){from._impl_.members_}
+    , decltype(_impl_.node_name_){}
+    , decltype(_impl_.target_){}
+    , decltype(_impl_.timeout_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node_name().empty()) {
+    _this->_impl_.node_name_.Set(from._internal_node_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.target_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_target().empty()) {
+    _this->_impl_.target_.Set(from._internal_target(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.timeout_ms_ = from._impl_.timeout_ms_;
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.PingRequest)
+}
+
+inline void PingRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.members_){arena}
+    , decltype(_impl_.node_name_){}
+    , decltype(_impl_.target_){}
+    , decltype(_impl_.timeout_ms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.target_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PingRequest::~PingRequest() {
+  // @@protoc_insertion_point(destructor:pf_gossip.PingRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PingRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.members_.~RepeatedPtrField();
+  _impl_.node_name_.Destroy();
+  _impl_.target_.Destroy();
+}
+
+void PingRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PingRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.PingRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.members_.Clear();
+  _impl_.node_name_.ClearToEmpty();
+  _impl_.target_.ClearToEmpty();
+  _impl_.timeout_ms_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PingRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string node_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_node_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.PingRequest.node_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string target = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_target();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.PingRequest.target"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timeout_ms = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_address();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.GossipNodeInfo.address"));
         } else
           goto handle_unusual;
         continue;
-      // repeated string pass_nodes = 4;
+      // repeated .pf_gossip.MemberUpdate members = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr -= 1;
           do {
             ptr += 1;
-            auto str = _internal_add_pass_nodes();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            ptr = ctx->ParseMessage(_internal_add_members(), ptr);
             CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.GossipNodeInfo.pass_nodes"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
         } else
@@ -1709,220 +4687,191 @@ failure:
 #undef CHK_
 }
 
-uint8_t* GossipNodeInfo::_InternalSerialize(
+uint8_t* PingRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.GossipNodeInfo)
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.PingRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (!this->_internal_name().empty()) {
+  // string node_name = 1;
+  if (!this->_internal_node_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      this->_internal_node_name().data(), static_cast<int>(this->_internal_node_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "pf_gossip.GossipNodeInfo.name");
+      "pf_gossip.PingRequest.node_name");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_name(), target);
-  }
-
-  // int64 version = 2;
-  if (this->_internal_version() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_version(), target);
+        1, this->_internal_node_name(), target);
   }
 
-  // string address = 3;
-  if (!this->_internal_address().empty()) {
+  // string target = 2;
+  if (!this->_internal_target().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_address().data(), static_cast<int>(this->_internal_address().length()),
+      this->_internal_target().data(), static_cast<int>(this->_internal_target().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "pf_gossip.GossipNodeInfo.address");
+      "pf_gossip.PingRequest.target");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_address(), target);
+        2, this->_internal_target(), target);
   }
 
-  // repeated string pass_nodes = 4;
-  for (int i = 0, n = this->_internal_pass_nodes_size(); i < n; i++) {
-    const auto& s = this->_internal_pass_nodes(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "pf_gossip.GossipNodeInfo.pass_nodes");
-    target = stream->WriteString(4, s, target);
+  // int64 timeout_ms = 3;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_timeout_ms(), target);
+  }
+
+  // repeated .pf_gossip.MemberUpdate members = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_members_size()); i < n; i++) {
+    const auto& repfield = this->_internal_members(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.GossipNodeInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.PingRequest)
   return target;
 }
 
-size_t GossipNodeInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:pf_gossip.GossipNodeInfo)
+size_t PingRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.PingRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated string pass_nodes = 4;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.pass_nodes_.size());
-  for (int i = 0, n = _impl_.pass_nodes_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      _impl_.pass_nodes_.Get(i));
+  // repeated .pf_gossip.MemberUpdate members = 4;
+  total_size += 1UL * this->_internal_members_size();
+  for (const auto& msg : this->_impl_.members_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // string name = 1;
-  if (!this->_internal_name().empty()) {
+  // string node_name = 1;
+  if (!this->_internal_node_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
+        this->_internal_node_name());
   }
 
-  // string address = 3;
-  if (!this->_internal_address().empty()) {
+  // string target = 2;
+  if (!this->_internal_target().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_address());
+        this->_internal_target());
   }
 
-  // int64 version = 2;
-  if (this->_internal_version() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_version());
+  // int64 timeout_ms = 3;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timeout_ms());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GossipNodeInfo::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PingRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GossipNodeInfo::MergeImpl
+    PingRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GossipNodeInfo::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PingRequest::GetClassData() const { return &_class_data_; }
 
 
-void GossipNodeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GossipNodeInfo*>(&to_msg);
-  auto& from = static_cast<const GossipNodeInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.GossipNodeInfo)
+void PingRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PingRequest*>(&to_msg);
+  auto& from = static_cast<const PingRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.PingRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.pass_nodes_.MergeFrom(from._impl_.pass_nodes_);
-  if (!from._internal_name().empty()) {
-    _this->_internal_set_name(from._internal_name());
+  _this->_impl_.members_.MergeFrom(from._impl_.members_);
+  if (!from._internal_node_name().empty()) {
+    _this->_internal_set_node_name(from._internal_node_name());
   }
-  if (!from._internal_address().empty()) {
-    _this->_internal_set_address(from._internal_address());
+  if (!from._internal_target().empty()) {
+    _this->_internal_set_target(from._internal_target());
   }
-  if (from._internal_version() != 0) {
-    _this->_internal_set_version(from._internal_version());
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GossipNodeInfo::CopyFrom(const GossipNodeInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.GossipNodeInfo)
+void PingRequest::CopyFrom(const PingRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.PingRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GossipNodeInfo::IsInitialized() const {
+bool PingRequest::IsInitialized() const {
   return true;
 }
 
-void GossipNodeInfo::InternalSwap(GossipNodeInfo* other) {
+void PingRequest::InternalSwap(PingRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.pass_nodes_.InternalSwap(&other->_impl_.pass_nodes_);
+  _impl_.members_.InternalSwap(&other->_impl_.members_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.name_, lhs_arena,
-      &other->_impl_.name_, rhs_arena
+      &_impl_.node_name_, lhs_arena,
+      &other->_impl_.node_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.address_, lhs_arena,
-      &other->_impl_.address_, rhs_arena
+      &_impl_.target_, lhs_arena,
+      &other->_impl_.target_, rhs_arena
   );
-  swap(_impl_.version_, other->_impl_.version_);
+  swap(_impl_.timeout_ms_, other->_impl_.timeout_ms_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GossipNodeInfo::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata PingRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
-      file_level_metadata_Gossip_2eproto[5]);
+      file_level_metadata_Gossip_2eproto[14]);
 }
 
 // ===================================================================
 
-class NodeVersions::_Internal {
+class PingResponse::_Internal {
  public:
 };
 
-NodeVersions::NodeVersions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+PingResponse::PingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:pf_gossip.NodeVersions)
+  // @@protoc_insertion_point(arena_constructor:pf_gossip.PingResponse)
 }
-NodeVersions::NodeVersions(const NodeVersions& from)
+PingResponse::PingResponse(const PingResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  NodeVersions* const _this = this; (void)_this;
+  PingResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.node_name_){}
-    , decltype(_impl_.slot_name_){}
-    , decltype(_impl_.slot_version_){}
+      decltype(_impl_.members_){from._impl_.members_}
+    , decltype(_impl_.ack_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.node_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.node_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_node_name().empty()) {
-    _this->_impl_.node_name_.Set(from._internal_node_name(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.slot_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.slot_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_slot_name().empty()) {
-    _this->_impl_.slot_name_.Set(from._internal_slot_name(), 
-      _this->GetArenaForAllocation());
-  }
-  _this->_impl_.slot_version_ = from._impl_.slot_version_;
-  // @@protoc_insertion_point(copy_constructor:pf_gossip.NodeVersions)
+  _this->_impl_.ack_ = from._impl_.ack_;
+  // @@protoc_insertion_point(copy_constructor:pf_gossip.PingResponse)
 }
 
-inline void NodeVersions::SharedCtor(
+inline void PingResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.node_name_){}
-    , decltype(_impl_.slot_name_){}
-    , decltype(_impl_.slot_version_){int64_t{0}}
+      decltype(_impl_.members_){arena}
+    , decltype(_impl_.ack_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.node_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.node_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.slot_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.slot_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-NodeVersions::~NodeVersions() {
-  // @@protoc_insertion_point(destructor:pf_gossip.NodeVersions)
+PingResponse::~PingResponse() {
+  // @@protoc_insertion_point(destructor:pf_gossip.PingResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1930,59 +4879,50 @@ NodeVersions::~NodeVersions() {
   SharedDtor();
 }
 
-inline void NodeVersions::SharedDtor() {
+inline void PingResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.node_name_.Destroy();
-  _impl_.slot_name_.Destroy();
+  _impl_.members_.~RepeatedPtrField();
 }
 
-void NodeVersions::SetCachedSize(int size) const {
+void PingResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void NodeVersions::Clear() {
-// @@protoc_insertion_point(message_clear_start:pf_gossip.NodeVersions)
+void PingResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip.PingResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.node_name_.ClearToEmpty();
-  _impl_.slot_name_.ClearToEmpty();
-  _impl_.slot_version_ = int64_t{0};
+  _impl_.members_.Clear();
+  _impl_.ack_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NodeVersions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* PingResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string node_name = 1;
+      // bool ack = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_node_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.NodeVersions.node_name"));
         } else
           goto handle_unusual;
         continue;
-      // string slot_name = 2;
+      // repeated .pf_gossip.MemberUpdate members = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_slot_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip.NodeVersions.slot_name"));
-        } else
-          goto handle_unusual;
-        continue;
-      // int64 slot_version = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.slot_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_members(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -2009,134 +4949,101 @@ failure:
 #undef CHK_
 }
 
-uint8_t* NodeVersions::_InternalSerialize(
+uint8_t* PingResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.NodeVersions)
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip.PingResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string node_name = 1;
-  if (!this->_internal_node_name().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_node_name().data(), static_cast<int>(this->_internal_node_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "pf_gossip.NodeVersions.node_name");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_node_name(), target);
-  }
-
-  // string slot_name = 2;
-  if (!this->_internal_slot_name().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_slot_name().data(), static_cast<int>(this->_internal_slot_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "pf_gossip.NodeVersions.slot_name");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_slot_name(), target);
+  // bool ack = 1;
+  if (this->_internal_ack() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_ack(), target);
   }
 
-  // int64 slot_version = 3;
-  if (this->_internal_slot_version() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_slot_version(), target);
+  // repeated .pf_gossip.MemberUpdate members = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_members_size()); i < n; i++) {
+    const auto& repfield = this->_internal_members(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.NodeVersions)
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip.PingResponse)
   return target;
 }
 
-size_t NodeVersions::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:pf_gossip.NodeVersions)
+size_t PingResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip.PingResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string node_name = 1;
-  if (!this->_internal_node_name().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_node_name());
-  }
-
-  // string slot_name = 2;
-  if (!this->_internal_slot_name().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_slot_name());
+  // repeated .pf_gossip.MemberUpdate members = 2;
+  total_size += 1UL * this->_internal_members_size();
+  for (const auto& msg : this->_impl_.members_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // int64 slot_version = 3;
-  if (this->_internal_slot_version() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_slot_version());
+  // bool ack = 1;
+  if (this->_internal_ack() != 0) {
+    total_size += 1 + 1;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeVersions::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PingResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    NodeVersions::MergeImpl
+    PingResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeVersions::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PingResponse::GetClassData() const { return &_class_data_; }
 
 
-void NodeVersions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<NodeVersions*>(&to_msg);
-  auto& from = static_cast<const NodeVersions&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.NodeVersions)
+void PingResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PingResponse*>(&to_msg);
+  auto& from = static_cast<const PingResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip.PingResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_node_name().empty()) {
-    _this->_internal_set_node_name(from._internal_node_name());
-  }
-  if (!from._internal_slot_name().empty()) {
-    _this->_internal_set_slot_name(from._internal_slot_name());
-  }
-  if (from._internal_slot_version() != 0) {
-    _this->_internal_set_slot_version(from._internal_slot_version());
+  _this->_impl_.members_.MergeFrom(from._impl_.members_);
+  if (from._internal_ack() != 0) {
+    _this->_internal_set_ack(from._internal_ack());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void NodeVersions::CopyFrom(const NodeVersions& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.NodeVersions)
+void PingResponse::CopyFrom(const PingResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip.PingResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool NodeVersions::IsInitialized() const {
+bool PingResponse::IsInitialized() const {
   return true;
 }
 
-void NodeVersions::InternalSwap(NodeVersions* other) {
+void PingResponse::InternalSwap(PingResponse* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.node_name_, lhs_arena,
-      &other->_impl_.node_name_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.slot_name_, lhs_arena,
-      &other->_impl_.slot_name_, rhs_arena
-  );
-  swap(_impl_.slot_version_, other->_impl_.slot_version_);
+  _impl_.members_.InternalSwap(&other->_impl_.members_);
+  swap(_impl_.ack_, other->_impl_.ack_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata NodeVersions::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata PingResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Gossip_2eproto_getter, &descriptor_table_Gossip_2eproto_once,
-      file_level_metadata_Gossip_2eproto[6]);
+      file_level_metadata_Gossip_2eproto[15]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -2162,14 +5069,50 @@ template<> PROTOBUF_NOINLINE ::pf_gossip::SlotUpdate*
 Arena::CreateMaybeMessage< ::pf_gossip::SlotUpdate >(Arena* arena) {
   return Arena::CreateMessageInternal< ::pf_gossip::SlotUpdate >(arena);
 }
+template<> PROTOBUF_NOINLINE ::pf_gossip::MerkleNode*
+Arena::CreateMaybeMessage< ::pf_gossip::MerkleNode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip::MerkleNode >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip::DigestRequest*
+Arena::CreateMaybeMessage< ::pf_gossip::DigestRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip::DigestRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip::DigestResponse*
+Arena::CreateMaybeMessage< ::pf_gossip::DigestResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip::DigestResponse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::pf_gossip::GossipNodeInfo*
 Arena::CreateMaybeMessage< ::pf_gossip::GossipNodeInfo >(Arena* arena) {
   return Arena::CreateMessageInternal< ::pf_gossip::GossipNodeInfo >(arena);
 }
+template<> PROTOBUF_NOINLINE ::pf_gossip::SlotVersionEntry*
+Arena::CreateMaybeMessage< ::pf_gossip::SlotVersionEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip::SlotVersionEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip::MemberUpdate*
+Arena::CreateMaybeMessage< ::pf_gossip::MemberUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip::MemberUpdate >(arena);
+}
 template<> PROTOBUF_NOINLINE ::pf_gossip::NodeVersions*
 Arena::CreateMaybeMessage< ::pf_gossip::NodeVersions >(Arena* arena) {
   return Arena::CreateMessageInternal< ::pf_gossip::NodeVersions >(arena);
 }
+template<> PROTOBUF_NOINLINE ::pf_gossip::SyncRequest*
+Arena::CreateMaybeMessage< ::pf_gossip::SyncRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip::SyncRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip::SyncResponse*
+Arena::CreateMaybeMessage< ::pf_gossip::SyncResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip::SyncResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip::PingRequest*
+Arena::CreateMaybeMessage< ::pf_gossip::PingRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip::PingRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip::PingResponse*
+Arena::CreateMaybeMessage< ::pf_gossip::PingResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip::PingResponse >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021005 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -29,6 +29,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -45,15 +46,33 @@ struct TableStruct_Gossip_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Gossip_2eproto;
 namespace pf_gossip {
+class DigestRequest;
+struct DigestRequestDefaultTypeInternal;
+extern DigestRequestDefaultTypeInternal _DigestRequest_default_instance_;
+class DigestResponse;
+struct DigestResponseDefaultTypeInternal;
+extern DigestResponseDefaultTypeInternal _DigestResponse_default_instance_;
 class GossipNodeInfo;
 struct GossipNodeInfoDefaultTypeInternal;
 extern GossipNodeInfoDefaultTypeInternal _GossipNodeInfo_default_instance_;
+class MemberUpdate;
+struct MemberUpdateDefaultTypeInternal;
+extern MemberUpdateDefaultTypeInternal _MemberUpdate_default_instance_;
+class MerkleNode;
+struct MerkleNodeDefaultTypeInternal;
+extern MerkleNodeDefaultTypeInternal _MerkleNode_default_instance_;
 class Message;
 struct MessageDefaultTypeInternal;
 extern MessageDefaultTypeInternal _Message_default_instance_;
 class NodeVersions;
 struct NodeVersionsDefaultTypeInternal;
 extern NodeVersionsDefaultTypeInternal _NodeVersions_default_instance_;
+class PingRequest;
+struct PingRequestDefaultTypeInternal;
+extern PingRequestDefaultTypeInternal _PingRequest_default_instance_;
+class PingResponse;
+struct PingResponseDefaultTypeInternal;
+extern PingResponseDefaultTypeInternal _PingResponse_default_instance_;
 class SearchResult;
 struct SearchResultDefaultTypeInternal;
 extern SearchResultDefaultTypeInternal _SearchResult_default_instance_;
@@ -63,21 +82,65 @@ extern SearchResult_MessageDefaultTypeInternal _SearchResult_Message_default_ins
 class SlotUpdate;
 struct SlotUpdateDefaultTypeInternal;
 extern SlotUpdateDefaultTypeInternal _SlotUpdate_default_instance_;
+class SlotVersionEntry;
+struct SlotVersionEntryDefaultTypeInternal;
+extern SlotVersionEntryDefaultTypeInternal _SlotVersionEntry_default_instance_;
+class SyncRequest;
+struct SyncRequestDefaultTypeInternal;
+extern SyncRequestDefaultTypeInternal _SyncRequest_default_instance_;
+class SyncResponse;
+struct SyncResponseDefaultTypeInternal;
+extern SyncResponseDefaultTypeInternal _SyncResponse_default_instance_;
 class updateResult;
 struct updateResultDefaultTypeInternal;
 extern updateResultDefaultTypeInternal _updateResult_default_instance_;
 }  // namespace pf_gossip
 PROTOBUF_NAMESPACE_OPEN
+template<> ::pf_gossip::DigestRequest* Arena::CreateMaybeMessage<::pf_gossip::DigestRequest>(Arena*);
+template<> ::pf_gossip::DigestResponse* Arena::CreateMaybeMessage<::pf_gossip::DigestResponse>(Arena*);
 template<> ::pf_gossip::GossipNodeInfo* Arena::CreateMaybeMessage<::pf_gossip::GossipNodeInfo>(Arena*);
+template<> ::pf_gossip::MemberUpdate* Arena::CreateMaybeMessage<::pf_gossip::MemberUpdate>(Arena*);
+template<> ::pf_gossip::MerkleNode* Arena::CreateMaybeMessage<::pf_gossip::MerkleNode>(Arena*);
 template<> ::pf_gossip::Message* Arena::CreateMaybeMessage<::pf_gossip::Message>(Arena*);
 template<> ::pf_gossip::NodeVersions* Arena::CreateMaybeMessage<::pf_gossip::NodeVersions>(Arena*);
+template<> ::pf_gossip::PingRequest* Arena::CreateMaybeMessage<::pf_gossip::PingRequest>(Arena*);
+template<> ::pf_gossip::PingResponse* Arena::CreateMaybeMessage<::pf_gossip::PingResponse>(Arena*);
 template<> ::pf_gossip::SearchResult* Arena::CreateMaybeMessage<::pf_gossip::SearchResult>(Arena*);
 template<> ::pf_gossip::SearchResult_Message* Arena::CreateMaybeMessage<::pf_gossip::SearchResult_Message>(Arena*);
 template<> ::pf_gossip::SlotUpdate* Arena::CreateMaybeMessage<::pf_gossip::SlotUpdate>(Arena*);
+template<> ::pf_gossip::SlotVersionEntry* Arena::CreateMaybeMessage<::pf_gossip::SlotVersionEntry>(Arena*);
+template<> ::pf_gossip::SyncRequest* Arena::CreateMaybeMessage<::pf_gossip::SyncRequest>(Arena*);
+template<> ::pf_gossip::SyncResponse* Arena::CreateMaybeMessage<::pf_gossip::SyncResponse>(Arena*);
 template<> ::pf_gossip::updateResult* Arena::CreateMaybeMessage<::pf_gossip::updateResult>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace pf_gossip {
 
+enum MemberState : int {
+  ALIVE = 0,
+  SUSPECT = 1,
+  DEAD = 2,
+  MemberState_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MemberState_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool MemberState_IsValid(int value);
+constexpr MemberState MemberState_MIN = ALIVE;
+constexpr MemberState MemberState_MAX = DEAD;
+constexpr int MemberState_ARRAYSIZE = MemberState_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MemberState_descriptor();
+template<typename T>
+inline const std::string& MemberState_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MemberState>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MemberState_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MemberState_descriptor(), enum_t_value);
+}
+inline bool MemberState_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MemberState* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MemberState>(
+    MemberState_descriptor(), name, value);
+}
 // ===================================================================
 
 class Message final :
@@ -203,6 +266,9 @@ class Message final :
   enum : int {
     kKeyFieldNumber = 1,
     kValueFieldNumber = 2,
+    kVersionFieldNumber = 3,
+    kTtlMsFieldNumber = 5,
+    kDeletedFieldNumber = 4,
   };
   // string key = 1;
   void clear_key();
@@ -232,6 +298,33 @@ class Message final :
   std::string* _internal_mutable_value();
   public:
 
+  // int64 version = 3;
+  void clear_version();
+  int64_t version() const;
+  void set_version(int64_t value);
+  private:
+  int64_t _internal_version() const;
+  void _internal_set_version(int64_t value);
+  public:
+
+  // int64 ttl_ms = 5;
+  void clear_ttl_ms();
+  int64_t ttl_ms() const;
+  void set_ttl_ms(int64_t value);
+  private:
+  int64_t _internal_ttl_ms() const;
+  void _internal_set_ttl_ms(int64_t value);
+  public:
+
+  // bool deleted = 4;
+  void clear_deleted();
+  bool deleted() const;
+  void set_deleted(bool value);
+  private:
+  bool _internal_deleted() const;
+  void _internal_set_deleted(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:pf_gossip.Message)
  private:
   class _Internal;
@@ -242,6 +335,9 @@ class Message final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int64_t version_;
+    int64_t ttl_ms_;
+    bool deleted_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -886,8 +982,11 @@ class SlotUpdate final :
   enum : int {
     kMessagesFieldNumber = 3,
     kPassNodesFieldNumber = 4,
+    kLeavesFieldNumber = 7,
     kNameFieldNumber = 1,
     kVersionFieldNumber = 2,
+    kBaseVersionFieldNumber = 6,
+    kDeltaFieldNumber = 5,
   };
   // repeated .pf_gossip.Message messages = 3;
   int messages_size() const;
@@ -931,6 +1030,28 @@ class SlotUpdate final :
   std::string* _internal_add_pass_nodes();
   public:
 
+  // repeated int32 leaves = 7;
+  int leaves_size() const;
+  private:
+  int _internal_leaves_size() const;
+  public:
+  void clear_leaves();
+  private:
+  int32_t _internal_leaves(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_leaves() const;
+  void _internal_add_leaves(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_leaves();
+  public:
+  int32_t leaves(int index) const;
+  void set_leaves(int index, int32_t value);
+  void add_leaves(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      leaves() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_leaves();
+
   // string name = 1;
   void clear_name();
   const std::string& name() const;
@@ -954,6 +1075,24 @@ class SlotUpdate final :
   void _internal_set_version(int64_t value);
   public:
 
+  // int64 base_version = 6;
+  void clear_base_version();
+  int64_t base_version() const;
+  void set_base_version(int64_t value);
+  private:
+  int64_t _internal_base_version() const;
+  void _internal_set_base_version(int64_t value);
+  public:
+
+  // bool delta = 5;
+  void clear_delta();
+  bool delta() const;
+  void set_delta(bool value);
+  private:
+  bool _internal_delta() const;
+  void _internal_set_delta(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:pf_gossip.SlotUpdate)
  private:
   class _Internal;
@@ -964,8 +1103,12 @@ class SlotUpdate final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::Message > messages_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> pass_nodes_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > leaves_;
+    mutable std::atomic<int> _leaves_cached_byte_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     int64_t version_;
+    int64_t base_version_;
+    bool delta_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -973,24 +1116,24 @@ class SlotUpdate final :
 };
 // -------------------------------------------------------------------
 
-class GossipNodeInfo final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.GossipNodeInfo) */ {
+class MerkleNode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.MerkleNode) */ {
  public:
-  inline GossipNodeInfo() : GossipNodeInfo(nullptr) {}
-  ~GossipNodeInfo() override;
-  explicit PROTOBUF_CONSTEXPR GossipNodeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline MerkleNode() : MerkleNode(nullptr) {}
+  ~MerkleNode() override;
+  explicit PROTOBUF_CONSTEXPR MerkleNode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GossipNodeInfo(const GossipNodeInfo& from);
-  GossipNodeInfo(GossipNodeInfo&& from) noexcept
-    : GossipNodeInfo() {
+  MerkleNode(const MerkleNode& from);
+  MerkleNode(MerkleNode&& from) noexcept
+    : MerkleNode() {
     *this = ::std::move(from);
   }
 
-  inline GossipNodeInfo& operator=(const GossipNodeInfo& from) {
+  inline MerkleNode& operator=(const MerkleNode& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GossipNodeInfo& operator=(GossipNodeInfo&& from) noexcept {
+  inline MerkleNode& operator=(MerkleNode&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1013,20 +1156,20 @@ class GossipNodeInfo final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const GossipNodeInfo& default_instance() {
+  static const MerkleNode& default_instance() {
     return *internal_default_instance();
   }
-  static inline const GossipNodeInfo* internal_default_instance() {
-    return reinterpret_cast<const GossipNodeInfo*>(
-               &_GossipNodeInfo_default_instance_);
+  static inline const MerkleNode* internal_default_instance() {
+    return reinterpret_cast<const MerkleNode*>(
+               &_MerkleNode_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(GossipNodeInfo& a, GossipNodeInfo& b) {
+  friend void swap(MerkleNode& a, MerkleNode& b) {
     a.Swap(&b);
   }
-  inline void Swap(GossipNodeInfo* other) {
+  inline void Swap(MerkleNode* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1039,7 +1182,7 @@ class GossipNodeInfo final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GossipNodeInfo* other) {
+  void UnsafeArenaSwap(MerkleNode* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1047,14 +1190,14 @@ class GossipNodeInfo final :
 
   // implements Message ----------------------------------------------
 
-  GossipNodeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<GossipNodeInfo>(arena);
+  MerkleNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MerkleNode>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const GossipNodeInfo& from);
+  void CopyFrom(const MerkleNode& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const GossipNodeInfo& from) {
-    GossipNodeInfo::MergeImpl(*this, from);
+  void MergeFrom( const MerkleNode& from) {
+    MerkleNode::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1072,15 +1215,15 @@ class GossipNodeInfo final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GossipNodeInfo* other);
+  void InternalSwap(MerkleNode* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "pf_gossip.GossipNodeInfo";
+    return "pf_gossip.MerkleNode";
   }
   protected:
-  explicit GossipNodeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit MerkleNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1094,34 +1237,186 @@ class GossipNodeInfo final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPassNodesFieldNumber = 4,
+    kHashFieldNumber = 2,
+    kIndexFieldNumber = 1,
+  };
+  // uint64 hash = 2;
+  void clear_hash();
+  uint64_t hash() const;
+  void set_hash(uint64_t value);
+  private:
+  uint64_t _internal_hash() const;
+  void _internal_set_hash(uint64_t value);
+  public:
+
+  // int32 index = 1;
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
+  private:
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip.MerkleNode)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t hash_;
+    int32_t index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Gossip_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DigestRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.DigestRequest) */ {
+ public:
+  inline DigestRequest() : DigestRequest(nullptr) {}
+  ~DigestRequest() override;
+  explicit PROTOBUF_CONSTEXPR DigestRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DigestRequest(const DigestRequest& from);
+  DigestRequest(DigestRequest&& from) noexcept
+    : DigestRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DigestRequest& operator=(const DigestRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DigestRequest& operator=(DigestRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DigestRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DigestRequest* internal_default_instance() {
+    return reinterpret_cast<const DigestRequest*>(
+               &_DigestRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(DigestRequest& a, DigestRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DigestRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DigestRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DigestRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DigestRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DigestRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DigestRequest& from) {
+    DigestRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DigestRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip.DigestRequest";
+  }
+  protected:
+  explicit DigestRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodesFieldNumber = 3,
     kNameFieldNumber = 1,
-    kAddressFieldNumber = 3,
     kVersionFieldNumber = 2,
   };
-  // repeated string pass_nodes = 4;
-  int pass_nodes_size() const;
+  // repeated .pf_gossip.MerkleNode nodes = 3;
+  int nodes_size() const;
   private:
-  int _internal_pass_nodes_size() const;
+  int _internal_nodes_size() const;
   public:
-  void clear_pass_nodes();
-  const std::string& pass_nodes(int index) const;
-  std::string* mutable_pass_nodes(int index);
-  void set_pass_nodes(int index, const std::string& value);
-  void set_pass_nodes(int index, std::string&& value);
-  void set_pass_nodes(int index, const char* value);
-  void set_pass_nodes(int index, const char* value, size_t size);
-  std::string* add_pass_nodes();
-  void add_pass_nodes(const std::string& value);
-  void add_pass_nodes(std::string&& value);
-  void add_pass_nodes(const char* value);
-  void add_pass_nodes(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& pass_nodes() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_pass_nodes();
+  void clear_nodes();
+  ::pf_gossip::MerkleNode* mutable_nodes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MerkleNode >*
+      mutable_nodes();
   private:
-  const std::string& _internal_pass_nodes(int index) const;
-  std::string* _internal_add_pass_nodes();
+  const ::pf_gossip::MerkleNode& _internal_nodes(int index) const;
+  ::pf_gossip::MerkleNode* _internal_add_nodes();
   public:
+  const ::pf_gossip::MerkleNode& nodes(int index) const;
+  ::pf_gossip::MerkleNode* add_nodes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MerkleNode >&
+      nodes() const;
 
   // string name = 1;
   void clear_name();
@@ -1137,20 +1432,6 @@ class GossipNodeInfo final :
   std::string* _internal_mutable_name();
   public:
 
-  // string address = 3;
-  void clear_address();
-  const std::string& address() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_address(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_address();
-  PROTOBUF_NODISCARD std::string* release_address();
-  void set_allocated_address(std::string* address);
-  private:
-  const std::string& _internal_address() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_address(const std::string& value);
-  std::string* _internal_mutable_address();
-  public:
-
   // int64 version = 2;
   void clear_version();
   int64_t version() const;
@@ -1160,7 +1441,7 @@ class GossipNodeInfo final :
   void _internal_set_version(int64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:pf_gossip.GossipNodeInfo)
+  // @@protoc_insertion_point(class_scope:pf_gossip.DigestRequest)
  private:
   class _Internal;
 
@@ -1168,9 +1449,8 @@ class GossipNodeInfo final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> pass_nodes_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MerkleNode > nodes_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr address_;
     int64_t version_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -1179,24 +1459,24 @@ class GossipNodeInfo final :
 };
 // -------------------------------------------------------------------
 
-class NodeVersions final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.NodeVersions) */ {
+class DigestResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.DigestResponse) */ {
  public:
-  inline NodeVersions() : NodeVersions(nullptr) {}
-  ~NodeVersions() override;
-  explicit PROTOBUF_CONSTEXPR NodeVersions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline DigestResponse() : DigestResponse(nullptr) {}
+  ~DigestResponse() override;
+  explicit PROTOBUF_CONSTEXPR DigestResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  NodeVersions(const NodeVersions& from);
-  NodeVersions(NodeVersions&& from) noexcept
-    : NodeVersions() {
+  DigestResponse(const DigestResponse& from);
+  DigestResponse(DigestResponse&& from) noexcept
+    : DigestResponse() {
     *this = ::std::move(from);
   }
 
-  inline NodeVersions& operator=(const NodeVersions& from) {
+  inline DigestResponse& operator=(const DigestResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline NodeVersions& operator=(NodeVersions&& from) noexcept {
+  inline DigestResponse& operator=(DigestResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1219,20 +1499,20 @@ class NodeVersions final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const NodeVersions& default_instance() {
+  static const DigestResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const NodeVersions* internal_default_instance() {
-    return reinterpret_cast<const NodeVersions*>(
-               &_NodeVersions_default_instance_);
+  static inline const DigestResponse* internal_default_instance() {
+    return reinterpret_cast<const DigestResponse*>(
+               &_DigestResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
-  friend void swap(NodeVersions& a, NodeVersions& b) {
+  friend void swap(DigestResponse& a, DigestResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(NodeVersions* other) {
+  inline void Swap(DigestResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1245,7 +1525,7 @@ class NodeVersions final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(NodeVersions* other) {
+  void UnsafeArenaSwap(DigestResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1253,14 +1533,14 @@ class NodeVersions final :
 
   // implements Message ----------------------------------------------
 
-  NodeVersions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<NodeVersions>(arena);
+  DigestResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DigestResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const NodeVersions& from);
+  void CopyFrom(const DigestResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const NodeVersions& from) {
-    NodeVersions::MergeImpl(*this, from);
+  void MergeFrom( const DigestResponse& from) {
+    DigestResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1278,15 +1558,15 @@ class NodeVersions final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(NodeVersions* other);
+  void InternalSwap(DigestResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "pf_gossip.NodeVersions";
+    return "pf_gossip.DigestResponse";
   }
   protected:
-  explicit NodeVersions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit DigestResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1300,48 +1580,246 @@ class NodeVersions final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kNodeNameFieldNumber = 1,
-    kSlotNameFieldNumber = 2,
-    kSlotVersionFieldNumber = 3,
+    kDiffersFieldNumber = 2,
+    kVersionFieldNumber = 1,
   };
-  // string node_name = 1;
-  void clear_node_name();
-  const std::string& node_name() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_node_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_node_name();
-  PROTOBUF_NODISCARD std::string* release_node_name();
-  void set_allocated_node_name(std::string* node_name);
+  // repeated int32 differs = 2;
+  int differs_size() const;
   private:
-  const std::string& _internal_node_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_name(const std::string& value);
-  std::string* _internal_mutable_node_name();
+  int _internal_differs_size() const;
   public:
-
-  // string slot_name = 2;
-  void clear_slot_name();
-  const std::string& slot_name() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_slot_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_slot_name();
-  PROTOBUF_NODISCARD std::string* release_slot_name();
-  void set_allocated_slot_name(std::string* slot_name);
+  void clear_differs();
   private:
-  const std::string& _internal_slot_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_slot_name(const std::string& value);
-  std::string* _internal_mutable_slot_name();
+  int32_t _internal_differs(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_differs() const;
+  void _internal_add_differs(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_differs();
+  public:
+  int32_t differs(int index) const;
+  void set_differs(int index, int32_t value);
+  void add_differs(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      differs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_differs();
+
+  // int64 version = 1;
+  void clear_version();
+  int64_t version() const;
+  void set_version(int64_t value);
+  private:
+  int64_t _internal_version() const;
+  void _internal_set_version(int64_t value);
   public:
 
-  // int64 slot_version = 3;
-  void clear_slot_version();
-  int64_t slot_version() const;
-  void set_slot_version(int64_t value);
+  // @@protoc_insertion_point(class_scope:pf_gossip.DigestResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > differs_;
+    mutable std::atomic<int> _differs_cached_byte_size_;
+    int64_t version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Gossip_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GossipNodeInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.GossipNodeInfo) */ {
+ public:
+  inline GossipNodeInfo() : GossipNodeInfo(nullptr) {}
+  ~GossipNodeInfo() override;
+  explicit PROTOBUF_CONSTEXPR GossipNodeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GossipNodeInfo(const GossipNodeInfo& from);
+  GossipNodeInfo(GossipNodeInfo&& from) noexcept
+    : GossipNodeInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline GossipNodeInfo& operator=(const GossipNodeInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GossipNodeInfo& operator=(GossipNodeInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GossipNodeInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GossipNodeInfo* internal_default_instance() {
+    return reinterpret_cast<const GossipNodeInfo*>(
+               &_GossipNodeInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(GossipNodeInfo& a, GossipNodeInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GossipNodeInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GossipNodeInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GossipNodeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GossipNodeInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GossipNodeInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GossipNodeInfo& from) {
+    GossipNodeInfo::MergeImpl(*this, from);
+  }
   private:
-  int64_t _internal_slot_version() const;
-  void _internal_set_slot_version(int64_t value);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  // @@protoc_insertion_point(class_scope:pf_gossip.NodeVersions)
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GossipNodeInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip.GossipNodeInfo";
+  }
+  protected:
+  explicit GossipNodeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPassNodesFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kAddressFieldNumber = 3,
+    kVersionFieldNumber = 2,
+  };
+  // repeated string pass_nodes = 4;
+  int pass_nodes_size() const;
+  private:
+  int _internal_pass_nodes_size() const;
+  public:
+  void clear_pass_nodes();
+  const std::string& pass_nodes(int index) const;
+  std::string* mutable_pass_nodes(int index);
+  void set_pass_nodes(int index, const std::string& value);
+  void set_pass_nodes(int index, std::string&& value);
+  void set_pass_nodes(int index, const char* value);
+  void set_pass_nodes(int index, const char* value, size_t size);
+  std::string* add_pass_nodes();
+  void add_pass_nodes(const std::string& value);
+  void add_pass_nodes(std::string&& value);
+  void add_pass_nodes(const char* value);
+  void add_pass_nodes(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& pass_nodes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_pass_nodes();
+  private:
+  const std::string& _internal_pass_nodes(int index) const;
+  std::string* _internal_add_pass_nodes();
+  public:
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string address = 3;
+  void clear_address();
+  const std::string& address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_address();
+  PROTOBUF_NODISCARD std::string* release_address();
+  void set_allocated_address(std::string* address);
+  private:
+  const std::string& _internal_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_address(const std::string& value);
+  std::string* _internal_mutable_address();
+  public:
+
+  // int64 version = 2;
+  void clear_version();
+  int64_t version() const;
+  void set_version(int64_t value);
+  private:
+  int64_t _internal_version() const;
+  void _internal_set_version(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip.GossipNodeInfo)
  private:
   class _Internal;
 
@@ -1349,815 +1827,3378 @@ class NodeVersions final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_name_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr slot_name_;
-    int64_t slot_version_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> pass_nodes_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr address_;
+    int64_t version_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_Gossip_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class SlotVersionEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.SlotVersionEntry) */ {
+ public:
+  inline SlotVersionEntry() : SlotVersionEntry(nullptr) {}
+  ~SlotVersionEntry() override;
+  explicit PROTOBUF_CONSTEXPR SlotVersionEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  SlotVersionEntry(const SlotVersionEntry& from);
+  SlotVersionEntry(SlotVersionEntry&& from) noexcept
+    : SlotVersionEntry() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Message
+  inline SlotVersionEntry& operator=(const SlotVersionEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SlotVersionEntry& operator=(SlotVersionEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string key = 1;
-inline void Message::clear_key() {
-  _impl_.key_.ClearToEmpty();
-}
-inline const std::string& Message::key() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.Message.key)
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SlotVersionEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SlotVersionEntry* internal_default_instance() {
+    return reinterpret_cast<const SlotVersionEntry*>(
+               &_SlotVersionEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(SlotVersionEntry& a, SlotVersionEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SlotVersionEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SlotVersionEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SlotVersionEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SlotVersionEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SlotVersionEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SlotVersionEntry& from) {
+    SlotVersionEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SlotVersionEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip.SlotVersionEntry";
+  }
+  protected:
+  explicit SlotVersionEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kVersionFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // int64 version = 2;
+  void clear_version();
+  int64_t version() const;
+  void set_version(int64_t value);
+  private:
+  int64_t _internal_version() const;
+  void _internal_set_version(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip.SlotVersionEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int64_t version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Gossip_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MemberUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.MemberUpdate) */ {
+ public:
+  inline MemberUpdate() : MemberUpdate(nullptr) {}
+  ~MemberUpdate() override;
+  explicit PROTOBUF_CONSTEXPR MemberUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MemberUpdate(const MemberUpdate& from);
+  MemberUpdate(MemberUpdate&& from) noexcept
+    : MemberUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline MemberUpdate& operator=(const MemberUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MemberUpdate& operator=(MemberUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MemberUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MemberUpdate* internal_default_instance() {
+    return reinterpret_cast<const MemberUpdate*>(
+               &_MemberUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(MemberUpdate& a, MemberUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MemberUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MemberUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MemberUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MemberUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MemberUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MemberUpdate& from) {
+    MemberUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MemberUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip.MemberUpdate";
+  }
+  protected:
+  explicit MemberUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kAddressFieldNumber = 2,
+    kIncarnationFieldNumber = 4,
+    kStateFieldNumber = 3,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string address = 2;
+  void clear_address();
+  const std::string& address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_address();
+  PROTOBUF_NODISCARD std::string* release_address();
+  void set_allocated_address(std::string* address);
+  private:
+  const std::string& _internal_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_address(const std::string& value);
+  std::string* _internal_mutable_address();
+  public:
+
+  // int64 incarnation = 4;
+  void clear_incarnation();
+  int64_t incarnation() const;
+  void set_incarnation(int64_t value);
+  private:
+  int64_t _internal_incarnation() const;
+  void _internal_set_incarnation(int64_t value);
+  public:
+
+  // .pf_gossip.MemberState state = 3;
+  void clear_state();
+  ::pf_gossip::MemberState state() const;
+  void set_state(::pf_gossip::MemberState value);
+  private:
+  ::pf_gossip::MemberState _internal_state() const;
+  void _internal_set_state(::pf_gossip::MemberState value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip.MemberUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr address_;
+    int64_t incarnation_;
+    int state_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Gossip_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NodeVersions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.NodeVersions) */ {
+ public:
+  inline NodeVersions() : NodeVersions(nullptr) {}
+  ~NodeVersions() override;
+  explicit PROTOBUF_CONSTEXPR NodeVersions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NodeVersions(const NodeVersions& from);
+  NodeVersions(NodeVersions&& from) noexcept
+    : NodeVersions() {
+    *this = ::std::move(from);
+  }
+
+  inline NodeVersions& operator=(const NodeVersions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NodeVersions& operator=(NodeVersions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NodeVersions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NodeVersions* internal_default_instance() {
+    return reinterpret_cast<const NodeVersions*>(
+               &_NodeVersions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(NodeVersions& a, NodeVersions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NodeVersions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NodeVersions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NodeVersions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NodeVersions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NodeVersions& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NodeVersions& from) {
+    NodeVersions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NodeVersions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip.NodeVersions";
+  }
+  protected:
+  explicit NodeVersions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotsFieldNumber = 4,
+    kMembersFieldNumber = 5,
+    kNodeNameFieldNumber = 1,
+    kSlotNameFieldNumber = 2,
+    kSlotVersionFieldNumber = 3,
+    kFullSlotsFieldNumber = 6,
+  };
+  // repeated .pf_gossip.SlotVersionEntry slots = 4;
+  int slots_size() const;
+  private:
+  int _internal_slots_size() const;
+  public:
+  void clear_slots();
+  ::pf_gossip::SlotVersionEntry* mutable_slots(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >*
+      mutable_slots();
+  private:
+  const ::pf_gossip::SlotVersionEntry& _internal_slots(int index) const;
+  ::pf_gossip::SlotVersionEntry* _internal_add_slots();
+  public:
+  const ::pf_gossip::SlotVersionEntry& slots(int index) const;
+  ::pf_gossip::SlotVersionEntry* add_slots();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >&
+      slots() const;
+
+  // repeated .pf_gossip.MemberUpdate members = 5;
+  int members_size() const;
+  private:
+  int _internal_members_size() const;
+  public:
+  void clear_members();
+  ::pf_gossip::MemberUpdate* mutable_members(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+      mutable_members();
+  private:
+  const ::pf_gossip::MemberUpdate& _internal_members(int index) const;
+  ::pf_gossip::MemberUpdate* _internal_add_members();
+  public:
+  const ::pf_gossip::MemberUpdate& members(int index) const;
+  ::pf_gossip::MemberUpdate* add_members();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+      members() const;
+
+  // string node_name = 1;
+  void clear_node_name();
+  const std::string& node_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_name();
+  PROTOBUF_NODISCARD std::string* release_node_name();
+  void set_allocated_node_name(std::string* node_name);
+  private:
+  const std::string& _internal_node_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_name(const std::string& value);
+  std::string* _internal_mutable_node_name();
+  public:
+
+  // string slot_name = 2;
+  void clear_slot_name();
+  const std::string& slot_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_slot_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_slot_name();
+  PROTOBUF_NODISCARD std::string* release_slot_name();
+  void set_allocated_slot_name(std::string* slot_name);
+  private:
+  const std::string& _internal_slot_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_slot_name(const std::string& value);
+  std::string* _internal_mutable_slot_name();
+  public:
+
+  // int64 slot_version = 3;
+  void clear_slot_version();
+  int64_t slot_version() const;
+  void set_slot_version(int64_t value);
+  private:
+  int64_t _internal_slot_version() const;
+  void _internal_set_slot_version(int64_t value);
+  public:
+
+  // bool full_slots = 6;
+  void clear_full_slots();
+  bool full_slots() const;
+  void set_full_slots(bool value);
+  private:
+  bool _internal_full_slots() const;
+  void _internal_set_full_slots(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip.NodeVersions)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry > slots_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate > members_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr slot_name_;
+    int64_t slot_version_;
+    bool full_slots_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Gossip_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.SyncRequest) */ {
+ public:
+  inline SyncRequest() : SyncRequest(nullptr) {}
+  ~SyncRequest() override;
+  explicit PROTOBUF_CONSTEXPR SyncRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncRequest(const SyncRequest& from);
+  SyncRequest(SyncRequest&& from) noexcept
+    : SyncRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncRequest& operator=(const SyncRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncRequest& operator=(SyncRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncRequest* internal_default_instance() {
+    return reinterpret_cast<const SyncRequest*>(
+               &_SyncRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(SyncRequest& a, SyncRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncRequest& from) {
+    SyncRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip.SyncRequest";
+  }
+  protected:
+  explicit SyncRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotsFieldNumber = 2,
+    kUpdatesFieldNumber = 3,
+    kMembersFieldNumber = 4,
+    kNodeNameFieldNumber = 1,
+  };
+  // repeated .pf_gossip.SlotVersionEntry slots = 2;
+  int slots_size() const;
+  private:
+  int _internal_slots_size() const;
+  public:
+  void clear_slots();
+  ::pf_gossip::SlotVersionEntry* mutable_slots(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >*
+      mutable_slots();
+  private:
+  const ::pf_gossip::SlotVersionEntry& _internal_slots(int index) const;
+  ::pf_gossip::SlotVersionEntry* _internal_add_slots();
+  public:
+  const ::pf_gossip::SlotVersionEntry& slots(int index) const;
+  ::pf_gossip::SlotVersionEntry* add_slots();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >&
+      slots() const;
+
+  // repeated bytes updates = 3;
+  int updates_size() const;
+  private:
+  int _internal_updates_size() const;
+  public:
+  void clear_updates();
+  const std::string& updates(int index) const;
+  std::string* mutable_updates(int index);
+  void set_updates(int index, const std::string& value);
+  void set_updates(int index, std::string&& value);
+  void set_updates(int index, const char* value);
+  void set_updates(int index, const void* value, size_t size);
+  std::string* add_updates();
+  void add_updates(const std::string& value);
+  void add_updates(std::string&& value);
+  void add_updates(const char* value);
+  void add_updates(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& updates() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_updates();
+  private:
+  const std::string& _internal_updates(int index) const;
+  std::string* _internal_add_updates();
+  public:
+
+  // repeated .pf_gossip.MemberUpdate members = 4;
+  int members_size() const;
+  private:
+  int _internal_members_size() const;
+  public:
+  void clear_members();
+  ::pf_gossip::MemberUpdate* mutable_members(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+      mutable_members();
+  private:
+  const ::pf_gossip::MemberUpdate& _internal_members(int index) const;
+  ::pf_gossip::MemberUpdate* _internal_add_members();
+  public:
+  const ::pf_gossip::MemberUpdate& members(int index) const;
+  ::pf_gossip::MemberUpdate* add_members();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+      members() const;
+
+  // string node_name = 1;
+  void clear_node_name();
+  const std::string& node_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_name();
+  PROTOBUF_NODISCARD std::string* release_node_name();
+  void set_allocated_node_name(std::string* node_name);
+  private:
+  const std::string& _internal_node_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_name(const std::string& value);
+  std::string* _internal_mutable_node_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip.SyncRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry > slots_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> updates_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate > members_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Gossip_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.SyncResponse) */ {
+ public:
+  inline SyncResponse() : SyncResponse(nullptr) {}
+  ~SyncResponse() override;
+  explicit PROTOBUF_CONSTEXPR SyncResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncResponse(const SyncResponse& from);
+  SyncResponse(SyncResponse&& from) noexcept
+    : SyncResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncResponse& operator=(const SyncResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncResponse& operator=(SyncResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncResponse* internal_default_instance() {
+    return reinterpret_cast<const SyncResponse*>(
+               &_SyncResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(SyncResponse& a, SyncResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncResponse& from) {
+    SyncResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip.SyncResponse";
+  }
+  protected:
+  explicit SyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotsFieldNumber = 1,
+    kUpdatesFieldNumber = 2,
+    kMembersFieldNumber = 3,
+  };
+  // repeated .pf_gossip.SlotVersionEntry slots = 1;
+  int slots_size() const;
+  private:
+  int _internal_slots_size() const;
+  public:
+  void clear_slots();
+  ::pf_gossip::SlotVersionEntry* mutable_slots(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >*
+      mutable_slots();
+  private:
+  const ::pf_gossip::SlotVersionEntry& _internal_slots(int index) const;
+  ::pf_gossip::SlotVersionEntry* _internal_add_slots();
+  public:
+  const ::pf_gossip::SlotVersionEntry& slots(int index) const;
+  ::pf_gossip::SlotVersionEntry* add_slots();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >&
+      slots() const;
+
+  // repeated bytes updates = 2;
+  int updates_size() const;
+  private:
+  int _internal_updates_size() const;
+  public:
+  void clear_updates();
+  const std::string& updates(int index) const;
+  std::string* mutable_updates(int index);
+  void set_updates(int index, const std::string& value);
+  void set_updates(int index, std::string&& value);
+  void set_updates(int index, const char* value);
+  void set_updates(int index, const void* value, size_t size);
+  std::string* add_updates();
+  void add_updates(const std::string& value);
+  void add_updates(std::string&& value);
+  void add_updates(const char* value);
+  void add_updates(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& updates() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_updates();
+  private:
+  const std::string& _internal_updates(int index) const;
+  std::string* _internal_add_updates();
+  public:
+
+  // repeated .pf_gossip.MemberUpdate members = 3;
+  int members_size() const;
+  private:
+  int _internal_members_size() const;
+  public:
+  void clear_members();
+  ::pf_gossip::MemberUpdate* mutable_members(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+      mutable_members();
+  private:
+  const ::pf_gossip::MemberUpdate& _internal_members(int index) const;
+  ::pf_gossip::MemberUpdate* _internal_add_members();
+  public:
+  const ::pf_gossip::MemberUpdate& members(int index) const;
+  ::pf_gossip::MemberUpdate* add_members();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+      members() const;
+
+  // @@protoc_insertion_point(class_scope:pf_gossip.SyncResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry > slots_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> updates_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate > members_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Gossip_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PingRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.PingRequest) */ {
+ public:
+  inline PingRequest() : PingRequest(nullptr) {}
+  ~PingRequest() override;
+  explicit PROTOBUF_CONSTEXPR PingRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PingRequest(const PingRequest& from);
+  PingRequest(PingRequest&& from) noexcept
+    : PingRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PingRequest& operator=(const PingRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PingRequest& operator=(PingRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PingRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PingRequest* internal_default_instance() {
+    return reinterpret_cast<const PingRequest*>(
+               &_PingRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(PingRequest& a, PingRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PingRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PingRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PingRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PingRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PingRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PingRequest& from) {
+    PingRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PingRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip.PingRequest";
+  }
+  protected:
+  explicit PingRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMembersFieldNumber = 4,
+    kNodeNameFieldNumber = 1,
+    kTargetFieldNumber = 2,
+    kTimeoutMsFieldNumber = 3,
+  };
+  // repeated .pf_gossip.MemberUpdate members = 4;
+  int members_size() const;
+  private:
+  int _internal_members_size() const;
+  public:
+  void clear_members();
+  ::pf_gossip::MemberUpdate* mutable_members(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+      mutable_members();
+  private:
+  const ::pf_gossip::MemberUpdate& _internal_members(int index) const;
+  ::pf_gossip::MemberUpdate* _internal_add_members();
+  public:
+  const ::pf_gossip::MemberUpdate& members(int index) const;
+  ::pf_gossip::MemberUpdate* add_members();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+      members() const;
+
+  // string node_name = 1;
+  void clear_node_name();
+  const std::string& node_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_name();
+  PROTOBUF_NODISCARD std::string* release_node_name();
+  void set_allocated_node_name(std::string* node_name);
+  private:
+  const std::string& _internal_node_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_name(const std::string& value);
+  std::string* _internal_mutable_node_name();
+  public:
+
+  // string target = 2;
+  void clear_target();
+  const std::string& target() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target();
+  PROTOBUF_NODISCARD std::string* release_target();
+  void set_allocated_target(std::string* target);
+  private:
+  const std::string& _internal_target() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target(const std::string& value);
+  std::string* _internal_mutable_target();
+  public:
+
+  // int64 timeout_ms = 3;
+  void clear_timeout_ms();
+  int64_t timeout_ms() const;
+  void set_timeout_ms(int64_t value);
+  private:
+  int64_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip.PingRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate > members_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_;
+    int64_t timeout_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Gossip_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PingResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip.PingResponse) */ {
+ public:
+  inline PingResponse() : PingResponse(nullptr) {}
+  ~PingResponse() override;
+  explicit PROTOBUF_CONSTEXPR PingResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PingResponse(const PingResponse& from);
+  PingResponse(PingResponse&& from) noexcept
+    : PingResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline PingResponse& operator=(const PingResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PingResponse& operator=(PingResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PingResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PingResponse* internal_default_instance() {
+    return reinterpret_cast<const PingResponse*>(
+               &_PingResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(PingResponse& a, PingResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PingResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PingResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PingResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PingResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PingResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PingResponse& from) {
+    PingResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PingResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip.PingResponse";
+  }
+  protected:
+  explicit PingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMembersFieldNumber = 2,
+    kAckFieldNumber = 1,
+  };
+  // repeated .pf_gossip.MemberUpdate members = 2;
+  int members_size() const;
+  private:
+  int _internal_members_size() const;
+  public:
+  void clear_members();
+  ::pf_gossip::MemberUpdate* mutable_members(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+      mutable_members();
+  private:
+  const ::pf_gossip::MemberUpdate& _internal_members(int index) const;
+  ::pf_gossip::MemberUpdate* _internal_add_members();
+  public:
+  const ::pf_gossip::MemberUpdate& members(int index) const;
+  ::pf_gossip::MemberUpdate* add_members();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+      members() const;
+
+  // bool ack = 1;
+  void clear_ack();
+  bool ack() const;
+  void set_ack(bool value);
+  private:
+  bool _internal_ack() const;
+  void _internal_set_ack(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip.PingResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate > members_;
+    bool ack_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Gossip_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Message
+
+// string key = 1;
+inline void Message::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& Message::key() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.Message.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.Message.key)
+}
+inline std::string* Message::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.Message.key)
+  return _s;
+}
+inline const std::string& Message::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Message::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_key() {
+  // @@protoc_insertion_point(field_release:pf_gossip.Message.key)
+  return _impl_.key_.Release();
+}
+inline void Message::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.Message.key)
+}
+
+// string value = 2;
+inline void Message::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& Message::value() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.Message.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.Message.value)
+}
+inline std::string* Message::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.Message.value)
+  return _s;
+}
+inline const std::string& Message::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Message::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_value() {
+  // @@protoc_insertion_point(field_release:pf_gossip.Message.value)
+  return _impl_.value_.Release();
+}
+inline void Message::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.Message.value)
+}
+
+// int64 version = 3;
+inline void Message::clear_version() {
+  _impl_.version_ = int64_t{0};
+}
+inline int64_t Message::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t Message::version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.Message.version)
+  return _internal_version();
+}
+inline void Message::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void Message::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.Message.version)
+}
+
+// bool deleted = 4;
+inline void Message::clear_deleted() {
+  _impl_.deleted_ = false;
+}
+inline bool Message::_internal_deleted() const {
+  return _impl_.deleted_;
+}
+inline bool Message::deleted() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.Message.deleted)
+  return _internal_deleted();
+}
+inline void Message::_internal_set_deleted(bool value) {
+  
+  _impl_.deleted_ = value;
+}
+inline void Message::set_deleted(bool value) {
+  _internal_set_deleted(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.Message.deleted)
+}
+
+// int64 ttl_ms = 5;
+inline void Message::clear_ttl_ms() {
+  _impl_.ttl_ms_ = int64_t{0};
+}
+inline int64_t Message::_internal_ttl_ms() const {
+  return _impl_.ttl_ms_;
+}
+inline int64_t Message::ttl_ms() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.Message.ttl_ms)
+  return _internal_ttl_ms();
+}
+inline void Message::_internal_set_ttl_ms(int64_t value) {
+  
+  _impl_.ttl_ms_ = value;
+}
+inline void Message::set_ttl_ms(int64_t value) {
+  _internal_set_ttl_ms(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.Message.ttl_ms)
+}
+
+// -------------------------------------------------------------------
+
+// SearchResult_Message
+
+// string key = 1;
+inline void SearchResult_Message::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& SearchResult_Message::key() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.Message.key)
   return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Message::set_key(ArgT0&& arg0, ArgT... args) {
+void SearchResult_Message::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.SearchResult.Message.key)
+}
+inline std::string* SearchResult_Message::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SearchResult.Message.key)
+  return _s;
+}
+inline const std::string& SearchResult_Message::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void SearchResult_Message::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchResult_Message::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchResult_Message::release_key() {
+  // @@protoc_insertion_point(field_release:pf_gossip.SearchResult.Message.key)
+  return _impl_.key_.Release();
+}
+inline void SearchResult_Message::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SearchResult.Message.key)
+}
+
+// string value = 2;
+inline void SearchResult_Message::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& SearchResult_Message::value() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.Message.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchResult_Message::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.SearchResult.Message.value)
+}
+inline std::string* SearchResult_Message::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SearchResult.Message.value)
+  return _s;
+}
+inline const std::string& SearchResult_Message::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void SearchResult_Message::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchResult_Message::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchResult_Message::release_value() {
+  // @@protoc_insertion_point(field_release:pf_gossip.SearchResult.Message.value)
+  return _impl_.value_.Release();
+}
+inline void SearchResult_Message::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SearchResult.Message.value)
+}
+
+// string owner = 3;
+inline void SearchResult_Message::clear_owner() {
+  _impl_.owner_.ClearToEmpty();
+}
+inline const std::string& SearchResult_Message::owner() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.Message.owner)
+  return _internal_owner();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchResult_Message::set_owner(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.owner_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.SearchResult.Message.owner)
+}
+inline std::string* SearchResult_Message::mutable_owner() {
+  std::string* _s = _internal_mutable_owner();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SearchResult.Message.owner)
+  return _s;
+}
+inline const std::string& SearchResult_Message::_internal_owner() const {
+  return _impl_.owner_.Get();
+}
+inline void SearchResult_Message::_internal_set_owner(const std::string& value) {
+  
+  _impl_.owner_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchResult_Message::_internal_mutable_owner() {
+  
+  return _impl_.owner_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchResult_Message::release_owner() {
+  // @@protoc_insertion_point(field_release:pf_gossip.SearchResult.Message.owner)
+  return _impl_.owner_.Release();
+}
+inline void SearchResult_Message::set_allocated_owner(std::string* owner) {
+  if (owner != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.owner_.SetAllocated(owner, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.owner_.IsDefault()) {
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SearchResult.Message.owner)
+}
+
+// int64 version = 4;
+inline void SearchResult_Message::clear_version() {
+  _impl_.version_ = int64_t{0};
+}
+inline int64_t SearchResult_Message::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t SearchResult_Message::version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.Message.version)
+  return _internal_version();
+}
+inline void SearchResult_Message::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void SearchResult_Message::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.SearchResult.Message.version)
+}
+
+// -------------------------------------------------------------------
+
+// SearchResult
+
+// repeated .pf_gossip.SearchResult.Message message = 1;
+inline int SearchResult::_internal_message_size() const {
+  return _impl_.message_.size();
+}
+inline int SearchResult::message_size() const {
+  return _internal_message_size();
+}
+inline void SearchResult::clear_message() {
+  _impl_.message_.Clear();
+}
+inline ::pf_gossip::SearchResult_Message* SearchResult::mutable_message(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SearchResult.message)
+  return _impl_.message_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SearchResult_Message >*
+SearchResult::mutable_message() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SearchResult.message)
+  return &_impl_.message_;
+}
+inline const ::pf_gossip::SearchResult_Message& SearchResult::_internal_message(int index) const {
+  return _impl_.message_.Get(index);
+}
+inline const ::pf_gossip::SearchResult_Message& SearchResult::message(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.message)
+  return _internal_message(index);
+}
+inline ::pf_gossip::SearchResult_Message* SearchResult::_internal_add_message() {
+  return _impl_.message_.Add();
+}
+inline ::pf_gossip::SearchResult_Message* SearchResult::add_message() {
+  ::pf_gossip::SearchResult_Message* _add = _internal_add_message();
+  // @@protoc_insertion_point(field_add:pf_gossip.SearchResult.message)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SearchResult_Message >&
+SearchResult::message() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SearchResult.message)
+  return _impl_.message_;
+}
+
+// -------------------------------------------------------------------
+
+// updateResult
+
+// int32 succeed = 1;
+inline void updateResult::clear_succeed() {
+  _impl_.succeed_ = 0;
+}
+inline int32_t updateResult::_internal_succeed() const {
+  return _impl_.succeed_;
+}
+inline int32_t updateResult::succeed() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.updateResult.succeed)
+  return _internal_succeed();
+}
+inline void updateResult::_internal_set_succeed(int32_t value) {
+  
+  _impl_.succeed_ = value;
+}
+inline void updateResult::set_succeed(int32_t value) {
+  _internal_set_succeed(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.updateResult.succeed)
+}
+
+// int64 version = 2;
+inline void updateResult::clear_version() {
+  _impl_.version_ = int64_t{0};
+}
+inline int64_t updateResult::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t updateResult::version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.updateResult.version)
+  return _internal_version();
+}
+inline void updateResult::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void updateResult::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.updateResult.version)
+}
+
+// -------------------------------------------------------------------
+
+// SlotUpdate
+
+// string name = 1;
+inline void SlotUpdate::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SlotUpdate::name() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SlotUpdate::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.name)
+}
+inline std::string* SlotUpdate::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SlotUpdate.name)
+  return _s;
+}
+inline const std::string& SlotUpdate::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SlotUpdate::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SlotUpdate::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SlotUpdate::release_name() {
+  // @@protoc_insertion_point(field_release:pf_gossip.SlotUpdate.name)
+  return _impl_.name_.Release();
+}
+inline void SlotUpdate::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SlotUpdate.name)
+}
+
+// int64 version = 2;
+inline void SlotUpdate::clear_version() {
+  _impl_.version_ = int64_t{0};
+}
+inline int64_t SlotUpdate::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t SlotUpdate::version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.version)
+  return _internal_version();
+}
+inline void SlotUpdate::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void SlotUpdate::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.version)
+}
+
+// repeated .pf_gossip.Message messages = 3;
+inline int SlotUpdate::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int SlotUpdate::messages_size() const {
+  return _internal_messages_size();
+}
+inline void SlotUpdate::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::pf_gossip::Message* SlotUpdate::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SlotUpdate.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::Message >*
+SlotUpdate::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SlotUpdate.messages)
+  return &_impl_.messages_;
+}
+inline const ::pf_gossip::Message& SlotUpdate::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::pf_gossip::Message& SlotUpdate::messages(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.messages)
+  return _internal_messages(index);
+}
+inline ::pf_gossip::Message* SlotUpdate::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::pf_gossip::Message* SlotUpdate::add_messages() {
+  ::pf_gossip::Message* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:pf_gossip.SlotUpdate.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::Message >&
+SlotUpdate::messages() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SlotUpdate.messages)
+  return _impl_.messages_;
+}
+
+// repeated string pass_nodes = 4;
+inline int SlotUpdate::_internal_pass_nodes_size() const {
+  return _impl_.pass_nodes_.size();
+}
+inline int SlotUpdate::pass_nodes_size() const {
+  return _internal_pass_nodes_size();
+}
+inline void SlotUpdate::clear_pass_nodes() {
+  _impl_.pass_nodes_.Clear();
+}
+inline std::string* SlotUpdate::add_pass_nodes() {
+  std::string* _s = _internal_add_pass_nodes();
+  // @@protoc_insertion_point(field_add_mutable:pf_gossip.SlotUpdate.pass_nodes)
+  return _s;
+}
+inline const std::string& SlotUpdate::_internal_pass_nodes(int index) const {
+  return _impl_.pass_nodes_.Get(index);
+}
+inline const std::string& SlotUpdate::pass_nodes(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.pass_nodes)
+  return _internal_pass_nodes(index);
+}
+inline std::string* SlotUpdate::mutable_pass_nodes(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SlotUpdate.pass_nodes)
+  return _impl_.pass_nodes_.Mutable(index);
+}
+inline void SlotUpdate::set_pass_nodes(int index, const std::string& value) {
+  _impl_.pass_nodes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.pass_nodes)
+}
+inline void SlotUpdate::set_pass_nodes(int index, std::string&& value) {
+  _impl_.pass_nodes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.pass_nodes)
+}
+inline void SlotUpdate::set_pass_nodes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.pass_nodes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:pf_gossip.SlotUpdate.pass_nodes)
+}
+inline void SlotUpdate::set_pass_nodes(int index, const char* value, size_t size) {
+  _impl_.pass_nodes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:pf_gossip.SlotUpdate.pass_nodes)
+}
+inline std::string* SlotUpdate::_internal_add_pass_nodes() {
+  return _impl_.pass_nodes_.Add();
+}
+inline void SlotUpdate::add_pass_nodes(const std::string& value) {
+  _impl_.pass_nodes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:pf_gossip.SlotUpdate.pass_nodes)
+}
+inline void SlotUpdate::add_pass_nodes(std::string&& value) {
+  _impl_.pass_nodes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:pf_gossip.SlotUpdate.pass_nodes)
+}
+inline void SlotUpdate::add_pass_nodes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.pass_nodes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:pf_gossip.SlotUpdate.pass_nodes)
+}
+inline void SlotUpdate::add_pass_nodes(const char* value, size_t size) {
+  _impl_.pass_nodes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:pf_gossip.SlotUpdate.pass_nodes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SlotUpdate::pass_nodes() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SlotUpdate.pass_nodes)
+  return _impl_.pass_nodes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SlotUpdate::mutable_pass_nodes() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SlotUpdate.pass_nodes)
+  return &_impl_.pass_nodes_;
+}
+
+// bool delta = 5;
+inline void SlotUpdate::clear_delta() {
+  _impl_.delta_ = false;
+}
+inline bool SlotUpdate::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline bool SlotUpdate::delta() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.delta)
+  return _internal_delta();
+}
+inline void SlotUpdate::_internal_set_delta(bool value) {
+  
+  _impl_.delta_ = value;
+}
+inline void SlotUpdate::set_delta(bool value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.delta)
+}
+
+// int64 base_version = 6;
+inline void SlotUpdate::clear_base_version() {
+  _impl_.base_version_ = int64_t{0};
+}
+inline int64_t SlotUpdate::_internal_base_version() const {
+  return _impl_.base_version_;
+}
+inline int64_t SlotUpdate::base_version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.base_version)
+  return _internal_base_version();
+}
+inline void SlotUpdate::_internal_set_base_version(int64_t value) {
+  
+  _impl_.base_version_ = value;
+}
+inline void SlotUpdate::set_base_version(int64_t value) {
+  _internal_set_base_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.base_version)
+}
+
+// repeated int32 leaves = 7;
+inline int SlotUpdate::_internal_leaves_size() const {
+  return _impl_.leaves_.size();
+}
+inline int SlotUpdate::leaves_size() const {
+  return _internal_leaves_size();
+}
+inline void SlotUpdate::clear_leaves() {
+  _impl_.leaves_.Clear();
+}
+inline int32_t SlotUpdate::_internal_leaves(int index) const {
+  return _impl_.leaves_.Get(index);
+}
+inline int32_t SlotUpdate::leaves(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.leaves)
+  return _internal_leaves(index);
+}
+inline void SlotUpdate::set_leaves(int index, int32_t value) {
+  _impl_.leaves_.Set(index, value);
+  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.leaves)
+}
+inline void SlotUpdate::_internal_add_leaves(int32_t value) {
+  _impl_.leaves_.Add(value);
+}
+inline void SlotUpdate::add_leaves(int32_t value) {
+  _internal_add_leaves(value);
+  // @@protoc_insertion_point(field_add:pf_gossip.SlotUpdate.leaves)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SlotUpdate::_internal_leaves() const {
+  return _impl_.leaves_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SlotUpdate::leaves() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SlotUpdate.leaves)
+  return _internal_leaves();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SlotUpdate::_internal_mutable_leaves() {
+  return &_impl_.leaves_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SlotUpdate::mutable_leaves() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SlotUpdate.leaves)
+  return _internal_mutable_leaves();
+}
+
+// -------------------------------------------------------------------
+
+// MerkleNode
+
+// int32 index = 1;
+inline void MerkleNode::clear_index() {
+  _impl_.index_ = 0;
+}
+inline int32_t MerkleNode::_internal_index() const {
+  return _impl_.index_;
+}
+inline int32_t MerkleNode::index() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.MerkleNode.index)
+  return _internal_index();
+}
+inline void MerkleNode::_internal_set_index(int32_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void MerkleNode::set_index(int32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.MerkleNode.index)
+}
+
+// uint64 hash = 2;
+inline void MerkleNode::clear_hash() {
+  _impl_.hash_ = uint64_t{0u};
+}
+inline uint64_t MerkleNode::_internal_hash() const {
+  return _impl_.hash_;
+}
+inline uint64_t MerkleNode::hash() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.MerkleNode.hash)
+  return _internal_hash();
+}
+inline void MerkleNode::_internal_set_hash(uint64_t value) {
+  
+  _impl_.hash_ = value;
+}
+inline void MerkleNode::set_hash(uint64_t value) {
+  _internal_set_hash(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.MerkleNode.hash)
+}
+
+// -------------------------------------------------------------------
+
+// DigestRequest
+
+// string name = 1;
+inline void DigestRequest::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& DigestRequest::name() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.DigestRequest.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DigestRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.DigestRequest.name)
+}
+inline std::string* DigestRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.DigestRequest.name)
+  return _s;
+}
+inline const std::string& DigestRequest::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void DigestRequest::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DigestRequest::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DigestRequest::release_name() {
+  // @@protoc_insertion_point(field_release:pf_gossip.DigestRequest.name)
+  return _impl_.name_.Release();
+}
+inline void DigestRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.DigestRequest.name)
+}
+
+// int64 version = 2;
+inline void DigestRequest::clear_version() {
+  _impl_.version_ = int64_t{0};
+}
+inline int64_t DigestRequest::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t DigestRequest::version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.DigestRequest.version)
+  return _internal_version();
+}
+inline void DigestRequest::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void DigestRequest::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.DigestRequest.version)
+}
+
+// repeated .pf_gossip.MerkleNode nodes = 3;
+inline int DigestRequest::_internal_nodes_size() const {
+  return _impl_.nodes_.size();
+}
+inline int DigestRequest::nodes_size() const {
+  return _internal_nodes_size();
+}
+inline void DigestRequest::clear_nodes() {
+  _impl_.nodes_.Clear();
+}
+inline ::pf_gossip::MerkleNode* DigestRequest::mutable_nodes(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.DigestRequest.nodes)
+  return _impl_.nodes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MerkleNode >*
+DigestRequest::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.DigestRequest.nodes)
+  return &_impl_.nodes_;
+}
+inline const ::pf_gossip::MerkleNode& DigestRequest::_internal_nodes(int index) const {
+  return _impl_.nodes_.Get(index);
+}
+inline const ::pf_gossip::MerkleNode& DigestRequest::nodes(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.DigestRequest.nodes)
+  return _internal_nodes(index);
+}
+inline ::pf_gossip::MerkleNode* DigestRequest::_internal_add_nodes() {
+  return _impl_.nodes_.Add();
+}
+inline ::pf_gossip::MerkleNode* DigestRequest::add_nodes() {
+  ::pf_gossip::MerkleNode* _add = _internal_add_nodes();
+  // @@protoc_insertion_point(field_add:pf_gossip.DigestRequest.nodes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MerkleNode >&
+DigestRequest::nodes() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.DigestRequest.nodes)
+  return _impl_.nodes_;
+}
+
+// -------------------------------------------------------------------
+
+// DigestResponse
+
+// int64 version = 1;
+inline void DigestResponse::clear_version() {
+  _impl_.version_ = int64_t{0};
+}
+inline int64_t DigestResponse::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t DigestResponse::version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.DigestResponse.version)
+  return _internal_version();
+}
+inline void DigestResponse::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void DigestResponse::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.DigestResponse.version)
+}
+
+// repeated int32 differs = 2;
+inline int DigestResponse::_internal_differs_size() const {
+  return _impl_.differs_.size();
+}
+inline int DigestResponse::differs_size() const {
+  return _internal_differs_size();
+}
+inline void DigestResponse::clear_differs() {
+  _impl_.differs_.Clear();
+}
+inline int32_t DigestResponse::_internal_differs(int index) const {
+  return _impl_.differs_.Get(index);
+}
+inline int32_t DigestResponse::differs(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.DigestResponse.differs)
+  return _internal_differs(index);
+}
+inline void DigestResponse::set_differs(int index, int32_t value) {
+  _impl_.differs_.Set(index, value);
+  // @@protoc_insertion_point(field_set:pf_gossip.DigestResponse.differs)
+}
+inline void DigestResponse::_internal_add_differs(int32_t value) {
+  _impl_.differs_.Add(value);
+}
+inline void DigestResponse::add_differs(int32_t value) {
+  _internal_add_differs(value);
+  // @@protoc_insertion_point(field_add:pf_gossip.DigestResponse.differs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DigestResponse::_internal_differs() const {
+  return _impl_.differs_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DigestResponse::differs() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.DigestResponse.differs)
+  return _internal_differs();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DigestResponse::_internal_mutable_differs() {
+  return &_impl_.differs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DigestResponse::mutable_differs() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.DigestResponse.differs)
+  return _internal_mutable_differs();
+}
+
+// -------------------------------------------------------------------
+
+// GossipNodeInfo
+
+// string name = 1;
+inline void GossipNodeInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& GossipNodeInfo::name() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.GossipNodeInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GossipNodeInfo::set_name(ArgT0&& arg0, ArgT... args) {
  
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.Message.key)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.name)
 }
-inline std::string* Message::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.Message.key)
+inline std::string* GossipNodeInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.GossipNodeInfo.name)
+  return _s;
+}
+inline const std::string& GossipNodeInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void GossipNodeInfo::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GossipNodeInfo::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GossipNodeInfo::release_name() {
+  // @@protoc_insertion_point(field_release:pf_gossip.GossipNodeInfo.name)
+  return _impl_.name_.Release();
+}
+inline void GossipNodeInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.GossipNodeInfo.name)
+}
+
+// int64 version = 2;
+inline void GossipNodeInfo::clear_version() {
+  _impl_.version_ = int64_t{0};
+}
+inline int64_t GossipNodeInfo::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t GossipNodeInfo::version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.GossipNodeInfo.version)
+  return _internal_version();
+}
+inline void GossipNodeInfo::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void GossipNodeInfo::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.version)
+}
+
+// string address = 3;
+inline void GossipNodeInfo::clear_address() {
+  _impl_.address_.ClearToEmpty();
+}
+inline const std::string& GossipNodeInfo::address() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.GossipNodeInfo.address)
+  return _internal_address();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GossipNodeInfo::set_address(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.address)
+}
+inline std::string* GossipNodeInfo::mutable_address() {
+  std::string* _s = _internal_mutable_address();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.GossipNodeInfo.address)
+  return _s;
+}
+inline const std::string& GossipNodeInfo::_internal_address() const {
+  return _impl_.address_.Get();
+}
+inline void GossipNodeInfo::_internal_set_address(const std::string& value) {
+  
+  _impl_.address_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GossipNodeInfo::_internal_mutable_address() {
+  
+  return _impl_.address_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GossipNodeInfo::release_address() {
+  // @@protoc_insertion_point(field_release:pf_gossip.GossipNodeInfo.address)
+  return _impl_.address_.Release();
+}
+inline void GossipNodeInfo::set_allocated_address(std::string* address) {
+  if (address != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.address_.SetAllocated(address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.address_.IsDefault()) {
+    _impl_.address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.GossipNodeInfo.address)
+}
+
+// repeated string pass_nodes = 4;
+inline int GossipNodeInfo::_internal_pass_nodes_size() const {
+  return _impl_.pass_nodes_.size();
+}
+inline int GossipNodeInfo::pass_nodes_size() const {
+  return _internal_pass_nodes_size();
+}
+inline void GossipNodeInfo::clear_pass_nodes() {
+  _impl_.pass_nodes_.Clear();
+}
+inline std::string* GossipNodeInfo::add_pass_nodes() {
+  std::string* _s = _internal_add_pass_nodes();
+  // @@protoc_insertion_point(field_add_mutable:pf_gossip.GossipNodeInfo.pass_nodes)
+  return _s;
+}
+inline const std::string& GossipNodeInfo::_internal_pass_nodes(int index) const {
+  return _impl_.pass_nodes_.Get(index);
+}
+inline const std::string& GossipNodeInfo::pass_nodes(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.GossipNodeInfo.pass_nodes)
+  return _internal_pass_nodes(index);
+}
+inline std::string* GossipNodeInfo::mutable_pass_nodes(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.GossipNodeInfo.pass_nodes)
+  return _impl_.pass_nodes_.Mutable(index);
+}
+inline void GossipNodeInfo::set_pass_nodes(int index, const std::string& value) {
+  _impl_.pass_nodes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.pass_nodes)
+}
+inline void GossipNodeInfo::set_pass_nodes(int index, std::string&& value) {
+  _impl_.pass_nodes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.pass_nodes)
+}
+inline void GossipNodeInfo::set_pass_nodes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.pass_nodes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:pf_gossip.GossipNodeInfo.pass_nodes)
+}
+inline void GossipNodeInfo::set_pass_nodes(int index, const char* value, size_t size) {
+  _impl_.pass_nodes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:pf_gossip.GossipNodeInfo.pass_nodes)
+}
+inline std::string* GossipNodeInfo::_internal_add_pass_nodes() {
+  return _impl_.pass_nodes_.Add();
+}
+inline void GossipNodeInfo::add_pass_nodes(const std::string& value) {
+  _impl_.pass_nodes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:pf_gossip.GossipNodeInfo.pass_nodes)
+}
+inline void GossipNodeInfo::add_pass_nodes(std::string&& value) {
+  _impl_.pass_nodes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:pf_gossip.GossipNodeInfo.pass_nodes)
+}
+inline void GossipNodeInfo::add_pass_nodes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.pass_nodes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:pf_gossip.GossipNodeInfo.pass_nodes)
+}
+inline void GossipNodeInfo::add_pass_nodes(const char* value, size_t size) {
+  _impl_.pass_nodes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:pf_gossip.GossipNodeInfo.pass_nodes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+GossipNodeInfo::pass_nodes() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.GossipNodeInfo.pass_nodes)
+  return _impl_.pass_nodes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+GossipNodeInfo::mutable_pass_nodes() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.GossipNodeInfo.pass_nodes)
+  return &_impl_.pass_nodes_;
+}
+
+// -------------------------------------------------------------------
+
+// SlotVersionEntry
+
+// string name = 1;
+inline void SlotVersionEntry::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SlotVersionEntry::name() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SlotVersionEntry.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SlotVersionEntry::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.SlotVersionEntry.name)
+}
+inline std::string* SlotVersionEntry::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SlotVersionEntry.name)
   return _s;
 }
-inline const std::string& Message::_internal_key() const {
-  return _impl_.key_.Get();
+inline const std::string& SlotVersionEntry::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Message::_internal_set_key(const std::string& value) {
+inline void SlotVersionEntry::_internal_set_name(const std::string& value) {
   
-  _impl_.key_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Message::_internal_mutable_key() {
+inline std::string* SlotVersionEntry::_internal_mutable_name() {
   
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Message::release_key() {
-  // @@protoc_insertion_point(field_release:pf_gossip.Message.key)
-  return _impl_.key_.Release();
+inline std::string* SlotVersionEntry::release_name() {
+  // @@protoc_insertion_point(field_release:pf_gossip.SlotVersionEntry.name)
+  return _impl_.name_.Release();
 }
-inline void Message::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
+inline void SlotVersionEntry::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.Message.key)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SlotVersionEntry.name)
 }
 
-// string value = 2;
-inline void Message::clear_value() {
-  _impl_.value_.ClearToEmpty();
+// int64 version = 2;
+inline void SlotVersionEntry::clear_version() {
+  _impl_.version_ = int64_t{0};
 }
-inline const std::string& Message::value() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.Message.value)
-  return _internal_value();
+inline int64_t SlotVersionEntry::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t SlotVersionEntry::version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SlotVersionEntry.version)
+  return _internal_version();
+}
+inline void SlotVersionEntry::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void SlotVersionEntry::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.SlotVersionEntry.version)
+}
+
+// -------------------------------------------------------------------
+
+// MemberUpdate
+
+// string name = 1;
+inline void MemberUpdate::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& MemberUpdate::name() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.MemberUpdate.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Message::set_value(ArgT0&& arg0, ArgT... args) {
+void MemberUpdate::set_name(ArgT0&& arg0, ArgT... args) {
  
- _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.Message.value)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.MemberUpdate.name)
 }
-inline std::string* Message::mutable_value() {
-  std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.Message.value)
+inline std::string* MemberUpdate::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.MemberUpdate.name)
   return _s;
 }
-inline const std::string& Message::_internal_value() const {
-  return _impl_.value_.Get();
+inline const std::string& MemberUpdate::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Message::_internal_set_value(const std::string& value) {
+inline void MemberUpdate::_internal_set_name(const std::string& value) {
   
-  _impl_.value_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Message::_internal_mutable_value() {
+inline std::string* MemberUpdate::_internal_mutable_name() {
   
-  return _impl_.value_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Message::release_value() {
-  // @@protoc_insertion_point(field_release:pf_gossip.Message.value)
-  return _impl_.value_.Release();
+inline std::string* MemberUpdate::release_name() {
+  // @@protoc_insertion_point(field_release:pf_gossip.MemberUpdate.name)
+  return _impl_.name_.Release();
 }
-inline void Message::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
+inline void MemberUpdate::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.Message.value)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.MemberUpdate.name)
 }
 
-// -------------------------------------------------------------------
-
-// SearchResult_Message
-
-// string key = 1;
-inline void SearchResult_Message::clear_key() {
-  _impl_.key_.ClearToEmpty();
+// string address = 2;
+inline void MemberUpdate::clear_address() {
+  _impl_.address_.ClearToEmpty();
 }
-inline const std::string& SearchResult_Message::key() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.Message.key)
-  return _internal_key();
+inline const std::string& MemberUpdate::address() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.MemberUpdate.address)
+  return _internal_address();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SearchResult_Message::set_key(ArgT0&& arg0, ArgT... args) {
+void MemberUpdate::set_address(ArgT0&& arg0, ArgT... args) {
  
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.SearchResult.Message.key)
+ _impl_.address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.MemberUpdate.address)
 }
-inline std::string* SearchResult_Message::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.SearchResult.Message.key)
+inline std::string* MemberUpdate::mutable_address() {
+  std::string* _s = _internal_mutable_address();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.MemberUpdate.address)
   return _s;
 }
-inline const std::string& SearchResult_Message::_internal_key() const {
-  return _impl_.key_.Get();
+inline const std::string& MemberUpdate::_internal_address() const {
+  return _impl_.address_.Get();
 }
-inline void SearchResult_Message::_internal_set_key(const std::string& value) {
+inline void MemberUpdate::_internal_set_address(const std::string& value) {
   
-  _impl_.key_.Set(value, GetArenaForAllocation());
+  _impl_.address_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SearchResult_Message::_internal_mutable_key() {
+inline std::string* MemberUpdate::_internal_mutable_address() {
   
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+  return _impl_.address_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SearchResult_Message::release_key() {
-  // @@protoc_insertion_point(field_release:pf_gossip.SearchResult.Message.key)
-  return _impl_.key_.Release();
+inline std::string* MemberUpdate::release_address() {
+  // @@protoc_insertion_point(field_release:pf_gossip.MemberUpdate.address)
+  return _impl_.address_.Release();
 }
-inline void SearchResult_Message::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
+inline void MemberUpdate::set_allocated_address(std::string* address) {
+  if (address != nullptr) {
     
   } else {
     
   }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+  _impl_.address_.SetAllocated(address, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  if (_impl_.address_.IsDefault()) {
+    _impl_.address_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SearchResult.Message.key)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.MemberUpdate.address)
 }
 
-// string value = 2;
-inline void SearchResult_Message::clear_value() {
-  _impl_.value_.ClearToEmpty();
+// .pf_gossip.MemberState state = 3;
+inline void MemberUpdate::clear_state() {
+  _impl_.state_ = 0;
 }
-inline const std::string& SearchResult_Message::value() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.Message.value)
-  return _internal_value();
+inline ::pf_gossip::MemberState MemberUpdate::_internal_state() const {
+  return static_cast< ::pf_gossip::MemberState >(_impl_.state_);
+}
+inline ::pf_gossip::MemberState MemberUpdate::state() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.MemberUpdate.state)
+  return _internal_state();
+}
+inline void MemberUpdate::_internal_set_state(::pf_gossip::MemberState value) {
+  
+  _impl_.state_ = value;
+}
+inline void MemberUpdate::set_state(::pf_gossip::MemberState value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.MemberUpdate.state)
+}
+
+// int64 incarnation = 4;
+inline void MemberUpdate::clear_incarnation() {
+  _impl_.incarnation_ = int64_t{0};
+}
+inline int64_t MemberUpdate::_internal_incarnation() const {
+  return _impl_.incarnation_;
+}
+inline int64_t MemberUpdate::incarnation() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.MemberUpdate.incarnation)
+  return _internal_incarnation();
+}
+inline void MemberUpdate::_internal_set_incarnation(int64_t value) {
+  
+  _impl_.incarnation_ = value;
+}
+inline void MemberUpdate::set_incarnation(int64_t value) {
+  _internal_set_incarnation(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.MemberUpdate.incarnation)
+}
+
+// -------------------------------------------------------------------
+
+// NodeVersions
+
+// string node_name = 1;
+inline void NodeVersions::clear_node_name() {
+  _impl_.node_name_.ClearToEmpty();
+}
+inline const std::string& NodeVersions::node_name() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.NodeVersions.node_name)
+  return _internal_node_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SearchResult_Message::set_value(ArgT0&& arg0, ArgT... args) {
+void NodeVersions::set_node_name(ArgT0&& arg0, ArgT... args) {
  
- _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.SearchResult.Message.value)
+ _impl_.node_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.NodeVersions.node_name)
 }
-inline std::string* SearchResult_Message::mutable_value() {
-  std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.SearchResult.Message.value)
+inline std::string* NodeVersions::mutable_node_name() {
+  std::string* _s = _internal_mutable_node_name();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.NodeVersions.node_name)
   return _s;
 }
-inline const std::string& SearchResult_Message::_internal_value() const {
-  return _impl_.value_.Get();
+inline const std::string& NodeVersions::_internal_node_name() const {
+  return _impl_.node_name_.Get();
 }
-inline void SearchResult_Message::_internal_set_value(const std::string& value) {
+inline void NodeVersions::_internal_set_node_name(const std::string& value) {
   
-  _impl_.value_.Set(value, GetArenaForAllocation());
+  _impl_.node_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SearchResult_Message::_internal_mutable_value() {
+inline std::string* NodeVersions::_internal_mutable_node_name() {
   
-  return _impl_.value_.Mutable(GetArenaForAllocation());
+  return _impl_.node_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SearchResult_Message::release_value() {
-  // @@protoc_insertion_point(field_release:pf_gossip.SearchResult.Message.value)
-  return _impl_.value_.Release();
+inline std::string* NodeVersions::release_node_name() {
+  // @@protoc_insertion_point(field_release:pf_gossip.NodeVersions.node_name)
+  return _impl_.node_name_.Release();
 }
-inline void SearchResult_Message::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
+inline void NodeVersions::set_allocated_node_name(std::string* node_name) {
+  if (node_name != nullptr) {
     
   } else {
     
   }
-  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+  _impl_.node_name_.SetAllocated(node_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArenaForAllocation());
+  if (_impl_.node_name_.IsDefault()) {
+    _impl_.node_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SearchResult.Message.value)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.NodeVersions.node_name)
 }
 
-// string owner = 3;
-inline void SearchResult_Message::clear_owner() {
-  _impl_.owner_.ClearToEmpty();
+// string slot_name = 2;
+inline void NodeVersions::clear_slot_name() {
+  _impl_.slot_name_.ClearToEmpty();
 }
-inline const std::string& SearchResult_Message::owner() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.Message.owner)
-  return _internal_owner();
+inline const std::string& NodeVersions::slot_name() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.NodeVersions.slot_name)
+  return _internal_slot_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SearchResult_Message::set_owner(ArgT0&& arg0, ArgT... args) {
+void NodeVersions::set_slot_name(ArgT0&& arg0, ArgT... args) {
  
- _impl_.owner_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.SearchResult.Message.owner)
+ _impl_.slot_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.NodeVersions.slot_name)
 }
-inline std::string* SearchResult_Message::mutable_owner() {
-  std::string* _s = _internal_mutable_owner();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.SearchResult.Message.owner)
+inline std::string* NodeVersions::mutable_slot_name() {
+  std::string* _s = _internal_mutable_slot_name();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.NodeVersions.slot_name)
   return _s;
 }
-inline const std::string& SearchResult_Message::_internal_owner() const {
-  return _impl_.owner_.Get();
+inline const std::string& NodeVersions::_internal_slot_name() const {
+  return _impl_.slot_name_.Get();
 }
-inline void SearchResult_Message::_internal_set_owner(const std::string& value) {
+inline void NodeVersions::_internal_set_slot_name(const std::string& value) {
   
-  _impl_.owner_.Set(value, GetArenaForAllocation());
+  _impl_.slot_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SearchResult_Message::_internal_mutable_owner() {
+inline std::string* NodeVersions::_internal_mutable_slot_name() {
   
-  return _impl_.owner_.Mutable(GetArenaForAllocation());
+  return _impl_.slot_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SearchResult_Message::release_owner() {
-  // @@protoc_insertion_point(field_release:pf_gossip.SearchResult.Message.owner)
-  return _impl_.owner_.Release();
+inline std::string* NodeVersions::release_slot_name() {
+  // @@protoc_insertion_point(field_release:pf_gossip.NodeVersions.slot_name)
+  return _impl_.slot_name_.Release();
 }
-inline void SearchResult_Message::set_allocated_owner(std::string* owner) {
-  if (owner != nullptr) {
+inline void NodeVersions::set_allocated_slot_name(std::string* slot_name) {
+  if (slot_name != nullptr) {
     
   } else {
     
   }
-  _impl_.owner_.SetAllocated(owner, GetArenaForAllocation());
+  _impl_.slot_name_.SetAllocated(slot_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.owner_.IsDefault()) {
-    _impl_.owner_.Set("", GetArenaForAllocation());
+  if (_impl_.slot_name_.IsDefault()) {
+    _impl_.slot_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SearchResult.Message.owner)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.NodeVersions.slot_name)
 }
 
-// int64 version = 4;
-inline void SearchResult_Message::clear_version() {
-  _impl_.version_ = int64_t{0};
+// int64 slot_version = 3;
+inline void NodeVersions::clear_slot_version() {
+  _impl_.slot_version_ = int64_t{0};
 }
-inline int64_t SearchResult_Message::_internal_version() const {
-  return _impl_.version_;
+inline int64_t NodeVersions::_internal_slot_version() const {
+  return _impl_.slot_version_;
 }
-inline int64_t SearchResult_Message::version() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.Message.version)
-  return _internal_version();
+inline int64_t NodeVersions::slot_version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.NodeVersions.slot_version)
+  return _internal_slot_version();
 }
-inline void SearchResult_Message::_internal_set_version(int64_t value) {
+inline void NodeVersions::_internal_set_slot_version(int64_t value) {
   
-  _impl_.version_ = value;
+  _impl_.slot_version_ = value;
 }
-inline void SearchResult_Message::set_version(int64_t value) {
-  _internal_set_version(value);
-  // @@protoc_insertion_point(field_set:pf_gossip.SearchResult.Message.version)
+inline void NodeVersions::set_slot_version(int64_t value) {
+  _internal_set_slot_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.NodeVersions.slot_version)
 }
 
-// -------------------------------------------------------------------
-
-// SearchResult
-
-// repeated .pf_gossip.SearchResult.Message message = 1;
-inline int SearchResult::_internal_message_size() const {
-  return _impl_.message_.size();
+// repeated .pf_gossip.SlotVersionEntry slots = 4;
+inline int NodeVersions::_internal_slots_size() const {
+  return _impl_.slots_.size();
 }
-inline int SearchResult::message_size() const {
-  return _internal_message_size();
+inline int NodeVersions::slots_size() const {
+  return _internal_slots_size();
 }
-inline void SearchResult::clear_message() {
-  _impl_.message_.Clear();
+inline void NodeVersions::clear_slots() {
+  _impl_.slots_.Clear();
 }
-inline ::pf_gossip::SearchResult_Message* SearchResult::mutable_message(int index) {
-  // @@protoc_insertion_point(field_mutable:pf_gossip.SearchResult.message)
-  return _impl_.message_.Mutable(index);
+inline ::pf_gossip::SlotVersionEntry* NodeVersions::mutable_slots(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.NodeVersions.slots)
+  return _impl_.slots_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SearchResult_Message >*
-SearchResult::mutable_message() {
-  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SearchResult.message)
-  return &_impl_.message_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >*
+NodeVersions::mutable_slots() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.NodeVersions.slots)
+  return &_impl_.slots_;
 }
-inline const ::pf_gossip::SearchResult_Message& SearchResult::_internal_message(int index) const {
-  return _impl_.message_.Get(index);
+inline const ::pf_gossip::SlotVersionEntry& NodeVersions::_internal_slots(int index) const {
+  return _impl_.slots_.Get(index);
 }
-inline const ::pf_gossip::SearchResult_Message& SearchResult::message(int index) const {
-  // @@protoc_insertion_point(field_get:pf_gossip.SearchResult.message)
-  return _internal_message(index);
+inline const ::pf_gossip::SlotVersionEntry& NodeVersions::slots(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.NodeVersions.slots)
+  return _internal_slots(index);
 }
-inline ::pf_gossip::SearchResult_Message* SearchResult::_internal_add_message() {
-  return _impl_.message_.Add();
+inline ::pf_gossip::SlotVersionEntry* NodeVersions::_internal_add_slots() {
+  return _impl_.slots_.Add();
 }
-inline ::pf_gossip::SearchResult_Message* SearchResult::add_message() {
-  ::pf_gossip::SearchResult_Message* _add = _internal_add_message();
-  // @@protoc_insertion_point(field_add:pf_gossip.SearchResult.message)
+inline ::pf_gossip::SlotVersionEntry* NodeVersions::add_slots() {
+  ::pf_gossip::SlotVersionEntry* _add = _internal_add_slots();
+  // @@protoc_insertion_point(field_add:pf_gossip.NodeVersions.slots)
   return _add;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SearchResult_Message >&
-SearchResult::message() const {
-  // @@protoc_insertion_point(field_list:pf_gossip.SearchResult.message)
-  return _impl_.message_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >&
+NodeVersions::slots() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.NodeVersions.slots)
+  return _impl_.slots_;
 }
 
-// -------------------------------------------------------------------
-
-// updateResult
-
-// int32 succeed = 1;
-inline void updateResult::clear_succeed() {
-  _impl_.succeed_ = 0;
+// repeated .pf_gossip.MemberUpdate members = 5;
+inline int NodeVersions::_internal_members_size() const {
+  return _impl_.members_.size();
 }
-inline int32_t updateResult::_internal_succeed() const {
-  return _impl_.succeed_;
+inline int NodeVersions::members_size() const {
+  return _internal_members_size();
 }
-inline int32_t updateResult::succeed() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.updateResult.succeed)
-  return _internal_succeed();
+inline void NodeVersions::clear_members() {
+  _impl_.members_.Clear();
 }
-inline void updateResult::_internal_set_succeed(int32_t value) {
-  
-  _impl_.succeed_ = value;
+inline ::pf_gossip::MemberUpdate* NodeVersions::mutable_members(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.NodeVersions.members)
+  return _impl_.members_.Mutable(index);
 }
-inline void updateResult::set_succeed(int32_t value) {
-  _internal_set_succeed(value);
-  // @@protoc_insertion_point(field_set:pf_gossip.updateResult.succeed)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+NodeVersions::mutable_members() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.NodeVersions.members)
+  return &_impl_.members_;
+}
+inline const ::pf_gossip::MemberUpdate& NodeVersions::_internal_members(int index) const {
+  return _impl_.members_.Get(index);
+}
+inline const ::pf_gossip::MemberUpdate& NodeVersions::members(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.NodeVersions.members)
+  return _internal_members(index);
+}
+inline ::pf_gossip::MemberUpdate* NodeVersions::_internal_add_members() {
+  return _impl_.members_.Add();
+}
+inline ::pf_gossip::MemberUpdate* NodeVersions::add_members() {
+  ::pf_gossip::MemberUpdate* _add = _internal_add_members();
+  // @@protoc_insertion_point(field_add:pf_gossip.NodeVersions.members)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+NodeVersions::members() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.NodeVersions.members)
+  return _impl_.members_;
 }
 
-// int64 version = 2;
-inline void updateResult::clear_version() {
-  _impl_.version_ = int64_t{0};
+// bool full_slots = 6;
+inline void NodeVersions::clear_full_slots() {
+  _impl_.full_slots_ = false;
 }
-inline int64_t updateResult::_internal_version() const {
-  return _impl_.version_;
+inline bool NodeVersions::_internal_full_slots() const {
+  return _impl_.full_slots_;
 }
-inline int64_t updateResult::version() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.updateResult.version)
-  return _internal_version();
+inline bool NodeVersions::full_slots() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.NodeVersions.full_slots)
+  return _internal_full_slots();
 }
-inline void updateResult::_internal_set_version(int64_t value) {
+inline void NodeVersions::_internal_set_full_slots(bool value) {
   
-  _impl_.version_ = value;
+  _impl_.full_slots_ = value;
 }
-inline void updateResult::set_version(int64_t value) {
-  _internal_set_version(value);
-  // @@protoc_insertion_point(field_set:pf_gossip.updateResult.version)
+inline void NodeVersions::set_full_slots(bool value) {
+  _internal_set_full_slots(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.NodeVersions.full_slots)
 }
 
 // -------------------------------------------------------------------
 
-// SlotUpdate
+// SyncRequest
 
-// string name = 1;
-inline void SlotUpdate::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// string node_name = 1;
+inline void SyncRequest::clear_node_name() {
+  _impl_.node_name_.ClearToEmpty();
 }
-inline const std::string& SlotUpdate::name() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.name)
-  return _internal_name();
+inline const std::string& SyncRequest::node_name() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SyncRequest.node_name)
+  return _internal_node_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SlotUpdate::set_name(ArgT0&& arg0, ArgT... args) {
+void SyncRequest::set_node_name(ArgT0&& arg0, ArgT... args) {
  
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.name)
+ _impl_.node_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.SyncRequest.node_name)
 }
-inline std::string* SlotUpdate::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.SlotUpdate.name)
+inline std::string* SyncRequest::mutable_node_name() {
+  std::string* _s = _internal_mutable_node_name();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SyncRequest.node_name)
   return _s;
 }
-inline const std::string& SlotUpdate::_internal_name() const {
-  return _impl_.name_.Get();
+inline const std::string& SyncRequest::_internal_node_name() const {
+  return _impl_.node_name_.Get();
 }
-inline void SlotUpdate::_internal_set_name(const std::string& value) {
+inline void SyncRequest::_internal_set_node_name(const std::string& value) {
   
-  _impl_.name_.Set(value, GetArenaForAllocation());
+  _impl_.node_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SlotUpdate::_internal_mutable_name() {
+inline std::string* SyncRequest::_internal_mutable_node_name() {
   
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+  return _impl_.node_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SlotUpdate::release_name() {
-  // @@protoc_insertion_point(field_release:pf_gossip.SlotUpdate.name)
-  return _impl_.name_.Release();
+inline std::string* SyncRequest::release_node_name() {
+  // @@protoc_insertion_point(field_release:pf_gossip.SyncRequest.node_name)
+  return _impl_.node_name_.Release();
 }
-inline void SlotUpdate::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void SyncRequest::set_allocated_node_name(std::string* node_name) {
+  if (node_name != nullptr) {
     
   } else {
     
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.node_name_.SetAllocated(node_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.node_name_.IsDefault()) {
+    _impl_.node_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SlotUpdate.name)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.SyncRequest.node_name)
 }
 
-// int64 version = 2;
-inline void SlotUpdate::clear_version() {
-  _impl_.version_ = int64_t{0};
-}
-inline int64_t SlotUpdate::_internal_version() const {
-  return _impl_.version_;
-}
-inline int64_t SlotUpdate::version() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.version)
-  return _internal_version();
-}
-inline void SlotUpdate::_internal_set_version(int64_t value) {
-  
-  _impl_.version_ = value;
-}
-inline void SlotUpdate::set_version(int64_t value) {
-  _internal_set_version(value);
-  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.version)
-}
-
-// repeated .pf_gossip.Message messages = 3;
-inline int SlotUpdate::_internal_messages_size() const {
-  return _impl_.messages_.size();
+// repeated .pf_gossip.SlotVersionEntry slots = 2;
+inline int SyncRequest::_internal_slots_size() const {
+  return _impl_.slots_.size();
 }
-inline int SlotUpdate::messages_size() const {
-  return _internal_messages_size();
+inline int SyncRequest::slots_size() const {
+  return _internal_slots_size();
 }
-inline void SlotUpdate::clear_messages() {
-  _impl_.messages_.Clear();
+inline void SyncRequest::clear_slots() {
+  _impl_.slots_.Clear();
 }
-inline ::pf_gossip::Message* SlotUpdate::mutable_messages(int index) {
-  // @@protoc_insertion_point(field_mutable:pf_gossip.SlotUpdate.messages)
-  return _impl_.messages_.Mutable(index);
+inline ::pf_gossip::SlotVersionEntry* SyncRequest::mutable_slots(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SyncRequest.slots)
+  return _impl_.slots_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::Message >*
-SlotUpdate::mutable_messages() {
-  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SlotUpdate.messages)
-  return &_impl_.messages_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >*
+SyncRequest::mutable_slots() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SyncRequest.slots)
+  return &_impl_.slots_;
 }
-inline const ::pf_gossip::Message& SlotUpdate::_internal_messages(int index) const {
-  return _impl_.messages_.Get(index);
+inline const ::pf_gossip::SlotVersionEntry& SyncRequest::_internal_slots(int index) const {
+  return _impl_.slots_.Get(index);
 }
-inline const ::pf_gossip::Message& SlotUpdate::messages(int index) const {
-  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.messages)
-  return _internal_messages(index);
+inline const ::pf_gossip::SlotVersionEntry& SyncRequest::slots(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SyncRequest.slots)
+  return _internal_slots(index);
 }
-inline ::pf_gossip::Message* SlotUpdate::_internal_add_messages() {
-  return _impl_.messages_.Add();
+inline ::pf_gossip::SlotVersionEntry* SyncRequest::_internal_add_slots() {
+  return _impl_.slots_.Add();
 }
-inline ::pf_gossip::Message* SlotUpdate::add_messages() {
-  ::pf_gossip::Message* _add = _internal_add_messages();
-  // @@protoc_insertion_point(field_add:pf_gossip.SlotUpdate.messages)
+inline ::pf_gossip::SlotVersionEntry* SyncRequest::add_slots() {
+  ::pf_gossip::SlotVersionEntry* _add = _internal_add_slots();
+  // @@protoc_insertion_point(field_add:pf_gossip.SyncRequest.slots)
   return _add;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::Message >&
-SlotUpdate::messages() const {
-  // @@protoc_insertion_point(field_list:pf_gossip.SlotUpdate.messages)
-  return _impl_.messages_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >&
+SyncRequest::slots() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SyncRequest.slots)
+  return _impl_.slots_;
 }
 
-// repeated string pass_nodes = 4;
-inline int SlotUpdate::_internal_pass_nodes_size() const {
-  return _impl_.pass_nodes_.size();
+// repeated bytes updates = 3;
+inline int SyncRequest::_internal_updates_size() const {
+  return _impl_.updates_.size();
 }
-inline int SlotUpdate::pass_nodes_size() const {
-  return _internal_pass_nodes_size();
+inline int SyncRequest::updates_size() const {
+  return _internal_updates_size();
 }
-inline void SlotUpdate::clear_pass_nodes() {
-  _impl_.pass_nodes_.Clear();
+inline void SyncRequest::clear_updates() {
+  _impl_.updates_.Clear();
 }
-inline std::string* SlotUpdate::add_pass_nodes() {
-  std::string* _s = _internal_add_pass_nodes();
-  // @@protoc_insertion_point(field_add_mutable:pf_gossip.SlotUpdate.pass_nodes)
+inline std::string* SyncRequest::add_updates() {
+  std::string* _s = _internal_add_updates();
+  // @@protoc_insertion_point(field_add_mutable:pf_gossip.SyncRequest.updates)
   return _s;
 }
-inline const std::string& SlotUpdate::_internal_pass_nodes(int index) const {
-  return _impl_.pass_nodes_.Get(index);
+inline const std::string& SyncRequest::_internal_updates(int index) const {
+  return _impl_.updates_.Get(index);
 }
-inline const std::string& SlotUpdate::pass_nodes(int index) const {
-  // @@protoc_insertion_point(field_get:pf_gossip.SlotUpdate.pass_nodes)
-  return _internal_pass_nodes(index);
+inline const std::string& SyncRequest::updates(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SyncRequest.updates)
+  return _internal_updates(index);
 }
-inline std::string* SlotUpdate::mutable_pass_nodes(int index) {
-  // @@protoc_insertion_point(field_mutable:pf_gossip.SlotUpdate.pass_nodes)
-  return _impl_.pass_nodes_.Mutable(index);
+inline std::string* SyncRequest::mutable_updates(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SyncRequest.updates)
+  return _impl_.updates_.Mutable(index);
 }
-inline void SlotUpdate::set_pass_nodes(int index, const std::string& value) {
-  _impl_.pass_nodes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.pass_nodes)
+inline void SyncRequest::set_updates(int index, const std::string& value) {
+  _impl_.updates_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.SyncRequest.updates)
 }
-inline void SlotUpdate::set_pass_nodes(int index, std::string&& value) {
-  _impl_.pass_nodes_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:pf_gossip.SlotUpdate.pass_nodes)
+inline void SyncRequest::set_updates(int index, std::string&& value) {
+  _impl_.updates_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:pf_gossip.SyncRequest.updates)
 }
-inline void SlotUpdate::set_pass_nodes(int index, const char* value) {
+inline void SyncRequest::set_updates(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.pass_nodes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:pf_gossip.SlotUpdate.pass_nodes)
+  _impl_.updates_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:pf_gossip.SyncRequest.updates)
 }
-inline void SlotUpdate::set_pass_nodes(int index, const char* value, size_t size) {
-  _impl_.pass_nodes_.Mutable(index)->assign(
+inline void SyncRequest::set_updates(int index, const void* value, size_t size) {
+  _impl_.updates_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:pf_gossip.SlotUpdate.pass_nodes)
+  // @@protoc_insertion_point(field_set_pointer:pf_gossip.SyncRequest.updates)
 }
-inline std::string* SlotUpdate::_internal_add_pass_nodes() {
-  return _impl_.pass_nodes_.Add();
+inline std::string* SyncRequest::_internal_add_updates() {
+  return _impl_.updates_.Add();
 }
-inline void SlotUpdate::add_pass_nodes(const std::string& value) {
-  _impl_.pass_nodes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:pf_gossip.SlotUpdate.pass_nodes)
+inline void SyncRequest::add_updates(const std::string& value) {
+  _impl_.updates_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:pf_gossip.SyncRequest.updates)
 }
-inline void SlotUpdate::add_pass_nodes(std::string&& value) {
-  _impl_.pass_nodes_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:pf_gossip.SlotUpdate.pass_nodes)
+inline void SyncRequest::add_updates(std::string&& value) {
+  _impl_.updates_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:pf_gossip.SyncRequest.updates)
 }
-inline void SlotUpdate::add_pass_nodes(const char* value) {
+inline void SyncRequest::add_updates(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.pass_nodes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:pf_gossip.SlotUpdate.pass_nodes)
+  _impl_.updates_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:pf_gossip.SyncRequest.updates)
 }
-inline void SlotUpdate::add_pass_nodes(const char* value, size_t size) {
-  _impl_.pass_nodes_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:pf_gossip.SlotUpdate.pass_nodes)
+inline void SyncRequest::add_updates(const void* value, size_t size) {
+  _impl_.updates_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:pf_gossip.SyncRequest.updates)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-SlotUpdate::pass_nodes() const {
-  // @@protoc_insertion_point(field_list:pf_gossip.SlotUpdate.pass_nodes)
-  return _impl_.pass_nodes_;
+SyncRequest::updates() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SyncRequest.updates)
+  return _impl_.updates_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-SlotUpdate::mutable_pass_nodes() {
-  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SlotUpdate.pass_nodes)
-  return &_impl_.pass_nodes_;
+SyncRequest::mutable_updates() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SyncRequest.updates)
+  return &_impl_.updates_;
 }
 
-// -------------------------------------------------------------------
-
-// GossipNodeInfo
-
-// string name = 1;
-inline void GossipNodeInfo::clear_name() {
-  _impl_.name_.ClearToEmpty();
-}
-inline const std::string& GossipNodeInfo::name() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.GossipNodeInfo.name)
-  return _internal_name();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GossipNodeInfo::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.name)
-}
-inline std::string* GossipNodeInfo::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.GossipNodeInfo.name)
-  return _s;
-}
-inline const std::string& GossipNodeInfo::_internal_name() const {
-  return _impl_.name_.Get();
-}
-inline void GossipNodeInfo::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
+// repeated .pf_gossip.MemberUpdate members = 4;
+inline int SyncRequest::_internal_members_size() const {
+  return _impl_.members_.size();
 }
-inline std::string* GossipNodeInfo::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+inline int SyncRequest::members_size() const {
+  return _internal_members_size();
 }
-inline std::string* GossipNodeInfo::release_name() {
-  // @@protoc_insertion_point(field_release:pf_gossip.GossipNodeInfo.name)
-  return _impl_.name_.Release();
+inline void SyncRequest::clear_members() {
+  _impl_.members_.Clear();
 }
-inline void GossipNodeInfo::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.GossipNodeInfo.name)
+inline ::pf_gossip::MemberUpdate* SyncRequest::mutable_members(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SyncRequest.members)
+  return _impl_.members_.Mutable(index);
 }
-
-// int64 version = 2;
-inline void GossipNodeInfo::clear_version() {
-  _impl_.version_ = int64_t{0};
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+SyncRequest::mutable_members() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SyncRequest.members)
+  return &_impl_.members_;
 }
-inline int64_t GossipNodeInfo::_internal_version() const {
-  return _impl_.version_;
+inline const ::pf_gossip::MemberUpdate& SyncRequest::_internal_members(int index) const {
+  return _impl_.members_.Get(index);
 }
-inline int64_t GossipNodeInfo::version() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.GossipNodeInfo.version)
-  return _internal_version();
+inline const ::pf_gossip::MemberUpdate& SyncRequest::members(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SyncRequest.members)
+  return _internal_members(index);
 }
-inline void GossipNodeInfo::_internal_set_version(int64_t value) {
-  
-  _impl_.version_ = value;
+inline ::pf_gossip::MemberUpdate* SyncRequest::_internal_add_members() {
+  return _impl_.members_.Add();
 }
-inline void GossipNodeInfo::set_version(int64_t value) {
-  _internal_set_version(value);
-  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.version)
+inline ::pf_gossip::MemberUpdate* SyncRequest::add_members() {
+  ::pf_gossip::MemberUpdate* _add = _internal_add_members();
+  // @@protoc_insertion_point(field_add:pf_gossip.SyncRequest.members)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+SyncRequest::members() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SyncRequest.members)
+  return _impl_.members_;
 }
 
-// string address = 3;
-inline void GossipNodeInfo::clear_address() {
-  _impl_.address_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// SyncResponse
+
+// repeated .pf_gossip.SlotVersionEntry slots = 1;
+inline int SyncResponse::_internal_slots_size() const {
+  return _impl_.slots_.size();
 }
-inline const std::string& GossipNodeInfo::address() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.GossipNodeInfo.address)
-  return _internal_address();
+inline int SyncResponse::slots_size() const {
+  return _internal_slots_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GossipNodeInfo::set_address(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.address)
+inline void SyncResponse::clear_slots() {
+  _impl_.slots_.Clear();
 }
-inline std::string* GossipNodeInfo::mutable_address() {
-  std::string* _s = _internal_mutable_address();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.GossipNodeInfo.address)
-  return _s;
+inline ::pf_gossip::SlotVersionEntry* SyncResponse::mutable_slots(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SyncResponse.slots)
+  return _impl_.slots_.Mutable(index);
 }
-inline const std::string& GossipNodeInfo::_internal_address() const {
-  return _impl_.address_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >*
+SyncResponse::mutable_slots() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SyncResponse.slots)
+  return &_impl_.slots_;
 }
-inline void GossipNodeInfo::_internal_set_address(const std::string& value) {
-  
-  _impl_.address_.Set(value, GetArenaForAllocation());
+inline const ::pf_gossip::SlotVersionEntry& SyncResponse::_internal_slots(int index) const {
+  return _impl_.slots_.Get(index);
 }
-inline std::string* GossipNodeInfo::_internal_mutable_address() {
-  
-  return _impl_.address_.Mutable(GetArenaForAllocation());
+inline const ::pf_gossip::SlotVersionEntry& SyncResponse::slots(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SyncResponse.slots)
+  return _internal_slots(index);
 }
-inline std::string* GossipNodeInfo::release_address() {
-  // @@protoc_insertion_point(field_release:pf_gossip.GossipNodeInfo.address)
-  return _impl_.address_.Release();
+inline ::pf_gossip::SlotVersionEntry* SyncResponse::_internal_add_slots() {
+  return _impl_.slots_.Add();
 }
-inline void GossipNodeInfo::set_allocated_address(std::string* address) {
-  if (address != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.address_.SetAllocated(address, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.address_.IsDefault()) {
-    _impl_.address_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.GossipNodeInfo.address)
+inline ::pf_gossip::SlotVersionEntry* SyncResponse::add_slots() {
+  ::pf_gossip::SlotVersionEntry* _add = _internal_add_slots();
+  // @@protoc_insertion_point(field_add:pf_gossip.SyncResponse.slots)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SlotVersionEntry >&
+SyncResponse::slots() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SyncResponse.slots)
+  return _impl_.slots_;
 }
 
-// repeated string pass_nodes = 4;
-inline int GossipNodeInfo::_internal_pass_nodes_size() const {
-  return _impl_.pass_nodes_.size();
+// repeated bytes updates = 2;
+inline int SyncResponse::_internal_updates_size() const {
+  return _impl_.updates_.size();
 }
-inline int GossipNodeInfo::pass_nodes_size() const {
-  return _internal_pass_nodes_size();
+inline int SyncResponse::updates_size() const {
+  return _internal_updates_size();
 }
-inline void GossipNodeInfo::clear_pass_nodes() {
-  _impl_.pass_nodes_.Clear();
+inline void SyncResponse::clear_updates() {
+  _impl_.updates_.Clear();
 }
-inline std::string* GossipNodeInfo::add_pass_nodes() {
-  std::string* _s = _internal_add_pass_nodes();
-  // @@protoc_insertion_point(field_add_mutable:pf_gossip.GossipNodeInfo.pass_nodes)
+inline std::string* SyncResponse::add_updates() {
+  std::string* _s = _internal_add_updates();
+  // @@protoc_insertion_point(field_add_mutable:pf_gossip.SyncResponse.updates)
   return _s;
 }
-inline const std::string& GossipNodeInfo::_internal_pass_nodes(int index) const {
-  return _impl_.pass_nodes_.Get(index);
+inline const std::string& SyncResponse::_internal_updates(int index) const {
+  return _impl_.updates_.Get(index);
 }
-inline const std::string& GossipNodeInfo::pass_nodes(int index) const {
-  // @@protoc_insertion_point(field_get:pf_gossip.GossipNodeInfo.pass_nodes)
-  return _internal_pass_nodes(index);
+inline const std::string& SyncResponse::updates(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SyncResponse.updates)
+  return _internal_updates(index);
 }
-inline std::string* GossipNodeInfo::mutable_pass_nodes(int index) {
-  // @@protoc_insertion_point(field_mutable:pf_gossip.GossipNodeInfo.pass_nodes)
-  return _impl_.pass_nodes_.Mutable(index);
+inline std::string* SyncResponse::mutable_updates(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SyncResponse.updates)
+  return _impl_.updates_.Mutable(index);
 }
-inline void GossipNodeInfo::set_pass_nodes(int index, const std::string& value) {
-  _impl_.pass_nodes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.pass_nodes)
+inline void SyncResponse::set_updates(int index, const std::string& value) {
+  _impl_.updates_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.SyncResponse.updates)
 }
-inline void GossipNodeInfo::set_pass_nodes(int index, std::string&& value) {
-  _impl_.pass_nodes_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:pf_gossip.GossipNodeInfo.pass_nodes)
+inline void SyncResponse::set_updates(int index, std::string&& value) {
+  _impl_.updates_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:pf_gossip.SyncResponse.updates)
 }
-inline void GossipNodeInfo::set_pass_nodes(int index, const char* value) {
+inline void SyncResponse::set_updates(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.pass_nodes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:pf_gossip.GossipNodeInfo.pass_nodes)
+  _impl_.updates_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:pf_gossip.SyncResponse.updates)
 }
-inline void GossipNodeInfo::set_pass_nodes(int index, const char* value, size_t size) {
-  _impl_.pass_nodes_.Mutable(index)->assign(
+inline void SyncResponse::set_updates(int index, const void* value, size_t size) {
+  _impl_.updates_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:pf_gossip.GossipNodeInfo.pass_nodes)
+  // @@protoc_insertion_point(field_set_pointer:pf_gossip.SyncResponse.updates)
 }
-inline std::string* GossipNodeInfo::_internal_add_pass_nodes() {
-  return _impl_.pass_nodes_.Add();
+inline std::string* SyncResponse::_internal_add_updates() {
+  return _impl_.updates_.Add();
 }
-inline void GossipNodeInfo::add_pass_nodes(const std::string& value) {
-  _impl_.pass_nodes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:pf_gossip.GossipNodeInfo.pass_nodes)
+inline void SyncResponse::add_updates(const std::string& value) {
+  _impl_.updates_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:pf_gossip.SyncResponse.updates)
 }
-inline void GossipNodeInfo::add_pass_nodes(std::string&& value) {
-  _impl_.pass_nodes_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:pf_gossip.GossipNodeInfo.pass_nodes)
+inline void SyncResponse::add_updates(std::string&& value) {
+  _impl_.updates_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:pf_gossip.SyncResponse.updates)
 }
-inline void GossipNodeInfo::add_pass_nodes(const char* value) {
+inline void SyncResponse::add_updates(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.pass_nodes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:pf_gossip.GossipNodeInfo.pass_nodes)
+  _impl_.updates_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:pf_gossip.SyncResponse.updates)
 }
-inline void GossipNodeInfo::add_pass_nodes(const char* value, size_t size) {
-  _impl_.pass_nodes_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:pf_gossip.GossipNodeInfo.pass_nodes)
+inline void SyncResponse::add_updates(const void* value, size_t size) {
+  _impl_.updates_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:pf_gossip.SyncResponse.updates)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-GossipNodeInfo::pass_nodes() const {
-  // @@protoc_insertion_point(field_list:pf_gossip.GossipNodeInfo.pass_nodes)
-  return _impl_.pass_nodes_;
+SyncResponse::updates() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SyncResponse.updates)
+  return _impl_.updates_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-GossipNodeInfo::mutable_pass_nodes() {
-  // @@protoc_insertion_point(field_mutable_list:pf_gossip.GossipNodeInfo.pass_nodes)
-  return &_impl_.pass_nodes_;
+SyncResponse::mutable_updates() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SyncResponse.updates)
+  return &_impl_.updates_;
+}
+
+// repeated .pf_gossip.MemberUpdate members = 3;
+inline int SyncResponse::_internal_members_size() const {
+  return _impl_.members_.size();
+}
+inline int SyncResponse::members_size() const {
+  return _internal_members_size();
+}
+inline void SyncResponse::clear_members() {
+  _impl_.members_.Clear();
+}
+inline ::pf_gossip::MemberUpdate* SyncResponse::mutable_members(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.SyncResponse.members)
+  return _impl_.members_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+SyncResponse::mutable_members() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.SyncResponse.members)
+  return &_impl_.members_;
+}
+inline const ::pf_gossip::MemberUpdate& SyncResponse::_internal_members(int index) const {
+  return _impl_.members_.Get(index);
+}
+inline const ::pf_gossip::MemberUpdate& SyncResponse::members(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.SyncResponse.members)
+  return _internal_members(index);
+}
+inline ::pf_gossip::MemberUpdate* SyncResponse::_internal_add_members() {
+  return _impl_.members_.Add();
+}
+inline ::pf_gossip::MemberUpdate* SyncResponse::add_members() {
+  ::pf_gossip::MemberUpdate* _add = _internal_add_members();
+  // @@protoc_insertion_point(field_add:pf_gossip.SyncResponse.members)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+SyncResponse::members() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.SyncResponse.members)
+  return _impl_.members_;
 }
 
 // -------------------------------------------------------------------
 
-// NodeVersions
+// PingRequest
 
 // string node_name = 1;
-inline void NodeVersions::clear_node_name() {
+inline void PingRequest::clear_node_name() {
   _impl_.node_name_.ClearToEmpty();
 }
-inline const std::string& NodeVersions::node_name() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.NodeVersions.node_name)
+inline const std::string& PingRequest::node_name() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.PingRequest.node_name)
   return _internal_node_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void NodeVersions::set_node_name(ArgT0&& arg0, ArgT... args) {
+void PingRequest::set_node_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.node_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.NodeVersions.node_name)
+  // @@protoc_insertion_point(field_set:pf_gossip.PingRequest.node_name)
 }
-inline std::string* NodeVersions::mutable_node_name() {
+inline std::string* PingRequest::mutable_node_name() {
   std::string* _s = _internal_mutable_node_name();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.NodeVersions.node_name)
+  // @@protoc_insertion_point(field_mutable:pf_gossip.PingRequest.node_name)
   return _s;
 }
-inline const std::string& NodeVersions::_internal_node_name() const {
+inline const std::string& PingRequest::_internal_node_name() const {
   return _impl_.node_name_.Get();
 }
-inline void NodeVersions::_internal_set_node_name(const std::string& value) {
+inline void PingRequest::_internal_set_node_name(const std::string& value) {
   
   _impl_.node_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NodeVersions::_internal_mutable_node_name() {
+inline std::string* PingRequest::_internal_mutable_node_name() {
   
   return _impl_.node_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* NodeVersions::release_node_name() {
-  // @@protoc_insertion_point(field_release:pf_gossip.NodeVersions.node_name)
+inline std::string* PingRequest::release_node_name() {
+  // @@protoc_insertion_point(field_release:pf_gossip.PingRequest.node_name)
   return _impl_.node_name_.Release();
 }
-inline void NodeVersions::set_allocated_node_name(std::string* node_name) {
+inline void PingRequest::set_allocated_node_name(std::string* node_name) {
   if (node_name != nullptr) {
     
   } else {
@@ -2169,77 +5210,181 @@ inline void NodeVersions::set_allocated_node_name(std::string* node_name) {
     _impl_.node_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.NodeVersions.node_name)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.PingRequest.node_name)
 }
 
-// string slot_name = 2;
-inline void NodeVersions::clear_slot_name() {
-  _impl_.slot_name_.ClearToEmpty();
+// string target = 2;
+inline void PingRequest::clear_target() {
+  _impl_.target_.ClearToEmpty();
 }
-inline const std::string& NodeVersions::slot_name() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.NodeVersions.slot_name)
-  return _internal_slot_name();
+inline const std::string& PingRequest::target() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.PingRequest.target)
+  return _internal_target();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void NodeVersions::set_slot_name(ArgT0&& arg0, ArgT... args) {
+void PingRequest::set_target(ArgT0&& arg0, ArgT... args) {
  
- _impl_.slot_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip.NodeVersions.slot_name)
+ _impl_.target_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip.PingRequest.target)
 }
-inline std::string* NodeVersions::mutable_slot_name() {
-  std::string* _s = _internal_mutable_slot_name();
-  // @@protoc_insertion_point(field_mutable:pf_gossip.NodeVersions.slot_name)
+inline std::string* PingRequest::mutable_target() {
+  std::string* _s = _internal_mutable_target();
+  // @@protoc_insertion_point(field_mutable:pf_gossip.PingRequest.target)
   return _s;
 }
-inline const std::string& NodeVersions::_internal_slot_name() const {
-  return _impl_.slot_name_.Get();
+inline const std::string& PingRequest::_internal_target() const {
+  return _impl_.target_.Get();
 }
-inline void NodeVersions::_internal_set_slot_name(const std::string& value) {
+inline void PingRequest::_internal_set_target(const std::string& value) {
   
-  _impl_.slot_name_.Set(value, GetArenaForAllocation());
+  _impl_.target_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NodeVersions::_internal_mutable_slot_name() {
+inline std::string* PingRequest::_internal_mutable_target() {
   
-  return _impl_.slot_name_.Mutable(GetArenaForAllocation());
+  return _impl_.target_.Mutable(GetArenaForAllocation());
 }
-inline std::string* NodeVersions::release_slot_name() {
-  // @@protoc_insertion_point(field_release:pf_gossip.NodeVersions.slot_name)
-  return _impl_.slot_name_.Release();
+inline std::string* PingRequest::release_target() {
+  // @@protoc_insertion_point(field_release:pf_gossip.PingRequest.target)
+  return _impl_.target_.Release();
 }
-inline void NodeVersions::set_allocated_slot_name(std::string* slot_name) {
-  if (slot_name != nullptr) {
+inline void PingRequest::set_allocated_target(std::string* target) {
+  if (target != nullptr) {
     
   } else {
     
   }
-  _impl_.slot_name_.SetAllocated(slot_name, GetArenaForAllocation());
+  _impl_.target_.SetAllocated(target, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.slot_name_.IsDefault()) {
-    _impl_.slot_name_.Set("", GetArenaForAllocation());
+  if (_impl_.target_.IsDefault()) {
+    _impl_.target_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip.NodeVersions.slot_name)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip.PingRequest.target)
 }
 
-// int64 slot_version = 3;
-inline void NodeVersions::clear_slot_version() {
-  _impl_.slot_version_ = int64_t{0};
+// int64 timeout_ms = 3;
+inline void PingRequest::clear_timeout_ms() {
+  _impl_.timeout_ms_ = int64_t{0};
 }
-inline int64_t NodeVersions::_internal_slot_version() const {
-  return _impl_.slot_version_;
+inline int64_t PingRequest::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
 }
-inline int64_t NodeVersions::slot_version() const {
-  // @@protoc_insertion_point(field_get:pf_gossip.NodeVersions.slot_version)
-  return _internal_slot_version();
+inline int64_t PingRequest::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.PingRequest.timeout_ms)
+  return _internal_timeout_ms();
 }
-inline void NodeVersions::_internal_set_slot_version(int64_t value) {
+inline void PingRequest::_internal_set_timeout_ms(int64_t value) {
   
-  _impl_.slot_version_ = value;
+  _impl_.timeout_ms_ = value;
 }
-inline void NodeVersions::set_slot_version(int64_t value) {
-  _internal_set_slot_version(value);
-  // @@protoc_insertion_point(field_set:pf_gossip.NodeVersions.slot_version)
+inline void PingRequest::set_timeout_ms(int64_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.PingRequest.timeout_ms)
+}
+
+// repeated .pf_gossip.MemberUpdate members = 4;
+inline int PingRequest::_internal_members_size() const {
+  return _impl_.members_.size();
+}
+inline int PingRequest::members_size() const {
+  return _internal_members_size();
+}
+inline void PingRequest::clear_members() {
+  _impl_.members_.Clear();
+}
+inline ::pf_gossip::MemberUpdate* PingRequest::mutable_members(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.PingRequest.members)
+  return _impl_.members_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+PingRequest::mutable_members() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.PingRequest.members)
+  return &_impl_.members_;
+}
+inline const ::pf_gossip::MemberUpdate& PingRequest::_internal_members(int index) const {
+  return _impl_.members_.Get(index);
+}
+inline const ::pf_gossip::MemberUpdate& PingRequest::members(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.PingRequest.members)
+  return _internal_members(index);
+}
+inline ::pf_gossip::MemberUpdate* PingRequest::_internal_add_members() {
+  return _impl_.members_.Add();
+}
+inline ::pf_gossip::MemberUpdate* PingRequest::add_members() {
+  ::pf_gossip::MemberUpdate* _add = _internal_add_members();
+  // @@protoc_insertion_point(field_add:pf_gossip.PingRequest.members)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+PingRequest::members() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.PingRequest.members)
+  return _impl_.members_;
+}
+
+// -------------------------------------------------------------------
+
+// PingResponse
+
+// bool ack = 1;
+inline void PingResponse::clear_ack() {
+  _impl_.ack_ = false;
+}
+inline bool PingResponse::_internal_ack() const {
+  return _impl_.ack_;
+}
+inline bool PingResponse::ack() const {
+  // @@protoc_insertion_point(field_get:pf_gossip.PingResponse.ack)
+  return _internal_ack();
+}
+inline void PingResponse::_internal_set_ack(bool value) {
+  
+  _impl_.ack_ = value;
+}
+inline void PingResponse::set_ack(bool value) {
+  _internal_set_ack(value);
+  // @@protoc_insertion_point(field_set:pf_gossip.PingResponse.ack)
+}
+
+// repeated .pf_gossip.MemberUpdate members = 2;
+inline int PingResponse::_internal_members_size() const {
+  return _impl_.members_.size();
+}
+inline int PingResponse::members_size() const {
+  return _internal_members_size();
+}
+inline void PingResponse::clear_members() {
+  _impl_.members_.Clear();
+}
+inline ::pf_gossip::MemberUpdate* PingResponse::mutable_members(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip.PingResponse.members)
+  return _impl_.members_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >*
+PingResponse::mutable_members() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip.PingResponse.members)
+  return &_impl_.members_;
+}
+inline const ::pf_gossip::MemberUpdate& PingResponse::_internal_members(int index) const {
+  return _impl_.members_.Get(index);
+}
+inline const ::pf_gossip::MemberUpdate& PingResponse::members(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip.PingResponse.members)
+  return _internal_members(index);
+}
+inline ::pf_gossip::MemberUpdate* PingResponse::_internal_add_members() {
+  return _impl_.members_.Add();
+}
+inline ::pf_gossip::MemberUpdate* PingResponse::add_members() {
+  ::pf_gossip::MemberUpdate* _add = _internal_add_members();
+  // @@protoc_insertion_point(field_add:pf_gossip.PingResponse.members)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::MemberUpdate >&
+PingResponse::members() const {
+  // @@protoc_insertion_point(field_list:pf_gossip.PingResponse.members)
+  return _impl_.members_;
 }
 
 #ifdef __GNUC__
@@ -2257,11 +5402,39 @@ inline void NodeVersions::set_slot_version(int64_t value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace pf_gossip
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::pf_gossip::MemberState> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::pf_gossip::MemberState>() {
+  return ::pf_gossip::MemberState_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -6,26 +6,30 @@
 #include "GossipCli.grpc.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/channel_interface.h>
-#include <grpcpp/impl/codegen/client_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
-#include <grpcpp/impl/codegen/rpc_service_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
 namespace pf_gossip_cli {
 
 static const char* GossipClient_method_names[] = {
   "/pf_gossip_cli.GossipClient/addMessage",
+  "/pf_gossip_cli.GossipClient/addMessages",
   "/pf_gossip_cli.GossipClient/deleteMessage",
   "/pf_gossip_cli.GossipClient/getMessage",
+  "/pf_gossip_cli.GossipClient/getMessages",
   "/pf_gossip_cli.GossipClient/searchMessage",
+  "/pf_gossip_cli.GossipClient/scanPrefix",
+  "/pf_gossip_cli.GossipClient/scanRange",
   "/pf_gossip_cli.GossipClient/getGossipNetwork",
   "/pf_gossip_cli.GossipClient/getNodeStatus",
   "/pf_gossip_cli.GossipClient/echo",
@@ -41,14 +45,18 @@ std::unique_ptr< GossipClient::Stub> GossipClient::NewStub(const std::shared_ptr
 
 GossipClient::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_addMessage_(GossipClient_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_deleteMessage_(GossipClient_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_getMessage_(GossipClient_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_searchMessage_(GossipClient_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_getGossipNetwork_(GossipClient_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_getNodeStatus_(GossipClient_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_echo_(GossipClient_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_connect_(GossipClient_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_shutdown_(GossipClient_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_addMessages_(GossipClient_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_deleteMessage_(GossipClient_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_getMessage_(GossipClient_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_getMessages_(GossipClient_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_searchMessage_(GossipClient_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_scanPrefix_(GossipClient_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_scanRange_(GossipClient_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_getGossipNetwork_(GossipClient_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_getNodeStatus_(GossipClient_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_echo_(GossipClient_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_connect_(GossipClient_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_shutdown_(GossipClient_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status GossipClient::Stub::addMessage(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::pf_gossip_cli::Echo* response) {
@@ -74,6 +82,29 @@ void GossipClient::Stub::async::addMessage(::grpc::ClientContext* context, const
   return result;
 }
 
+::grpc::Status GossipClient::Stub::addMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::pf_gossip_cli::WriteResult* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::pf_gossip_cli::WriteBatch, ::pf_gossip_cli::WriteResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_addMessages_, context, request, response);
+}
+
+void GossipClient::Stub::async::addMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch* request, ::pf_gossip_cli::WriteResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::pf_gossip_cli::WriteBatch, ::pf_gossip_cli::WriteResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_addMessages_, context, request, response, std::move(f));
+}
+
+void GossipClient::Stub::async::addMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch* request, ::pf_gossip_cli::WriteResult* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_addMessages_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::WriteResult>* GossipClient::Stub::PrepareAsyncaddMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::pf_gossip_cli::WriteResult, ::pf_gossip_cli::WriteBatch, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_addMessages_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::WriteResult>* GossipClient::Stub::AsyncaddMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncaddMessagesRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status GossipClient::Stub::deleteMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::pf_gossip_cli::Echo* response) {
   return ::grpc::internal::BlockingUnaryCall< ::pf_gossip_cli::Key, ::pf_gossip_cli::Echo, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_deleteMessage_, context, request, response);
 }
@@ -120,6 +151,29 @@ void GossipClient::Stub::async::getMessage(::grpc::ClientContext* context, const
   return result;
 }
 
+::grpc::Status GossipClient::Stub::getMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::pf_gossip::SearchResult* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::pf_gossip_cli::KeyList, ::pf_gossip::SearchResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_getMessages_, context, request, response);
+}
+
+void GossipClient::Stub::async::getMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList* request, ::pf_gossip::SearchResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::pf_gossip_cli::KeyList, ::pf_gossip::SearchResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_getMessages_, context, request, response, std::move(f));
+}
+
+void GossipClient::Stub::async::getMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList* request, ::pf_gossip::SearchResult* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_getMessages_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>* GossipClient::Stub::PrepareAsyncgetMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::pf_gossip::SearchResult, ::pf_gossip_cli::KeyList, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_getMessages_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>* GossipClient::Stub::AsyncgetMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncgetMessagesRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status GossipClient::Stub::searchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::pf_gossip::SearchResult* response) {
   return ::grpc::internal::BlockingUnaryCall< ::pf_gossip_cli::SearchInfo, ::pf_gossip::SearchResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_searchMessage_, context, request, response);
 }
@@ -143,6 +197,38 @@ void GossipClient::Stub::async::searchMessage(::grpc::ClientContext* context, co
   return result;
 }
 
+::grpc::ClientReader< ::pf_gossip_cli::ScanResult>* GossipClient::Stub::scanPrefixRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request) {
+  return ::grpc::internal::ClientReaderFactory< ::pf_gossip_cli::ScanResult>::Create(channel_.get(), rpcmethod_scanPrefix_, context, request);
+}
+
+void GossipClient::Stub::async::scanPrefix(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan* request, ::grpc::ClientReadReactor< ::pf_gossip_cli::ScanResult>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::pf_gossip_cli::ScanResult>::Create(stub_->channel_.get(), stub_->rpcmethod_scanPrefix_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>* GossipClient::Stub::AsyncscanPrefixRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::pf_gossip_cli::ScanResult>::Create(channel_.get(), cq, rpcmethod_scanPrefix_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>* GossipClient::Stub::PrepareAsyncscanPrefixRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::pf_gossip_cli::ScanResult>::Create(channel_.get(), cq, rpcmethod_scanPrefix_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::pf_gossip_cli::ScanResult>* GossipClient::Stub::scanRangeRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request) {
+  return ::grpc::internal::ClientReaderFactory< ::pf_gossip_cli::ScanResult>::Create(channel_.get(), rpcmethod_scanRange_, context, request);
+}
+
+void GossipClient::Stub::async::scanRange(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan* request, ::grpc::ClientReadReactor< ::pf_gossip_cli::ScanResult>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::pf_gossip_cli::ScanResult>::Create(stub_->channel_.get(), stub_->rpcmethod_scanRange_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>* GossipClient::Stub::AsyncscanRangeRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::pf_gossip_cli::ScanResult>::Create(channel_.get(), cq, rpcmethod_scanRange_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>* GossipClient::Stub::PrepareAsyncscanRangeRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::pf_gossip_cli::ScanResult>::Create(channel_.get(), cq, rpcmethod_scanRange_, context, request, false, nullptr);
+}
+
 ::grpc::Status GossipClient::Stub::getGossipNetwork(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::pf_gossip_cli::JsonValue* response) {
   return ::grpc::internal::BlockingUnaryCall< ::google::protobuf::Any, ::pf_gossip_cli::JsonValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_getGossipNetwork_, context, request, response);
 }
@@ -272,6 +358,16 @@ GossipClient::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       GossipClient_method_names[1],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::pf_gossip_cli::WriteBatch, ::pf_gossip_cli::WriteResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GossipClient::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::pf_gossip_cli::WriteBatch* req,
+             ::pf_gossip_cli::WriteResult* resp) {
+               return service->addMessages(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GossipClient_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::pf_gossip_cli::Key, ::pf_gossip_cli::Echo, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](GossipClient::Service* service,
              ::grpc::ServerContext* ctx,
@@ -280,7 +376,7 @@ GossipClient::Service::Service() {
                return service->deleteMessage(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GossipClient_method_names[2],
+      GossipClient_method_names[3],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::pf_gossip_cli::Key, ::pf_gossip::Message, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](GossipClient::Service* service,
@@ -290,7 +386,17 @@ GossipClient::Service::Service() {
                return service->getMessage(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GossipClient_method_names[3],
+      GossipClient_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::pf_gossip_cli::KeyList, ::pf_gossip::SearchResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GossipClient::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::pf_gossip_cli::KeyList* req,
+             ::pf_gossip::SearchResult* resp) {
+               return service->getMessages(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GossipClient_method_names[5],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::pf_gossip_cli::SearchInfo, ::pf_gossip::SearchResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](GossipClient::Service* service,
@@ -300,7 +406,27 @@ GossipClient::Service::Service() {
                return service->searchMessage(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GossipClient_method_names[4],
+      GossipClient_method_names[6],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< GossipClient::Service, ::pf_gossip_cli::PrefixScan, ::pf_gossip_cli::ScanResult>(
+          [](GossipClient::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::pf_gossip_cli::PrefixScan* req,
+             ::grpc::ServerWriter<::pf_gossip_cli::ScanResult>* writer) {
+               return service->scanPrefix(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GossipClient_method_names[7],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< GossipClient::Service, ::pf_gossip_cli::RangeScan, ::pf_gossip_cli::ScanResult>(
+          [](GossipClient::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::pf_gossip_cli::RangeScan* req,
+             ::grpc::ServerWriter<::pf_gossip_cli::ScanResult>* writer) {
+               return service->scanRange(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GossipClient_method_names[8],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::google::protobuf::Any, ::pf_gossip_cli::JsonValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](GossipClient::Service* service,
@@ -310,7 +436,7 @@ GossipClient::Service::Service() {
                return service->getGossipNetwork(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GossipClient_method_names[5],
+      GossipClient_method_names[9],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::google::protobuf::Any, ::pf_gossip_cli::JsonValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](GossipClient::Service* service,
@@ -320,7 +446,7 @@ GossipClient::Service::Service() {
                return service->getNodeStatus(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GossipClient_method_names[6],
+      GossipClient_method_names[10],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::pf_gossip_cli::Echo, ::pf_gossip_cli::Echo, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](GossipClient::Service* service,
@@ -330,7 +456,7 @@ GossipClient::Service::Service() {
                return service->echo(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GossipClient_method_names[7],
+      GossipClient_method_names[11],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::pf_gossip_cli::Url, ::pf_gossip_cli::Echo, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](GossipClient::Service* service,
@@ -340,7 +466,7 @@ GossipClient::Service::Service() {
                return service->connect(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GossipClient_method_names[8],
+      GossipClient_method_names[12],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< GossipClient::Service, ::google::protobuf::Any, ::pf_gossip_cli::Echo, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](GossipClient::Service* service,
@@ -361,6 +487,13 @@ GossipClient::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status GossipClient::Service::addMessages(::grpc::ServerContext* context, const ::pf_gossip_cli::WriteBatch* request, ::pf_gossip_cli::WriteResult* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status GossipClient::Service::deleteMessage(::grpc::ServerContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip_cli::Echo* response) {
   (void) context;
   (void) request;
@@ -375,6 +508,13 @@ GossipClient::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status GossipClient::Service::getMessages(::grpc::ServerContext* context, const ::pf_gossip_cli::KeyList* request, ::pf_gossip::SearchResult* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status GossipClient::Service::searchMessage(::grpc::ServerContext* context, const ::pf_gossip_cli::SearchInfo* request, ::pf_gossip::SearchResult* response) {
   (void) context;
   (void) request;
@@ -382,6 +522,20 @@ GossipClient::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status GossipClient::Service::scanPrefix(::grpc::ServerContext* context, const ::pf_gossip_cli::PrefixScan* request, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GossipClient::Service::scanRange(::grpc::ServerContext* context, const ::pf_gossip_cli::RangeScan* request, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status GossipClient::Service::getGossipNetwork(::grpc::ServerContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response) {
   (void) context;
   (void) request;
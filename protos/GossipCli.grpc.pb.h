@@ -7,23 +7,23 @@
 #include "GossipCli.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_generic_service.h>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/client_context.h>
-#include <grpcpp/impl/codegen/completion_queue.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/codegen/proto_utils.h>
-#include <grpcpp/impl/codegen/rpc_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
 #include <grpcpp/impl/codegen/status.h>
-#include <grpcpp/impl/codegen/stub_options.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 namespace pf_gossip_cli {
 
@@ -42,6 +42,14 @@ class GossipClient final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::Echo>> PrepareAsyncaddMessage(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::Echo>>(PrepareAsyncaddMessageRaw(context, request, cq));
     }
+    virtual ::grpc::Status addMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::pf_gossip_cli::WriteResult* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::WriteResult>> AsyncaddMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::WriteResult>>(AsyncaddMessagesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::WriteResult>> PrepareAsyncaddMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::WriteResult>>(PrepareAsyncaddMessagesRaw(context, request, cq));
+    }
+    // 批量写入和删除，只使用一个版本并且只传播一次
     virtual ::grpc::Status deleteMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::pf_gossip_cli::Echo* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::Echo>> AsyncdeleteMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::Echo>>(AsyncdeleteMessageRaw(context, request, cq));
@@ -57,6 +65,14 @@ class GossipClient final {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::Message>>(PrepareAsyncgetMessageRaw(context, request, cq));
     }
     // 查找 message 信息
+    virtual ::grpc::Status getMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::pf_gossip::SearchResult* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>> AsyncgetMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>>(AsyncgetMessagesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>> PrepareAsyncgetMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>>(PrepareAsyncgetMessagesRaw(context, request, cq));
+    }
+    // 批量查找，结果与请求中的键一一对应，未找到时 version 为 0
     virtual ::grpc::Status searchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::pf_gossip::SearchResult* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>> AsyncsearchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>>(AsyncsearchMessageRaw(context, request, cq));
@@ -64,6 +80,26 @@ class GossipClient final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>> PrepareAsyncsearchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>>(PrepareAsyncsearchMessageRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::pf_gossip_cli::ScanResult>> scanPrefix(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::pf_gossip_cli::ScanResult>>(scanPrefixRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>> AsyncscanPrefix(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>>(AsyncscanPrefixRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>> PrepareAsyncscanPrefix(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>>(PrepareAsyncscanPrefixRaw(context, request, cq));
+    }
+    // 按键的顺序分段返回一个 slot 中以 prefix 开头的键值对
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::pf_gossip_cli::ScanResult>> scanRange(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::pf_gossip_cli::ScanResult>>(scanRangeRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>> AsyncscanRange(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>>(AsyncscanRangeRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>> PrepareAsyncscanRange(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>>(PrepareAsyncscanRangeRaw(context, request, cq));
+    }
+    // 按键的顺序分段返回一个 slot 中 [start, end) 范围内的键值对
     virtual ::grpc::Status getGossipNetwork(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::pf_gossip_cli::JsonValue* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::JsonValue>> AsyncgetGossipNetwork(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::JsonValue>>(AsyncgetGossipNetworkRaw(context, request, cq));
@@ -108,13 +144,23 @@ class GossipClient final {
       virtual ~async_interface() {}
       virtual void addMessage(::grpc::ClientContext* context, const ::pf_gossip::Message* request, ::pf_gossip_cli::Echo* response, std::function<void(::grpc::Status)>) = 0;
       virtual void addMessage(::grpc::ClientContext* context, const ::pf_gossip::Message* request, ::pf_gossip_cli::Echo* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void addMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch* request, ::pf_gossip_cli::WriteResult* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void addMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch* request, ::pf_gossip_cli::WriteResult* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // 批量写入和删除，只使用一个版本并且只传播一次
       virtual void deleteMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip_cli::Echo* response, std::function<void(::grpc::Status)>) = 0;
       virtual void deleteMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip_cli::Echo* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void getMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip::Message* response, std::function<void(::grpc::Status)>) = 0;
       virtual void getMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip::Message* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // 查找 message 信息
+      virtual void getMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList* request, ::pf_gossip::SearchResult* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void getMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList* request, ::pf_gossip::SearchResult* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // 批量查找，结果与请求中的键一一对应，未找到时 version 为 0
       virtual void searchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo* request, ::pf_gossip::SearchResult* response, std::function<void(::grpc::Status)>) = 0;
       virtual void searchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo* request, ::pf_gossip::SearchResult* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void scanPrefix(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan* request, ::grpc::ClientReadReactor< ::pf_gossip_cli::ScanResult>* reactor) = 0;
+      // 按键的顺序分段返回一个 slot 中以 prefix 开头的键值对
+      virtual void scanRange(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan* request, ::grpc::ClientReadReactor< ::pf_gossip_cli::ScanResult>* reactor) = 0;
+      // 按键的顺序分段返回一个 slot 中 [start, end) 范围内的键值对
       virtual void getGossipNetwork(::grpc::ClientContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response, std::function<void(::grpc::Status)>) = 0;
       virtual void getGossipNetwork(::grpc::ClientContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // 当前的网络结构
@@ -136,12 +182,22 @@ class GossipClient final {
    private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::Echo>* AsyncaddMessageRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::Echo>* PrepareAsyncaddMessageRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::WriteResult>* AsyncaddMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::WriteResult>* PrepareAsyncaddMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::Echo>* AsyncdeleteMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::Echo>* PrepareAsyncdeleteMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::Message>* AsyncgetMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::Message>* PrepareAsyncgetMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>* AsyncgetMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>* PrepareAsyncgetMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>* AsyncsearchMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip::SearchResult>* PrepareAsyncsearchMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::pf_gossip_cli::ScanResult>* scanPrefixRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>* AsyncscanPrefixRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>* PrepareAsyncscanPrefixRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::pf_gossip_cli::ScanResult>* scanRangeRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>* AsyncscanRangeRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::pf_gossip_cli::ScanResult>* PrepareAsyncscanRangeRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::JsonValue>* AsyncgetGossipNetworkRaw(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::JsonValue>* PrepareAsyncgetGossipNetworkRaw(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::pf_gossip_cli::JsonValue>* AsyncgetNodeStatusRaw(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) = 0;
@@ -163,6 +219,13 @@ class GossipClient final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>> PrepareAsyncaddMessage(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>>(PrepareAsyncaddMessageRaw(context, request, cq));
     }
+    ::grpc::Status addMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::pf_gossip_cli::WriteResult* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::WriteResult>> AsyncaddMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::WriteResult>>(AsyncaddMessagesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::WriteResult>> PrepareAsyncaddMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::WriteResult>>(PrepareAsyncaddMessagesRaw(context, request, cq));
+    }
     ::grpc::Status deleteMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::pf_gossip_cli::Echo* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>> AsyncdeleteMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>>(AsyncdeleteMessageRaw(context, request, cq));
@@ -177,6 +240,13 @@ class GossipClient final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>> PrepareAsyncgetMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>>(PrepareAsyncgetMessageRaw(context, request, cq));
     }
+    ::grpc::Status getMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::pf_gossip::SearchResult* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>> AsyncgetMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>>(AsyncgetMessagesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>> PrepareAsyncgetMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>>(PrepareAsyncgetMessagesRaw(context, request, cq));
+    }
     ::grpc::Status searchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::pf_gossip::SearchResult* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>> AsyncsearchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>>(AsyncsearchMessageRaw(context, request, cq));
@@ -184,6 +254,24 @@ class GossipClient final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>> PrepareAsyncsearchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>>(PrepareAsyncsearchMessageRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::pf_gossip_cli::ScanResult>> scanPrefix(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::pf_gossip_cli::ScanResult>>(scanPrefixRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>> AsyncscanPrefix(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>>(AsyncscanPrefixRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>> PrepareAsyncscanPrefix(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>>(PrepareAsyncscanPrefixRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::pf_gossip_cli::ScanResult>> scanRange(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::pf_gossip_cli::ScanResult>>(scanRangeRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>> AsyncscanRange(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>>(AsyncscanRangeRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>> PrepareAsyncscanRange(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>>(PrepareAsyncscanRangeRaw(context, request, cq));
+    }
     ::grpc::Status getGossipNetwork(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::pf_gossip_cli::JsonValue* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::JsonValue>> AsyncgetGossipNetwork(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::JsonValue>>(AsyncgetGossipNetworkRaw(context, request, cq));
@@ -224,12 +312,18 @@ class GossipClient final {
      public:
       void addMessage(::grpc::ClientContext* context, const ::pf_gossip::Message* request, ::pf_gossip_cli::Echo* response, std::function<void(::grpc::Status)>) override;
       void addMessage(::grpc::ClientContext* context, const ::pf_gossip::Message* request, ::pf_gossip_cli::Echo* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void addMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch* request, ::pf_gossip_cli::WriteResult* response, std::function<void(::grpc::Status)>) override;
+      void addMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch* request, ::pf_gossip_cli::WriteResult* response, ::grpc::ClientUnaryReactor* reactor) override;
       void deleteMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip_cli::Echo* response, std::function<void(::grpc::Status)>) override;
       void deleteMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip_cli::Echo* response, ::grpc::ClientUnaryReactor* reactor) override;
       void getMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip::Message* response, std::function<void(::grpc::Status)>) override;
       void getMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip::Message* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void getMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList* request, ::pf_gossip::SearchResult* response, std::function<void(::grpc::Status)>) override;
+      void getMessages(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList* request, ::pf_gossip::SearchResult* response, ::grpc::ClientUnaryReactor* reactor) override;
       void searchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo* request, ::pf_gossip::SearchResult* response, std::function<void(::grpc::Status)>) override;
       void searchMessage(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo* request, ::pf_gossip::SearchResult* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void scanPrefix(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan* request, ::grpc::ClientReadReactor< ::pf_gossip_cli::ScanResult>* reactor) override;
+      void scanRange(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan* request, ::grpc::ClientReadReactor< ::pf_gossip_cli::ScanResult>* reactor) override;
       void getGossipNetwork(::grpc::ClientContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response, std::function<void(::grpc::Status)>) override;
       void getGossipNetwork(::grpc::ClientContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response, ::grpc::ClientUnaryReactor* reactor) override;
       void getNodeStatus(::grpc::ClientContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response, std::function<void(::grpc::Status)>) override;
@@ -253,12 +347,22 @@ class GossipClient final {
     class async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>* AsyncaddMessageRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>* PrepareAsyncaddMessageRaw(::grpc::ClientContext* context, const ::pf_gossip::Message& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::WriteResult>* AsyncaddMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::WriteResult>* PrepareAsyncaddMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::WriteBatch& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>* AsyncdeleteMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>* PrepareAsyncdeleteMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>* AsyncgetMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::Message>* PrepareAsyncgetMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::Key& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>* AsyncgetMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>* PrepareAsyncgetMessagesRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::KeyList& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>* AsyncsearchMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip::SearchResult>* PrepareAsyncsearchMessageRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::SearchInfo& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::pf_gossip_cli::ScanResult>* scanPrefixRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request) override;
+    ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>* AsyncscanPrefixRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>* PrepareAsyncscanPrefixRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::PrefixScan& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::pf_gossip_cli::ScanResult>* scanRangeRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request) override;
+    ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>* AsyncscanRangeRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::pf_gossip_cli::ScanResult>* PrepareAsyncscanRangeRaw(::grpc::ClientContext* context, const ::pf_gossip_cli::RangeScan& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::JsonValue>* AsyncgetGossipNetworkRaw(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::JsonValue>* PrepareAsyncgetGossipNetworkRaw(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::JsonValue>* AsyncgetNodeStatusRaw(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) override;
@@ -270,9 +374,13 @@ class GossipClient final {
     ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>* AsyncshutdownRaw(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::pf_gossip_cli::Echo>* PrepareAsyncshutdownRaw(::grpc::ClientContext* context, const ::google::protobuf::Any& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_addMessage_;
+    const ::grpc::internal::RpcMethod rpcmethod_addMessages_;
     const ::grpc::internal::RpcMethod rpcmethod_deleteMessage_;
     const ::grpc::internal::RpcMethod rpcmethod_getMessage_;
+    const ::grpc::internal::RpcMethod rpcmethod_getMessages_;
     const ::grpc::internal::RpcMethod rpcmethod_searchMessage_;
+    const ::grpc::internal::RpcMethod rpcmethod_scanPrefix_;
+    const ::grpc::internal::RpcMethod rpcmethod_scanRange_;
     const ::grpc::internal::RpcMethod rpcmethod_getGossipNetwork_;
     const ::grpc::internal::RpcMethod rpcmethod_getNodeStatus_;
     const ::grpc::internal::RpcMethod rpcmethod_echo_;
@@ -286,10 +394,18 @@ class GossipClient final {
     Service();
     virtual ~Service();
     virtual ::grpc::Status addMessage(::grpc::ServerContext* context, const ::pf_gossip::Message* request, ::pf_gossip_cli::Echo* response);
+    virtual ::grpc::Status addMessages(::grpc::ServerContext* context, const ::pf_gossip_cli::WriteBatch* request, ::pf_gossip_cli::WriteResult* response);
+    // 批量写入和删除，只使用一个版本并且只传播一次
     virtual ::grpc::Status deleteMessage(::grpc::ServerContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip_cli::Echo* response);
     virtual ::grpc::Status getMessage(::grpc::ServerContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip::Message* response);
     // 查找 message 信息
+    virtual ::grpc::Status getMessages(::grpc::ServerContext* context, const ::pf_gossip_cli::KeyList* request, ::pf_gossip::SearchResult* response);
+    // 批量查找，结果与请求中的键一一对应，未找到时 version 为 0
     virtual ::grpc::Status searchMessage(::grpc::ServerContext* context, const ::pf_gossip_cli::SearchInfo* request, ::pf_gossip::SearchResult* response);
+    virtual ::grpc::Status scanPrefix(::grpc::ServerContext* context, const ::pf_gossip_cli::PrefixScan* request, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* writer);
+    // 按键的顺序分段返回一个 slot 中以 prefix 开头的键值对
+    virtual ::grpc::Status scanRange(::grpc::ServerContext* context, const ::pf_gossip_cli::RangeScan* request, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* writer);
+    // 按键的顺序分段返回一个 slot 中 [start, end) 范围内的键值对
     virtual ::grpc::Status getGossipNetwork(::grpc::ServerContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response);
     // 当前的网络结构
     virtual ::grpc::Status getNodeStatus(::grpc::ServerContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response);
@@ -321,12 +437,32 @@ class GossipClient final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_addMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_addMessages() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_addMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status addMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::WriteBatch* /*request*/, ::pf_gossip_cli::WriteResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestaddMessages(::grpc::ServerContext* context, ::pf_gossip_cli::WriteBatch* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip_cli::WriteResult>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_deleteMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_deleteMessage() {
-      ::grpc::Service::MarkMethodAsync(1);
+      ::grpc::Service::MarkMethodAsync(2);
     }
     ~WithAsyncMethod_deleteMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -337,7 +473,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestdeleteMessage(::grpc::ServerContext* context, ::pf_gossip_cli::Key* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip_cli::Echo>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -346,7 +482,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_getMessage() {
-      ::grpc::Service::MarkMethodAsync(2);
+      ::grpc::Service::MarkMethodAsync(3);
     }
     ~WithAsyncMethod_getMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -357,7 +493,27 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestgetMessage(::grpc::ServerContext* context, ::pf_gossip_cli::Key* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::Message>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_getMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_getMessages() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_getMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::KeyList* /*request*/, ::pf_gossip::SearchResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestgetMessages(::grpc::ServerContext* context, ::pf_gossip_cli::KeyList* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::SearchResult>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -366,7 +522,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_searchMessage() {
-      ::grpc::Service::MarkMethodAsync(3);
+      ::grpc::Service::MarkMethodAsync(5);
     }
     ~WithAsyncMethod_searchMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -377,7 +533,47 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsearchMessage(::grpc::ServerContext* context, ::pf_gossip_cli::SearchInfo* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip::SearchResult>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_scanPrefix : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_scanPrefix() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_scanPrefix() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanPrefix(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::PrefixScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestscanPrefix(::grpc::ServerContext* context, ::pf_gossip_cli::PrefixScan* request, ::grpc::ServerAsyncWriter< ::pf_gossip_cli::ScanResult>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_scanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_scanRange() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_scanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanRange(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::RangeScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestscanRange(::grpc::ServerContext* context, ::pf_gossip_cli::RangeScan* request, ::grpc::ServerAsyncWriter< ::pf_gossip_cli::ScanResult>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(7, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -386,7 +582,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_getGossipNetwork() {
-      ::grpc::Service::MarkMethodAsync(4);
+      ::grpc::Service::MarkMethodAsync(8);
     }
     ~WithAsyncMethod_getGossipNetwork() override {
       BaseClassMustBeDerivedFromService(this);
@@ -397,7 +593,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestgetGossipNetwork(::grpc::ServerContext* context, ::google::protobuf::Any* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip_cli::JsonValue>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -406,7 +602,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_getNodeStatus() {
-      ::grpc::Service::MarkMethodAsync(5);
+      ::grpc::Service::MarkMethodAsync(9);
     }
     ~WithAsyncMethod_getNodeStatus() override {
       BaseClassMustBeDerivedFromService(this);
@@ -417,7 +613,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestgetNodeStatus(::grpc::ServerContext* context, ::google::protobuf::Any* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip_cli::JsonValue>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -426,7 +622,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_echo() {
-      ::grpc::Service::MarkMethodAsync(6);
+      ::grpc::Service::MarkMethodAsync(10);
     }
     ~WithAsyncMethod_echo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -437,7 +633,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void Requestecho(::grpc::ServerContext* context, ::pf_gossip_cli::Echo* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip_cli::Echo>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -446,7 +642,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_connect() {
-      ::grpc::Service::MarkMethodAsync(7);
+      ::grpc::Service::MarkMethodAsync(11);
     }
     ~WithAsyncMethod_connect() override {
       BaseClassMustBeDerivedFromService(this);
@@ -457,7 +653,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void Requestconnect(::grpc::ServerContext* context, ::pf_gossip_cli::Url* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip_cli::Echo>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -466,7 +662,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_shutdown() {
-      ::grpc::Service::MarkMethodAsync(8);
+      ::grpc::Service::MarkMethodAsync(12);
     }
     ~WithAsyncMethod_shutdown() override {
       BaseClassMustBeDerivedFromService(this);
@@ -477,10 +673,10 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void Requestshutdown(::grpc::ServerContext* context, ::google::protobuf::Any* request, ::grpc::ServerAsyncResponseWriter< ::pf_gossip_cli::Echo>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_addMessage<WithAsyncMethod_deleteMessage<WithAsyncMethod_getMessage<WithAsyncMethod_searchMessage<WithAsyncMethod_getGossipNetwork<WithAsyncMethod_getNodeStatus<WithAsyncMethod_echo<WithAsyncMethod_connect<WithAsyncMethod_shutdown<Service > > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_addMessage<WithAsyncMethod_addMessages<WithAsyncMethod_deleteMessage<WithAsyncMethod_getMessage<WithAsyncMethod_getMessages<WithAsyncMethod_searchMessage<WithAsyncMethod_scanPrefix<WithAsyncMethod_scanRange<WithAsyncMethod_getGossipNetwork<WithAsyncMethod_getNodeStatus<WithAsyncMethod_echo<WithAsyncMethod_connect<WithAsyncMethod_shutdown<Service > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_addMessage : public BaseClass {
    private:
@@ -509,18 +705,45 @@ class GossipClient final {
       ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip::Message* /*request*/, ::pf_gossip_cli::Echo* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_addMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_addMessages() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::WriteBatch, ::pf_gossip_cli::WriteResult>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::pf_gossip_cli::WriteBatch* request, ::pf_gossip_cli::WriteResult* response) { return this->addMessages(context, request, response); }));}
+    void SetMessageAllocatorFor_addMessages(
+        ::grpc::MessageAllocator< ::pf_gossip_cli::WriteBatch, ::pf_gossip_cli::WriteResult>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::WriteBatch, ::pf_gossip_cli::WriteResult>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_addMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status addMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::WriteBatch* /*request*/, ::pf_gossip_cli::WriteResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* addMessages(
+      ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip_cli::WriteBatch* /*request*/, ::pf_gossip_cli::WriteResult* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_deleteMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_deleteMessage() {
-      ::grpc::Service::MarkMethodCallback(1,
+      ::grpc::Service::MarkMethodCallback(2,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::Key, ::pf_gossip_cli::Echo>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip_cli::Echo* response) { return this->deleteMessage(context, request, response); }));}
     void SetMessageAllocatorFor_deleteMessage(
         ::grpc::MessageAllocator< ::pf_gossip_cli::Key, ::pf_gossip_cli::Echo>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::Key, ::pf_gossip_cli::Echo>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -541,13 +764,13 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_getMessage() {
-      ::grpc::Service::MarkMethodCallback(2,
+      ::grpc::Service::MarkMethodCallback(3,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::Key, ::pf_gossip::Message>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip_cli::Key* request, ::pf_gossip::Message* response) { return this->getMessage(context, request, response); }));}
     void SetMessageAllocatorFor_getMessage(
         ::grpc::MessageAllocator< ::pf_gossip_cli::Key, ::pf_gossip::Message>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::Key, ::pf_gossip::Message>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -563,18 +786,45 @@ class GossipClient final {
       ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip_cli::Key* /*request*/, ::pf_gossip::Message* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_getMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_getMessages() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::KeyList, ::pf_gossip::SearchResult>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::pf_gossip_cli::KeyList* request, ::pf_gossip::SearchResult* response) { return this->getMessages(context, request, response); }));}
+    void SetMessageAllocatorFor_getMessages(
+        ::grpc::MessageAllocator< ::pf_gossip_cli::KeyList, ::pf_gossip::SearchResult>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::KeyList, ::pf_gossip::SearchResult>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_getMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::KeyList* /*request*/, ::pf_gossip::SearchResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* getMessages(
+      ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip_cli::KeyList* /*request*/, ::pf_gossip::SearchResult* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_searchMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_searchMessage() {
-      ::grpc::Service::MarkMethodCallback(3,
+      ::grpc::Service::MarkMethodCallback(5,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::SearchInfo, ::pf_gossip::SearchResult>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip_cli::SearchInfo* request, ::pf_gossip::SearchResult* response) { return this->searchMessage(context, request, response); }));}
     void SetMessageAllocatorFor_searchMessage(
         ::grpc::MessageAllocator< ::pf_gossip_cli::SearchInfo, ::pf_gossip::SearchResult>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::SearchInfo, ::pf_gossip::SearchResult>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -590,18 +840,62 @@ class GossipClient final {
       ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip_cli::SearchInfo* /*request*/, ::pf_gossip::SearchResult* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_scanPrefix : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_scanPrefix() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::pf_gossip_cli::PrefixScan, ::pf_gossip_cli::ScanResult>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::pf_gossip_cli::PrefixScan* request) { return this->scanPrefix(context, request); }));
+    }
+    ~WithCallbackMethod_scanPrefix() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanPrefix(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::PrefixScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::pf_gossip_cli::ScanResult>* scanPrefix(
+      ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip_cli::PrefixScan* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_scanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_scanRange() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::pf_gossip_cli::RangeScan, ::pf_gossip_cli::ScanResult>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::pf_gossip_cli::RangeScan* request) { return this->scanRange(context, request); }));
+    }
+    ~WithCallbackMethod_scanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanRange(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::RangeScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::pf_gossip_cli::ScanResult>* scanRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::pf_gossip_cli::RangeScan* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_getGossipNetwork : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_getGossipNetwork() {
-      ::grpc::Service::MarkMethodCallback(4,
+      ::grpc::Service::MarkMethodCallback(8,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Any, ::pf_gossip_cli::JsonValue>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response) { return this->getGossipNetwork(context, request, response); }));}
     void SetMessageAllocatorFor_getGossipNetwork(
         ::grpc::MessageAllocator< ::google::protobuf::Any, ::pf_gossip_cli::JsonValue>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Any, ::pf_gossip_cli::JsonValue>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -622,13 +916,13 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_getNodeStatus() {
-      ::grpc::Service::MarkMethodCallback(5,
+      ::grpc::Service::MarkMethodCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Any, ::pf_gossip_cli::JsonValue>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::JsonValue* response) { return this->getNodeStatus(context, request, response); }));}
     void SetMessageAllocatorFor_getNodeStatus(
         ::grpc::MessageAllocator< ::google::protobuf::Any, ::pf_gossip_cli::JsonValue>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Any, ::pf_gossip_cli::JsonValue>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -649,13 +943,13 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_echo() {
-      ::grpc::Service::MarkMethodCallback(6,
+      ::grpc::Service::MarkMethodCallback(10,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::Echo, ::pf_gossip_cli::Echo>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip_cli::Echo* request, ::pf_gossip_cli::Echo* response) { return this->echo(context, request, response); }));}
     void SetMessageAllocatorFor_echo(
         ::grpc::MessageAllocator< ::pf_gossip_cli::Echo, ::pf_gossip_cli::Echo>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::Echo, ::pf_gossip_cli::Echo>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -676,13 +970,13 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_connect() {
-      ::grpc::Service::MarkMethodCallback(7,
+      ::grpc::Service::MarkMethodCallback(11,
           new ::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::Url, ::pf_gossip_cli::Echo>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::pf_gossip_cli::Url* request, ::pf_gossip_cli::Echo* response) { return this->connect(context, request, response); }));}
     void SetMessageAllocatorFor_connect(
         ::grpc::MessageAllocator< ::pf_gossip_cli::Url, ::pf_gossip_cli::Echo>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::pf_gossip_cli::Url, ::pf_gossip_cli::Echo>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -703,13 +997,13 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_shutdown() {
-      ::grpc::Service::MarkMethodCallback(8,
+      ::grpc::Service::MarkMethodCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Any, ::pf_gossip_cli::Echo>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Any* request, ::pf_gossip_cli::Echo* response) { return this->shutdown(context, request, response); }));}
     void SetMessageAllocatorFor_shutdown(
         ::grpc::MessageAllocator< ::google::protobuf::Any, ::pf_gossip_cli::Echo>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Any, ::pf_gossip_cli::Echo>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -724,7 +1018,7 @@ class GossipClient final {
     virtual ::grpc::ServerUnaryReactor* shutdown(
       ::grpc::CallbackServerContext* /*context*/, const ::google::protobuf::Any* /*request*/, ::pf_gossip_cli::Echo* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_addMessage<WithCallbackMethod_deleteMessage<WithCallbackMethod_getMessage<WithCallbackMethod_searchMessage<WithCallbackMethod_getGossipNetwork<WithCallbackMethod_getNodeStatus<WithCallbackMethod_echo<WithCallbackMethod_connect<WithCallbackMethod_shutdown<Service > > > > > > > > > CallbackService;
+  typedef WithCallbackMethod_addMessage<WithCallbackMethod_addMessages<WithCallbackMethod_deleteMessage<WithCallbackMethod_getMessage<WithCallbackMethod_getMessages<WithCallbackMethod_searchMessage<WithCallbackMethod_scanPrefix<WithCallbackMethod_scanRange<WithCallbackMethod_getGossipNetwork<WithCallbackMethod_getNodeStatus<WithCallbackMethod_echo<WithCallbackMethod_connect<WithCallbackMethod_shutdown<Service > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_addMessage : public BaseClass {
@@ -744,12 +1038,29 @@ class GossipClient final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_addMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_addMessages() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_addMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status addMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::WriteBatch* /*request*/, ::pf_gossip_cli::WriteResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_deleteMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_deleteMessage() {
-      ::grpc::Service::MarkMethodGeneric(1);
+      ::grpc::Service::MarkMethodGeneric(2);
     }
     ~WithGenericMethod_deleteMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -766,7 +1077,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_getMessage() {
-      ::grpc::Service::MarkMethodGeneric(2);
+      ::grpc::Service::MarkMethodGeneric(3);
     }
     ~WithGenericMethod_getMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -778,12 +1089,29 @@ class GossipClient final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_getMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_getMessages() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_getMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::KeyList* /*request*/, ::pf_gossip::SearchResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_searchMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_searchMessage() {
-      ::grpc::Service::MarkMethodGeneric(3);
+      ::grpc::Service::MarkMethodGeneric(5);
     }
     ~WithGenericMethod_searchMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -795,12 +1123,46 @@ class GossipClient final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_scanPrefix : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_scanPrefix() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_scanPrefix() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanPrefix(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::PrefixScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_scanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_scanRange() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_scanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanRange(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::RangeScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_getGossipNetwork : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_getGossipNetwork() {
-      ::grpc::Service::MarkMethodGeneric(4);
+      ::grpc::Service::MarkMethodGeneric(8);
     }
     ~WithGenericMethod_getGossipNetwork() override {
       BaseClassMustBeDerivedFromService(this);
@@ -817,7 +1179,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_getNodeStatus() {
-      ::grpc::Service::MarkMethodGeneric(5);
+      ::grpc::Service::MarkMethodGeneric(9);
     }
     ~WithGenericMethod_getNodeStatus() override {
       BaseClassMustBeDerivedFromService(this);
@@ -834,7 +1196,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_echo() {
-      ::grpc::Service::MarkMethodGeneric(6);
+      ::grpc::Service::MarkMethodGeneric(10);
     }
     ~WithGenericMethod_echo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -851,7 +1213,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_connect() {
-      ::grpc::Service::MarkMethodGeneric(7);
+      ::grpc::Service::MarkMethodGeneric(11);
     }
     ~WithGenericMethod_connect() override {
       BaseClassMustBeDerivedFromService(this);
@@ -868,7 +1230,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_shutdown() {
-      ::grpc::Service::MarkMethodGeneric(8);
+      ::grpc::Service::MarkMethodGeneric(12);
     }
     ~WithGenericMethod_shutdown() override {
       BaseClassMustBeDerivedFromService(this);
@@ -900,12 +1262,32 @@ class GossipClient final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_addMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_addMessages() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_addMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status addMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::WriteBatch* /*request*/, ::pf_gossip_cli::WriteResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestaddMessages(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_deleteMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_deleteMessage() {
-      ::grpc::Service::MarkMethodRaw(1);
+      ::grpc::Service::MarkMethodRaw(2);
     }
     ~WithRawMethod_deleteMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -916,7 +1298,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestdeleteMessage(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -925,7 +1307,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_getMessage() {
-      ::grpc::Service::MarkMethodRaw(2);
+      ::grpc::Service::MarkMethodRaw(3);
     }
     ~WithRawMethod_getMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -936,7 +1318,27 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestgetMessage(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_getMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_getMessages() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_getMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::KeyList* /*request*/, ::pf_gossip::SearchResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestgetMessages(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -945,7 +1347,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_searchMessage() {
-      ::grpc::Service::MarkMethodRaw(3);
+      ::grpc::Service::MarkMethodRaw(5);
     }
     ~WithRawMethod_searchMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -956,7 +1358,47 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsearchMessage(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_scanPrefix : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_scanPrefix() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_scanPrefix() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanPrefix(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::PrefixScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestscanPrefix(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_scanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_scanRange() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_scanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanRange(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::RangeScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestscanRange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(7, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -965,7 +1407,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_getGossipNetwork() {
-      ::grpc::Service::MarkMethodRaw(4);
+      ::grpc::Service::MarkMethodRaw(8);
     }
     ~WithRawMethod_getGossipNetwork() override {
       BaseClassMustBeDerivedFromService(this);
@@ -976,7 +1418,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestgetGossipNetwork(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -985,7 +1427,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_getNodeStatus() {
-      ::grpc::Service::MarkMethodRaw(5);
+      ::grpc::Service::MarkMethodRaw(9);
     }
     ~WithRawMethod_getNodeStatus() override {
       BaseClassMustBeDerivedFromService(this);
@@ -996,7 +1438,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestgetNodeStatus(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1005,7 +1447,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_echo() {
-      ::grpc::Service::MarkMethodRaw(6);
+      ::grpc::Service::MarkMethodRaw(10);
     }
     ~WithRawMethod_echo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1016,7 +1458,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void Requestecho(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1025,7 +1467,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_connect() {
-      ::grpc::Service::MarkMethodRaw(7);
+      ::grpc::Service::MarkMethodRaw(11);
     }
     ~WithRawMethod_connect() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1036,7 +1478,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void Requestconnect(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1045,7 +1487,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_shutdown() {
-      ::grpc::Service::MarkMethodRaw(8);
+      ::grpc::Service::MarkMethodRaw(12);
     }
     ~WithRawMethod_shutdown() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1056,7 +1498,7 @@ class GossipClient final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void Requestshutdown(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1082,12 +1524,34 @@ class GossipClient final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_addMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_addMessages() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->addMessages(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_addMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status addMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::WriteBatch* /*request*/, ::pf_gossip_cli::WriteResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* addMessages(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_deleteMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_deleteMessage() {
-      ::grpc::Service::MarkMethodRawCallback(1,
+      ::grpc::Service::MarkMethodRawCallback(2,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->deleteMessage(context, request, response); }));
@@ -1109,7 +1573,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_getMessage() {
-      ::grpc::Service::MarkMethodRawCallback(2,
+      ::grpc::Service::MarkMethodRawCallback(3,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->getMessage(context, request, response); }));
@@ -1126,12 +1590,34 @@ class GossipClient final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_getMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_getMessages() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->getMessages(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_getMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::KeyList* /*request*/, ::pf_gossip::SearchResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* getMessages(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_searchMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_searchMessage() {
-      ::grpc::Service::MarkMethodRawCallback(3,
+      ::grpc::Service::MarkMethodRawCallback(5,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->searchMessage(context, request, response); }));
@@ -1148,12 +1634,56 @@ class GossipClient final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_scanPrefix : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_scanPrefix() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->scanPrefix(context, request); }));
+    }
+    ~WithRawCallbackMethod_scanPrefix() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanPrefix(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::PrefixScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* scanPrefix(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_scanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_scanRange() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->scanRange(context, request); }));
+    }
+    ~WithRawCallbackMethod_scanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scanRange(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::RangeScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* scanRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_getGossipNetwork : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_getGossipNetwork() {
-      ::grpc::Service::MarkMethodRawCallback(4,
+      ::grpc::Service::MarkMethodRawCallback(8,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->getGossipNetwork(context, request, response); }));
@@ -1175,7 +1705,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_getNodeStatus() {
-      ::grpc::Service::MarkMethodRawCallback(5,
+      ::grpc::Service::MarkMethodRawCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->getNodeStatus(context, request, response); }));
@@ -1197,7 +1727,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_echo() {
-      ::grpc::Service::MarkMethodRawCallback(6,
+      ::grpc::Service::MarkMethodRawCallback(10,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->echo(context, request, response); }));
@@ -1219,7 +1749,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_connect() {
-      ::grpc::Service::MarkMethodRawCallback(7,
+      ::grpc::Service::MarkMethodRawCallback(11,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->connect(context, request, response); }));
@@ -1241,7 +1771,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_shutdown() {
-      ::grpc::Service::MarkMethodRawCallback(8,
+      ::grpc::Service::MarkMethodRawCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->shutdown(context, request, response); }));
@@ -1285,12 +1815,39 @@ class GossipClient final {
     virtual ::grpc::Status StreamedaddMessage(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip::Message,::pf_gossip_cli::Echo>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_addMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_addMessages() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::pf_gossip_cli::WriteBatch, ::pf_gossip_cli::WriteResult>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::pf_gossip_cli::WriteBatch, ::pf_gossip_cli::WriteResult>* streamer) {
+                       return this->StreamedaddMessages(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_addMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status addMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::WriteBatch* /*request*/, ::pf_gossip_cli::WriteResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedaddMessages(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip_cli::WriteBatch,::pf_gossip_cli::WriteResult>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_deleteMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_deleteMessage() {
-      ::grpc::Service::MarkMethodStreamed(1,
+      ::grpc::Service::MarkMethodStreamed(2,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip_cli::Key, ::pf_gossip_cli::Echo>(
             [this](::grpc::ServerContext* context,
@@ -1317,7 +1874,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_getMessage() {
-      ::grpc::Service::MarkMethodStreamed(2,
+      ::grpc::Service::MarkMethodStreamed(3,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip_cli::Key, ::pf_gossip::Message>(
             [this](::grpc::ServerContext* context,
@@ -1339,12 +1896,39 @@ class GossipClient final {
     virtual ::grpc::Status StreamedgetMessage(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip_cli::Key,::pf_gossip::Message>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_getMessages : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_getMessages() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::pf_gossip_cli::KeyList, ::pf_gossip::SearchResult>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::pf_gossip_cli::KeyList, ::pf_gossip::SearchResult>* streamer) {
+                       return this->StreamedgetMessages(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_getMessages() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status getMessages(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::KeyList* /*request*/, ::pf_gossip::SearchResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedgetMessages(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::pf_gossip_cli::KeyList,::pf_gossip::SearchResult>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_searchMessage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_searchMessage() {
-      ::grpc::Service::MarkMethodStreamed(3,
+      ::grpc::Service::MarkMethodStreamed(5,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip_cli::SearchInfo, ::pf_gossip::SearchResult>(
             [this](::grpc::ServerContext* context,
@@ -1371,7 +1955,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_getGossipNetwork() {
-      ::grpc::Service::MarkMethodStreamed(4,
+      ::grpc::Service::MarkMethodStreamed(8,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Any, ::pf_gossip_cli::JsonValue>(
             [this](::grpc::ServerContext* context,
@@ -1398,7 +1982,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_getNodeStatus() {
-      ::grpc::Service::MarkMethodStreamed(5,
+      ::grpc::Service::MarkMethodStreamed(9,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Any, ::pf_gossip_cli::JsonValue>(
             [this](::grpc::ServerContext* context,
@@ -1425,7 +2009,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_echo() {
-      ::grpc::Service::MarkMethodStreamed(6,
+      ::grpc::Service::MarkMethodStreamed(10,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip_cli::Echo, ::pf_gossip_cli::Echo>(
             [this](::grpc::ServerContext* context,
@@ -1452,7 +2036,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_connect() {
-      ::grpc::Service::MarkMethodStreamed(7,
+      ::grpc::Service::MarkMethodStreamed(11,
         new ::grpc::internal::StreamedUnaryHandler<
           ::pf_gossip_cli::Url, ::pf_gossip_cli::Echo>(
             [this](::grpc::ServerContext* context,
@@ -1479,7 +2063,7 @@ class GossipClient final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_shutdown() {
-      ::grpc::Service::MarkMethodStreamed(8,
+      ::grpc::Service::MarkMethodStreamed(12,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Any, ::pf_gossip_cli::Echo>(
             [this](::grpc::ServerContext* context,
@@ -1500,9 +2084,63 @@ class GossipClient final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status Streamedshutdown(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Any,::pf_gossip_cli::Echo>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_addMessage<WithStreamedUnaryMethod_deleteMessage<WithStreamedUnaryMethod_getMessage<WithStreamedUnaryMethod_searchMessage<WithStreamedUnaryMethod_getGossipNetwork<WithStreamedUnaryMethod_getNodeStatus<WithStreamedUnaryMethod_echo<WithStreamedUnaryMethod_connect<WithStreamedUnaryMethod_shutdown<Service > > > > > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_addMessage<WithStreamedUnaryMethod_deleteMessage<WithStreamedUnaryMethod_getMessage<WithStreamedUnaryMethod_searchMessage<WithStreamedUnaryMethod_getGossipNetwork<WithStreamedUnaryMethod_getNodeStatus<WithStreamedUnaryMethod_echo<WithStreamedUnaryMethod_connect<WithStreamedUnaryMethod_shutdown<Service > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_addMessage<WithStreamedUnaryMethod_addMessages<WithStreamedUnaryMethod_deleteMessage<WithStreamedUnaryMethod_getMessage<WithStreamedUnaryMethod_getMessages<WithStreamedUnaryMethod_searchMessage<WithStreamedUnaryMethod_getGossipNetwork<WithStreamedUnaryMethod_getNodeStatus<WithStreamedUnaryMethod_echo<WithStreamedUnaryMethod_connect<WithStreamedUnaryMethod_shutdown<Service > > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_scanPrefix : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_scanPrefix() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::pf_gossip_cli::PrefixScan, ::pf_gossip_cli::ScanResult>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::pf_gossip_cli::PrefixScan, ::pf_gossip_cli::ScanResult>* streamer) {
+                       return this->StreamedscanPrefix(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_scanPrefix() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status scanPrefix(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::PrefixScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedscanPrefix(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::pf_gossip_cli::PrefixScan,::pf_gossip_cli::ScanResult>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_scanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_scanRange() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::pf_gossip_cli::RangeScan, ::pf_gossip_cli::ScanResult>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::pf_gossip_cli::RangeScan, ::pf_gossip_cli::ScanResult>* streamer) {
+                       return this->StreamedscanRange(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_scanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status scanRange(::grpc::ServerContext* /*context*/, const ::pf_gossip_cli::RangeScan* /*request*/, ::grpc::ServerWriter< ::pf_gossip_cli::ScanResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedscanRange(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::pf_gossip_cli::RangeScan,::pf_gossip_cli::ScanResult>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_scanPrefix<WithSplitStreamingMethod_scanRange<Service > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_addMessage<WithStreamedUnaryMethod_addMessages<WithStreamedUnaryMethod_deleteMessage<WithStreamedUnaryMethod_getMessage<WithStreamedUnaryMethod_getMessages<WithStreamedUnaryMethod_searchMessage<WithSplitStreamingMethod_scanPrefix<WithSplitStreamingMethod_scanRange<WithStreamedUnaryMethod_getGossipNetwork<WithStreamedUnaryMethod_getNodeStatus<WithStreamedUnaryMethod_echo<WithStreamedUnaryMethod_connect<WithStreamedUnaryMethod_shutdown<Service > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace pf_gossip_cli
@@ -88,8 +88,127 @@ struct SearchInfoDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchInfoDefaultTypeInternal _SearchInfo_default_instance_;
+PROTOBUF_CONSTEXPR WriteOperation::WriteOperation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ttl_ms_)*/int64_t{0}
+  , /*decltype(_impl_.remove_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteOperationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteOperationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteOperationDefaultTypeInternal() {}
+  union {
+    WriteOperation _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteOperationDefaultTypeInternal _WriteOperation_default_instance_;
+PROTOBUF_CONSTEXPR WriteBatch::WriteBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operations_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteBatchDefaultTypeInternal() {}
+  union {
+    WriteBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteBatchDefaultTypeInternal _WriteBatch_default_instance_;
+PROTOBUF_CONSTEXPR WriteResult::WriteResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_)*/int64_t{0}
+  , /*decltype(_impl_.succeed_)*/false
+  , /*decltype(_impl_.applied_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteResultDefaultTypeInternal() {}
+  union {
+    WriteResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteResultDefaultTypeInternal _WriteResult_default_instance_;
+PROTOBUF_CONSTEXPR SlotKey::SlotKey(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.owner_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SlotKeyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SlotKeyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SlotKeyDefaultTypeInternal() {}
+  union {
+    SlotKey _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SlotKeyDefaultTypeInternal _SlotKey_default_instance_;
+PROTOBUF_CONSTEXPR KeyList::KeyList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KeyListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeyListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeyListDefaultTypeInternal() {}
+  union {
+    KeyList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeyListDefaultTypeInternal _KeyList_default_instance_;
+PROTOBUF_CONSTEXPR PrefixScan::PrefixScan(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.owner_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.continuation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.limit_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrefixScanDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrefixScanDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrefixScanDefaultTypeInternal() {}
+  union {
+    PrefixScan _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrefixScanDefaultTypeInternal _PrefixScan_default_instance_;
+PROTOBUF_CONSTEXPR RangeScan::RangeScan(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.start_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.end_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.owner_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.continuation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.limit_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RangeScanDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RangeScanDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RangeScanDefaultTypeInternal() {}
+  union {
+    RangeScan _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RangeScanDefaultTypeInternal _RangeScan_default_instance_;
+PROTOBUF_CONSTEXPR ScanResult::ScanResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{}
+  , /*decltype(_impl_.continuation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScanResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScanResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScanResultDefaultTypeInternal() {}
+  union {
+    ScanResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScanResultDefaultTypeInternal _ScanResult_default_instance_;
 }  // namespace pf_gossip_cli
-static ::_pb::Metadata file_level_metadata_GossipCli_2eproto[5];
+static ::_pb::Metadata file_level_metadata_GossipCli_2eproto[13];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_GossipCli_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_GossipCli_2eproto = nullptr;
 
@@ -131,6 +250,77 @@ const uint32_t TableStruct_GossipCli_2eproto::offsets[] PROTOBUF_SECTION_VARIABL
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::SearchInfo, _impl_.key_),
   PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::SearchInfo, _impl_.latest_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteOperation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteOperation, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteOperation, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteOperation, _impl_.remove_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteOperation, _impl_.ttl_ms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteBatch, _impl_.operations_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteResult, _impl_.succeed_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteResult, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteResult, _impl_.applied_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::WriteResult, _impl_.message_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::SlotKey, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::SlotKey, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::SlotKey, _impl_.owner_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::KeyList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::KeyList, _impl_.keys_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::PrefixScan, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::PrefixScan, _impl_.prefix_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::PrefixScan, _impl_.owner_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::PrefixScan, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::PrefixScan, _impl_.continuation_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::RangeScan, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::RangeScan, _impl_.start_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::RangeScan, _impl_.end_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::RangeScan, _impl_.owner_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::RangeScan, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::RangeScan, _impl_.continuation_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::ScanResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::ScanResult, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::pf_gossip_cli::ScanResult, _impl_.continuation_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::pf_gossip_cli::Key)},
@@ -138,6 +328,14 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 14, -1, -1, sizeof(::pf_gossip_cli::Url)},
   { 21, -1, -1, sizeof(::pf_gossip_cli::Echo)},
   { 29, -1, -1, sizeof(::pf_gossip_cli::SearchInfo)},
+  { 37, -1, -1, sizeof(::pf_gossip_cli::WriteOperation)},
+  { 47, -1, -1, sizeof(::pf_gossip_cli::WriteBatch)},
+  { 54, -1, -1, sizeof(::pf_gossip_cli::WriteResult)},
+  { 64, -1, -1, sizeof(::pf_gossip_cli::SlotKey)},
+  { 72, -1, -1, sizeof(::pf_gossip_cli::KeyList)},
+  { 79, -1, -1, sizeof(::pf_gossip_cli::PrefixScan)},
+  { 89, -1, -1, sizeof(::pf_gossip_cli::RangeScan)},
+  { 100, -1, -1, sizeof(::pf_gossip_cli::ScanResult)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -146,6 +344,14 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::pf_gossip_cli::_Url_default_instance_._instance,
   &::pf_gossip_cli::_Echo_default_instance_._instance,
   &::pf_gossip_cli::_SearchInfo_default_instance_._instance,
+  &::pf_gossip_cli::_WriteOperation_default_instance_._instance,
+  &::pf_gossip_cli::_WriteBatch_default_instance_._instance,
+  &::pf_gossip_cli::_WriteResult_default_instance_._instance,
+  &::pf_gossip_cli::_SlotKey_default_instance_._instance,
+  &::pf_gossip_cli::_KeyList_default_instance_._instance,
+  &::pf_gossip_cli::_PrefixScan_default_instance_._instance,
+  &::pf_gossip_cli::_RangeScan_default_instance_._instance,
+  &::pf_gossip_cli::_ScanResult_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_GossipCli_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -154,21 +360,42 @@ const char descriptor_table_protodef_GossipCli_2eproto[] PROTOBUF_SECTION_VARIAB
   "\022\017\n\007content\030\001 \001(\t\"\034\n\tJsonValue\022\017\n\007conten"
   "t\030\002 \001(\t\"\026\n\003Url\022\017\n\007content\030\001 \001(\t\"(\n\004Echo\022"
   "\017\n\007succeed\030\001 \001(\010\022\017\n\007message\030\002 \001(\t\")\n\nSea"
-  "rchInfo\022\013\n\003key\030\001 \001(\t\022\016\n\006latest\030\002 \001(\0102\234\004\n"
-  "\014GossipClient\0225\n\naddMessage\022\022.pf_gossip."
-  "Message\032\023.pf_gossip_cli.Echo\0228\n\rdeleteMe"
-  "ssage\022\022.pf_gossip_cli.Key\032\023.pf_gossip_cl"
-  "i.Echo\0224\n\ngetMessage\022\022.pf_gossip_cli.Key"
-  "\032\022.pf_gossip.Message\022C\n\rsearchMessage\022\031."
-  "pf_gossip_cli.SearchInfo\032\027.pf_gossip.Sea"
-  "rchResult\022B\n\020getGossipNetwork\022\024.google.p"
-  "rotobuf.Any\032\030.pf_gossip_cli.JsonValue\022\?\n"
-  "\rgetNodeStatus\022\024.google.protobuf.Any\032\030.p"
-  "f_gossip_cli.JsonValue\0220\n\004echo\022\023.pf_goss"
-  "ip_cli.Echo\032\023.pf_gossip_cli.Echo\0222\n\007conn"
-  "ect\022\022.pf_gossip_cli.Url\032\023.pf_gossip_cli."
-  "Echo\0225\n\010shutdown\022\024.google.protobuf.Any\032\023"
-  ".pf_gossip_cli.Echob\006proto3"
+  "rchInfo\022\013\n\003key\030\001 \001(\t\022\016\n\006latest\030\002 \001(\010\"L\n\016"
+  "WriteOperation\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001"
+  "(\t\022\016\n\006remove\030\003 \001(\010\022\016\n\006ttl_ms\030\004 \001(\003\"\?\n\nWr"
+  "iteBatch\0221\n\noperations\030\001 \003(\0132\035.pf_gossip"
+  "_cli.WriteOperation\"Q\n\013WriteResult\022\017\n\007su"
+  "cceed\030\001 \001(\010\022\017\n\007version\030\002 \001(\003\022\017\n\007applied\030"
+  "\003 \001(\005\022\017\n\007message\030\004 \001(\t\"%\n\007SlotKey\022\013\n\003key"
+  "\030\001 \001(\t\022\r\n\005owner\030\002 \001(\t\"/\n\007KeyList\022$\n\004keys"
+  "\030\001 \003(\0132\026.pf_gossip_cli.SlotKey\"P\n\nPrefix"
+  "Scan\022\016\n\006prefix\030\001 \001(\t\022\r\n\005owner\030\002 \001(\t\022\r\n\005l"
+  "imit\030\003 \001(\005\022\024\n\014continuation\030\004 \001(\t\"[\n\tRang"
+  "eScan\022\r\n\005start\030\001 \001(\t\022\013\n\003end\030\002 \001(\t\022\r\n\005own"
+  "er\030\003 \001(\t\022\r\n\005limit\030\004 \001(\005\022\024\n\014continuation\030"
+  "\005 \001(\t\"T\n\nScanResult\0220\n\007message\030\001 \003(\0132\037.p"
+  "f_gossip.SearchResult.Message\022\024\n\014continu"
+  "ation\030\002 \001(\t2\254\006\n\014GossipClient\0225\n\naddMessa"
+  "ge\022\022.pf_gossip.Message\032\023.pf_gossip_cli.E"
+  "cho\022D\n\013addMessages\022\031.pf_gossip_cli.Write"
+  "Batch\032\032.pf_gossip_cli.WriteResult\0228\n\rdel"
+  "eteMessage\022\022.pf_gossip_cli.Key\032\023.pf_goss"
+  "ip_cli.Echo\0224\n\ngetMessage\022\022.pf_gossip_cl"
+  "i.Key\032\022.pf_gossip.Message\022>\n\013getMessages"
+  "\022\026.pf_gossip_cli.KeyList\032\027.pf_gossip.Sea"
+  "rchResult\022C\n\rsearchMessage\022\031.pf_gossip_c"
+  "li.SearchInfo\032\027.pf_gossip.SearchResult\022D"
+  "\n\nscanPrefix\022\031.pf_gossip_cli.PrefixScan\032"
+  "\031.pf_gossip_cli.ScanResult0\001\022B\n\tscanRang"
+  "e\022\030.pf_gossip_cli.RangeScan\032\031.pf_gossip_"
+  "cli.ScanResult0\001\022B\n\020getGossipNetwork\022\024.g"
+  "oogle.protobuf.Any\032\030.pf_gossip_cli.JsonV"
+  "alue\022\?\n\rgetNodeStatus\022\024.google.protobuf."
+  "Any\032\030.pf_gossip_cli.JsonValue\0220\n\004echo\022\023."
+  "pf_gossip_cli.Echo\032\023.pf_gossip_cli.Echo\022"
+  "2\n\007connect\022\022.pf_gossip_cli.Url\032\023.pf_goss"
+  "ip_cli.Echo\0225\n\010shutdown\022\024.google.protobu"
+  "f.Any\032\023.pf_gossip_cli.Echob\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_GossipCli_2eproto_deps[2] = {
   &::descriptor_table_Gossip_2eproto,
@@ -176,9 +403,9 @@ static const ::_pbi::DescriptorTable* const descriptor_table_GossipCli_2eproto_d
 };
 static ::_pbi::once_flag descriptor_table_GossipCli_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_GossipCli_2eproto = {
-    false, false, 787, descriptor_table_protodef_GossipCli_2eproto,
+    false, false, 1634, descriptor_table_protodef_GossipCli_2eproto,
     "GossipCli.proto",
-    &descriptor_table_GossipCli_2eproto_once, descriptor_table_GossipCli_2eproto_deps, 2, 5,
+    &descriptor_table_GossipCli_2eproto_once, descriptor_table_GossipCli_2eproto_deps, 2, 13,
     schemas, file_default_instances, TableStruct_GossipCli_2eproto::offsets,
     file_level_metadata_GossipCli_2eproto, file_level_enum_descriptors_GossipCli_2eproto,
     file_level_service_descriptors_GossipCli_2eproto,
@@ -1260,28 +1487,2233 @@ void SearchInfo::InternalSwap(SearchInfo* other) {
       file_level_metadata_GossipCli_2eproto[4]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace pf_gossip_cli
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::pf_gossip_cli::Key*
-Arena::CreateMaybeMessage< ::pf_gossip_cli::Key >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::pf_gossip_cli::Key >(arena);
+// ===================================================================
+
+class WriteOperation::_Internal {
+ public:
+};
+
+WriteOperation::WriteOperation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip_cli.WriteOperation)
 }
-template<> PROTOBUF_NOINLINE ::pf_gossip_cli::JsonValue*
-Arena::CreateMaybeMessage< ::pf_gossip_cli::JsonValue >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::pf_gossip_cli::JsonValue >(arena);
+WriteOperation::WriteOperation(const WriteOperation& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteOperation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.ttl_ms_){}
+    , decltype(_impl_.remove_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.ttl_ms_, &from._impl_.ttl_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.remove_) -
+    reinterpret_cast<char*>(&_impl_.ttl_ms_)) + sizeof(_impl_.remove_));
+  // @@protoc_insertion_point(copy_constructor:pf_gossip_cli.WriteOperation)
 }
-template<> PROTOBUF_NOINLINE ::pf_gossip_cli::Url*
-Arena::CreateMaybeMessage< ::pf_gossip_cli::Url >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::pf_gossip_cli::Url >(arena);
+
+inline void WriteOperation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.ttl_ms_){int64_t{0}}
+    , decltype(_impl_.remove_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
-template<> PROTOBUF_NOINLINE ::pf_gossip_cli::Echo*
-Arena::CreateMaybeMessage< ::pf_gossip_cli::Echo >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::pf_gossip_cli::Echo >(arena);
+
+WriteOperation::~WriteOperation() {
+  // @@protoc_insertion_point(destructor:pf_gossip_cli.WriteOperation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::pf_gossip_cli::SearchInfo*
-Arena::CreateMaybeMessage< ::pf_gossip_cli::SearchInfo >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::pf_gossip_cli::SearchInfo >(arena);
+
+inline void WriteOperation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void WriteOperation::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteOperation::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip_cli.WriteOperation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.ttl_ms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.remove_) -
+      reinterpret_cast<char*>(&_impl_.ttl_ms_)) + sizeof(_impl_.remove_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteOperation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.WriteOperation.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.WriteOperation.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool remove = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.remove_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 ttl_ms = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.ttl_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteOperation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip_cli.WriteOperation)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.WriteOperation.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.WriteOperation.value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  // bool remove = 3;
+  if (this->_internal_remove() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_remove(), target);
+  }
+
+  // int64 ttl_ms = 4;
+  if (this->_internal_ttl_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_ttl_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip_cli.WriteOperation)
+  return target;
+}
+
+size_t WriteOperation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip_cli.WriteOperation)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  // int64 ttl_ms = 4;
+  if (this->_internal_ttl_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ttl_ms());
+  }
+
+  // bool remove = 3;
+  if (this->_internal_remove() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteOperation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteOperation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteOperation::GetClassData() const { return &_class_data_; }
+
+
+void WriteOperation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteOperation*>(&to_msg);
+  auto& from = static_cast<const WriteOperation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip_cli.WriteOperation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_ttl_ms() != 0) {
+    _this->_internal_set_ttl_ms(from._internal_ttl_ms());
+  }
+  if (from._internal_remove() != 0) {
+    _this->_internal_set_remove(from._internal_remove());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteOperation::CopyFrom(const WriteOperation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip_cli.WriteOperation)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteOperation::IsInitialized() const {
+  return true;
+}
+
+void WriteOperation::InternalSwap(WriteOperation* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteOperation, _impl_.remove_)
+      + sizeof(WriteOperation::_impl_.remove_)
+      - PROTOBUF_FIELD_OFFSET(WriteOperation, _impl_.ttl_ms_)>(
+          reinterpret_cast<char*>(&_impl_.ttl_ms_),
+          reinterpret_cast<char*>(&other->_impl_.ttl_ms_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteOperation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GossipCli_2eproto_getter, &descriptor_table_GossipCli_2eproto_once,
+      file_level_metadata_GossipCli_2eproto[5]);
+}
+
+// ===================================================================
+
+class WriteBatch::_Internal {
+ public:
+};
+
+WriteBatch::WriteBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip_cli.WriteBatch)
+}
+WriteBatch::WriteBatch(const WriteBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){from._impl_.operations_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:pf_gossip_cli.WriteBatch)
+}
+
+inline void WriteBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteBatch::~WriteBatch() {
+  // @@protoc_insertion_point(destructor:pf_gossip_cli.WriteBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operations_.~RepeatedPtrField();
+}
+
+void WriteBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip_cli.WriteBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operations_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .pf_gossip_cli.WriteOperation operations = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_operations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip_cli.WriteBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip_cli.WriteOperation operations = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_operations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_operations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip_cli.WriteBatch)
+  return target;
+}
+
+size_t WriteBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip_cli.WriteBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip_cli.WriteOperation operations = 1;
+  total_size += 1UL * this->_internal_operations_size();
+  for (const auto& msg : this->_impl_.operations_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteBatch::GetClassData() const { return &_class_data_; }
+
+
+void WriteBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteBatch*>(&to_msg);
+  auto& from = static_cast<const WriteBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip_cli.WriteBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.operations_.MergeFrom(from._impl_.operations_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteBatch::CopyFrom(const WriteBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip_cli.WriteBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteBatch::IsInitialized() const {
+  return true;
+}
+
+void WriteBatch::InternalSwap(WriteBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.operations_.InternalSwap(&other->_impl_.operations_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GossipCli_2eproto_getter, &descriptor_table_GossipCli_2eproto_once,
+      file_level_metadata_GossipCli_2eproto[6]);
+}
+
+// ===================================================================
+
+class WriteResult::_Internal {
+ public:
+};
+
+WriteResult::WriteResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip_cli.WriteResult)
+}
+WriteResult::WriteResult(const WriteResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.succeed_){}
+    , decltype(_impl_.applied_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_message().empty()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.applied_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.applied_));
+  // @@protoc_insertion_point(copy_constructor:pf_gossip_cli.WriteResult)
+}
+
+inline void WriteResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.version_){int64_t{0}}
+    , decltype(_impl_.succeed_){false}
+    , decltype(_impl_.applied_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WriteResult::~WriteResult() {
+  // @@protoc_insertion_point(destructor:pf_gossip_cli.WriteResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+}
+
+void WriteResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip_cli.WriteResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_.ClearToEmpty();
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.applied_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.applied_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool succeed = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.succeed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 applied = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.applied_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string message = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.WriteResult.message"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip_cli.WriteResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool succeed = 1;
+  if (this->_internal_succeed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_succeed(), target);
+  }
+
+  // int64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  // int32 applied = 3;
+  if (this->_internal_applied() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_applied(), target);
+  }
+
+  // string message = 4;
+  if (!this->_internal_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.WriteResult.message");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip_cli.WriteResult)
+  return target;
+}
+
+size_t WriteResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip_cli.WriteResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string message = 4;
+  if (!this->_internal_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  // int64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_version());
+  }
+
+  // bool succeed = 1;
+  if (this->_internal_succeed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 applied = 3;
+  if (this->_internal_applied() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_applied());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteResult::GetClassData() const { return &_class_data_; }
+
+
+void WriteResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteResult*>(&to_msg);
+  auto& from = static_cast<const WriteResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip_cli.WriteResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_succeed() != 0) {
+    _this->_internal_set_succeed(from._internal_succeed());
+  }
+  if (from._internal_applied() != 0) {
+    _this->_internal_set_applied(from._internal_applied());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteResult::CopyFrom(const WriteResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip_cli.WriteResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteResult::IsInitialized() const {
+  return true;
+}
+
+void WriteResult::InternalSwap(WriteResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteResult, _impl_.applied_)
+      + sizeof(WriteResult::_impl_.applied_)
+      - PROTOBUF_FIELD_OFFSET(WriteResult, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GossipCli_2eproto_getter, &descriptor_table_GossipCli_2eproto_once,
+      file_level_metadata_GossipCli_2eproto[7]);
+}
+
+// ===================================================================
+
+class SlotKey::_Internal {
+ public:
+};
+
+SlotKey::SlotKey(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip_cli.SlotKey)
+}
+SlotKey::SlotKey(const SlotKey& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SlotKey* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.owner_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_owner().empty()) {
+    _this->_impl_.owner_.Set(from._internal_owner(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:pf_gossip_cli.SlotKey)
+}
+
+inline void SlotKey::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.owner_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SlotKey::~SlotKey() {
+  // @@protoc_insertion_point(destructor:pf_gossip_cli.SlotKey)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SlotKey::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.owner_.Destroy();
+}
+
+void SlotKey::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SlotKey::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip_cli.SlotKey)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.owner_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SlotKey::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.SlotKey.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string owner = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_owner();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.SlotKey.owner"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SlotKey::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip_cli.SlotKey)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.SlotKey.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // string owner = 2;
+  if (!this->_internal_owner().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_owner().data(), static_cast<int>(this->_internal_owner().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.SlotKey.owner");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_owner(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip_cli.SlotKey)
+  return target;
+}
+
+size_t SlotKey::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip_cli.SlotKey)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // string owner = 2;
+  if (!this->_internal_owner().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_owner());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SlotKey::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SlotKey::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SlotKey::GetClassData() const { return &_class_data_; }
+
+
+void SlotKey::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SlotKey*>(&to_msg);
+  auto& from = static_cast<const SlotKey&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip_cli.SlotKey)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_owner().empty()) {
+    _this->_internal_set_owner(from._internal_owner());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SlotKey::CopyFrom(const SlotKey& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip_cli.SlotKey)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SlotKey::IsInitialized() const {
+  return true;
+}
+
+void SlotKey::InternalSwap(SlotKey* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.owner_, lhs_arena,
+      &other->_impl_.owner_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SlotKey::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GossipCli_2eproto_getter, &descriptor_table_GossipCli_2eproto_once,
+      file_level_metadata_GossipCli_2eproto[8]);
+}
+
+// ===================================================================
+
+class KeyList::_Internal {
+ public:
+};
+
+KeyList::KeyList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip_cli.KeyList)
+}
+KeyList::KeyList(const KeyList& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KeyList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:pf_gossip_cli.KeyList)
+}
+
+inline void KeyList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+KeyList::~KeyList() {
+  // @@protoc_insertion_point(destructor:pf_gossip_cli.KeyList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void KeyList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+}
+
+void KeyList::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void KeyList::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip_cli.KeyList)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KeyList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .pf_gossip_cli.SlotKey keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_keys(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KeyList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip_cli.KeyList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip_cli.SlotKey keys = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_keys_size()); i < n; i++) {
+    const auto& repfield = this->_internal_keys(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip_cli.KeyList)
+  return target;
+}
+
+size_t KeyList::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip_cli.KeyList)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip_cli.SlotKey keys = 1;
+  total_size += 1UL * this->_internal_keys_size();
+  for (const auto& msg : this->_impl_.keys_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KeyList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KeyList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KeyList::GetClassData() const { return &_class_data_; }
+
+
+void KeyList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KeyList*>(&to_msg);
+  auto& from = static_cast<const KeyList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip_cli.KeyList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KeyList::CopyFrom(const KeyList& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip_cli.KeyList)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KeyList::IsInitialized() const {
+  return true;
+}
+
+void KeyList::InternalSwap(KeyList* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata KeyList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GossipCli_2eproto_getter, &descriptor_table_GossipCli_2eproto_once,
+      file_level_metadata_GossipCli_2eproto[9]);
+}
+
+// ===================================================================
+
+class PrefixScan::_Internal {
+ public:
+};
+
+PrefixScan::PrefixScan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip_cli.PrefixScan)
+}
+PrefixScan::PrefixScan(const PrefixScan& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrefixScan* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefix_){}
+    , decltype(_impl_.owner_){}
+    , decltype(_impl_.continuation_){}
+    , decltype(_impl_.limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_prefix().empty()) {
+    _this->_impl_.prefix_.Set(from._internal_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_owner().empty()) {
+    _this->_impl_.owner_.Set(from._internal_owner(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.continuation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.continuation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_continuation().empty()) {
+    _this->_impl_.continuation_.Set(from._internal_continuation(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.limit_ = from._impl_.limit_;
+  // @@protoc_insertion_point(copy_constructor:pf_gossip_cli.PrefixScan)
+}
+
+inline void PrefixScan::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefix_){}
+    , decltype(_impl_.owner_){}
+    , decltype(_impl_.continuation_){}
+    , decltype(_impl_.limit_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.continuation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.continuation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PrefixScan::~PrefixScan() {
+  // @@protoc_insertion_point(destructor:pf_gossip_cli.PrefixScan)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrefixScan::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.prefix_.Destroy();
+  _impl_.owner_.Destroy();
+  _impl_.continuation_.Destroy();
+}
+
+void PrefixScan::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrefixScan::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip_cli.PrefixScan)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.prefix_.ClearToEmpty();
+  _impl_.owner_.ClearToEmpty();
+  _impl_.continuation_.ClearToEmpty();
+  _impl_.limit_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrefixScan::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string prefix = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.PrefixScan.prefix"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string owner = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_owner();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.PrefixScan.owner"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 limit = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string continuation = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_continuation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.PrefixScan.continuation"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrefixScan::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip_cli.PrefixScan)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string prefix = 1;
+  if (!this->_internal_prefix().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_prefix().data(), static_cast<int>(this->_internal_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.PrefixScan.prefix");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_prefix(), target);
+  }
+
+  // string owner = 2;
+  if (!this->_internal_owner().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_owner().data(), static_cast<int>(this->_internal_owner().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.PrefixScan.owner");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_owner(), target);
+  }
+
+  // int32 limit = 3;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_limit(), target);
+  }
+
+  // string continuation = 4;
+  if (!this->_internal_continuation().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_continuation().data(), static_cast<int>(this->_internal_continuation().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.PrefixScan.continuation");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_continuation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip_cli.PrefixScan)
+  return target;
+}
+
+size_t PrefixScan::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip_cli.PrefixScan)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string prefix = 1;
+  if (!this->_internal_prefix().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_prefix());
+  }
+
+  // string owner = 2;
+  if (!this->_internal_owner().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_owner());
+  }
+
+  // string continuation = 4;
+  if (!this->_internal_continuation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_continuation());
+  }
+
+  // int32 limit = 3;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_limit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrefixScan::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrefixScan::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrefixScan::GetClassData() const { return &_class_data_; }
+
+
+void PrefixScan::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrefixScan*>(&to_msg);
+  auto& from = static_cast<const PrefixScan&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip_cli.PrefixScan)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_prefix().empty()) {
+    _this->_internal_set_prefix(from._internal_prefix());
+  }
+  if (!from._internal_owner().empty()) {
+    _this->_internal_set_owner(from._internal_owner());
+  }
+  if (!from._internal_continuation().empty()) {
+    _this->_internal_set_continuation(from._internal_continuation());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrefixScan::CopyFrom(const PrefixScan& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip_cli.PrefixScan)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrefixScan::IsInitialized() const {
+  return true;
+}
+
+void PrefixScan::InternalSwap(PrefixScan* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prefix_, lhs_arena,
+      &other->_impl_.prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.owner_, lhs_arena,
+      &other->_impl_.owner_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.continuation_, lhs_arena,
+      &other->_impl_.continuation_, rhs_arena
+  );
+  swap(_impl_.limit_, other->_impl_.limit_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrefixScan::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GossipCli_2eproto_getter, &descriptor_table_GossipCli_2eproto_once,
+      file_level_metadata_GossipCli_2eproto[10]);
+}
+
+// ===================================================================
+
+class RangeScan::_Internal {
+ public:
+};
+
+RangeScan::RangeScan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip_cli.RangeScan)
+}
+RangeScan::RangeScan(const RangeScan& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RangeScan* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.owner_){}
+    , decltype(_impl_.continuation_){}
+    , decltype(_impl_.limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_start().empty()) {
+    _this->_impl_.start_.Set(from._internal_start(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_end().empty()) {
+    _this->_impl_.end_.Set(from._internal_end(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_owner().empty()) {
+    _this->_impl_.owner_.Set(from._internal_owner(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.continuation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.continuation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_continuation().empty()) {
+    _this->_impl_.continuation_.Set(from._internal_continuation(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.limit_ = from._impl_.limit_;
+  // @@protoc_insertion_point(copy_constructor:pf_gossip_cli.RangeScan)
+}
+
+inline void RangeScan::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.owner_){}
+    , decltype(_impl_.continuation_){}
+    , decltype(_impl_.limit_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.continuation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.continuation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RangeScan::~RangeScan() {
+  // @@protoc_insertion_point(destructor:pf_gossip_cli.RangeScan)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RangeScan::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.start_.Destroy();
+  _impl_.end_.Destroy();
+  _impl_.owner_.Destroy();
+  _impl_.continuation_.Destroy();
+}
+
+void RangeScan::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RangeScan::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip_cli.RangeScan)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.start_.ClearToEmpty();
+  _impl_.end_.ClearToEmpty();
+  _impl_.owner_.ClearToEmpty();
+  _impl_.continuation_.ClearToEmpty();
+  _impl_.limit_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RangeScan::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string start = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_start();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.RangeScan.start"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string end = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_end();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.RangeScan.end"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string owner = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_owner();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.RangeScan.owner"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 limit = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string continuation = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_continuation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.RangeScan.continuation"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RangeScan::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip_cli.RangeScan)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string start = 1;
+  if (!this->_internal_start().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_start().data(), static_cast<int>(this->_internal_start().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.RangeScan.start");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_start(), target);
+  }
+
+  // string end = 2;
+  if (!this->_internal_end().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_end().data(), static_cast<int>(this->_internal_end().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.RangeScan.end");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_end(), target);
+  }
+
+  // string owner = 3;
+  if (!this->_internal_owner().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_owner().data(), static_cast<int>(this->_internal_owner().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.RangeScan.owner");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_owner(), target);
+  }
+
+  // int32 limit = 4;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_limit(), target);
+  }
+
+  // string continuation = 5;
+  if (!this->_internal_continuation().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_continuation().data(), static_cast<int>(this->_internal_continuation().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.RangeScan.continuation");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_continuation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip_cli.RangeScan)
+  return target;
+}
+
+size_t RangeScan::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip_cli.RangeScan)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string start = 1;
+  if (!this->_internal_start().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_start());
+  }
+
+  // string end = 2;
+  if (!this->_internal_end().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_end());
+  }
+
+  // string owner = 3;
+  if (!this->_internal_owner().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_owner());
+  }
+
+  // string continuation = 5;
+  if (!this->_internal_continuation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_continuation());
+  }
+
+  // int32 limit = 4;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_limit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RangeScan::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RangeScan::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RangeScan::GetClassData() const { return &_class_data_; }
+
+
+void RangeScan::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RangeScan*>(&to_msg);
+  auto& from = static_cast<const RangeScan&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip_cli.RangeScan)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_start().empty()) {
+    _this->_internal_set_start(from._internal_start());
+  }
+  if (!from._internal_end().empty()) {
+    _this->_internal_set_end(from._internal_end());
+  }
+  if (!from._internal_owner().empty()) {
+    _this->_internal_set_owner(from._internal_owner());
+  }
+  if (!from._internal_continuation().empty()) {
+    _this->_internal_set_continuation(from._internal_continuation());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RangeScan::CopyFrom(const RangeScan& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip_cli.RangeScan)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RangeScan::IsInitialized() const {
+  return true;
+}
+
+void RangeScan::InternalSwap(RangeScan* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.start_, lhs_arena,
+      &other->_impl_.start_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.end_, lhs_arena,
+      &other->_impl_.end_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.owner_, lhs_arena,
+      &other->_impl_.owner_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.continuation_, lhs_arena,
+      &other->_impl_.continuation_, rhs_arena
+  );
+  swap(_impl_.limit_, other->_impl_.limit_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RangeScan::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GossipCli_2eproto_getter, &descriptor_table_GossipCli_2eproto_once,
+      file_level_metadata_GossipCli_2eproto[11]);
+}
+
+// ===================================================================
+
+class ScanResult::_Internal {
+ public:
+};
+
+void ScanResult::clear_message() {
+  _impl_.message_.Clear();
+}
+ScanResult::ScanResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pf_gossip_cli.ScanResult)
+}
+ScanResult::ScanResult(const ScanResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScanResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){from._impl_.message_}
+    , decltype(_impl_.continuation_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.continuation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.continuation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_continuation().empty()) {
+    _this->_impl_.continuation_.Set(from._internal_continuation(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:pf_gossip_cli.ScanResult)
+}
+
+inline void ScanResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){arena}
+    , decltype(_impl_.continuation_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.continuation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.continuation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ScanResult::~ScanResult() {
+  // @@protoc_insertion_point(destructor:pf_gossip_cli.ScanResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScanResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.~RepeatedPtrField();
+  _impl_.continuation_.Destroy();
+}
+
+void ScanResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScanResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:pf_gossip_cli.ScanResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_.Clear();
+  _impl_.continuation_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScanResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .pf_gossip.SearchResult.Message message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_message(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string continuation = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_continuation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pf_gossip_cli.ScanResult.continuation"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScanResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pf_gossip_cli.ScanResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip.SearchResult.Message message = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_message_size()); i < n; i++) {
+    const auto& repfield = this->_internal_message(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string continuation = 2;
+  if (!this->_internal_continuation().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_continuation().data(), static_cast<int>(this->_internal_continuation().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pf_gossip_cli.ScanResult.continuation");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_continuation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pf_gossip_cli.ScanResult)
+  return target;
+}
+
+size_t ScanResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pf_gossip_cli.ScanResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .pf_gossip.SearchResult.Message message = 1;
+  total_size += 1UL * this->_internal_message_size();
+  for (const auto& msg : this->_impl_.message_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string continuation = 2;
+  if (!this->_internal_continuation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_continuation());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScanResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScanResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScanResult::GetClassData() const { return &_class_data_; }
+
+
+void ScanResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScanResult*>(&to_msg);
+  auto& from = static_cast<const ScanResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pf_gossip_cli.ScanResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.message_.MergeFrom(from._impl_.message_);
+  if (!from._internal_continuation().empty()) {
+    _this->_internal_set_continuation(from._internal_continuation());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScanResult::CopyFrom(const ScanResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pf_gossip_cli.ScanResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScanResult::IsInitialized() const {
+  return true;
+}
+
+void ScanResult::InternalSwap(ScanResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.message_.InternalSwap(&other->_impl_.message_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.continuation_, lhs_arena,
+      &other->_impl_.continuation_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScanResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GossipCli_2eproto_getter, &descriptor_table_GossipCli_2eproto_once,
+      file_level_metadata_GossipCli_2eproto[12]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace pf_gossip_cli
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::Key*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::Key >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::Key >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::JsonValue*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::JsonValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::JsonValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::Url*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::Url >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::Url >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::Echo*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::Echo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::Echo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::SearchInfo*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::SearchInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::SearchInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::WriteOperation*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::WriteOperation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::WriteOperation >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::WriteBatch*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::WriteBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::WriteBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::WriteResult*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::WriteResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::WriteResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::SlotKey*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::SlotKey >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::SlotKey >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::KeyList*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::KeyList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::KeyList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::PrefixScan*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::PrefixScan >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::PrefixScan >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::RangeScan*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::RangeScan >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::RangeScan >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pf_gossip_cli::ScanResult*
+Arena::CreateMaybeMessage< ::pf_gossip_cli::ScanResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pf_gossip_cli::ScanResult >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
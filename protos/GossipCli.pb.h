@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021005 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -56,19 +56,51 @@ extern JsonValueDefaultTypeInternal _JsonValue_default_instance_;
 class Key;
 struct KeyDefaultTypeInternal;
 extern KeyDefaultTypeInternal _Key_default_instance_;
+class KeyList;
+struct KeyListDefaultTypeInternal;
+extern KeyListDefaultTypeInternal _KeyList_default_instance_;
+class PrefixScan;
+struct PrefixScanDefaultTypeInternal;
+extern PrefixScanDefaultTypeInternal _PrefixScan_default_instance_;
+class RangeScan;
+struct RangeScanDefaultTypeInternal;
+extern RangeScanDefaultTypeInternal _RangeScan_default_instance_;
+class ScanResult;
+struct ScanResultDefaultTypeInternal;
+extern ScanResultDefaultTypeInternal _ScanResult_default_instance_;
 class SearchInfo;
 struct SearchInfoDefaultTypeInternal;
 extern SearchInfoDefaultTypeInternal _SearchInfo_default_instance_;
+class SlotKey;
+struct SlotKeyDefaultTypeInternal;
+extern SlotKeyDefaultTypeInternal _SlotKey_default_instance_;
 class Url;
 struct UrlDefaultTypeInternal;
 extern UrlDefaultTypeInternal _Url_default_instance_;
+class WriteBatch;
+struct WriteBatchDefaultTypeInternal;
+extern WriteBatchDefaultTypeInternal _WriteBatch_default_instance_;
+class WriteOperation;
+struct WriteOperationDefaultTypeInternal;
+extern WriteOperationDefaultTypeInternal _WriteOperation_default_instance_;
+class WriteResult;
+struct WriteResultDefaultTypeInternal;
+extern WriteResultDefaultTypeInternal _WriteResult_default_instance_;
 }  // namespace pf_gossip_cli
 PROTOBUF_NAMESPACE_OPEN
 template<> ::pf_gossip_cli::Echo* Arena::CreateMaybeMessage<::pf_gossip_cli::Echo>(Arena*);
 template<> ::pf_gossip_cli::JsonValue* Arena::CreateMaybeMessage<::pf_gossip_cli::JsonValue>(Arena*);
 template<> ::pf_gossip_cli::Key* Arena::CreateMaybeMessage<::pf_gossip_cli::Key>(Arena*);
+template<> ::pf_gossip_cli::KeyList* Arena::CreateMaybeMessage<::pf_gossip_cli::KeyList>(Arena*);
+template<> ::pf_gossip_cli::PrefixScan* Arena::CreateMaybeMessage<::pf_gossip_cli::PrefixScan>(Arena*);
+template<> ::pf_gossip_cli::RangeScan* Arena::CreateMaybeMessage<::pf_gossip_cli::RangeScan>(Arena*);
+template<> ::pf_gossip_cli::ScanResult* Arena::CreateMaybeMessage<::pf_gossip_cli::ScanResult>(Arena*);
 template<> ::pf_gossip_cli::SearchInfo* Arena::CreateMaybeMessage<::pf_gossip_cli::SearchInfo>(Arena*);
+template<> ::pf_gossip_cli::SlotKey* Arena::CreateMaybeMessage<::pf_gossip_cli::SlotKey>(Arena*);
 template<> ::pf_gossip_cli::Url* Arena::CreateMaybeMessage<::pf_gossip_cli::Url>(Arena*);
+template<> ::pf_gossip_cli::WriteBatch* Arena::CreateMaybeMessage<::pf_gossip_cli::WriteBatch>(Arena*);
+template<> ::pf_gossip_cli::WriteOperation* Arena::CreateMaybeMessage<::pf_gossip_cli::WriteOperation>(Arena*);
+template<> ::pf_gossip_cli::WriteResult* Arena::CreateMaybeMessage<::pf_gossip_cli::WriteResult>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace pf_gossip_cli {
 
@@ -859,321 +891,2701 @@ class SearchInfo final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_GossipCli_2eproto;
 };
+// -------------------------------------------------------------------
+
+class WriteOperation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip_cli.WriteOperation) */ {
+ public:
+  inline WriteOperation() : WriteOperation(nullptr) {}
+  ~WriteOperation() override;
+  explicit PROTOBUF_CONSTEXPR WriteOperation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteOperation(const WriteOperation& from);
+  WriteOperation(WriteOperation&& from) noexcept
+    : WriteOperation() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteOperation& operator=(const WriteOperation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteOperation& operator=(WriteOperation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteOperation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteOperation* internal_default_instance() {
+    return reinterpret_cast<const WriteOperation*>(
+               &_WriteOperation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(WriteOperation& a, WriteOperation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteOperation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteOperation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteOperation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteOperation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteOperation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteOperation& from) {
+    WriteOperation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteOperation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip_cli.WriteOperation";
+  }
+  protected:
+  explicit WriteOperation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kTtlMsFieldNumber = 4,
+    kRemoveFieldNumber = 3,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // string value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int64 ttl_ms = 4;
+  void clear_ttl_ms();
+  int64_t ttl_ms() const;
+  void set_ttl_ms(int64_t value);
+  private:
+  int64_t _internal_ttl_ms() const;
+  void _internal_set_ttl_ms(int64_t value);
+  public:
+
+  // bool remove = 3;
+  void clear_remove();
+  bool remove() const;
+  void set_remove(bool value);
+  private:
+  bool _internal_remove() const;
+  void _internal_set_remove(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip_cli.WriteOperation)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int64_t ttl_ms_;
+    bool remove_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GossipCli_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip_cli.WriteBatch) */ {
+ public:
+  inline WriteBatch() : WriteBatch(nullptr) {}
+  ~WriteBatch() override;
+  explicit PROTOBUF_CONSTEXPR WriteBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteBatch(const WriteBatch& from);
+  WriteBatch(WriteBatch&& from) noexcept
+    : WriteBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteBatch& operator=(const WriteBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteBatch& operator=(WriteBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteBatch* internal_default_instance() {
+    return reinterpret_cast<const WriteBatch*>(
+               &_WriteBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(WriteBatch& a, WriteBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteBatch& from) {
+    WriteBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip_cli.WriteBatch";
+  }
+  protected:
+  explicit WriteBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationsFieldNumber = 1,
+  };
+  // repeated .pf_gossip_cli.WriteOperation operations = 1;
+  int operations_size() const;
+  private:
+  int _internal_operations_size() const;
+  public:
+  void clear_operations();
+  ::pf_gossip_cli::WriteOperation* mutable_operations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::WriteOperation >*
+      mutable_operations();
+  private:
+  const ::pf_gossip_cli::WriteOperation& _internal_operations(int index) const;
+  ::pf_gossip_cli::WriteOperation* _internal_add_operations();
+  public:
+  const ::pf_gossip_cli::WriteOperation& operations(int index) const;
+  ::pf_gossip_cli::WriteOperation* add_operations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::WriteOperation >&
+      operations() const;
+
+  // @@protoc_insertion_point(class_scope:pf_gossip_cli.WriteBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::WriteOperation > operations_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GossipCli_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip_cli.WriteResult) */ {
+ public:
+  inline WriteResult() : WriteResult(nullptr) {}
+  ~WriteResult() override;
+  explicit PROTOBUF_CONSTEXPR WriteResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteResult(const WriteResult& from);
+  WriteResult(WriteResult&& from) noexcept
+    : WriteResult() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteResult& operator=(const WriteResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteResult& operator=(WriteResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteResult* internal_default_instance() {
+    return reinterpret_cast<const WriteResult*>(
+               &_WriteResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(WriteResult& a, WriteResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteResult& from) {
+    WriteResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip_cli.WriteResult";
+  }
+  protected:
+  explicit WriteResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 4,
+    kVersionFieldNumber = 2,
+    kSucceedFieldNumber = 1,
+    kAppliedFieldNumber = 3,
+  };
+  // string message = 4;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // int64 version = 2;
+  void clear_version();
+  int64_t version() const;
+  void set_version(int64_t value);
+  private:
+  int64_t _internal_version() const;
+  void _internal_set_version(int64_t value);
+  public:
+
+  // bool succeed = 1;
+  void clear_succeed();
+  bool succeed() const;
+  void set_succeed(bool value);
+  private:
+  bool _internal_succeed() const;
+  void _internal_set_succeed(bool value);
+  public:
+
+  // int32 applied = 3;
+  void clear_applied();
+  int32_t applied() const;
+  void set_applied(int32_t value);
+  private:
+  int32_t _internal_applied() const;
+  void _internal_set_applied(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip_cli.WriteResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int64_t version_;
+    bool succeed_;
+    int32_t applied_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GossipCli_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SlotKey final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip_cli.SlotKey) */ {
+ public:
+  inline SlotKey() : SlotKey(nullptr) {}
+  ~SlotKey() override;
+  explicit PROTOBUF_CONSTEXPR SlotKey(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SlotKey(const SlotKey& from);
+  SlotKey(SlotKey&& from) noexcept
+    : SlotKey() {
+    *this = ::std::move(from);
+  }
+
+  inline SlotKey& operator=(const SlotKey& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SlotKey& operator=(SlotKey&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SlotKey& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SlotKey* internal_default_instance() {
+    return reinterpret_cast<const SlotKey*>(
+               &_SlotKey_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(SlotKey& a, SlotKey& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SlotKey* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SlotKey* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SlotKey* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SlotKey>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SlotKey& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SlotKey& from) {
+    SlotKey::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SlotKey* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip_cli.SlotKey";
+  }
+  protected:
+  explicit SlotKey(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kOwnerFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // string owner = 2;
+  void clear_owner();
+  const std::string& owner() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_owner(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_owner();
+  PROTOBUF_NODISCARD std::string* release_owner();
+  void set_allocated_owner(std::string* owner);
+  private:
+  const std::string& _internal_owner() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_owner(const std::string& value);
+  std::string* _internal_mutable_owner();
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip_cli.SlotKey)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr owner_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GossipCli_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeyList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip_cli.KeyList) */ {
+ public:
+  inline KeyList() : KeyList(nullptr) {}
+  ~KeyList() override;
+  explicit PROTOBUF_CONSTEXPR KeyList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeyList(const KeyList& from);
+  KeyList(KeyList&& from) noexcept
+    : KeyList() {
+    *this = ::std::move(from);
+  }
+
+  inline KeyList& operator=(const KeyList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeyList& operator=(KeyList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeyList* internal_default_instance() {
+    return reinterpret_cast<const KeyList*>(
+               &_KeyList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(KeyList& a, KeyList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeyList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeyList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeyList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeyList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyList& from) {
+    KeyList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeyList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip_cli.KeyList";
+  }
+  protected:
+  explicit KeyList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+  };
+  // repeated .pf_gossip_cli.SlotKey keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  ::pf_gossip_cli::SlotKey* mutable_keys(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::SlotKey >*
+      mutable_keys();
+  private:
+  const ::pf_gossip_cli::SlotKey& _internal_keys(int index) const;
+  ::pf_gossip_cli::SlotKey* _internal_add_keys();
+  public:
+  const ::pf_gossip_cli::SlotKey& keys(int index) const;
+  ::pf_gossip_cli::SlotKey* add_keys();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::SlotKey >&
+      keys() const;
+
+  // @@protoc_insertion_point(class_scope:pf_gossip_cli.KeyList)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::SlotKey > keys_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GossipCli_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrefixScan final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip_cli.PrefixScan) */ {
+ public:
+  inline PrefixScan() : PrefixScan(nullptr) {}
+  ~PrefixScan() override;
+  explicit PROTOBUF_CONSTEXPR PrefixScan(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrefixScan(const PrefixScan& from);
+  PrefixScan(PrefixScan&& from) noexcept
+    : PrefixScan() {
+    *this = ::std::move(from);
+  }
+
+  inline PrefixScan& operator=(const PrefixScan& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrefixScan& operator=(PrefixScan&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrefixScan& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrefixScan* internal_default_instance() {
+    return reinterpret_cast<const PrefixScan*>(
+               &_PrefixScan_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(PrefixScan& a, PrefixScan& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrefixScan* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrefixScan* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrefixScan* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrefixScan>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrefixScan& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrefixScan& from) {
+    PrefixScan::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrefixScan* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip_cli.PrefixScan";
+  }
+  protected:
+  explicit PrefixScan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrefixFieldNumber = 1,
+    kOwnerFieldNumber = 2,
+    kContinuationFieldNumber = 4,
+    kLimitFieldNumber = 3,
+  };
+  // string prefix = 1;
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
+  private:
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
+  public:
+
+  // string owner = 2;
+  void clear_owner();
+  const std::string& owner() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_owner(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_owner();
+  PROTOBUF_NODISCARD std::string* release_owner();
+  void set_allocated_owner(std::string* owner);
+  private:
+  const std::string& _internal_owner() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_owner(const std::string& value);
+  std::string* _internal_mutable_owner();
+  public:
+
+  // string continuation = 4;
+  void clear_continuation();
+  const std::string& continuation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_continuation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_continuation();
+  PROTOBUF_NODISCARD std::string* release_continuation();
+  void set_allocated_continuation(std::string* continuation);
+  private:
+  const std::string& _internal_continuation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_continuation(const std::string& value);
+  std::string* _internal_mutable_continuation();
+  public:
+
+  // int32 limit = 3;
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip_cli.PrefixScan)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr owner_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr continuation_;
+    int32_t limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GossipCli_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RangeScan final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip_cli.RangeScan) */ {
+ public:
+  inline RangeScan() : RangeScan(nullptr) {}
+  ~RangeScan() override;
+  explicit PROTOBUF_CONSTEXPR RangeScan(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RangeScan(const RangeScan& from);
+  RangeScan(RangeScan&& from) noexcept
+    : RangeScan() {
+    *this = ::std::move(from);
+  }
+
+  inline RangeScan& operator=(const RangeScan& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RangeScan& operator=(RangeScan&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RangeScan& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RangeScan* internal_default_instance() {
+    return reinterpret_cast<const RangeScan*>(
+               &_RangeScan_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(RangeScan& a, RangeScan& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RangeScan* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RangeScan* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RangeScan* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RangeScan>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RangeScan& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RangeScan& from) {
+    RangeScan::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RangeScan* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip_cli.RangeScan";
+  }
+  protected:
+  explicit RangeScan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartFieldNumber = 1,
+    kEndFieldNumber = 2,
+    kOwnerFieldNumber = 3,
+    kContinuationFieldNumber = 5,
+    kLimitFieldNumber = 4,
+  };
+  // string start = 1;
+  void clear_start();
+  const std::string& start() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_start(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_start();
+  PROTOBUF_NODISCARD std::string* release_start();
+  void set_allocated_start(std::string* start);
+  private:
+  const std::string& _internal_start() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start(const std::string& value);
+  std::string* _internal_mutable_start();
+  public:
+
+  // string end = 2;
+  void clear_end();
+  const std::string& end() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_end(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_end();
+  PROTOBUF_NODISCARD std::string* release_end();
+  void set_allocated_end(std::string* end);
+  private:
+  const std::string& _internal_end() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end(const std::string& value);
+  std::string* _internal_mutable_end();
+  public:
+
+  // string owner = 3;
+  void clear_owner();
+  const std::string& owner() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_owner(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_owner();
+  PROTOBUF_NODISCARD std::string* release_owner();
+  void set_allocated_owner(std::string* owner);
+  private:
+  const std::string& _internal_owner() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_owner(const std::string& value);
+  std::string* _internal_mutable_owner();
+  public:
+
+  // string continuation = 5;
+  void clear_continuation();
+  const std::string& continuation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_continuation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_continuation();
+  PROTOBUF_NODISCARD std::string* release_continuation();
+  void set_allocated_continuation(std::string* continuation);
+  private:
+  const std::string& _internal_continuation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_continuation(const std::string& value);
+  std::string* _internal_mutable_continuation();
+  public:
+
+  // int32 limit = 4;
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip_cli.RangeScan)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr owner_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr continuation_;
+    int32_t limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GossipCli_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScanResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pf_gossip_cli.ScanResult) */ {
+ public:
+  inline ScanResult() : ScanResult(nullptr) {}
+  ~ScanResult() override;
+  explicit PROTOBUF_CONSTEXPR ScanResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScanResult(const ScanResult& from);
+  ScanResult(ScanResult&& from) noexcept
+    : ScanResult() {
+    *this = ::std::move(from);
+  }
+
+  inline ScanResult& operator=(const ScanResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScanResult& operator=(ScanResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanResult* internal_default_instance() {
+    return reinterpret_cast<const ScanResult*>(
+               &_ScanResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ScanResult& a, ScanResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScanResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanResult& from) {
+    ScanResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pf_gossip_cli.ScanResult";
+  }
+  protected:
+  explicit ScanResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+    kContinuationFieldNumber = 2,
+  };
+  // repeated .pf_gossip.SearchResult.Message message = 1;
+  int message_size() const;
+  private:
+  int _internal_message_size() const;
+  public:
+  void clear_message();
+  ::pf_gossip::SearchResult_Message* mutable_message(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SearchResult_Message >*
+      mutable_message();
+  private:
+  const ::pf_gossip::SearchResult_Message& _internal_message(int index) const;
+  ::pf_gossip::SearchResult_Message* _internal_add_message();
+  public:
+  const ::pf_gossip::SearchResult_Message& message(int index) const;
+  ::pf_gossip::SearchResult_Message* add_message();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SearchResult_Message >&
+      message() const;
+
+  // string continuation = 2;
+  void clear_continuation();
+  const std::string& continuation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_continuation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_continuation();
+  PROTOBUF_NODISCARD std::string* release_continuation();
+  void set_allocated_continuation(std::string* continuation);
+  private:
+  const std::string& _internal_continuation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_continuation(const std::string& value);
+  std::string* _internal_mutable_continuation();
+  public:
+
+  // @@protoc_insertion_point(class_scope:pf_gossip_cli.ScanResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SearchResult_Message > message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr continuation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GossipCli_2eproto;
+};
 // ===================================================================
 
 
-// ===================================================================
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Key
+
+// string content = 1;
+inline void Key::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& Key::content() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.Key.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Key::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.Key.content)
+}
+inline std::string* Key::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.Key.content)
+  return _s;
+}
+inline const std::string& Key::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void Key::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Key::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Key::release_content() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.Key.content)
+  return _impl_.content_.Release();
+}
+inline void Key::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.Key.content)
+}
+
+// -------------------------------------------------------------------
+
+// JsonValue
+
+// string content = 2;
+inline void JsonValue::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& JsonValue::content() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.JsonValue.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JsonValue::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.JsonValue.content)
+}
+inline std::string* JsonValue::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.JsonValue.content)
+  return _s;
+}
+inline const std::string& JsonValue::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void JsonValue::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JsonValue::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JsonValue::release_content() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.JsonValue.content)
+  return _impl_.content_.Release();
+}
+inline void JsonValue::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.JsonValue.content)
+}
+
+// -------------------------------------------------------------------
+
+// Url
+
+// string content = 1;
+inline void Url::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& Url::content() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.Url.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Url::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.Url.content)
+}
+inline std::string* Url::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.Url.content)
+  return _s;
+}
+inline const std::string& Url::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void Url::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Url::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Url::release_content() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.Url.content)
+  return _impl_.content_.Release();
+}
+inline void Url::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.Url.content)
+}
+
+// -------------------------------------------------------------------
+
+// Echo
+
+// bool succeed = 1;
+inline void Echo::clear_succeed() {
+  _impl_.succeed_ = false;
+}
+inline bool Echo::_internal_succeed() const {
+  return _impl_.succeed_;
+}
+inline bool Echo::succeed() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.Echo.succeed)
+  return _internal_succeed();
+}
+inline void Echo::_internal_set_succeed(bool value) {
+  
+  _impl_.succeed_ = value;
+}
+inline void Echo::set_succeed(bool value) {
+  _internal_set_succeed(value);
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.Echo.succeed)
+}
+
+// string message = 2;
+inline void Echo::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& Echo::message() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.Echo.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Echo::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.Echo.message)
+}
+inline std::string* Echo::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.Echo.message)
+  return _s;
+}
+inline const std::string& Echo::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void Echo::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Echo::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Echo::release_message() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.Echo.message)
+  return _impl_.message_.Release();
+}
+inline void Echo::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.Echo.message)
+}
+
+// -------------------------------------------------------------------
+
+// SearchInfo
+
+// string key = 1;
+inline void SearchInfo::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& SearchInfo::key() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.SearchInfo.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchInfo::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.SearchInfo.key)
+}
+inline std::string* SearchInfo::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.SearchInfo.key)
+  return _s;
+}
+inline const std::string& SearchInfo::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void SearchInfo::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchInfo::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchInfo::release_key() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.SearchInfo.key)
+  return _impl_.key_.Release();
+}
+inline void SearchInfo::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.SearchInfo.key)
+}
+
+// bool latest = 2;
+inline void SearchInfo::clear_latest() {
+  _impl_.latest_ = false;
+}
+inline bool SearchInfo::_internal_latest() const {
+  return _impl_.latest_;
+}
+inline bool SearchInfo::latest() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.SearchInfo.latest)
+  return _internal_latest();
+}
+inline void SearchInfo::_internal_set_latest(bool value) {
+  
+  _impl_.latest_ = value;
+}
+inline void SearchInfo::set_latest(bool value) {
+  _internal_set_latest(value);
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.SearchInfo.latest)
+}
+
+// -------------------------------------------------------------------
+
+// WriteOperation
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Key
+// string key = 1;
+inline void WriteOperation::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& WriteOperation::key() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.WriteOperation.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteOperation::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.WriteOperation.key)
+}
+inline std::string* WriteOperation::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.WriteOperation.key)
+  return _s;
+}
+inline const std::string& WriteOperation::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void WriteOperation::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteOperation::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteOperation::release_key() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.WriteOperation.key)
+  return _impl_.key_.Release();
+}
+inline void WriteOperation::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.WriteOperation.key)
+}
+
+// string value = 2;
+inline void WriteOperation::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& WriteOperation::value() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.WriteOperation.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteOperation::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.WriteOperation.value)
+}
+inline std::string* WriteOperation::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.WriteOperation.value)
+  return _s;
+}
+inline const std::string& WriteOperation::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void WriteOperation::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteOperation::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteOperation::release_value() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.WriteOperation.value)
+  return _impl_.value_.Release();
+}
+inline void WriteOperation::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.WriteOperation.value)
+}
+
+// bool remove = 3;
+inline void WriteOperation::clear_remove() {
+  _impl_.remove_ = false;
+}
+inline bool WriteOperation::_internal_remove() const {
+  return _impl_.remove_;
+}
+inline bool WriteOperation::remove() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.WriteOperation.remove)
+  return _internal_remove();
+}
+inline void WriteOperation::_internal_set_remove(bool value) {
+  
+  _impl_.remove_ = value;
+}
+inline void WriteOperation::set_remove(bool value) {
+  _internal_set_remove(value);
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.WriteOperation.remove)
+}
+
+// int64 ttl_ms = 4;
+inline void WriteOperation::clear_ttl_ms() {
+  _impl_.ttl_ms_ = int64_t{0};
+}
+inline int64_t WriteOperation::_internal_ttl_ms() const {
+  return _impl_.ttl_ms_;
+}
+inline int64_t WriteOperation::ttl_ms() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.WriteOperation.ttl_ms)
+  return _internal_ttl_ms();
+}
+inline void WriteOperation::_internal_set_ttl_ms(int64_t value) {
+  
+  _impl_.ttl_ms_ = value;
+}
+inline void WriteOperation::set_ttl_ms(int64_t value) {
+  _internal_set_ttl_ms(value);
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.WriteOperation.ttl_ms)
+}
+
+// -------------------------------------------------------------------
+
+// WriteBatch
+
+// repeated .pf_gossip_cli.WriteOperation operations = 1;
+inline int WriteBatch::_internal_operations_size() const {
+  return _impl_.operations_.size();
+}
+inline int WriteBatch::operations_size() const {
+  return _internal_operations_size();
+}
+inline void WriteBatch::clear_operations() {
+  _impl_.operations_.Clear();
+}
+inline ::pf_gossip_cli::WriteOperation* WriteBatch::mutable_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.WriteBatch.operations)
+  return _impl_.operations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::WriteOperation >*
+WriteBatch::mutable_operations() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip_cli.WriteBatch.operations)
+  return &_impl_.operations_;
+}
+inline const ::pf_gossip_cli::WriteOperation& WriteBatch::_internal_operations(int index) const {
+  return _impl_.operations_.Get(index);
+}
+inline const ::pf_gossip_cli::WriteOperation& WriteBatch::operations(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.WriteBatch.operations)
+  return _internal_operations(index);
+}
+inline ::pf_gossip_cli::WriteOperation* WriteBatch::_internal_add_operations() {
+  return _impl_.operations_.Add();
+}
+inline ::pf_gossip_cli::WriteOperation* WriteBatch::add_operations() {
+  ::pf_gossip_cli::WriteOperation* _add = _internal_add_operations();
+  // @@protoc_insertion_point(field_add:pf_gossip_cli.WriteBatch.operations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::WriteOperation >&
+WriteBatch::operations() const {
+  // @@protoc_insertion_point(field_list:pf_gossip_cli.WriteBatch.operations)
+  return _impl_.operations_;
+}
+
+// -------------------------------------------------------------------
+
+// WriteResult
+
+// bool succeed = 1;
+inline void WriteResult::clear_succeed() {
+  _impl_.succeed_ = false;
+}
+inline bool WriteResult::_internal_succeed() const {
+  return _impl_.succeed_;
+}
+inline bool WriteResult::succeed() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.WriteResult.succeed)
+  return _internal_succeed();
+}
+inline void WriteResult::_internal_set_succeed(bool value) {
+  
+  _impl_.succeed_ = value;
+}
+inline void WriteResult::set_succeed(bool value) {
+  _internal_set_succeed(value);
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.WriteResult.succeed)
+}
+
+// int64 version = 2;
+inline void WriteResult::clear_version() {
+  _impl_.version_ = int64_t{0};
+}
+inline int64_t WriteResult::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t WriteResult::version() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.WriteResult.version)
+  return _internal_version();
+}
+inline void WriteResult::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void WriteResult::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.WriteResult.version)
+}
+
+// int32 applied = 3;
+inline void WriteResult::clear_applied() {
+  _impl_.applied_ = 0;
+}
+inline int32_t WriteResult::_internal_applied() const {
+  return _impl_.applied_;
+}
+inline int32_t WriteResult::applied() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.WriteResult.applied)
+  return _internal_applied();
+}
+inline void WriteResult::_internal_set_applied(int32_t value) {
+  
+  _impl_.applied_ = value;
+}
+inline void WriteResult::set_applied(int32_t value) {
+  _internal_set_applied(value);
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.WriteResult.applied)
+}
+
+// string message = 4;
+inline void WriteResult::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& WriteResult::message() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.WriteResult.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteResult::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.WriteResult.message)
+}
+inline std::string* WriteResult::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.WriteResult.message)
+  return _s;
+}
+inline const std::string& WriteResult::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void WriteResult::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteResult::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteResult::release_message() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.WriteResult.message)
+  return _impl_.message_.Release();
+}
+inline void WriteResult::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.WriteResult.message)
+}
+
+// -------------------------------------------------------------------
+
+// SlotKey
+
+// string key = 1;
+inline void SlotKey::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& SlotKey::key() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.SlotKey.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SlotKey::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.SlotKey.key)
+}
+inline std::string* SlotKey::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.SlotKey.key)
+  return _s;
+}
+inline const std::string& SlotKey::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void SlotKey::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SlotKey::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SlotKey::release_key() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.SlotKey.key)
+  return _impl_.key_.Release();
+}
+inline void SlotKey::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.SlotKey.key)
+}
+
+// string owner = 2;
+inline void SlotKey::clear_owner() {
+  _impl_.owner_.ClearToEmpty();
+}
+inline const std::string& SlotKey::owner() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.SlotKey.owner)
+  return _internal_owner();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SlotKey::set_owner(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.owner_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.SlotKey.owner)
+}
+inline std::string* SlotKey::mutable_owner() {
+  std::string* _s = _internal_mutable_owner();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.SlotKey.owner)
+  return _s;
+}
+inline const std::string& SlotKey::_internal_owner() const {
+  return _impl_.owner_.Get();
+}
+inline void SlotKey::_internal_set_owner(const std::string& value) {
+  
+  _impl_.owner_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SlotKey::_internal_mutable_owner() {
+  
+  return _impl_.owner_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SlotKey::release_owner() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.SlotKey.owner)
+  return _impl_.owner_.Release();
+}
+inline void SlotKey::set_allocated_owner(std::string* owner) {
+  if (owner != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.owner_.SetAllocated(owner, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.owner_.IsDefault()) {
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.SlotKey.owner)
+}
+
+// -------------------------------------------------------------------
+
+// KeyList
+
+// repeated .pf_gossip_cli.SlotKey keys = 1;
+inline int KeyList::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int KeyList::keys_size() const {
+  return _internal_keys_size();
+}
+inline void KeyList::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline ::pf_gossip_cli::SlotKey* KeyList::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.KeyList.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::SlotKey >*
+KeyList::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip_cli.KeyList.keys)
+  return &_impl_.keys_;
+}
+inline const ::pf_gossip_cli::SlotKey& KeyList::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const ::pf_gossip_cli::SlotKey& KeyList::keys(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.KeyList.keys)
+  return _internal_keys(index);
+}
+inline ::pf_gossip_cli::SlotKey* KeyList::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline ::pf_gossip_cli::SlotKey* KeyList::add_keys() {
+  ::pf_gossip_cli::SlotKey* _add = _internal_add_keys();
+  // @@protoc_insertion_point(field_add:pf_gossip_cli.KeyList.keys)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip_cli::SlotKey >&
+KeyList::keys() const {
+  // @@protoc_insertion_point(field_list:pf_gossip_cli.KeyList.keys)
+  return _impl_.keys_;
+}
+
+// -------------------------------------------------------------------
+
+// PrefixScan
+
+// string prefix = 1;
+inline void PrefixScan::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+}
+inline const std::string& PrefixScan::prefix() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.PrefixScan.prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrefixScan::set_prefix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.PrefixScan.prefix)
+}
+inline std::string* PrefixScan::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.PrefixScan.prefix)
+  return _s;
+}
+inline const std::string& PrefixScan::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void PrefixScan::_internal_set_prefix(const std::string& value) {
+  
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrefixScan::_internal_mutable_prefix() {
+  
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrefixScan::release_prefix() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.PrefixScan.prefix)
+  return _impl_.prefix_.Release();
+}
+inline void PrefixScan::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.PrefixScan.prefix)
+}
 
-// string content = 1;
-inline void Key::clear_content() {
-  _impl_.content_.ClearToEmpty();
+// string owner = 2;
+inline void PrefixScan::clear_owner() {
+  _impl_.owner_.ClearToEmpty();
 }
-inline const std::string& Key::content() const {
-  // @@protoc_insertion_point(field_get:pf_gossip_cli.Key.content)
-  return _internal_content();
+inline const std::string& PrefixScan::owner() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.PrefixScan.owner)
+  return _internal_owner();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Key::set_content(ArgT0&& arg0, ArgT... args) {
+void PrefixScan::set_owner(ArgT0&& arg0, ArgT... args) {
  
- _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip_cli.Key.content)
+ _impl_.owner_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.PrefixScan.owner)
 }
-inline std::string* Key::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.Key.content)
+inline std::string* PrefixScan::mutable_owner() {
+  std::string* _s = _internal_mutable_owner();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.PrefixScan.owner)
   return _s;
 }
-inline const std::string& Key::_internal_content() const {
-  return _impl_.content_.Get();
+inline const std::string& PrefixScan::_internal_owner() const {
+  return _impl_.owner_.Get();
 }
-inline void Key::_internal_set_content(const std::string& value) {
+inline void PrefixScan::_internal_set_owner(const std::string& value) {
   
-  _impl_.content_.Set(value, GetArenaForAllocation());
+  _impl_.owner_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Key::_internal_mutable_content() {
+inline std::string* PrefixScan::_internal_mutable_owner() {
   
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  return _impl_.owner_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Key::release_content() {
-  // @@protoc_insertion_point(field_release:pf_gossip_cli.Key.content)
-  return _impl_.content_.Release();
+inline std::string* PrefixScan::release_owner() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.PrefixScan.owner)
+  return _impl_.owner_.Release();
 }
-inline void Key::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
+inline void PrefixScan::set_allocated_owner(std::string* owner) {
+  if (owner != nullptr) {
     
   } else {
     
   }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+  _impl_.owner_.SetAllocated(owner, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.owner_.IsDefault()) {
+    _impl_.owner_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.Key.content)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.PrefixScan.owner)
 }
 
-// -------------------------------------------------------------------
-
-// JsonValue
+// int32 limit = 3;
+inline void PrefixScan::clear_limit() {
+  _impl_.limit_ = 0;
+}
+inline int32_t PrefixScan::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t PrefixScan::limit() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.PrefixScan.limit)
+  return _internal_limit();
+}
+inline void PrefixScan::_internal_set_limit(int32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void PrefixScan::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.PrefixScan.limit)
+}
 
-// string content = 2;
-inline void JsonValue::clear_content() {
-  _impl_.content_.ClearToEmpty();
+// string continuation = 4;
+inline void PrefixScan::clear_continuation() {
+  _impl_.continuation_.ClearToEmpty();
 }
-inline const std::string& JsonValue::content() const {
-  // @@protoc_insertion_point(field_get:pf_gossip_cli.JsonValue.content)
-  return _internal_content();
+inline const std::string& PrefixScan::continuation() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.PrefixScan.continuation)
+  return _internal_continuation();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void JsonValue::set_content(ArgT0&& arg0, ArgT... args) {
+void PrefixScan::set_continuation(ArgT0&& arg0, ArgT... args) {
  
- _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip_cli.JsonValue.content)
+ _impl_.continuation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.PrefixScan.continuation)
 }
-inline std::string* JsonValue::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.JsonValue.content)
+inline std::string* PrefixScan::mutable_continuation() {
+  std::string* _s = _internal_mutable_continuation();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.PrefixScan.continuation)
   return _s;
 }
-inline const std::string& JsonValue::_internal_content() const {
-  return _impl_.content_.Get();
+inline const std::string& PrefixScan::_internal_continuation() const {
+  return _impl_.continuation_.Get();
 }
-inline void JsonValue::_internal_set_content(const std::string& value) {
+inline void PrefixScan::_internal_set_continuation(const std::string& value) {
   
-  _impl_.content_.Set(value, GetArenaForAllocation());
+  _impl_.continuation_.Set(value, GetArenaForAllocation());
 }
-inline std::string* JsonValue::_internal_mutable_content() {
+inline std::string* PrefixScan::_internal_mutable_continuation() {
   
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  return _impl_.continuation_.Mutable(GetArenaForAllocation());
 }
-inline std::string* JsonValue::release_content() {
-  // @@protoc_insertion_point(field_release:pf_gossip_cli.JsonValue.content)
-  return _impl_.content_.Release();
+inline std::string* PrefixScan::release_continuation() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.PrefixScan.continuation)
+  return _impl_.continuation_.Release();
 }
-inline void JsonValue::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
+inline void PrefixScan::set_allocated_continuation(std::string* continuation) {
+  if (continuation != nullptr) {
     
   } else {
     
   }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+  _impl_.continuation_.SetAllocated(continuation, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.continuation_.IsDefault()) {
+    _impl_.continuation_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.JsonValue.content)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.PrefixScan.continuation)
 }
 
 // -------------------------------------------------------------------
 
-// Url
+// RangeScan
 
-// string content = 1;
-inline void Url::clear_content() {
-  _impl_.content_.ClearToEmpty();
+// string start = 1;
+inline void RangeScan::clear_start() {
+  _impl_.start_.ClearToEmpty();
 }
-inline const std::string& Url::content() const {
-  // @@protoc_insertion_point(field_get:pf_gossip_cli.Url.content)
-  return _internal_content();
+inline const std::string& RangeScan::start() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.RangeScan.start)
+  return _internal_start();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Url::set_content(ArgT0&& arg0, ArgT... args) {
+void RangeScan::set_start(ArgT0&& arg0, ArgT... args) {
  
- _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip_cli.Url.content)
+ _impl_.start_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.RangeScan.start)
 }
-inline std::string* Url::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.Url.content)
+inline std::string* RangeScan::mutable_start() {
+  std::string* _s = _internal_mutable_start();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.RangeScan.start)
   return _s;
 }
-inline const std::string& Url::_internal_content() const {
-  return _impl_.content_.Get();
+inline const std::string& RangeScan::_internal_start() const {
+  return _impl_.start_.Get();
 }
-inline void Url::_internal_set_content(const std::string& value) {
+inline void RangeScan::_internal_set_start(const std::string& value) {
   
-  _impl_.content_.Set(value, GetArenaForAllocation());
+  _impl_.start_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Url::_internal_mutable_content() {
+inline std::string* RangeScan::_internal_mutable_start() {
   
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  return _impl_.start_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Url::release_content() {
-  // @@protoc_insertion_point(field_release:pf_gossip_cli.Url.content)
-  return _impl_.content_.Release();
+inline std::string* RangeScan::release_start() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.RangeScan.start)
+  return _impl_.start_.Release();
 }
-inline void Url::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
+inline void RangeScan::set_allocated_start(std::string* start) {
+  if (start != nullptr) {
     
   } else {
     
   }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+  _impl_.start_.SetAllocated(start, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.start_.IsDefault()) {
+    _impl_.start_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.Url.content)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.RangeScan.start)
 }
 
-// -------------------------------------------------------------------
-
-// Echo
-
-// bool succeed = 1;
-inline void Echo::clear_succeed() {
-  _impl_.succeed_ = false;
+// string end = 2;
+inline void RangeScan::clear_end() {
+  _impl_.end_.ClearToEmpty();
 }
-inline bool Echo::_internal_succeed() const {
-  return _impl_.succeed_;
+inline const std::string& RangeScan::end() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.RangeScan.end)
+  return _internal_end();
 }
-inline bool Echo::succeed() const {
-  // @@protoc_insertion_point(field_get:pf_gossip_cli.Echo.succeed)
-  return _internal_succeed();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RangeScan::set_end(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.end_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.RangeScan.end)
 }
-inline void Echo::_internal_set_succeed(bool value) {
+inline std::string* RangeScan::mutable_end() {
+  std::string* _s = _internal_mutable_end();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.RangeScan.end)
+  return _s;
+}
+inline const std::string& RangeScan::_internal_end() const {
+  return _impl_.end_.Get();
+}
+inline void RangeScan::_internal_set_end(const std::string& value) {
   
-  _impl_.succeed_ = value;
+  _impl_.end_.Set(value, GetArenaForAllocation());
 }
-inline void Echo::set_succeed(bool value) {
-  _internal_set_succeed(value);
-  // @@protoc_insertion_point(field_set:pf_gossip_cli.Echo.succeed)
+inline std::string* RangeScan::_internal_mutable_end() {
+  
+  return _impl_.end_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RangeScan::release_end() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.RangeScan.end)
+  return _impl_.end_.Release();
+}
+inline void RangeScan::set_allocated_end(std::string* end) {
+  if (end != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.end_.SetAllocated(end, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_.IsDefault()) {
+    _impl_.end_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.RangeScan.end)
 }
 
-// string message = 2;
-inline void Echo::clear_message() {
-  _impl_.message_.ClearToEmpty();
+// string owner = 3;
+inline void RangeScan::clear_owner() {
+  _impl_.owner_.ClearToEmpty();
 }
-inline const std::string& Echo::message() const {
-  // @@protoc_insertion_point(field_get:pf_gossip_cli.Echo.message)
-  return _internal_message();
+inline const std::string& RangeScan::owner() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.RangeScan.owner)
+  return _internal_owner();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Echo::set_message(ArgT0&& arg0, ArgT... args) {
+void RangeScan::set_owner(ArgT0&& arg0, ArgT... args) {
  
- _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip_cli.Echo.message)
+ _impl_.owner_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.RangeScan.owner)
 }
-inline std::string* Echo::mutable_message() {
-  std::string* _s = _internal_mutable_message();
-  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.Echo.message)
+inline std::string* RangeScan::mutable_owner() {
+  std::string* _s = _internal_mutable_owner();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.RangeScan.owner)
   return _s;
 }
-inline const std::string& Echo::_internal_message() const {
-  return _impl_.message_.Get();
+inline const std::string& RangeScan::_internal_owner() const {
+  return _impl_.owner_.Get();
 }
-inline void Echo::_internal_set_message(const std::string& value) {
+inline void RangeScan::_internal_set_owner(const std::string& value) {
   
-  _impl_.message_.Set(value, GetArenaForAllocation());
+  _impl_.owner_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Echo::_internal_mutable_message() {
+inline std::string* RangeScan::_internal_mutable_owner() {
   
-  return _impl_.message_.Mutable(GetArenaForAllocation());
+  return _impl_.owner_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Echo::release_message() {
-  // @@protoc_insertion_point(field_release:pf_gossip_cli.Echo.message)
-  return _impl_.message_.Release();
+inline std::string* RangeScan::release_owner() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.RangeScan.owner)
+  return _impl_.owner_.Release();
 }
-inline void Echo::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
+inline void RangeScan::set_allocated_owner(std::string* owner) {
+  if (owner != nullptr) {
     
   } else {
     
   }
-  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+  _impl_.owner_.SetAllocated(owner, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.message_.IsDefault()) {
-    _impl_.message_.Set("", GetArenaForAllocation());
+  if (_impl_.owner_.IsDefault()) {
+    _impl_.owner_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.Echo.message)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.RangeScan.owner)
 }
 
-// -------------------------------------------------------------------
-
-// SearchInfo
+// int32 limit = 4;
+inline void RangeScan::clear_limit() {
+  _impl_.limit_ = 0;
+}
+inline int32_t RangeScan::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t RangeScan::limit() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.RangeScan.limit)
+  return _internal_limit();
+}
+inline void RangeScan::_internal_set_limit(int32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void RangeScan::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.RangeScan.limit)
+}
 
-// string key = 1;
-inline void SearchInfo::clear_key() {
-  _impl_.key_.ClearToEmpty();
+// string continuation = 5;
+inline void RangeScan::clear_continuation() {
+  _impl_.continuation_.ClearToEmpty();
 }
-inline const std::string& SearchInfo::key() const {
-  // @@protoc_insertion_point(field_get:pf_gossip_cli.SearchInfo.key)
-  return _internal_key();
+inline const std::string& RangeScan::continuation() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.RangeScan.continuation)
+  return _internal_continuation();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SearchInfo::set_key(ArgT0&& arg0, ArgT... args) {
+void RangeScan::set_continuation(ArgT0&& arg0, ArgT... args) {
  
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:pf_gossip_cli.SearchInfo.key)
+ _impl_.continuation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.RangeScan.continuation)
 }
-inline std::string* SearchInfo::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.SearchInfo.key)
+inline std::string* RangeScan::mutable_continuation() {
+  std::string* _s = _internal_mutable_continuation();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.RangeScan.continuation)
   return _s;
 }
-inline const std::string& SearchInfo::_internal_key() const {
-  return _impl_.key_.Get();
+inline const std::string& RangeScan::_internal_continuation() const {
+  return _impl_.continuation_.Get();
 }
-inline void SearchInfo::_internal_set_key(const std::string& value) {
+inline void RangeScan::_internal_set_continuation(const std::string& value) {
   
-  _impl_.key_.Set(value, GetArenaForAllocation());
+  _impl_.continuation_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SearchInfo::_internal_mutable_key() {
+inline std::string* RangeScan::_internal_mutable_continuation() {
   
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+  return _impl_.continuation_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SearchInfo::release_key() {
-  // @@protoc_insertion_point(field_release:pf_gossip_cli.SearchInfo.key)
-  return _impl_.key_.Release();
+inline std::string* RangeScan::release_continuation() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.RangeScan.continuation)
+  return _impl_.continuation_.Release();
 }
-inline void SearchInfo::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
+inline void RangeScan::set_allocated_continuation(std::string* continuation) {
+  if (continuation != nullptr) {
     
   } else {
     
   }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+  _impl_.continuation_.SetAllocated(continuation, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  if (_impl_.continuation_.IsDefault()) {
+    _impl_.continuation_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.SearchInfo.key)
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.RangeScan.continuation)
 }
 
-// bool latest = 2;
-inline void SearchInfo::clear_latest() {
-  _impl_.latest_ = false;
+// -------------------------------------------------------------------
+
+// ScanResult
+
+// repeated .pf_gossip.SearchResult.Message message = 1;
+inline int ScanResult::_internal_message_size() const {
+  return _impl_.message_.size();
 }
-inline bool SearchInfo::_internal_latest() const {
-  return _impl_.latest_;
+inline int ScanResult::message_size() const {
+  return _internal_message_size();
 }
-inline bool SearchInfo::latest() const {
-  // @@protoc_insertion_point(field_get:pf_gossip_cli.SearchInfo.latest)
-  return _internal_latest();
+inline ::pf_gossip::SearchResult_Message* ScanResult::mutable_message(int index) {
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.ScanResult.message)
+  return _impl_.message_.Mutable(index);
 }
-inline void SearchInfo::_internal_set_latest(bool value) {
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SearchResult_Message >*
+ScanResult::mutable_message() {
+  // @@protoc_insertion_point(field_mutable_list:pf_gossip_cli.ScanResult.message)
+  return &_impl_.message_;
+}
+inline const ::pf_gossip::SearchResult_Message& ScanResult::_internal_message(int index) const {
+  return _impl_.message_.Get(index);
+}
+inline const ::pf_gossip::SearchResult_Message& ScanResult::message(int index) const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.ScanResult.message)
+  return _internal_message(index);
+}
+inline ::pf_gossip::SearchResult_Message* ScanResult::_internal_add_message() {
+  return _impl_.message_.Add();
+}
+inline ::pf_gossip::SearchResult_Message* ScanResult::add_message() {
+  ::pf_gossip::SearchResult_Message* _add = _internal_add_message();
+  // @@protoc_insertion_point(field_add:pf_gossip_cli.ScanResult.message)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pf_gossip::SearchResult_Message >&
+ScanResult::message() const {
+  // @@protoc_insertion_point(field_list:pf_gossip_cli.ScanResult.message)
+  return _impl_.message_;
+}
+
+// string continuation = 2;
+inline void ScanResult::clear_continuation() {
+  _impl_.continuation_.ClearToEmpty();
+}
+inline const std::string& ScanResult::continuation() const {
+  // @@protoc_insertion_point(field_get:pf_gossip_cli.ScanResult.continuation)
+  return _internal_continuation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanResult::set_continuation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.continuation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pf_gossip_cli.ScanResult.continuation)
+}
+inline std::string* ScanResult::mutable_continuation() {
+  std::string* _s = _internal_mutable_continuation();
+  // @@protoc_insertion_point(field_mutable:pf_gossip_cli.ScanResult.continuation)
+  return _s;
+}
+inline const std::string& ScanResult::_internal_continuation() const {
+  return _impl_.continuation_.Get();
+}
+inline void ScanResult::_internal_set_continuation(const std::string& value) {
   
-  _impl_.latest_ = value;
+  _impl_.continuation_.Set(value, GetArenaForAllocation());
 }
-inline void SearchInfo::set_latest(bool value) {
-  _internal_set_latest(value);
-  // @@protoc_insertion_point(field_set:pf_gossip_cli.SearchInfo.latest)
+inline std::string* ScanResult::_internal_mutable_continuation() {
+  
+  return _impl_.continuation_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanResult::release_continuation() {
+  // @@protoc_insertion_point(field_release:pf_gossip_cli.ScanResult.continuation)
+  return _impl_.continuation_.Release();
+}
+inline void ScanResult::set_allocated_continuation(std::string* continuation) {
+  if (continuation != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.continuation_.SetAllocated(continuation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.continuation_.IsDefault()) {
+    _impl_.continuation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pf_gossip_cli.ScanResult.continuation)
 }
 
 #ifdef __GNUC__
@@ -1187,6 +3599,22 @@ inline void SearchInfo::set_latest(bool value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -0,0 +1,69 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipClock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+
+namespace gossip::server {
+
+    namespace {
+
+        std::atomic<SlotVersion> latest{0};     // 本进程生成或收到的最大版本
+        std::atomic<int64_t> max_drift{0};      // 收到的版本最多超前物理时间的毫秒数，0 表示不限制
+
+        SlotVersion wallTime() {
+            return static_cast<SlotVersion>(GossipClock::millis()) << GossipClock::kLogicalBits;
+        }
+
+    }
+
+    SlotVersion GossipClock::now() {
+        auto wall = wallTime();
+        auto last = latest.load();
+        SlotVersion next;
+        // 物理时间没有前进时增加逻辑计数，计数溢出时进位到物理时间，之后物理时间会追上
+        do {
+            next = std::max(wall, last + 1);
+        } while (!latest.compare_exchange_weak(last, next));
+        return next;
+    }
+
+    bool GossipClock::update(SlotVersion received) {
+        bool accepted = true;
+        auto drift = max_drift.load();
+        if (drift > 0) {
+            // 超前太多的版本来自时钟错误的节点，时钟最多只推进到允许的偏差
+            auto wall = millis();
+            auto bound = static_cast<SlotVersion>(wall + drift) << kLogicalBits;
+            if (received > bound) {
+                std::cerr << "Received Version " << received << " Is " << physical(received) - wall
+                          << "ms Ahead Of Local Clock" << std::endl;
+                received = bound;
+                accepted = false;
+            }
+        }
+
+        auto last = latest.load();
+        while (received > last && !latest.compare_exchange_weak(last, received));
+        return accepted;
+    }
+
+    void GossipClock::setMaxDrift(int64_t max_drift_ms) {
+        max_drift = std::max<int64_t>(max_drift_ms, 0);
+    }
+
+    SlotVersion GossipClock::last() {
+        return latest.load();
+    }
+
+    int64_t GossipClock::millis() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+}
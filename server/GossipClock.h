@@ -0,0 +1,67 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPCLOCK_H
+#define GOSSIP_GOSSIPCLOCK_H
+
+#include <cstdint>
+
+namespace gossip::server {
+
+    using SlotVersion = long;
+
+    /// @brief Hybrid logical clock of this process, used for all slot and K-V pair versions.
+    /// @details A version packs the physical time in milliseconds in its high bits and a logical counter in its low
+    /// kLogicalBits bits, so versions still compare as plain integers. Every local event gets a version larger than
+    /// all versions generated or received before, even if wall clock steps backwards or many events happen in the
+    /// same millisecond. Received versions only move the clock forward, and never further than max drift ahead of
+    /// wall clock, so a node with a wrong clock can't push versions of this process far into the future. All
+    /// functions are thread safe.
+    class GossipClock {
+    public:
+
+        /// The number of bits of logical counter.
+        static constexpr int kLogicalBits = 16;
+
+        /// Get a version for a local event.
+        /// \return A version larger than all versions seen by this clock
+        static SlotVersion now();
+
+        /// Advance the clock with a received version, later local events are ordered after it. A version more than
+        /// max drift ahead of wall clock is logged and only advances the clock to max drift.
+        /// \param received Received version
+        /// \return If received version is not more than max drift ahead of wall clock
+        static bool update(SlotVersion received);
+
+        /// Set how far a received version may be ahead of wall clock.
+        /// \param max_drift_ms Max drift in milliseconds, 0 means unlimited
+        static void setMaxDrift(int64_t max_drift_ms);
+
+        /// Get the latest version seen by this clock without advancing it.
+        /// \return Latest version
+        static SlotVersion last();
+
+        /// Get the wall clock time, used to check expiration of K-V pairs.
+        /// \return Milliseconds since epoch
+        static int64_t millis();
+
+        /// Get the physical time of a version.
+        /// \param version Version of hybrid logical clock
+        /// \return Milliseconds since epoch
+        static int64_t physical(SlotVersion version) {
+            return version >> kLogicalBits;
+        }
+
+        /// Get the logical counter of a version.
+        /// \param version Version of hybrid logical clock
+        /// \return Logical counter
+        static int64_t logical(SlotVersion version) {
+            return version & ((SlotVersion(1) << kLogicalBits) - 1);
+        }
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPCLOCK_H
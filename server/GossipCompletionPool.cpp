@@ -0,0 +1,44 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipCompletionPool.h"
+#include "GossipPeerNode.h"
+
+#include <algorithm>
+
+namespace gossip::server {
+
+    GossipCompletionPool::GossipCompletionPool(size_t threads) {
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        for (size_t i = 0; i < threads; i++)
+            queues_.emplace_back(std::make_unique<grpc::CompletionQueue>());
+        for (auto &queue: queues_)
+            threads_.emplace_back(&GossipCompletionPool::poll, queue.get());
+    }
+
+    GossipCompletionPool::~GossipCompletionPool() {
+        for (auto &queue: queues_)
+            queue->Shutdown();
+        for (auto &th: threads_)
+            th.join();
+    }
+
+    grpc::CompletionQueue *GossipCompletionPool::assign() {
+        return queues_[next_++ % queues_.size()].get();
+    }
+
+    void GossipCompletionPool::poll(grpc::CompletionQueue *queue) {
+        void *got_tag;
+        bool ok = false;
+
+        // Block until the next result is available in the completion queue.
+        while (queue->Next(&got_tag, &ok)) {
+            auto call = static_cast<GossipPeerNode::AsyncCall *>(got_tag);
+            call->owner_->receiveResult(call);
+        }
+    }
+
+}
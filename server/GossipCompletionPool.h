@@ -0,0 +1,61 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPCOMPLETIONPOOL_H
+#define GOSSIP_GOSSIPCOMPLETIONPOOL_H
+
+#include <grpcpp/grpcpp.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace gossip::server {
+
+    /// @brief Completion queues and polling threads shared by all GossipPeerNode of a GossipNode.
+    /// @details Every queue is polled by one thread, and peers are assigned to queues in turn when they are
+    /// created, so the number of threads doesn't grow with cluster membership. Every tag of these queues must
+    /// be a GossipPeerNode::AsyncCall, and its result is handed to the peer that owns it.
+    class GossipCompletionPool {
+    public:
+
+        /// Constructor of GossipCompletionPool.
+        /// \param threads Number of queues and polling threads. If 0, use the number of cores
+        explicit GossipCompletionPool(size_t threads);
+
+        /// Destructor of GossipCompletionPool. Shutdown all queues and wait for pending results to be handled.
+        ~GossipCompletionPool();
+
+        GossipCompletionPool(const GossipCompletionPool &) = delete;
+
+        GossipCompletionPool &operator=(const GossipCompletionPool &) = delete;
+
+        /// Get a completion queue for a new peer, queues are assigned in turn.
+        /// \return Completion queue owned by this pool
+        grpc::CompletionQueue *assign();
+
+        /// Get the number of completion queues.
+        /// \return The number of completion queues
+        [[nodiscard]] size_t size() const {
+            return queues_.size();
+        }
+
+    private:
+
+        /// Poll a completion queue until it is shutdown.
+        /// \param queue The completion queue
+        static void poll(grpc::CompletionQueue *queue);
+
+    private:
+
+        std::vector<std::unique_ptr<grpc::CompletionQueue>> queues_;
+        std::vector<std::thread> threads_;
+        std::atomic<size_t> next_{0};   // 下一个分配的队列
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPCOMPLETIONPOOL_H
@@ -0,0 +1,105 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipEpoch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace gossip::server {
+
+    namespace {
+
+        /// Epoch record of a reader thread, 0 means the thread is not pinned.
+        struct Record {
+            std::atomic<uint64_t> epoch{0};
+            bool used = false;
+        };
+
+        /// Shared state of all readers and writers.
+        struct Domain {
+            std::atomic<uint64_t> epoch{1};
+            std::mutex mtx;     // 保护 records 和 retired
+            std::deque<Record> records;     // deque 保证记录的地址不会改变
+            std::vector<std::pair<uint64_t, std::shared_ptr<const void>>> retired;
+        };
+
+        Domain &domain() {
+            static auto *domain = new Domain;   // 不析构，其他静态对象析构时可能仍在使用
+            return *domain;
+        }
+
+        /// Record of current thread, released when thread exits.
+        struct LocalRecord {
+            LocalRecord() {
+                auto &d = domain();
+                std::lock_guard<std::mutex> lg(d.mtx);
+                auto it = std::find_if(d.records.begin(), d.records.end(), [](auto &r) { return !r.used; });
+                record = it != d.records.end() ? &*it : &d.records.emplace_back();
+                record->used = true;
+            }
+
+            ~LocalRecord() {
+                std::lock_guard<std::mutex> lg(domain().mtx);
+                record->epoch = 0;
+                record->used = false;
+            }
+
+            Record *record;
+            int depth = 0;  // 同一线程重入的次数
+        };
+
+        LocalRecord &localRecord() {
+            thread_local LocalRecord local;
+            return local;
+        }
+
+    }
+
+    GossipEpoch::Guard::Guard() {
+        auto &local = localRecord();
+        if (local.depth++ == 0)
+            local.record->epoch = domain().epoch.load();
+    }
+
+    GossipEpoch::Guard::~Guard() {
+        auto &local = localRecord();
+        if (--local.depth == 0)
+            local.record->epoch = 0;
+    }
+
+    void GossipEpoch::retire(std::shared_ptr<const void> object) {
+        auto &d = domain();
+        std::vector<std::shared_ptr<const void>> released;
+
+        {
+            std::lock_guard<std::mutex> lg(d.mtx);
+            // 新对象已经发布，之后进入的读者不会再读到旧对象
+            d.retired.emplace_back(d.epoch.fetch_add(1), std::move(object));
+
+            auto oldest = std::numeric_limits<uint64_t>::max();
+            for (auto &record: d.records) {
+                auto epoch = record.epoch.load();
+                if (epoch != 0)
+                    oldest = std::min(oldest, epoch);
+            }
+
+            // 读者进入时的 epoch 大于退休时的 epoch，说明它只可能读到新对象
+            auto it = std::partition(d.retired.begin(), d.retired.end(),
+                                     [oldest](auto &r) { return r.first >= oldest; });
+            for (auto i = it; i != d.retired.end(); ++i)
+                released.emplace_back(std::move(i->second));
+            d.retired.erase(it, d.retired.end());
+        }
+
+        // 在锁外析构，避免析构时间过长阻塞其他线程
+    }
+
+}
@@ -0,0 +1,47 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPEPOCH_H
+#define GOSSIP_GOSSIPEPOCH_H
+
+#include <memory>
+
+namespace gossip::server {
+
+    /// @brief Epoch based reclamation for read-mostly data published by pointer.
+    /// @details Readers pin the current epoch before loading a published pointer and unpin after use, which only
+    /// costs one store to a thread local record. Writers publish a new object first and then retire the old one
+    /// with the epoch it was replaced in. A retired object is destroyed after every reader that may have loaded
+    /// it has unpinned. Pins are reentrant in the same thread.
+    class GossipEpoch {
+    public:
+
+        /// @brief RAII pin of current epoch.
+        class Guard {
+        public:
+            Guard();
+
+            ~Guard();
+
+            Guard(const Guard &) = delete;
+
+            Guard &operator=(const Guard &) = delete;
+        };
+
+        /// Pin current epoch, published pointers loaded while the guard is alive stay valid.
+        /// \return Guard of current epoch
+        static Guard pin() {
+            return {};
+        }
+
+        /// Retire an object which is no longer published. The object is released after all readers that pinned
+        /// before this call have unpinned. Must be called after the new object is published.
+        /// \param object The retired object
+        static void retire(std::shared_ptr<const void> object);
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPEPOCH_H
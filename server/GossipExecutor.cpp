@@ -0,0 +1,60 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipExecutor.h"
+
+#include <algorithm>
+
+namespace gossip::server {
+
+    GossipExecutor::GossipExecutor(size_t threads, size_t queue_size) : queue_size_(std::max<size_t>(queue_size, 1)) {
+        threads = std::max<size_t>(threads, 1);
+        threads_.reserve(threads);
+        for (size_t i = 0; i < threads; i++)
+            threads_.emplace_back(&GossipExecutor::work, this);
+    }
+
+    GossipExecutor::~GossipExecutor() {
+        {
+            std::lock_guard<std::mutex> lg(mtx);
+            quit_ = true;
+        }
+        cv.notify_all();
+        for (auto &th: threads_)
+            th.join();
+    }
+
+    bool GossipExecutor::submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lg(mtx);
+            if (quit_ || tasks_.size() >= queue_size_)
+                return false;
+            tasks_.emplace_back(std::move(task));
+        }
+        cv.notify_one();
+        return true;
+    }
+
+    size_t GossipExecutor::pending() {
+        std::lock_guard<std::mutex> lg(mtx);
+        return tasks_.size();
+    }
+
+    void GossipExecutor::work() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> ul(mtx);
+                cv.wait(ul, [this] { return quit_ || !tasks_.empty(); });
+                // 退出前需要执行完已经接受的任务，否则对应的 rpc 永远不会结束
+                if (tasks_.empty())
+                    return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+}
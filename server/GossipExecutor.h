@@ -0,0 +1,63 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPEXECUTOR_H
+#define GOSSIP_GOSSIPEXECUTOR_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gossip::server {
+
+    /// @brief Fixed size thread pool with a bounded task queue.
+    /// @details Class GossipExecutor never grows its threads or queue, so a burst of requests can't exhaust the
+    /// host. Tasks that can't be queued are rejected immediately and the caller decides how to fail them. Queued
+    /// tasks are still run when the executor is destroyed.
+    class GossipExecutor {
+    public:
+
+        /// Constructor of GossipExecutor.
+        /// \param threads Number of worker threads, at least 1
+        /// \param queue_size Max number of queued tasks
+        GossipExecutor(size_t threads, size_t queue_size);
+
+        /// Destructor of GossipExecutor. Run all queued tasks and join worker threads.
+        ~GossipExecutor();
+
+        GossipExecutor(const GossipExecutor &) = delete;
+
+        GossipExecutor &operator=(const GossipExecutor &) = delete;
+
+        /// Submit a task to executor.
+        /// \param task The task to run
+        /// \return If task is queued. Returns false if queue is full or executor is stopping
+        bool submit(std::function<void()> task);
+
+        /// Get the number of queued tasks.
+        /// \return The number of queued tasks
+        size_t pending();
+
+    private:
+
+        /// Loop of worker threads.
+        void work();
+
+    private:
+
+        std::mutex mtx;
+        std::condition_variable cv;
+        std::deque<std::function<void()>> tasks_;   // 等待执行的任务
+        size_t queue_size_;
+        bool quit_ = false;
+        std::vector<std::thread> threads_;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPEXECUTOR_H
@@ -0,0 +1,60 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipExpiryWheel.h"
+
+#include <algorithm>
+
+namespace gossip::server {
+
+    GossipExpiryWheel::GossipExpiryWheel(std::chrono::milliseconds tick)
+            : tick_ms_(std::max<int64_t>(tick.count(), 1)),
+              enabled_(tick.count() > 0),
+              wheel_(static_cast<uint64_t>(GossipClock::millis() / tick_ms_)) {}
+
+    void GossipExpiryWheel::add(GossipSlot *slot, std::string key, SlotVersion version, int64_t expires) {
+        // 没有定时器推进时间轮，加入的键值对永远不会被取出
+        if (!enabled_)
+            return;
+
+        // 向上取整，取出时过期时间一定已经过去
+        auto tick = static_cast<uint64_t>((std::max<int64_t>(expires, 0) + tick_ms_ - 1) / tick_ms_);
+
+        std::lock_guard<std::mutex> lg(mtx);
+        auto &pending = pending_[slot];
+        auto found = pending.find(key);
+        if (found == pending.end()) {
+            auto it = wheel_.add(tick, {slot, key, version});
+            pending.emplace(std::move(key), it);
+            return;
+        }
+
+        // 晚到的旧版本不覆盖新版本的过期时间
+        auto it = found->second;
+        if (version < it->value.version)
+            return;
+        it->value.version = version;
+        wheel_.reschedule(it, tick);
+    }
+
+    std::vector<GossipExpiryWheel::Entry> GossipExpiryWheel::advance(int64_t now) {
+        auto target = static_cast<uint64_t>(std::max<int64_t>(now, 0) / tick_ms_);
+
+        std::lock_guard<std::mutex> lg(mtx);
+        wheel_.advance(target);
+
+        std::vector<Entry> expired;
+        for (auto &node: wheel_.takeReady()) {
+            pending_[node.value.slot].erase(node.value.key);
+            expired.emplace_back(std::move(node.value));
+        }
+        return expired;
+    }
+
+    size_t GossipExpiryWheel::size() {
+        std::lock_guard<std::mutex> lg(mtx);
+        return wheel_.size();
+    }
+
+}
@@ -0,0 +1,81 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPEXPIRYWHEEL_H
+#define GOSSIP_GOSSIPEXPIRYWHEEL_H
+
+#include "GossipSlot.h"
+#include "GossipTimerWheel.h"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gossip::server {
+
+    /// @brief Hierarchical timer wheel of K-V pairs written with a TTL.
+    /// @details Class GossipExpiryWheel finds expired K-V pairs without scanning any slot. Entries are kept in a
+    /// GossipTimerWheel by the tick of their expiration, so adding an entry is O(1). Ticks are counted on wall
+    /// clock, since expiration is a wall clock time shared by all replicas. The wheel keeps at most one entry for
+    /// each key of a slot, a newer version of the key replaces it in place. Entries are not removed when a K-V pair
+    /// is written again without a TTL or deleted, the slot checks the version of every taken entry instead. All
+    /// functions are thread safe.
+    class GossipExpiryWheel {
+    public:
+
+        /// A K-V pair that expires at a tick.
+        struct Entry {
+            /// Slot of K-V pair, slots are never destroyed while the node runs
+            GossipSlot *slot;
+            /// The key of K-V pair
+            std::string key;
+            /// The version of K-V pair when it was added
+            SlotVersion version;
+        };
+
+        /// Constructor of GossipExpiryWheel.
+        /// \param tick Resolution of wheel, expirations are rounded up to it. If 0, wheel is disabled and ignores
+        /// all added K-V pairs
+        explicit GossipExpiryWheel(std::chrono::milliseconds tick);
+
+        GossipExpiryWheel(const GossipExpiryWheel &) = delete;
+
+        GossipExpiryWheel &operator=(const GossipExpiryWheel &) = delete;
+
+        /// Add a K-V pair to expire. If the key is already in wheel, the entry is moved to the new expiration when
+        /// version is not older, otherwise the K-V pair is ignored.
+        /// \param slot Slot of K-V pair
+        /// \param key The key of K-V pair
+        /// \param version The version of K-V pair
+        /// \param expires Expiration time in milliseconds
+        void add(GossipSlot *slot, std::string key, SlotVersion version, int64_t expires);
+
+        /// Advance wheel to a time and take all entries that have expired.
+        /// \param now Wall clock time in milliseconds
+        /// \return Expired entries
+        std::vector<Entry> advance(int64_t now);
+
+        /// Get the number of keys in wheel.
+        /// \return The number of keys
+        size_t size();
+
+    private:
+
+        int64_t tick_ms_;
+        bool enabled_;
+
+        std::mutex mtx;
+
+        GossipTimerWheel<Entry> wheel_;
+        // 每个 slot 中键对应的时间轮条目，重复写入同一个键时原地更新
+        std::unordered_map<GossipSlot *, std::unordered_map<std::string, GossipTimerWheel<Entry>::Handle>> pending_;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPEXPIRYWHEEL_H
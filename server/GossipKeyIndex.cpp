@@ -0,0 +1,102 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipKeyIndex.h"
+
+#include <algorithm>
+
+namespace gossip::server {
+
+    void GossipKeyIndex::add(GossipSlot *slot, const std::vector<uint64_t> &hashes) {
+        forEachLocked(hashes, [slot](Shard &shard, uint64_t hash) {
+            auto &owners = shard.owners[hash];
+            auto it = std::find_if(owners.begin(), owners.end(), [slot](auto &owner) { return owner.slot == slot; });
+            if (it != owners.end()) {
+                it->count++;
+                return;
+            }
+            owners.push_back({slot, 1});
+            shard.size++;
+        });
+    }
+
+    void GossipKeyIndex::remove(GossipSlot *slot, const std::vector<uint64_t> &hashes) {
+        forEachLocked(hashes, [slot](Shard &shard, uint64_t hash) {
+            auto entry = shard.owners.find(hash);
+            if (entry == shard.owners.end())
+                return;
+            auto &owners = entry->second;
+            auto it = std::find_if(owners.begin(), owners.end(), [slot](auto &owner) { return owner.slot == slot; });
+            if (it == owners.end() || --it->count > 0)
+                return;
+
+            owners.erase(it);
+            shard.size--;
+            if (owners.empty())
+                shard.owners.erase(entry);
+        });
+    }
+
+    void GossipKeyIndex::addCold(GossipSlot *slot) {
+        std::lock_guard<std::mutex> lg(cold_mtx_);
+        if (std::find(cold_.begin(), cold_.end(), slot) == cold_.end())
+            cold_.push_back(slot);
+    }
+
+    void GossipKeyIndex::removeCold(GossipSlot *slot) {
+        std::lock_guard<std::mutex> lg(cold_mtx_);
+        cold_.erase(std::remove(cold_.begin(), cold_.end(), slot), cold_.end());
+    }
+
+    std::vector<GossipSlot *> GossipKeyIndex::find(const std::string &key) const {
+        std::vector<GossipSlot *> slots;
+        {
+            std::lock_guard<std::mutex> lg(cold_mtx_);
+            slots = cold_;
+        }
+
+        auto hash = GossipKeyIndex::hash(key);
+        auto &shard = shardOf(hash);
+        std::lock_guard<std::mutex> lg(shard.mtx);
+        auto it = shard.owners.find(hash);
+        if (it != shard.owners.end()) {
+            for (auto &owner: it->second) {
+                // 冷 slot 加载时先加入索引再移出冷 slot 列表，可能同时出现在两边
+                if (std::find(slots.begin(), slots.end(), owner.slot) == slots.end())
+                    slots.push_back(owner.slot);
+            }
+        }
+        return slots;
+    }
+
+    size_t GossipKeyIndex::size() const {
+        size_t size = 0;
+        for (auto &shard: shards_) {
+            std::lock_guard<std::mutex> lg(shard.mtx);
+            size += shard.size;
+        }
+        return size;
+    }
+
+    void GossipKeyIndex::forEachLocked(const std::vector<uint64_t> &hashes,
+                                       const std::function<void(Shard &, uint64_t)> &func) {
+        if (hashes.size() == 1) {
+            auto &shard = shardOf(hashes.front());
+            std::lock_guard<std::mutex> lg(shard.mtx);
+            func(shard, hashes.front());
+            return;
+        }
+
+        // 按分片排序，全量更新这样的大批量修改每个分片只加锁一次
+        auto sorted = hashes;
+        std::sort(sorted.begin(), sorted.end());
+        for (auto it = sorted.begin(); it != sorted.end();) {
+            auto &shard = shardOf(*it);
+            std::lock_guard<std::mutex> lg(shard.mtx);
+            for (; it != sorted.end() && &shardOf(*it) == &shard; ++it)
+                func(shard, *it);
+        }
+    }
+
+}
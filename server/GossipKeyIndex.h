@@ -0,0 +1,104 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPKEYINDEX_H
+#define GOSSIP_GOSSIPKEYINDEX_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gossip::server {
+
+    class GossipSlot;
+
+    /// @brief Node wide inverted index from key to the slots that own it.
+    /// @details Class GossipKeyIndex lets a search visit only the slots that hold a key, instead of every slot of
+    /// the cluster. Keys are indexed by their 64 bit hash and every owner keeps a count, so two keys of a slot with
+    /// the same hash are still removed correctly, and a collision only costs one extra lookup. A slot reports the
+    /// keys it adds and erases when it publishes a snapshot, tombstones stay indexed until they are collected, so
+    /// the owners of a key are candidates that are checked by reading the slots. Cold slots are not indexed until
+    /// they are loaded, a search always checks them.
+    class GossipKeyIndex {
+    public:
+
+        /// The number of shards of index.
+        static constexpr int kShards = 64;
+
+        /// Get the hash of a key used by index.
+        /// \param key The key
+        /// \return Hash of key
+        static uint64_t hash(const std::string &key) {
+            return std::hash<std::string>{}(key);
+        }
+
+        /// Add keys to a slot.
+        /// \param slot Owner slot
+        /// \param hashes Hashes of keys
+        void add(GossipSlot *slot, const std::vector<uint64_t> &hashes);
+
+        /// Remove keys from a slot.
+        /// \param slot Owner slot
+        /// \param hashes Hashes of keys
+        void remove(GossipSlot *slot, const std::vector<uint64_t> &hashes);
+
+        /// Mark a slot as cold, its keys are not indexed.
+        /// \param slot Cold slot
+        void addCold(GossipSlot *slot);
+
+        /// Unmark a cold slot after its keys are indexed.
+        /// \param slot Loaded slot
+        void removeCold(GossipSlot *slot);
+
+        /// Find the slots that may own a key.
+        /// \param key The key
+        /// \return Owner slots and all cold slots
+        [[nodiscard]] std::vector<GossipSlot *> find(const std::string &key) const;
+
+        /// Get the number of indexed keys, a key owned by many slots is counted once for each slot.
+        /// \return The number of indexed keys
+        [[nodiscard]] size_t size() const;
+
+    private:
+
+        /// A slot owning a hash, count is the number of its keys with the hash.
+        struct Owner {
+            GossipSlot *slot;
+            uint32_t count;
+        };
+
+        /// Keys whose hashes are in the same shard.
+        struct Shard {
+            mutable std::mutex mtx;
+            std::unordered_map<uint64_t, std::vector<Owner>> owners;  // 大多数键只属于一个 slot
+            size_t size = 0;
+        };
+
+        /// Get the shard of a hash. The map inside a shard uses the low bits, shards use the high bits.
+        /// \param hash Hash of key
+        /// \return The shard of hash
+        Shard &shardOf(uint64_t hash) const {
+            return shards_[hash >> 58];
+        }
+
+        /// Call func(shard, hash) for all hashes, locking every shard once.
+        /// \param hashes Hashes of keys
+        /// \param func Function to call
+        void forEachLocked(const std::vector<uint64_t> &hashes, const std::function<void(Shard &, uint64_t)> &func);
+
+    private:
+
+        mutable std::array<Shard, kShards> shards_;
+        mutable std::mutex cold_mtx_;
+        std::vector<GossipSlot *> cold_;    // 还没有加载的冷 slot，它们的键不在索引中
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPKEYINDEX_H
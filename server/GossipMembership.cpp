@@ -0,0 +1,219 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipMembership.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace gossip::server {
+
+    GossipMembership::GossipMembership(std::string self, std::string address, int retransmit_mult)
+            : self_(std::move(self)), address_(std::move(address)), retransmit_mult_(retransmit_mult),
+              incarnation_(std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::system_clock::now().time_since_epoch()).count()),
+              random_(std::random_device{}()) {}
+
+    int64_t GossipMembership::incarnation() {
+        std::lock_guard<std::mutex> lg(mtx);
+        return incarnation_;
+    }
+
+    void GossipMembership::join(const std::string &name, const std::string &address) {
+        if (name.empty() || name == self_)
+            return;
+
+        std::lock_guard<std::mutex> lg(mtx);
+        auto it = members_.find(name);
+        if (it == members_.end()) {
+            // 还不知道对方的 incarnation，对方自己的更新会覆盖它
+            merge({name, address, pf_gossip::ALIVE, 0});
+            return;
+        }
+
+        if (it->second.address.empty())
+            it->second.address = address;
+        // 重新直接连接上的死亡节点以更高的 incarnation 复活
+        if (it->second.state == pf_gossip::DEAD)
+            merge({name, it->second.address, pf_gossip::ALIVE, it->second.incarnation + 1});
+    }
+
+    std::vector<GossipMembership::Member>
+    GossipMembership::apply(const google::protobuf::RepeatedPtrField<pf_gossip::MemberUpdate> &updates) {
+        std::vector<Member> changes;
+
+        std::lock_guard<std::mutex> lg(mtx);
+        for (auto &update: updates) {
+            if (update.name().empty())
+                continue;
+            Member member{update.name(), update.address(), update.state(), update.incarnation()};
+            if (merge(member))
+                changes.emplace_back(members_.at(member.name));
+        }
+        return changes;
+    }
+
+    std::optional<GossipMembership::Member> GossipMembership::suspect(const std::string &name) {
+        std::lock_guard<std::mutex> lg(mtx);
+        auto it = members_.find(name);
+        if (it == members_.end() || it->second.state != pf_gossip::ALIVE)
+            return {};
+
+        auto member = it->second;
+        member.state = pf_gossip::SUSPECT;
+        merge(member);
+        return member;
+    }
+
+    std::optional<GossipMembership::Member> GossipMembership::confirm(const std::string &name, int64_t incarnation) {
+        std::lock_guard<std::mutex> lg(mtx);
+        auto it = members_.find(name);
+        // 期间节点已经反驳，或者已经被其他节点确认
+        if (it == members_.end() || it->second.state != pf_gossip::SUSPECT || it->second.incarnation != incarnation)
+            return {};
+
+        auto member = it->second;
+        member.state = pf_gossip::DEAD;
+        merge(member);
+        return member;
+    }
+
+    std::optional<GossipMembership::Member> GossipMembership::leave(const std::string &name) {
+        std::lock_guard<std::mutex> lg(mtx);
+        auto it = members_.find(name);
+        if (it == members_.end() || it->second.state == pf_gossip::DEAD)
+            return {};
+
+        auto member = it->second;
+        member.state = pf_gossip::DEAD;
+        merge(member);
+        return member;
+    }
+
+    GossipMembership::State GossipMembership::state(const std::string &name) {
+        std::lock_guard<std::mutex> lg(mtx);
+        auto it = members_.find(name);
+        return it == members_.end() ? pf_gossip::DEAD : it->second.state;
+    }
+
+    std::vector<std::string> GossipMembership::members() {
+        std::lock_guard<std::mutex> lg(mtx);
+        std::vector<std::string> names;
+        names.reserve(members_.size());
+        for (auto &[name, member]: members_)
+            names.emplace_back(name);
+        return names;
+    }
+
+    std::string GossipMembership::nextProbeTarget() {
+        std::lock_guard<std::mutex> lg(mtx);
+
+        for (int round = 0; round < 2; round++) {
+            while (probe_index_ < probe_order_.size()) {
+                auto &name = probe_order_[probe_index_++];
+                auto it = members_.find(name);
+                if (it != members_.end() && it->second.state != pf_gossip::DEAD)
+                    return name;
+            }
+
+            // 一轮结束后重新打乱顺序，新加入的节点在下一轮被探测
+            probe_order_.clear();
+            probe_index_ = 0;
+            for (auto &[name, member]: members_) {
+                if (member.state != pf_gossip::DEAD)
+                    probe_order_.emplace_back(name);
+            }
+            std::shuffle(probe_order_.begin(), probe_order_.end(), random_);
+        }
+        return {};
+    }
+
+    void GossipMembership::collect(google::protobuf::RepeatedPtrField<pf_gossip::MemberUpdate> *updates,
+                                   const std::string &receiver, size_t max) {
+        std::lock_guard<std::mutex> lg(mtx);
+
+        auto self = updates->Add();
+        self->set_name(self_);
+        self->set_address(address_);
+        self->set_state(pf_gossip::ALIVE);
+        self->set_incarnation(incarnation_);
+
+        if (broadcasts_.empty() || max == 0)
+            return;
+
+        // 接收方自己的变化优先，使它能够尽快反驳对自己的怀疑
+        std::vector<std::pair<std::string, Broadcast *>> selected;
+        selected.reserve(broadcasts_.size());
+        for (auto &[name, broadcast]: broadcasts_)
+            selected.emplace_back(name, &broadcast);
+        auto rank = [&receiver](const std::pair<std::string, Broadcast *> &item) {
+            return std::make_pair(item.first != receiver, item.second->transmits);
+        };
+        auto count = std::min(max, selected.size());
+        std::partial_sort(selected.begin(), selected.begin() + static_cast<long>(count), selected.end(),
+                          [&rank](auto &a, auto &b) { return rank(a) < rank(b); });
+
+        // 每个变化被捎带 retransmit_mult * log2(节点数量) 次
+        int nodes = static_cast<int>(members_.size()) + 1;
+        int limit = retransmit_mult_ * (32 - __builtin_clz(static_cast<unsigned>(nodes)));
+
+        for (size_t i = 0; i < count; i++) {
+            auto &[name, broadcast] = selected[i];
+            auto &member = broadcast->member;
+            auto update = updates->Add();
+            update->set_name(member.name);
+            update->set_address(member.address);
+            update->set_state(member.state);
+            update->set_incarnation(member.incarnation);
+            if (++broadcast->transmits >= limit)
+                broadcasts_.erase(name);
+        }
+    }
+
+    bool GossipMembership::overrides(const Member &known, const Member &update) {
+        // 死亡的节点只能以更高的 incarnation 重新加入
+        if (known.state == pf_gossip::DEAD)
+            return update.state == pf_gossip::ALIVE && update.incarnation > known.incarnation;
+        if (update.state == pf_gossip::DEAD)
+            return true;
+        if (update.state == pf_gossip::SUSPECT && known.state == pf_gossip::ALIVE)
+            return update.incarnation >= known.incarnation;
+        return update.incarnation > known.incarnation;
+    }
+
+    bool GossipMembership::merge(const Member &update) {
+        if (update.name == self_) {
+            refute(update);
+            return false;
+        }
+
+        auto it = members_.find(update.name);
+        if (it == members_.end()) {
+            it = members_.emplace(update.name, update).first;
+        } else if (overrides(it->second, update)) {
+            auto address = it->second.address;
+            it->second = update;
+            if (it->second.address.empty())
+                it->second.address = std::move(address);
+        } else {
+            return false;
+        }
+
+        broadcast(it->second);
+        return true;
+    }
+
+    void GossipMembership::refute(const Member &update) {
+        if (update.state == pf_gossip::ALIVE || update.incarnation < incarnation_)
+            return;
+
+        // 本节点的 alive 更新总是被捎带，增加 incarnation 即可反驳
+        incarnation_ = update.incarnation + 1;
+    }
+
+    void GossipMembership::broadcast(const Member &member) {
+        broadcasts_[member.name] = {member, 0};
+    }
+
+}
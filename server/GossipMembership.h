@@ -0,0 +1,144 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPMEMBERSHIP_H
+#define GOSSIP_GOSSIPMEMBERSHIP_H
+
+#include "Gossip.pb.h"
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gossip::server {
+
+    /// @brief Membership list of SWIM failure detection.
+    /// @details Class GossipMembership keeps the state and incarnation of every known node. A node that fails a
+    /// probe is suspected, and is declared dead if it doesn't refute in time. Only a node itself increases its
+    /// incarnation, so an alive update with a higher incarnation refutes a suspicion, a suspicion overrides an
+    /// alive update of the same incarnation, and dead overrides both. Dead nodes are kept to reject stale updates,
+    /// a node that restarts rejoins with a higher incarnation. Every change is piggybacked on the next messages
+    /// a limited number of times, with the least sent changes first. All functions are thread safe.
+    class GossipMembership {
+    public:
+
+        using State = pf_gossip::MemberState;
+
+        /// A node and its state known by this node.
+        struct Member {
+            std::string name;
+            std::string address;
+            State state = pf_gossip::ALIVE;
+            int64_t incarnation = 0;
+        };
+
+        /// Constructor of GossipMembership.
+        /// \param self Name of this node
+        /// \param address Internal address of this node
+        /// \param retransmit_mult A change is piggybacked retransmit_mult * log2(nodes) times
+        GossipMembership(std::string self, std::string address, int retransmit_mult = 3);
+
+        /// Get the incarnation of this node. It starts from the time of construction, so a node that restarts has
+        /// a higher incarnation than before.
+        /// \return Incarnation of this node
+        int64_t incarnation();
+
+        /// Add a node connected directly as alive. A dead node is revived with a higher incarnation.
+        /// \param name Name of node
+        /// \param address Internal address of node
+        void join(const std::string &name, const std::string &address);
+
+        /// Merge membership updates received from another node.
+        /// \param updates Updates piggybacked on a message
+        /// \return Members whose state is changed
+        std::vector<Member> apply(const google::protobuf::RepeatedPtrField<pf_gossip::MemberUpdate> &updates);
+
+        /// Suspect a node that fails direct and indirect probes.
+        /// \param name Name of node
+        /// \return The member if it turns from alive to suspect
+        std::optional<Member> suspect(const std::string &name);
+
+        /// Declare a suspected node dead if it hasn't refuted since.
+        /// \param name Name of node
+        /// \param incarnation Incarnation of node when it was suspected
+        /// \return The member if it turns from suspect to dead
+        std::optional<Member> confirm(const std::string &name, int64_t incarnation);
+
+        /// Declare a node dead when it leaves voluntarily.
+        /// \param name Name of node
+        /// \return The member if it turns dead
+        std::optional<Member> leave(const std::string &name);
+
+        /// Get the state of a node.
+        /// \param name Name of node
+        /// \return State of node, or dead if node is unknown
+        State state(const std::string &name);
+
+        /// Get the names of all known nodes, dead nodes included.
+        /// \return Names of nodes other than this node
+        std::vector<std::string> members();
+
+        /// Get the next node to probe. Nodes not dead are probed in turn, and the order is shuffled every round, so
+        /// every node is probed once in a round.
+        /// \return Name of node, or empty if no node is alive
+        std::string nextProbeTarget();
+
+        /// Collect membership updates to piggyback on a message. The alive update of this node is always
+        /// included, then updates of the receiver, then updates sent the least times.
+        /// \param updates Stores updates
+        /// \param receiver Name of receiver
+        /// \param max Max number of updates besides this node's own
+        void collect(google::protobuf::RepeatedPtrField<pf_gossip::MemberUpdate> *updates,
+                     const std::string &receiver, size_t max);
+
+    private:
+
+        /// Check if an update overrides the known state of a node.
+        /// \param known Known state of node
+        /// \param update Received state of node
+        /// \return If update overrides known state
+        static bool overrides(const Member &known, const Member &update);
+
+        /// Merge a change and queue it to be piggybacked. Caller must hold mtx.
+        /// \param update New state of a node
+        /// \return If known state is changed
+        bool merge(const Member &update);
+
+        /// Handle a suspicion or death of this node by increasing incarnation. Caller must hold mtx.
+        /// \param update Received state of this node
+        void refute(const Member &update);
+
+        /// Queue a change to be piggybacked, it replaces an older change of the same node. Caller must hold mtx.
+        /// \param member Changed member
+        void broadcast(const Member &member);
+
+    private:
+
+        /// A change waiting to be piggybacked.
+        struct Broadcast {
+            Member member;
+            int transmits = 0;  // 已经被捎带的次数
+        };
+
+        std::string self_, address_;
+        int retransmit_mult_;
+
+        std::mutex mtx;
+        int64_t incarnation_;
+        std::unordered_map<std::string, Member> members_;  // 不包括本节点，死亡的节点也会保留
+        std::unordered_map<std::string, Broadcast> broadcasts_;    // 每个节点只保留最新的变化
+
+        std::vector<std::string> probe_order_;  // 本轮的探测顺序
+        size_t probe_index_ = 0;
+        std::default_random_engine random_;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPMEMBERSHIP_H
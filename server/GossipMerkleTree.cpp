@@ -0,0 +1,35 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipMerkleTree.h"
+
+#include <functional>
+
+namespace gossip::server {
+
+    namespace {
+
+        /// Mix bits of a 64-bit value, std::hash of integer is identity in most implementations.
+        uint64_t mix(uint64_t x) {
+            x += 0x9e3779b97f4a7c15ULL;
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+            return x ^ (x >> 31);
+        }
+
+    }
+
+    void GossipMerkleTree::toggle(const std::string &key, long version) {
+        auto hash = mix(std::hash<std::string>{}(key) ^ mix(static_cast<uint64_t>(version)));
+
+        // 从叶子节点一直更新到根节点
+        for (int index = kLeaves + leafOf(key); index >= kRoot; index >>= 1)
+            nodes_[index] ^= hash;
+    }
+
+    int GossipMerkleTree::leafOf(const std::string &key) {
+        return static_cast<int>(mix(std::hash<std::string>{}(key)) >> (64 - kDepth));
+    }
+
+}
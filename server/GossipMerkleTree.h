@@ -0,0 +1,82 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPMERKLETREE_H
+#define GOSSIP_GOSSIPMERKLETREE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace gossip::server {
+
+    /// @brief Incrementally updated merkle tree over the K-V pairs of a slot.
+    /// @details Class GossipMerkleTree is a complete binary tree with a fixed number of leaves. Every K-V pair is
+    /// hashed into a leaf by its key, and the hash of a node is the xor of hashes of all K-V pairs under it, so
+    /// adding or removing a K-V pair only updates the nodes on the path from its leaf to root. Nodes are numbered
+    /// from 1 (root), and children of node i are 2i and 2i + 1. Two slots with the same K-V pairs and versions
+    /// have the same tree, so peers can find differing key ranges by comparing the tree level by level.
+    class GossipMerkleTree {
+    public:
+
+        /// The depth of merkle tree, all peers must use the same depth.
+        static constexpr int kDepth = 10;
+
+        /// The number of leaves of merkle tree.
+        static constexpr int kLeaves = 1 << kDepth;
+
+        /// Index of root node.
+        static constexpr int kRoot = 1;
+
+        /// Constructor of GossipMerkleTree. All nodes of an empty tree have hash 0.
+        GossipMerkleTree() : nodes_(2 * kLeaves, 0) {}
+
+        /// Add or remove a K-V pair. Xor is its own inverse, so toggling the same K-V pair twice removes it.
+        /// \param key The key of K-V pair
+        /// \param version The version of K-V pair
+        void toggle(const std::string &key, long version);
+
+        /// Get the hash of a tree node.
+        /// \param index The index of tree node
+        /// \return The hash of node or 0 if index is invalid
+        [[nodiscard]] uint64_t hash(int index) const {
+            if (index < kRoot || index >= 2 * kLeaves)
+                return 0;
+            return nodes_[index];
+        }
+
+        /// Reset the tree to an empty tree.
+        void clear() {
+            std::fill(nodes_.begin(), nodes_.end(), 0);
+        }
+
+        /// Get the leaf index of a key, which is in range [0, kLeaves).
+        /// \param key The key of K-V pair
+        /// \return The leaf index of key
+        static int leafOf(const std::string &key);
+
+        /// Check if a tree node is leaf node.
+        /// \param index The index of tree node
+        /// \return Is leaf node
+        static bool isLeaf(int index) {
+            return index >= kLeaves;
+        }
+
+        /// Get the leaf index of a leaf node.
+        /// \param index The index of leaf node
+        /// \return The leaf index, which is in range [0, kLeaves)
+        static int leafIndex(int index) {
+            return index - kLeaves;
+        }
+
+    private:
+
+        std::vector<uint64_t> nodes_;   // 树节点的哈希值，下标 0 不使用
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPMERKLETREE_H
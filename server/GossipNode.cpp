@@ -5,31 +5,96 @@
 #include "GossipNode.h"
 #include "GossipPeerNode.h"
 #include "GossipSlot.h"
+#include "GossipSlotCodec.h"
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
 
 namespace gossip::server {
 
-    GossipNode::GossipNode(std::string name, std::string ex_addr, std::string in_addr, std::string token)
+    GossipNode::GossipNode(std::string name, std::string ex_addr, std::string in_addr, std::string token,
+                           GossipOptions options)
             : name_(std::move(name)), external_address_(std::move(ex_addr)), internal_address_(std::move(in_addr)),
-              token_(std::move(token)) {
+              token_(std::move(token)), options_(options), membership_(name_, internal_address_),
+              rumors_(std::chrono::milliseconds(options.rumor_window_ms), options.rumor_max_writes),
+              expiry_(std::chrono::milliseconds(options.expiry_tick_ms)) {
 
         if (name_.empty()) {
             throw std::runtime_error("Empty Node Name");
         }
 
+        GossipClock::setMaxDrift(static_cast<int64_t>(options_.max_clock_drift_ms));
+
         std::cout << "Gossip Node Name: \"" << name_ << "\"" << std::endl
                   << "Gossip External Address: \"" << external_address_ << "\"" << std::endl
                   << "Gossip Internal Address: \"" << internal_address_ << "\"" << std::endl
-                  << "Gossip Entry Token: \"" << token_ << "\"" << std::endl;
+                  << "Gossip Entry Token: \"" << token_ << "\"" << std::endl
+                  << "Gossip Service Mode: "
+                  << (options_.service_mode == GossipOptions::ServiceMode::Callback ? "callback" : "sync")
+                  << std::endl
+                  << "Gossip Client Service Mode: "
+                  << (options_.cli_service_mode == GossipOptions::ServiceMode::Callback ? "callback" : "sync")
+                  << std::endl;
+
+        local_slot_ = slots_.findOrCreate(name_).first;
+
+        // 在开放端口之前从快照与日志恢复本地 slot，对方节点不会看到空的本地 slot
+        if (!options_.data_dir.empty()) {
+            store_ = std::make_unique<GossipStore>(options_.data_dir, name_, options_.durability,
+                                                   std::chrono::milliseconds(options_.wal_sync_interval_ms));
+            auto records = store_->recover(local_slot_);
+            std::cout << "Gossip Local Slot Recovered: version " << local_slot_->version() << ", "
+                      << records << " log records replayed" << std::endl;
+            local_slot_->snapshot()->forEach([this](const std::string &key, const SlotEntry &entry) {
+                if (entry.expires != 0 && !entry.deleted)
+                    expiry_.add(local_slot_, key, entry.version, entry.expires);
+            });
+
+            // 其他 slot 直接从映射的镜像读取，之后只需要从对方节点获取版本更新的 slot 的增量
+            if (auto image = GossipSlotImage::open(options_.data_dir + "/" + name_ + ".slots")) {
+                for (size_t i = 0; i < image->slots(); i++) {
+                    std::string slot(image->name(i));
+                    if (slot == name_)
+                        continue;
+                    auto target = slots_.findOrCreate(slot).first;
+                    target->attach(image, i);
+                    image_versions_.emplace(slot, image->version(i));
+
+                    // 只读取定长的键值对表，带 TTL 的键值对加入时间轮，冷 slot 在第一次过期时加载
+                    for (size_t j = 0; j < image->size(i); j++) {
+                        auto entry = image->entry(i, j);
+                        if (entry && entry->expires != 0 && !entry->deleted)
+                            expiry_.add(target, std::string(entry->key), entry->version, entry->expires);
+                    }
+                }
+                std::cout << "Gossip Slot Image Mapped: " << image->slots() << " slots, " << image->bytes()
+                          << " bytes" << std::endl;
+            }
+        }
 
-        slots_.emplace(name_, GossipSlot(name_));
-        local_slot_ = &slots_.at(name_);
+        completion_pool_ = std::make_unique<GossipCompletionPool>(options_.completion_threads);
 
-        internal_service_ = new service::GossipService(this);
-        external_service_ = new service::GossipCliService(this);
+        if (options_.service_mode == GossipOptions::ServiceMode::Callback) {
+            internal_service_ = new service::GossipCallbackService(this, options_.handler_threads,
+                                                                   options_.handler_queue_size);
+        } else {
+            internal_service_ = new service::GossipService(this);
+        }
+        if (options_.cli_service_mode == GossipOptions::ServiceMode::Callback) {
+            external_service_ = new service::GossipCliCallbackService(this, options_.handler_threads,
+                                                                      options_.handler_queue_size);
+        } else {
+            external_service_ = new service::GossipCliService(this);
+        }
 
         if (!internal_address_.empty()) {
             grpc::ServerBuilder builder;
@@ -54,6 +119,8 @@ namespace gossip::server {
             th1_.join();
         if (th2_.joinable())
             th2_.join();
+        // 等待所有异步 rpc 的结果处理完成
+        completion_pool_.reset();
         delete internal_service_;
         delete external_service_;
     }
@@ -79,34 +146,61 @@ namespace gossip::server {
     }
 
     bool GossipNode::stop() {
-        quit = true;
+        scheduler_.stop();
         startDeleteNodeNotify();
         std::cout << "ready to shutdown" << std::endl;
         return true;
     }
 
-    SlotVersion GossipNode::insertOrUpdateMessage(const std::string &key, const std::string &value) {
+    template<class Write>
+    SlotVersion GossipNode::writeLocal(Write &&write) {
+        SlotVersion version;
+        uint64_t sequence = 0;
+        bool start, flush;
+        {
+            // 本地写入与记录 rumor 在同一个锁内完成，刷新时不会看到没有被记录的写入
+            // 日志记录也在锁内追加，日志中的版本按顺序递增
+            std::lock_guard<std::mutex> lg(rumor_mtx_);
+            bool empty = rumors_.empty();
+            version = write(rumors_);
+            start = empty && !rumors_.empty();
+            flush = rumors_.due();
+            if (store_)
+                sequence = store_->appended();
+        }
+
+        // 锁外等待 fsync，并发的写入共享同一次 fsync
+        if (store_ && version != -1)
+            store_->wait(sequence);
+
+        if (flush) {
+            flushRumors();
+        } else if (start) {
+            // 缓冲的第一次写入，在时间窗口结束时传播
+            scheduler_.schedule(std::chrono::milliseconds(options_.rumor_window_ms), [this] { doGossipTask(); });
+        }
+        return version;
+    }
+
+    SlotVersion GossipNode::insertOrUpdateMessage(const std::string &key, const std::string &value, int64_t ttl_ms) {
 
         if (key.empty())
             return -1;
 
         std::cout << "insert message " << key << " " << value << std::endl;
 
-        auto version = local_slot_->insertOrUpdate(key, value);
+        auto version = writeLocal([&](GossipRumorBuffer &rumors) {
+            SlotVersion base;
+            auto version = local_slot_->insertOrUpdate(key, value, &base, ttl_ms);
+            rumors.recordPut(key, base);
+            if (store_)
+                store_->appendPut(version, key, value, ttl_ms);
+            if (ttl_ms > 0)
+                expiry_.add(local_slot_, key, version, SlotEntry::expiration(version, ttl_ms));
+            return version;
+        });
 
         std::cout << "inserted version " << version << std::endl;
-
-        pf_gossip::SlotUpdate slot;
-        slot.set_name(local_slot_->name());
-        slot.set_version(version);
-        slot.add_pass_nodes(NodeName());
-
-        // 传播消息
-        auto selected = randomSelectGossipNodes(slot.pass_nodes());
-        for (auto &peer: selected) {
-            peer->pull(&slot);    // 异步，不会进行阻塞
-        }
-
         return version;
     }
 
@@ -117,21 +211,172 @@ namespace gossip::server {
 
         std::cout << "delete message " << key << std::endl;
 
-        auto version = local_slot_->remove(key);
+        return writeLocal([&](GossipRumorBuffer &rumors) {
+            auto base = local_slot_->version();
+            auto version = local_slot_->remove(key);
+            // 删除留下墓碑，和写入一样只传播这个键
+            if (version != -1) {
+                rumors.recordDelete(key, base);
+                if (store_)
+                    store_->appendDelete(version, key);
+            }
+            return version;
+        });
+    }
+
+    SlotVersion GossipNode::writeMessages(const SlotBatch &batch, int *applied) {
 
-        if (version == -1)
-            return -1;
+        std::cout << "write batch of " << batch.size() << " messages" << std::endl;
 
-        pf_gossip::SlotUpdate slot;
-        slot.set_name(local_slot_->name());
-        slot.set_version(version);
-        slot.add_pass_nodes(NodeName());
+        return writeLocal([&](GossipRumorBuffer &rumors) {
+            SlotVersion base;
+            auto version = local_slot_->applyBatch(batch, &base, applied);
+            if (version == -1)
+                return version;
+            if (store_)
+                store_->appendBatch(version, batch);
+
+            // 没有生效的删除在快照中找不到，发送时被跳过
+            for (auto &operation: batch) {
+                if (operation.remove) {
+                    rumors.recordDelete(operation.key, base);
+                    continue;
+                }
+                rumors.recordPut(operation.key, base);
+                if (operation.ttl_ms > 0)
+                    expiry_.add(local_slot_, operation.key, version, SlotEntry::expiration(version, operation.ttl_ms));
+            }
+            return version;
+        });
+    }
+
+    void GossipNode::flushRumors() {
+        SlotRumor rumor;
+        {
+            std::lock_guard<std::mutex> lg(rumor_mtx_);
+            if (rumors_.empty())
+                return;
+            rumor = rumors_.take(*local_slot_);
+        }
+
+        pf_gossip::SlotUpdate header;
+        header.set_name(local_slot_->name());
+        header.set_version(rumor.snapshot->version);
+        header.add_pass_nodes(NodeName());
+
+        auto selected = randomSelectGossipNodes(header.pass_nodes());
+        if (selected.empty())
+            return;
+
+        // 缓冲期间的所有写入合并为一次增量更新，所有节点共享同一份编码结果
+        // 对方节点已经持有 base 版本时可以直接合并
+        header.set_delta(true);
+        header.set_base_version(rumor.base);
+        auto update = GossipSlotCodec::encodeKeys(header, *rumor.snapshot, rumor.keys);
 
-        auto selected = randomSelectGossipNodes(slot.pass_nodes());
         for (auto &peer: selected) {
-            peer->pull(&slot);    // 异步，不会进行阻塞
+            peer->pull(update, true);    // 异步，不会进行阻塞
         }
-        return version;
+    }
+
+    void GossipNode::checkpoint() try {
+        if (!store_->dirty())
+            return;
+
+        // 快照与切换日志文件在本地写入的锁内完成，新的日志文件只包含快照之后的写入
+        SlotSnapshotPtr snapshot;
+        uint64_t first;
+        {
+            std::lock_guard<std::mutex> lg(rumor_mtx_);
+            snapshot = local_slot_->snapshot();
+            first = store_->rotate();
+        }
+        store_->checkpoint(*snapshot, first);
+
+    } catch (std::exception &e) {
+        std::cerr << "checkpoint failed: " << e.what() << std::endl;
+    }
+
+    void GossipNode::writeImage() try {
+        std::vector<const GossipSlot *> slots;
+        SlotVersions versions;
+        slots_.forEach([this, &slots, &versions](const std::string &name, GossipSlot &slot) {
+            if (&slot == local_slot_)
+                return;
+            slots.emplace_back(&slot);
+            versions.emplace(name, slot.version());
+        });
+        if (versions == image_versions_)
+            return;
+
+        auto bytes = GossipSlotImage::write(options_.data_dir + "/" + name_ + ".slots", slots);
+        image_versions_ = std::move(versions);
+        std::cout << "slot image written: " << slots.size() << " slots, " << bytes << " bytes" << std::endl;
+
+    } catch (std::exception &e) {
+        std::cerr << "write slot image failed: " << e.what() << std::endl;
+    }
+
+    void GossipNode::expireMessages() {
+        auto now = GossipClock::millis();
+        auto expired = expiry_.advance(now);
+        if (expired.empty())
+            return;
+
+        // 同一个 slot 的过期键值对一次处理，只发布一个快照
+        std::unordered_map<GossipSlot *, std::vector<std::pair<std::string, SlotVersion>>> groups;
+        for (auto &entry: expired)
+            groups[entry.slot].emplace_back(std::move(entry.key), entry.version);
+
+        size_t count = 0;
+        for (auto &[slot, keys]: groups)
+            count += slot->expire(keys, now);
+        if (count > 0)
+            std::cout << "expired " << count << " messages" << std::endl;
+    }
+
+    void GossipNode::collectTombstones() {
+        // 死亡的节点仍然保留在 peers_list_ 中并继续限制回收，直到墓碑超过最长保留时间，
+        // 这样短暂失联后恢复的节点仍然可以收到删除的增量
+        std::vector<GossipPeerNode *> peers;
+        {
+            std::shared_lock<std::shared_mutex> lock(peers_mtx_);
+            peers = peers_list_;
+        }
+
+        // 成员列表中没有连接过的节点从来没有确认过任何版本，只能等待墓碑超过最长保留时间
+        std::unordered_set<std::string> connected;
+        for (auto peer: peers)
+            connected.emplace(peer->name());
+        bool unacknowledged = false;
+        for (auto &member: membership_.members())
+            unacknowledged |= connected.count(member) == 0;
+
+        // 超过最长保留时间的墓碑即使还有节点没有确认也会被回收，这些节点之后收到全量更新
+        SlotVersion expired = 0;
+        if (options_.tombstone_max_age_ms > 0) {
+            auto age = static_cast<int64_t>(options_.tombstone_max_age_ms);
+            auto physical = std::max<int64_t>(GossipClock::physical(GossipClock::last()) - age, 0);
+            expired = physical << GossipClock::kLogicalBits;
+        }
+
+        size_t collected = 0;
+        slots_.forEach([&](const std::string &name, GossipSlot &slot) {
+            if (slot.tombstones() == 0)
+                return;
+            // 所有已知节点都确认过的版本，之前的墓碑已经传播到了每个节点；
+            // 没有任何已知节点时无法确认，只按照最长保留时间回收
+            SlotVersion horizon = 0;
+            if (!peers.empty() && !unacknowledged) {
+                horizon = slot.version();
+                for (auto peer: peers)
+                    horizon = std::min(horizon, peer->acknowledged(name));
+            }
+            collected += slot.collect(std::max(horizon, expired));
+        });
+
+        if (collected > 0)
+            std::cout << "collected " << collected << " tombstones" << std::endl;
     }
 
     pf_gossip::SearchResult GossipNode::searchMessage(const std::string &key, bool latest) {
@@ -143,59 +388,268 @@ namespace gossip::server {
             // FIXME
         }
 
-        for (auto &[name, slot]: slots_) {
+        // 只查找键索引中拥有这个键的 slot，与集群中 slot 的数量无关
+        for (auto slot: slots_.keys().find(key)) {
 
-            auto[value, version] = slot.find(key);
+            auto[value, version] = slot->find(key);
             if (version == 0)
                 continue;
 
             auto message = res.add_message();
             message->set_key(key);
             message->set_value(value);
-            message->set_owner(name);
+            message->set_owner(slot->name());
             message->set_version(version);
         }
 
         return std::move(res);
     }
 
-    SlotVersion GossipNode::handlePullRequest(const std::string &slot, const SlotValues &values, SlotVersion version,
-                                              const pf_gossip::SlotUpdate *origin) {
+    std::unique_ptr<SlotScanner> GossipNode::scanMessages(const std::string &owner, const std::string &start,
+                                                          std::string end) {
+        auto slot = slots_.find(owner.empty() ? name_ : owner);
+        if (slot == nullptr)
+            return nullptr;
+        return std::make_unique<SlotScanner>(slot->indexedSnapshot(), start, std::move(end));
+    }
 
-        std::cout << "slot: " << slot << " version: " << version << std::endl;
+    SlotVersion GossipNode::handlePullRequest(pf_gossip::SlotUpdate *request) {
 
-        if (slots_.find(slot) == slots_.end()) {
-            slots_.emplace(slot, GossipSlot(slot));
-        }
+        auto version = request->version();
+        std::cout << "slot: " << request->name() << " version: " << version << std::endl;
+
+        // 版本超前本地时钟太多的更新不进行合并，也不会传播给其他节点
+        if (!GossipClock::update(version))
+            return -1;
+
+        // 第一次收到某个 slot 时创建，只会锁住 registry 的一个分片
+        auto target = slots_.findOrCreate(request->name()).first;
 
         // 如果是旧消息，则不会进行传播操作
-        if (version < slots_.at(slot).version())
+        if (version < target->version())
             return -1;
 
-        // 传播
-        auto selected = randomSelectGossipNodes(origin->pass_nodes());
-        for (auto &peer: selected) {
-            peer->pull(origin);    // 异步，不会进行阻塞
+        // 传播，只编码一次并且由所有节点共享。没有键值对的增量更新只在两个节点的键值对完全相同时提升版本，
+        // 不能传播给其他节点，否则没有这些键值对的节点也会提升版本。按照 merkle 树叶子节点发送的更新同理，
+        // 只包含与发起比较的节点不同的叶子节点，其他节点合并后会认为自己已经是最新版本，只由比较的双方合并
+        std::list<GossipPeerNode *> selected;
+        if (request->leaves_size() == 0 && (!request->delta() || request->messages_size() > 0))
+            selected = randomSelectGossipNodes(request->pass_nodes());
+        if (!selected.empty()) {
+            request->add_pass_nodes(NodeName());
+            auto update = GossipSlotCodec::encode(*request);
+            for (auto &peer: selected) {
+                peer->pull(update, false);    // 异步，不会进行阻塞
+            }
         }
 
-        return slots_.at(slot).compareAndMergeSlot(values, version);
+        return mergeUpdate(target, request);
     }
 
-    SlotVersion
-    GossipNode::handleHeartbeatRequest(const std::string &node_name, const std::string &slot_name,
-                                       SlotVersion version) {
+    SlotVersion GossipNode::mergeUpdate(GossipSlot *target, pf_gossip::SlotUpdate *request) {
 
-        std::cout << "received heartbeat" << std::endl;
+        auto version = request->version();
+
+        // 键值对从请求中移动到 slot 中
+        auto values = GossipSlotCodec::decode(request);
+
+        // 带 TTL 的键值对在合并之后加入时间轮
+        std::vector<std::tuple<std::string, SlotVersion, int64_t>> expiring;
+        for (auto &[key, entry]: values) {
+            if (entry.expires != 0 && !entry.deleted)
+                expiring.emplace_back(key, entry.version, entry.expires);
+        }
+        SlotVersion merged;
+
+        // 按照 merkle 树叶子节点范围进行覆盖更新
+        if (request->leaves_size() > 0) {
+            std::vector<int> leaves(request->leaves().begin(), request->leaves().end());
+            merged = target->mergeLeaves(leaves, std::move(values), version);
+        } else {
+            merged = target->compareAndMergeSlot(std::move(values), version, request->delta(), request->base_version());
+        }
+
+        // 只加入被合并的键值对，否则没有被合并的新版本会替换掉 slot 中版本的过期时间
+        auto snapshot = target->snapshot();
+        for (auto &[key, entry_version, expires]: expiring) {
+            auto entry = snapshot->lookup(key);
+            if (entry != nullptr && !entry->deleted && entry->version == entry_version)
+                expiry_.add(target, std::move(key), entry_version, expires);
+        }
+        return merged;
+    }
+
+    void GossipNode::mergeUpdates(const google::protobuf::RepeatedPtrField<std::string> &updates) {
+        for (auto &bytes: updates) {
+            pf_gossip::SlotUpdate update;
+            if (!update.ParseFromString(bytes) || update.name().empty()) {
+                std::cerr << "Invalid Slot Update" << std::endl;
+                continue;
+            }
+
+            if (!GossipClock::update(update.version()))
+                continue;
+
+            // 反熵交换的数据不再进行传播
+            auto target = slots_.findOrCreate(update.name()).first;
+            if (update.version() < target->version())
+                continue;
+            mergeUpdate(target, &update);
+        }
+    }
+
+    void GossipNode::handleSyncRequest(const pf_gossip::SyncRequest &request, pf_gossip::SyncResponse *response) {
+
+        std::cout << "received sync request" << std::endl;
+
+        handlePeerHeartbeat(request.node_name());
+        handleMemberUpdates(request.members());
+        mergeUpdates(request.updates());
+
+        SlotVersions theirs;
+        for (auto &entry: request.slots())
+            theirs.emplace(entry.name(), entry.version());
+        handlePeerVersions(request.node_name(), theirs);
+
+        encodeSlots(slotsBehind(request.node_name(), theirs, true), response->mutable_updates());
+        collectVersions(response->mutable_slots());
+        collectMembers(response->mutable_members(), request.node_name());
+    }
+
+    void GossipNode::handleSyncResponse(const std::string &peer, const pf_gossip::SyncResponse &response,
+                                        const SlotVersions &versions) {
+
+        handleMemberUpdates(response.members());
+        mergeUpdates(response.updates());
+
+        // 上一轮的版本过期时，对方仍然落后的 slot 立即发送给对方
+        auto behind = slotsBehind(peer, versions, true);
+        if (!behind.empty()) {
+            scheduler_.post([this, peer, behind = std::move(behind)] {
+                pullSlotsToLowerNode(peer, behind);
+            });
+        }
+    }
+
+    std::vector<std::pair<std::string, SlotVersion>>
+    GossipNode::slotsBehind(const std::string &peer, const SlotVersions &theirs, bool all) {
+        std::vector<std::pair<std::string, SlotVersion>> behind;
+        slots_.forEach([&](const std::string &name, GossipSlot &slot) {
+            // 对方自己的 slot 以对方为准
+            if (name == peer)
+                return;
+            auto it = theirs.find(name);
+            if (it == theirs.end() && !all)
+                return;
+            auto known = it == theirs.end() ? 0 : it->second;
+            if (slot.version() > known)
+                behind.emplace_back(name, known);
+        });
+        return behind;
+    }
+
+    void GossipNode::encodeSlots(const std::vector<std::pair<std::string, SlotVersion>> &slots,
+                                 google::protobuf::RepeatedPtrField<std::string> *updates) {
+        for (auto &[name, known]: slots) {
+            auto slot = slots_.find(name);
+            if (slot == nullptr)
+                continue;
+
+            // 对方的版本已知并且之后没有无法增量传播的变化时，只需要发送增量
+            bool delta = known > 0 && known >= slot->fullSyncVersion();
+            auto since = delta ? known : 0;
+
+            auto snapshot = slot->snapshot();
+            pf_gossip::SlotUpdate header;
+            header.set_name(name);
+            header.set_version(snapshot->version);
+            header.set_delta(delta);
+            header.set_base_version(since);
+            header.add_pass_nodes(name_);
+
+            GossipSlotCodec::encode(header, *snapshot, [since](const std::string &, const SlotEntry &entry) {
+                return entry.version > since;
+            }, updates->Add());
+        }
+    }
+
+    SlotVersion GossipNode::handleDigestRequest(const std::string &slot, const std::vector<int> &nodes,
+                                                const std::vector<uint64_t> &hashes, std::vector<int> *differs) {
 
-        auto it = slots_.find(slot_name);
-        if (it == slots_.end())
+        auto target = slots_.find(slot);
+        if (target == nullptr) {
+            // 没有这个 slot 时视为空树
+            for (size_t i = 0; i < nodes.size(); i++) {
+                if (hashes[i] != 0)
+                    differs->emplace_back(nodes[i]);
+            }
             return -1;
+        }
+
+        auto [local, version] = target->digest(nodes);
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (hashes[i] != local[i])
+                differs->emplace_back(nodes[i]);
+        }
+        return version;
+    }
 
+    void GossipNode::handleHeartbeatRequest(const pf_gossip::NodeVersions &versions,
+                                            pf_gossip::NodeVersions *reply) {
 
-        if (version < it->second.version())
-            lower_slots.emplace_back(node_name);
+        std::cout << "received heartbeat" << std::endl;
 
-        return it->second.version();
+        // 对方的回复由发起请求的 peer 记录心跳
+        if (reply != nullptr)
+            handlePeerHeartbeat(versions.node_name());
+        handleMemberUpdates(versions.members());
+
+        // 对方持有的 slot 版本，没有出现的 slot 视为版本 0；旧版本的节点不会设置 full_slots，只会发送一个 slot 的版本
+        bool full = versions.full_slots();
+        SlotVersions theirs;
+        for (auto &entry: versions.slots())
+            theirs.emplace(entry.name(), entry.version());
+        if (!full)
+            theirs.emplace(versions.slot_name(), versions.slot_version());
+        else
+            handlePeerVersions(versions.node_name(), theirs);
+
+        // 只计算对方落后的 slot，本节点落后的 slot 由对方发送
+        auto behind = slotsBehind(versions.node_name(), theirs, full);
+
+        if (!behind.empty()) {
+            // 立即在守护线程中拉取，不再等待下一个周期
+            scheduler_.post([this, name = versions.node_name(), behind = std::move(behind)] {
+                pullSlotsToLowerNode(name, behind);
+            });
+        }
+
+        if (reply != nullptr) {
+            collectVersions(reply);
+            auto target = slots_.find(versions.slot_name());
+            reply->set_slot_name(versions.slot_name());
+            reply->set_slot_version(target == nullptr ? -1 : target->version());
+            collectMembers(reply->mutable_members(), versions.node_name());
+        }
+    }
+
+    void GossipNode::collectVersions(pf_gossip::NodeVersions *versions) {
+        versions->set_node_name(name_);
+        versions->set_slot_name(local_slot_->name());
+        versions->set_slot_version(local_slot_->version());
+        versions->set_full_slots(true);
+        collectVersions(versions->mutable_slots());
+    }
+
+    void GossipNode::collectVersions(google::protobuf::RepeatedPtrField<pf_gossip::SlotVersionEntry> *slots) {
+        slots_.forEach([slots](const std::string &name, GossipSlot &slot) {
+            auto version = slot.version();
+            if (version <= 0)
+                return;
+            auto entry = slots->Add();
+            entry->set_name(name);
+            entry->set_version(version);
+        });
     }
 
     bool GossipNode::handleNewNodeNotify(const std::string &name, const std::string &address, SlotVersion version,
@@ -207,19 +661,17 @@ namespace gossip::server {
         }
 
         // 如果断线重连，或者是已经收到通知，则什么都不做
-        if (peers_.find(name) != peers_.end())
+        if (findPeer(name) != nullptr)
             return true;
 
-        auto node = new GossipPeerNode(name, address, version, this);
-
         // 对消息进行传播
         auto selected = randomSelectGossipNodes(origin->pass_nodes());
         for (auto &peer: selected) {
             peer->newNodeNotify(origin);    // 异步，不会进行阻塞
         }
 
-        auto ptr = peers_.emplace(name, node).first->second;
-        peers_list_.emplace_back(ptr);
+        addPeer(name, address, version);
+        membership_.join(name, address);
 
         std::cout << "established new connection " << std::endl;
 
@@ -229,19 +681,22 @@ namespace gossip::server {
     void GossipNode::handleDeleteNodeNotify(const std::string &name, const std::string &address, SlotVersion version,
                                             const ::pf_gossip::GossipNodeInfo *origin) {
 
-        auto it = peers_.find(name);
+        auto peer = findPeer(name);
 
-        if (it == peers_.end()) {
+        if (peer == nullptr) {
             std::cerr << "Delete Not Exist Node" << std::endl;
             return;
         }
 
-        if (it->second->version() > version) {
+        if (peer->version() > version) {
             std::cerr << "Delete Version Lower" << std::endl;
             return;
         }
 
-        it->second->setNotAlive();
+        // 主动下线的节点不需要经过怀疑阶段
+        if (auto member = membership_.leave(name)) {
+            scheduler_.post([this, member = *member] { applyMemberChanges({member}); });
+        }
 
         // 对消息进行传播
         auto selected = randomSelectGossipNodes(origin->pass_nodes());
@@ -262,6 +717,49 @@ namespace gossip::server {
         return value;
     }
 
+    void GossipNode::getMessages(const pf_gossip_cli::KeyList &keys, pf_gossip::SearchResult *result) {
+
+        // 按照 slot 分组，每个 slot 只查找并固定一次快照
+        std::unordered_map<std::string_view, std::vector<int>> groups;
+        for (int i = 0; i < keys.keys_size(); i++) {
+            auto &owner = keys.keys(i).owner();
+            groups[owner.empty() ? std::string_view(name_) : std::string_view(owner)].emplace_back(i);
+
+            auto message = result->add_message();
+            message->set_key(keys.keys(i).key());
+            message->set_owner(owner.empty() ? name_ : owner);
+        }
+
+        for (auto &[owner, indexes]: groups) {
+            auto slot = slots_.find(std::string(owner));
+            if (slot == nullptr)
+                continue;
+
+            // 冷 slot 逐个在镜像上查找，读取不会把它加载到内存
+            if (slot->cold()) {
+                for (auto i: indexes) {
+                    auto [value, version] = slot->find(keys.keys(i).key());
+                    if (version == 0)
+                        continue;
+                    auto message = result->mutable_message(i);
+                    message->set_value(std::move(value));
+                    message->set_version(version);
+                }
+                continue;
+            }
+
+            auto snapshot = slot->snapshot();
+            for (auto i: indexes) {
+                auto entry = snapshot->find(keys.keys(i).key());
+                if (entry == nullptr)
+                    continue;
+                auto message = result->mutable_message(i);
+                message->set_value(entry->value);
+                message->set_version(entry->version);
+            }
+        }
+    }
+
     std::string GossipNode::startConnection(const std::string &address) {
 
         auto peer = new GossipPeerNode("", address, 0, this);
@@ -271,9 +769,12 @@ namespace gossip::server {
         startNewNodeNotify(peer->name(), peer->address(), peer->version());
 
         if (conn_res.empty()) { // 如果成功
-            auto ptr = peers_.emplace(peer->name(), peer).first->second;
-            slots_.emplace(peer->name(), GossipSlot(peer->name()));
-            peers_list_.emplace_back(ptr);
+            std::unique_lock<std::shared_mutex> lock(peers_mtx_);
+            if (peers_.emplace(peer->name(), peer).second)
+                peers_list_.emplace_back(peer);
+            lock.unlock();
+            slots_.findOrCreate(peer->name());
+            membership_.join(peer->name(), address);
         }
 
         return conn_res;
@@ -308,158 +809,325 @@ namespace gossip::server {
     }
 
     void GossipNode::DaemonTask() {
-        time_t clock = time(nullptr) + 5;
+        using std::chrono::milliseconds;
+
+        // 各个周期任务相互独立，事件触发的任务由其他线程直接加入调度器
+        scheduler_.every(milliseconds(options_.heartbeat_interval_ms), [this] { startHeartBeat(); });
+        if (options_.probe_interval_ms > 0)
+            scheduler_.every(milliseconds(options_.probe_interval_ms), [this] { startProbe(); });
+        if (options_.sync_interval_ms > 0)
+            scheduler_.every(milliseconds(options_.sync_interval_ms), [this] { startSync(); });
+        if (store_ && options_.snapshot_interval_ms > 0)
+            scheduler_.every(milliseconds(options_.snapshot_interval_ms), [this] { checkpoint(); });
+        if (store_ && options_.image_interval_ms > 0)
+            scheduler_.every(milliseconds(options_.image_interval_ms), [this] { writeImage(); });
+        if (options_.expiry_tick_ms > 0)
+            scheduler_.every(milliseconds(options_.expiry_tick_ms), [this] { expireMessages(); });
+        if (options_.tombstone_gc_interval_ms > 0)
+            scheduler_.every(milliseconds(options_.tombstone_gc_interval_ms), [this] { collectTombstones(); });
+
+        scheduler_.run();
+    }
 
-        while (!quit) {
+    void GossipNode::pullSlotsToLowerNode(const std::string &name,
+                                          const std::vector<std::pair<std::string, SlotVersion>> &slots) {
+
+        auto peer = findPeer(name);
+        if (peer == nullptr) {
+            std::cerr << "Pull Not Exist Slot." << std::endl;
+            return;
+        }
 
-            auto now = time(nullptr);
+        for (auto &[slot_name, known]: slots) {
+            auto slot = slots_.find(slot_name);
+            if (slot == nullptr)
+                continue;
 
-            if (now >= clock) {
-                checkPeerHealth();
-                clock = now + 5;    // 定时一段时间来随机检查一次健康状况
+            // 对方的版本已知并且之后没有无法增量传播的变化时，发送增量即可
+            if (known > 0 && known >= slot->fullSyncVersion()) {
+                peer->pull(slot, known);
+                continue;
             }
 
-            doRetryTask();
-            doGossipTask();
-            removeUnHealthyNode();
-            pullSlotToLowerNode();
+            // 否则通过比较 merkle 树只发送不同的部分，失败时退化为全量更新。比较是异步的，不会阻塞守护线程
+            peer->syncDigest(slot, [this, peer, slot](bool synced) {
+                if (!synced)
+                    scheduler_.post([peer, slot] { peer->pull(slot, 0); });
+            });
+        }
+    }
+
+    void GossipNode::handlePing(const pf_gossip::PingRequest &request, pf_gossip::PingResponse *response,
+                                std::function<void()> done) {
+
+        handlePeerHeartbeat(request.node_name());
+        handleMemberUpdates(request.members());
 
-            sleep(1);
+        GossipPeerNode *target = nullptr;
+        if (request.target().empty() || request.target() == name_) {
+            response->set_ack(true);
+        } else {
+            target = findPeer(request.target());
         }
 
+        if (target == nullptr) {
+            collectMembers(response->mutable_members(), request.node_name());
+            done();
+            return;
+        }
+
+        // 间接探测，由本节点探测目标节点，在目标节点应答或者超时之后才回复，不占用线程等待
+        target->ping({}, std::chrono::milliseconds(request.timeout_ms()),
+                     [this, response, sender = request.node_name(), done = std::move(done)](bool ack) {
+                         response->set_ack(ack);
+                         collectMembers(response->mutable_members(), sender);
+                         done();
+                     });
+    }
+
+    void GossipNode::handleMemberUpdates(const google::protobuf::RepeatedPtrField<pf_gossip::MemberUpdate> &updates) {
+        if (updates.empty())
+            return;
+
+        // 成员列表本身是线程安全的，成员变化引起的 peer 修改在守护线程中进行
+        auto changes = membership_.apply(updates);
+        if (!changes.empty()) {
+            scheduler_.post([this, changes = std::move(changes)] { applyMemberChanges(changes); });
+        }
     }
 
-    void GossipNode::removeUnHealthyNode() {
+    void GossipNode::handlePeerHeartbeat(const std::string &name) {
+        auto peer = findPeer(name);
+        if (peer != nullptr)
+            peer->beat();
+    }
 
-        std::list<GossipPeerNode *> peers;
+    void GossipNode::handlePeerVersions(const std::string &name, const SlotVersions &versions) {
+        auto peer = findPeer(name);
+        if (peer != nullptr)
+            peer->acknowledge(versions);
+    }
 
-        std::swap(unhealthy_peers_, peers);
+    void GossipNode::collectMembers(google::protobuf::RepeatedPtrField<pf_gossip::MemberUpdate> *updates,
+                                    const std::string &receiver) {
+        membership_.collect(updates, receiver, options_.max_piggyback);
+    }
 
-        auto now = time(nullptr);
+    void GossipNode::startProbe() {
 
-        // 大于 30s 没有通信且无应答的节点视为下线
-        for (auto &peer: peers) {
-            if (now - peer->timestamp() > 30) {
-                if (!peer->echo()) {
-                    peers_.erase(peer->name());
-                }
-            } else {
-                unhealthy_peers_.emplace_back(peer);
-            }
+        auto target = membership_.nextProbeTarget();
+        auto peer = findPeer(target);
+        if (peer == nullptr)
+            return;
+
+        peer->ping({}, std::chrono::milliseconds(options_.probe_timeout_ms), [this, target](bool ack) {
+            if (!ack)
+                scheduler_.post([this, target] { probeIndirectly(target); });
+        });
+    }
+
+    void GossipNode::probeIndirectly(const std::string &target) {
+
+        google::protobuf::RepeatedPtrField<std::string> excluded;
+        *excluded.Add() = target;
+        auto helpers = randomSelectGossipNodes(excluded, options_.indirect_probes);
+        if (helpers.empty()) {
+            suspectMember(target);
+            return;
+        }
+
+        // 任意一个节点收到应答即可，全部失败时才怀疑目标节点
+        struct Probe {
+            std::atomic<size_t> pending;
+            std::atomic<bool> acked{false};
+        };
+        auto probe = std::make_shared<Probe>();
+        probe->pending = helpers.size();
+
+        for (auto &helper: helpers) {
+            helper->ping(target, std::chrono::milliseconds(options_.probe_timeout_ms), [this, target, probe](bool ack) {
+                if (ack)
+                    probe->acked = true;
+                if (--probe->pending == 0 && !probe->acked)
+                    scheduler_.post([this, target] { suspectMember(target); });
+            });
         }
     }
 
-    void GossipNode::pullSlotToLowerNode() {
-        std::lock_guard<std::mutex> lg(ls_mtx);
-        if (lower_slots.empty())
+    void GossipNode::suspectMember(const std::string &name) {
+        // 按照对方心跳间隔的历史，这段时间没有消息仍然正常时，只是暂时变慢，不进行怀疑
+        auto peer = findPeer(name);
+        if (peer != nullptr && peer->phi() < options_.phi_suspect_threshold) {
+            std::cout << "probe of " << name << " failed, phi " << peer->phi() << std::endl;
             return;
+        }
 
-        auto front = lower_slots.front();
-        auto it = peers_.find(front);
-        lower_slots.pop_front();
+        if (auto member = membership_.suspect(name))
+            applyMemberChanges({*member});
+    }
 
-        if (it == peers_.end()) {
-            std::cerr << "Pull Not Exist Slot." << std::endl;
+    void GossipNode::confirmMember(const std::string &name, int64_t incarnation) {
+        // 仍然被怀疑但是 phi 不够高时延长怀疑，而不是判定死亡
+        auto peer = findPeer(name);
+        if (peer != nullptr && peer->phi() < options_.phi_dead_threshold &&
+            membership_.state(name) == pf_gossip::SUSPECT) {
+            scheduler_.schedule(std::chrono::milliseconds(options_.suspect_timeout_ms),
+                                [this, name, incarnation] { confirmMember(name, incarnation); });
             return;
         }
 
-        pf_gossip::SlotUpdate slot;
-        slot.set_name(local_slot_->name());
-        slot.set_version(local_slot_->version());
-        slot.add_pass_nodes(NodeName());
-        it->second->pull(&slot);
+        if (auto dead = membership_.confirm(name, incarnation))
+            applyMemberChanges({*dead});
     }
 
-    void GossipNode::checkPeerHealth() {
+    void GossipNode::applyMemberChanges(const std::vector<GossipMembership::Member> &changes) {
+        for (auto &member: changes) {
+            switch (member.state) {
+                case pf_gossip::ALIVE:
+                    // 通过捎带得知的新节点直接连接
+                    if (!member.address.empty() && member.address != internal_address_)
+                        addPeer(member.name, member.address, 0);
+                    break;
+
+                case pf_gossip::SUSPECT: {
+                    std::cout << "suspect node " << member.name << std::endl;
+                    auto name = member.name;
+                    auto incarnation = member.incarnation;
+                    scheduler_.schedule(std::chrono::milliseconds(options_.suspect_timeout_ms),
+                                        [this, name, incarnation] { confirmMember(name, incarnation); });
+                    break;
+                }
 
-        startHeartBeat();
+                case pf_gossip::DEAD: {
+                    std::cout << "node " << member.name << " is dead" << std::endl;
+                    // peer 对象保留在 peers_list_ 中，进行中的 rpc 仍然可以使用
+                    std::unique_lock<std::shared_mutex> lock(peers_mtx_);
+                    auto it = peers_.find(member.name);
+                    if (it != peers_.end()) {
+                        it->second->setNotAlive();
+                        peers_.erase(it);
+                    }
+                    break;
+                }
 
-        for (auto &[name, peer]: peers_) {
-            if (!peer->isAlive())
-                unhealthy_peers_.emplace_back(peer);
+                default:
+                    break;
+            }
         }
     }
 
-    void GossipNode::addRetryTask(GossipPeerNode::AsyncClientCall<google::protobuf::Any, google::protobuf::Any> *call) {
-        std::lock_guard<std::mutex> lg(mtx);
-        retry_list_.emplace_back(call);
+    GossipPeerNode *GossipNode::findPeer(const std::string &name) {
+        std::shared_lock<std::shared_mutex> lock(peers_mtx_);
+        auto it = peers_.find(name);
+        return it == peers_.end() ? nullptr : it->second;
     }
 
-    void GossipNode::doRetryTask() {
-        std::list<RetryCall *> calls;
-        {
-            std::lock_guard<std::mutex> lg(mtx);
-            std::swap(calls, retry_list_);
+    GossipPeerNode *GossipNode::addPeer(const std::string &name, const std::string &address, SlotVersion version) {
+        std::unique_lock<std::shared_mutex> lock(peers_mtx_);
+        auto it = peers_.find(name);
+        if (it != peers_.end()) {
+            it->second->setAlive();
+            return it->second;
+        }
+
+        // 死亡后以相同地址重新加入的节点复用原来的连接
+        GossipPeerNode *peer = nullptr;
+        for (auto candidate: peers_list_) {
+            if (candidate->name() == name && candidate->address() == address) {
+                peer = candidate;
+                break;
+            }
         }
+        if (peer == nullptr) {
+            peer = new GossipPeerNode(name, address, version, this);
+            peers_list_.emplace_back(peer);
+        }
+
+        peer->setAlive();
+        peers_.emplace(name, peer);
+        return peer;
+    }
+
+    void GossipNode::addRetryTask(RetryCall *call) {
+        // 指数退避，避免对不可用的节点频繁重试
+        auto backoff = options_.retry_backoff_ms << std::min(call->attempts_, 16);
+        auto delay = std::chrono::milliseconds(std::min(backoff, options_.retry_max_backoff_ms));
 
-        for (auto &call: calls) {
+        scheduler_.schedule(delay, [this, call] {
             auto cli = randomSelectGossipNode();
+            if (cli == nullptr) {
+                call->release();
+                return;
+            }
             call->retry(cli);
-        }
+        });
+    }
+
+    void GossipNode::startSync() {
 
+        auto cli = randomSelectGossipNode();
+        if (cli == nullptr)
+            return;
+
+        cli->syncSlots();
     }
 
     void GossipNode::doGossipTask() {
-
+        bool due;
+        {
+            std::lock_guard<std::mutex> lg(rumor_mtx_);
+            due = rumors_.due();
+        }
+        if (due)
+            flushRumors();
     }
 
     GossipPeerNode *GossipNode::randomSelectGossipNode() {
 
-        if (peers_list_.empty())
+        // 死亡的节点仍然留在 peers_list_ 中，只从存活的节点中选择
+        std::vector<GossipPeerNode *> alive;
+        {
+            std::shared_lock<std::shared_mutex> lock(peers_mtx_);
+            for (auto peer: peers_list_) {
+                if (peer->isAlive())
+                    alive.emplace_back(peer);
+            }
+        }
+        if (alive.empty())
             return {};
 
         std::random_device rd;
         std::default_random_engine e(rd());
-        std::uniform_int_distribution<int> u(0, static_cast<int>(peers_.size()) - 1);
+        std::uniform_int_distribution<size_t> u(0, alive.size() - 1);
 
-        int selected = u(e);
-
-        if (peers_list_[selected]->isAlive())
-            return peers_.at(peers_list_[selected]->name());
-
-        return {};
+        return alive[u(e)];
     }
 
     std::list<GossipPeerNode *>
     GossipNode::randomSelectGossipNodes(const google::protobuf::RepeatedPtrField<std::string> &passed_nodes,
                                         size_t nums) {
 
-        if (peers_list_.empty())
+        // 只从还没有收到消息的节点中进行选择
+        std::vector<GossipPeerNode *> candidates;
+        {
+            std::shared_lock<std::shared_mutex> lock(peers_mtx_);
+            for (auto peer: peers_list_) {
+                auto passed = std::find(passed_nodes.begin(), passed_nodes.end(), peer->name()) != passed_nodes.end();
+                if (!passed && peer->isAlive())
+                    candidates.emplace_back(peer);
+            }
+        }
+        if (candidates.empty())
             return {};
 
-        std::list<GossipPeerNode *> nodes;
-
-        auto select_nums = std::min(nums, peers_list_.size());
-        std::set<int> peer_no;
-
         std::random_device rd;
         std::default_random_engine e(rd());
-        std::uniform_int_distribution<int> u(0, static_cast<int>(peers_list_.size()) - 1);
-
-        while (peer_no.size() < select_nums) {
-
-            int rand = u(e);
-
-            auto find_node = [passed_nodes, this, rand] {
-                if (passed_nodes.empty())
-                    return false;
-                for (auto &node: passed_nodes) {
-                    if (node == peers_list_[rand]->name()) {
-                        return true;
-                    }
-                }
-                return false;
-            };
+        std::shuffle(candidates.begin(), candidates.end(), e);
 
-            if (!find_node())
-                peer_no.emplace(u(e));
-        }
+        if (candidates.size() > nums)
+            candidates.resize(nums);
 
-        for (auto rand: peer_no) {
-            nodes.emplace_back(peers_.at(peers_list_[rand]->name()));
-        }
-
-        return nodes;
+        return {candidates.begin(), candidates.end()};
     }
 
     nlohmann::json GossipNode::getNodeStatus() {
@@ -469,11 +1137,29 @@ namespace gossip::server {
         json["name"] = name_;
         json["internal_address"] = internal_address_;
         json["external_address"] = external_address_;
-        json["mem_use"] = mem_use_;
+
+        size_t mem_use = 0, cold = 0, tombstones = 0;
+        slots_.forEach([&mem_use, &cold, &tombstones](const std::string &, GossipSlot &slot) {
+            mem_use += slot.approximateMemoryUse();
+            cold += slot.cold();
+            tombstones += slot.tombstones();
+        });
+        json["mem_use"] = mem_use;
+        json["cold_slots"] = cold;
+        json["tombstones"] = tombstones;
+        json["expiring"] = expiry_.size();
+        json["slots"] = slots_.size();
+        if (store_)
+            json["wal"] = {{"appended", store_->appended()}, {"syncs", store_->syncs()}};
+        json["incarnation"] = membership_.incarnation();
+        std::shared_lock<std::shared_mutex> lock(peers_mtx_);
         for (auto &[name, peer]: peers_) {
+            auto state = pf_gossip::MemberState_Name(membership_.state(name));
             json["peers"].emplace_back(nlohmann::json{{"name",    name},
                                                       {"address", peer->address()},
-                                                      {"alive",   peer->isAlive()}});
+                                                      {"alive",   peer->isAlive()},
+                                                      {"state",   state},
+                                                      {"phi",     peer->phi()}});
         }
         return json;
     }
@@ -6,8 +6,19 @@
 #define GOSSIP_GOSSIPNODE_H
 
 #include "services/GossipService.h"
+#include "services/GossipCallbackService.h"
 #include "services/GossipCliService.h"
+#include "services/GossipCliCallbackService.h"
+#include "GossipCompletionPool.h"
+#include "GossipExpiryWheel.h"
+#include "GossipMembership.h"
+#include "GossipOptions.h"
+#include "GossipRumorBuffer.h"
+#include "GossipScheduler.h"
 #include "GossipSlot.h"
+#include "GossipSlotImage.h"
+#include "GossipSlotRegistry.h"
+#include "GossipStore.h"
 #include "GossipPeerNode.h"
 
 #include <nlohmann/json.hpp>
@@ -16,6 +27,7 @@
 #include <string>
 #include <utility>
 #include <random>
+#include <shared_mutex>
 
 namespace gossip::server {
 
@@ -26,14 +38,16 @@ namespace gossip::server {
 
     public:
 
-        using RetryCall = GossipPeerNode::AsyncClientCall<google::protobuf::Any, google::protobuf::Any>;
+        using RetryCall = GossipPeerNode::AsyncCall;
 
         /// Constructor of GossipNode. Create gossip peer node listen port and gossip client listen port.
         /// \param name Name of gossip node. Used to identify different gossip slot.
         /// \param ex_addr Gossip client listen address. If is set "", means don't open client port.
         /// \param in_addr Gossip peer node listen address. If is set "", means don't open peer node port.
         /// \param token Gossip Client Entry token. If not set, this node will acquire no token.
-        explicit GossipNode(std::string name, std::string ex_addr, std::string in_addr,std::string token = "");
+        /// \param options Tunable options of this node, such as the service models of both ports.
+        explicit GossipNode(std::string name, std::string ex_addr, std::string in_addr, std::string token = "",
+                            GossipOptions options = {});
 
         /// Destructor of GossipNode. Recycle the sources claimed.
         ~GossipNode();
@@ -63,6 +77,18 @@ namespace gossip::server {
             return local_slot_;
         }
 
+        /// Get the options of this node.
+        /// \return Options given at construction
+        [[nodiscard]] const GossipOptions &options() const {
+            return options_;
+        }
+
+        /// Get the completion queues shared by all peer nodes of this node.
+        /// \return Completion queue pool
+        [[nodiscard]] GossipCompletionPool *completionPool() const {
+            return completion_pool_.get();
+        }
+
         /// Get the name of this gossip node.
         /// \return The name of this gossip node
         [[nodiscard]] std::string NodeName() const {
@@ -75,6 +101,13 @@ namespace gossip::server {
             return token_;   // 这里不涉及写操作，不需要加锁
         }
 
+        /// Get the SWIM state of a node known by this node.
+        /// \param name Name of node
+        /// \return State of node, or dead if node is unknown
+        GossipMembership::State memberState(const std::string &name) {
+            return membership_.state(name);
+        }
+
         /// Get the status of this gossip node.
         /// \return The status of gossip node
         nlohmann::json getNodeStatus();
@@ -83,19 +116,33 @@ namespace gossip::server {
         /// slot version.
         /// \param key The key of message
         /// \param value The value of message
+        /// \param ttl_ms TTL of message in milliseconds, 0 means never expire
         /// \return Updated slot version
-        SlotVersion insertOrUpdateMessage(const std::string &key, const std::string &value);
+        SlotVersion insertOrUpdateMessage(const std::string &key, const std::string &value, int64_t ttl_ms = 0);
 
         /// Handle gossip client's delete request by key.
         /// \param key The key of message
         /// \return Updated slot version
         SlotVersion deleteMessage(const std::string &key);
 
+        /// Handle gossip client's batch write request. All puts and deletes are applied to local slot with one
+        /// version and propagated as one gossip message.
+        /// \param batch Operations to apply in order
+        /// \param applied If not nullptr, stores the number of operations that changed local slot
+        /// \return Updated slot version or -1 if nothing is changed
+        SlotVersion writeMessages(const SlotBatch &batch, int *applied = nullptr);
+
         /// Handle gossip client's read request by key. This function only finds value in local slot.
         /// \param key The key of message
         /// \return Latest value
         std::string getMessage(const std::string &key);
 
+        /// Handle gossip client's multi read request. Keys are grouped by owner slot, so every slot is looked up
+        /// and pinned once. Keys without owner are found in local slot.
+        /// \param keys Keys to find
+        /// \param result Found messages in the order of keys. The version of a message not found is 0
+        void getMessages(const pf_gossip_cli::KeyList &keys, pf_gossip::SearchResult *result);
+
         /// Handle gossip client's read request by key. This function will finds version in all slot. If latest is
         /// set true, this node will ask the owner of message to get latest version.
         /// \param key The key of message
@@ -103,26 +150,108 @@ namespace gossip::server {
         /// \return Find result
         pf_gossip::SearchResult searchMessage(const std::string &key, bool latest);
 
+        /// Open an ordered scan over one slot for gossip client's scan request. The slot builds its ordered index on
+        /// the first scan, and the scanner reads a pinned snapshot, so it never blocks writes.
+        /// \param owner Name of slot, empty means local slot
+        /// \param start First key, inclusive
+        /// \param end Last key, exclusive. Empty means no upper bound
+        /// \return Scanner of K-V pairs in range, or nullptr if slot doesn't exist
+        std::unique_ptr<SlotScanner> scanMessages(const std::string &owner, const std::string &start, std::string end);
+
         /// Handle gossip peer node's pull request. Node will first propagate message to another nodes and
-        /// then compare and update this node's slot. If slot is updated, function returns new version; if not,
-        /// function returns original version.
-        /// \param slot Slot name
-        /// \param values Slot values
-        /// \param version Slot version
-        /// \param origin Peer's request
+        /// then compare and update this node's slot. If request is a delta update, values will be merged into
+        /// the slot in place. If slot is updated, function returns new version; if not, function returns
+        /// original version.
+        /// \param request Peer's request. K-V pairs are moved out of it into the slot
         /// \return Updated slot version. If not updated, returns original version.
-        SlotVersion handlePullRequest(const std::string &slot, const SlotValues &values, SlotVersion version,
-                                      const pf_gossip::SlotUpdate *origin);
-
-        /// Handle gossip peer node's heartbeat request. If peer node's version is higher than this or
-        /// the same as this, function will do nothing. If peer node's version is less than this, function
-        /// will put peer node to lower_slots and delayed pull this node's slot to that peer node.
-        /// \param node_name Node name of peer node
-        /// \param slot_name Slot name to compare
-        /// \param version Version of peer node's slot
-        /// \return This node's slot version
-        SlotVersion
-        handleHeartbeatRequest(const std::string &node_name, const std::string &slot_name, SlotVersion version);
+        SlotVersion handlePullRequest(pf_gossip::SlotUpdate *request);
+
+        /// Handle gossip peer node's merkle digest request. Compare the hashes of given merkle tree nodes with this
+        /// node's copy of slot, and find out which nodes are different.
+        /// \param slot Slot name
+        /// \param nodes Indexes of merkle tree nodes
+        /// \param hashes Hashes of merkle tree nodes on peer node
+        /// \param differs Indexes of different merkle tree nodes
+        /// \return This node's slot version or -1 if slot doesn't exist
+        SlotVersion handleDigestRequest(const std::string &slot, const std::vector<int> &nodes,
+                                        const std::vector<uint64_t> &hashes, std::vector<int> *differs);
+
+        /// Handle gossip peer node's heartbeat request or response. Compare the versions of all slots held by this
+        /// node with peer node's, and schedule pulls of the slots that peer node is behind on at once. Peer node
+        /// does the same with the versions replied, so both nodes only send the slots they are ahead on. If peer
+        /// node only sends the version of one slot, only that slot is compared.
+        /// \param versions Slot versions of peer node
+        /// \param reply If not nullptr, stores slot versions of this node. Its slot_version is this node's version
+        /// of the slot named in versions
+        void handleHeartbeatRequest(const pf_gossip::NodeVersions &versions, pf_gossip::NodeVersions *reply);
+
+        /// Collect the versions of all slots held by this node.
+        /// \param versions Stores node name, local slot version and versions of all non-empty slots
+        void collectVersions(pf_gossip::NodeVersions *versions);
+
+        /// Collect the versions of all non-empty slots held by this node.
+        /// \param slots Stores versions of slots
+        void collectVersions(google::protobuf::RepeatedPtrField<pf_gossip::SlotVersionEntry> *slots);
+
+        /// Handle gossip peer node's push-pull anti-entropy request. Slots pushed by peer node are merged first,
+        /// and then the slots that peer node is behind on are returned with the versions of all slots of this node.
+        /// \param request Peer's request
+        /// \param response Stores slots that peer node is behind on and versions of this node
+        void handleSyncRequest(const pf_gossip::SyncRequest &request, pf_gossip::SyncResponse *response);
+
+        /// Handle the response of a push-pull anti-entropy round. Slots returned by peer node are merged, and slots
+        /// that peer node is still behind on are pulled to it at once.
+        /// \param peer Name of peer node
+        /// \param response Peer's response
+        /// \param versions Versions of all slots of peer node after it merged the request
+        void handleSyncResponse(const std::string &peer, const pf_gossip::SyncResponse &response,
+                                const SlotVersions &versions);
+
+        /// Find the slots that a peer node is behind on. The peer node's own slot is never included.
+        /// \param peer Name of peer node
+        /// \param theirs Versions of slots held by peer node
+        /// \param all If set, a slot missing in theirs is seen as version 0. Otherwise it is skipped
+        /// \return Names of slots and their versions held by peer node
+        std::vector<std::pair<std::string, SlotVersion>>
+        slotsBehind(const std::string &peer, const SlotVersions &theirs, bool all);
+
+        /// Encode slots as SlotUpdates. Only K-V pairs changed after the given version are encoded if possible,
+        /// otherwise the whole slot is encoded.
+        /// \param slots Names of slots and their versions held by receiver
+        /// \param updates Stores wire bytes of every SlotUpdate
+        void encodeSlots(const std::vector<std::pair<std::string, SlotVersion>> &slots,
+                         google::protobuf::RepeatedPtrField<std::string> *updates);
+
+        /// Handle gossip peer node's SWIM ping. Membership changes piggybacked on the ping are merged, and changes
+        /// of this node are piggybacked on the ack. If the ping names a target node, this node pings target node
+        /// asynchronously and response is ready when target node acks or the timeout of request passes, no thread
+        /// waits for it.
+        /// \param request Peer's ping
+        /// \param response Stores whether this node or target node acks
+        /// \param done Called once response is ready, on a polling thread of GossipCompletionPool for indirect pings
+        void handlePing(const pf_gossip::PingRequest &request, pf_gossip::PingResponse *response,
+                        std::function<void()> done);
+
+        /// Merge membership changes piggybacked on a message. Peers are added, revived or removed on daemon thread
+        /// according to the changes.
+        /// \param updates Membership changes
+        void handleMemberUpdates(const google::protobuf::RepeatedPtrField<pf_gossip::MemberUpdate> &updates);
+
+        /// Record a heartbeat received from a peer node, its interval is sampled by the phi-accrual failure detector
+        /// of peer node.
+        /// \param name Name of peer node
+        void handlePeerHeartbeat(const std::string &name);
+
+        /// Record the versions of all slots reported by a peer node, used to garbage collect tombstones.
+        /// \param name Name of peer node
+        /// \param versions Versions of slots on peer node
+        void handlePeerVersions(const std::string &name, const SlotVersions &versions);
+
+        /// Collect membership changes to piggyback on a message.
+        /// \param updates Stores membership changes
+        /// \param receiver Name of receiver, whose own changes are sent first
+        void collectMembers(google::protobuf::RepeatedPtrField<pf_gossip::MemberUpdate> *updates,
+                            const std::string &receiver);
 
         /// Handle gossip peer node's new node notify. If the new node is not connected, this node will connect
         /// to it. Otherwise, this node will do nothing.
@@ -134,8 +263,8 @@ namespace gossip::server {
         bool handleNewNodeNotify(const std::string &name, const std::string &address, SlotVersion version,
                                  const ::pf_gossip::GossipNodeInfo *origin);
 
-        /// Handle gossip peer node's node delete notify. This node will set that node unhealthy and then check
-        /// its real status.
+        /// Handle gossip peer node's node delete notify. The node has left voluntarily, so it is declared dead at
+        /// once without being suspected.
         /// \param name The name of deleted node
         /// \param address The address of deleted node
         /// \param version The version of deleted node
@@ -166,31 +295,99 @@ namespace gossip::server {
         /// \param version New gossip node's version
         void startNewNodeNotify(const std::string &name, const std::string &address, SlotVersion version);
 
-        /// Add a retry task in gossip retry tasks.
+        /// Schedule a retry of failed rpc. The delay doubles on every attempt of the call, up to
+        /// GossipOptions::retry_max_backoff_ms.
         /// \param call A rpc async object
-        void addRetryTask(GossipPeerNode::AsyncClientCall<google::protobuf::Any, google::protobuf::Any> *call);
+        void addRetryTask(RetryCall *call);
 
     private:
 
-        /// Run daemon task of this gossip node.
+        /// Schedule periodic tasks of this gossip node, and run all scheduled tasks until the node is stopped.
         void DaemonTask();
 
-        /// Check the status of unhealthy gossip peer node. Node that is not communicated more than 30
-        /// seconds and is not attachable will be removed. This is to avoid some nodes ups and downs in a
-        /// short time eval and received its information more than one time.
-        void removeUnHealthyNode();
+        /// Pull slots to a node whose versions of them are lower than this node's. If peer node's version of a
+        /// slot is not known or a delta is not enough, merkle trees will be compared to only send differing key
+        /// ranges.
+        /// \param name Name of the lower node
+        /// \param slots Names of slots and their versions held by the lower node
+        void pullSlotsToLowerNode(const std::string &name, const std::vector<std::pair<std::string, SlotVersion>> &slots);
+
+        /// Ping the next peer of SWIM probe order. If it doesn't ack in time, it is pinged indirectly.
+        void startProbe();
+
+        /// Ask some other peers to ping a peer that doesn't ack a direct ping. The peer is suspected if none of
+        /// them receives an ack.
+        /// \param target Name of peer
+        void probeIndirectly(const std::string &target);
+
+        /// Suspect a peer that fails a probe, if its phi-accrual suspicion is high enough. It is declared dead if it
+        /// doesn't refute in time.
+        /// \param name Name of peer
+        void suspectMember(const std::string &name);
+
+        /// Declare a suspected peer dead when its suspicion times out. If its phi-accrual suspicion is still low,
+        /// the suspicion is extended by another timeout instead.
+        /// \param name Name of peer
+        /// \param incarnation Incarnation of peer when it was suspected
+        void confirmMember(const std::string &name, int64_t incarnation);
+
+        /// Apply membership changes to peers on daemon thread. Alive nodes are added or revived, dead nodes are
+        /// removed, and a timer is started for every suspected node.
+        /// \param changes Changed members
+        void applyMemberChanges(const std::vector<GossipMembership::Member> &changes);
+
+        /// Find a connected peer node that is not dead. Thread safe.
+        /// \param name Name of peer node
+        /// \return The peer node, or nullptr if it is not connected or is dead
+        GossipPeerNode *findPeer(const std::string &name);
+
+        /// Add a peer node, or revive it if it was removed as dead. Thread safe.
+        /// \param name Name of peer node
+        /// \param address Internal address of peer node
+        /// \param version Version of peer node
+        /// \return The peer node
+        GossipPeerNode *addPeer(const std::string &name, const std::string &address, SlotVersion version);
+
+        /// Start a push-pull anti-entropy round with a random peer node.
+        void startSync();
+
+        /// Merge an update into a slot. If request is a delta update, values will be merged into the slot in place.
+        /// \param target Slot to update
+        /// \param request Update whose K-V pairs are moved out of it into the slot
+        /// \return Updated slot version. If not updated, returns original version.
+        SlotVersion mergeUpdate(GossipSlot *target, pf_gossip::SlotUpdate *request);
 
-        /// Pull local slot to nodes whose version is lower than local version.
-        void pullSlotToLowerNode();
+        /// Merge encoded updates into slots without propagating them. Stale updates are skipped.
+        /// \param updates Wire bytes of SlotUpdates
+        void mergeUpdates(const google::protobuf::RepeatedPtrField<std::string> &updates);
 
-        /// Check the health of peer gossip node. If peer is down, transfer it to unhealthy_peers list.
-        void checkPeerHealth();
+        /// Gossip buffered local writes if their window has passed.
+        void doGossipTask();
 
-        /// Retry failed rpc.
-        void doRetryTask();
+        /// Apply a local write and record it in rumor buffer. The buffer is flushed at once if it is due,
+        /// otherwise a flush is scheduled at the end of its window.
+        /// \param write Function that writes local slot, records changes and returns new slot version
+        /// \return Slot version returned by write
+        template<class Write>
+        SlotVersion writeLocal(Write &&write);
 
+        /// Send all buffered local writes to randomly selected peer nodes as one update.
+        void flushRumors();
 
-        void doGossipTask();
+        /// Write a snapshot of local slot and delete write-ahead log before it, if local slot is changed since
+        /// last snapshot.
+        void checkpoint();
+
+        /// Write an image of all slots other than local slot, if any of them is changed since last image.
+        void writeImage();
+
+        /// Turn K-V pairs whose TTL has passed into tombstones, every replica does it by itself.
+        void expireMessages();
+
+        /// Garbage collect tombstones of every slot that all known peer nodes, including dead ones, have reported a
+        /// version past, or that are older than max tombstone age. Only the age is used if there is no known peer
+        /// node, or if some member has never been connected and can't report a version.
+        void collectTombstones();
 
         /// Random select a gossip node and returns its client's pointer.
         /// \return Ptr of selected GossipPeerNode
@@ -209,26 +406,33 @@ namespace gossip::server {
         GossipSlot *local_slot_;    // 本地slot指针
         std::string internal_address_, external_address_;   // 内外地址
         std::string token_;
-        size_t mem_use_ = 0;    // 记录当前的数据库内存使用
+        GossipOptions options_;
 
-        std::unordered_map<std::string, GossipSlot> slots_;    // gossip 节点所维护的数据表
+        GossipSlotRegistry slots_;    // gossip 节点所维护的数据表，可以被多个 rpc 线程并发访问
 
 
+        // rpc 线程、完成队列线程与守护线程都会访问 peer，修改很少，读取时只需要共享锁。
+        // peer 对象从不释放，解锁之后仍然可以使用查找到的指针
+        mutable std::shared_mutex peers_mtx_;
         std::unordered_map<std::string, server::GossipPeerNode *> peers_;  // 用来存储已连接的 gossip node
-        std::vector<GossipPeerNode *> peers_list_;  // 用于随机选择 node
-        std::list<GossipPeerNode *> unhealthy_peers_;
+        std::vector<GossipPeerNode *> peers_list_;  // 用于随机选择 node，死亡的节点也会保留，重新加入时复用
 
-        std::mutex ls_mtx;  // 用于保护lower_slots
-        std::list<std::string> lower_slots;    // 通过心跳包可以看到有哪些节点的版本是较低的
+        GossipMembership membership_;   // SWIM 成员列表
 
-        std::mutex mtx;
-        std::list<RetryCall *> retry_list_;
+        std::mutex rumor_mtx_;  // 保护 rumors_，本地写入也在这个锁内完成
+        GossipRumorBuffer rumors_;  // 等待传播的本地写入
+        std::unique_ptr<GossipStore> store_;    // 本地 slot 的预写日志与快照，没有设置数据目录时为空
+        SlotVersions image_versions_;   // 上一次写入镜像时各个 slot 的版本，只在调度线程中访问
+        GossipExpiryWheel expiry_;      // 所有 slot 中带 TTL 的键值对，按过期时间排列
+
+        GossipScheduler scheduler_;     // 心跳、重试、健康检查与 slot 拉取都是其中独立的定时任务
 
         grpc::Service *internal_service_, *external_service_;  // 用于构建 gossip 服务
         std::unique_ptr<grpc::Server> internal_server, external_server;
 
         std::thread th1_, th2_;
-        bool quit = false;
+
+        std::unique_ptr<GossipCompletionPool> completion_pool_;  // 所有 peer 节点共享的异步 rpc 完成队列
     };
 
 
@@ -0,0 +1,143 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPOPTIONS_H
+#define GOSSIP_GOSSIPOPTIONS_H
+
+#include <cstddef>
+#include <string>
+
+namespace gossip::server {
+
+    /// @brief Tunable options of a GossipNode, fixed at construction.
+    struct GossipOptions {
+
+        /// How the peer service handles rpc.
+        enum class ServiceMode {
+            Sync,       // grpc 同步模型，每个进行中的 rpc 占用一个 grpc 线程
+            Callback,   // grpc 回调模型，耗时的请求交给有界的线程池处理
+        };
+
+        /// When a local write is durable in write-ahead log.
+        enum class Durability {
+            Sync,       // 每次写入立即 fsync 后才返回，并发的写入共享同一次 fsync
+            Batched,    // 写入等待下一次批量 fsync 后返回
+            Async,      // 写入不等待 fsync，崩溃时可能丢失最后一个批量周期内的写入
+        };
+
+        /// Service model of peer node service.
+        ServiceMode service_mode = ServiceMode::Sync;
+
+        /// Service model of gossip client service.
+        ServiceMode cli_service_mode = ServiceMode::Sync;
+
+        /// Number of handler threads of every service in callback mode.
+        size_t handler_threads = 4;
+
+        /// Number of completion queues and polling threads shared by all peer nodes. If 0, use the number of
+        /// cores.
+        size_t completion_threads = 0;
+
+        /// Max number of queued requests of every service in callback mode. Requests beyond it are rejected with
+        /// RESOURCE_EXHAUSTED.
+        size_t handler_queue_size = 1024;
+
+        /// Max time in milliseconds a local write waits before it is gossiped. Writes in this window are coalesced
+        /// into one update per peer. If 0, every write is gossiped immediately.
+        size_t rumor_window_ms = 10;
+
+        /// Number of buffered local writes that are gossiped at once without waiting for the window.
+        size_t rumor_max_writes = 128;
+
+        /// Interval in milliseconds between two heartbeats sent to a random peer.
+        size_t heartbeat_interval_ms = 5000;
+
+        /// Interval in milliseconds between two push-pull anti-entropy rounds with a random peer. If 0, no round
+        /// is started by this node.
+        size_t sync_interval_ms = 1000;
+
+        /// Interval in milliseconds between two SWIM probes. Every probe pings one peer, and peers are probed in
+        /// turn.
+        size_t probe_interval_ms = 1000;
+
+        /// Time in milliseconds to wait for the ack of a direct ping before asking other peers to ping indirectly.
+        size_t probe_timeout_ms = 300;
+
+        /// Number of peers asked to ping a peer that doesn't ack a direct ping.
+        size_t indirect_probes = 3;
+
+        /// Time in milliseconds a suspected peer has to refute before it is declared dead.
+        size_t suspect_timeout_ms = 3000;
+
+        /// Max number of membership changes piggybacked on one message.
+        size_t max_piggyback = 8;
+
+        /// A peer that fails a SWIM probe is only suspected if its phi-accrual suspicion reaches this level. If 0,
+        /// every failed probe suspects the peer.
+        double phi_suspect_threshold = 8;
+
+        /// A suspected peer is only declared dead if its phi-accrual suspicion reaches this level, otherwise the
+        /// suspicion is extended. If 0, a peer is declared dead when its suspicion times out.
+        double phi_dead_threshold = 12;
+
+        /// Number of heartbeat intervals of every peer kept by phi-accrual failure detector.
+        size_t phi_window = 200;
+
+        /// Min standard deviation in milliseconds of heartbeat intervals, so phi of a very regular peer doesn't
+        /// rise too fast.
+        size_t phi_min_stddev_ms = 100;
+
+        /// Directory of write-ahead log and snapshot of local slot, and of the image of all other slots. If empty,
+        /// nothing is persisted and a restarted node starts with empty slots.
+        std::string data_dir;
+
+        /// When a local write is durable.
+        Durability durability = Durability::Batched;
+
+        /// Max delay in milliseconds of a batched fsync of write-ahead log.
+        size_t wal_sync_interval_ms = 2;
+
+        /// Interval in milliseconds between two snapshots of local slot, write-ahead log before a snapshot is
+        /// deleted. A snapshot is only written if local slot is changed.
+        size_t snapshot_interval_ms = 60000;
+
+        /// Interval in milliseconds between two memory mapped images of all slots other than local slot. A
+        /// restarted node maps the image and only fetches deltas of slots that have changed since. An image is
+        /// only written if any slot is changed. If 0, no image is written.
+        size_t image_interval_ms = 60000;
+
+        /// Max number of K-V pairs in one message of a streaming scan.
+        size_t scan_chunk_size = 1000;
+
+        /// Resolution in milliseconds of expiration of K-V pairs written with a TTL. Reads never see an expired K-V
+        /// pair, it is turned into a tombstone within one tick after its expiration. If 0, expired K-V pairs are
+        /// hidden from reads but never turned into tombstones.
+        size_t expiry_tick_ms = 100;
+
+        /// Max time in milliseconds a received version may be ahead of wall clock. Updates further ahead come from a
+        /// node with a wrong clock, they are rejected and don't advance the clock. The clock is shared by all nodes
+        /// of a process, the last constructed node sets it. If 0, any version is accepted.
+        size_t max_clock_drift_ms = 60000;
+
+        /// Interval in milliseconds between two garbage collections of tombstones. A tombstone is collected once all
+        /// known peers have reported a slot version not older than it. If 0, tombstones are never collected.
+        size_t tombstone_gc_interval_ms = 1000;
+
+        /// Max time in milliseconds a tombstone is kept while some peer hasn't reported its version, so a peer that
+        /// doesn't report can't keep tombstones forever. Peers behind a collected tombstone receive a full slot
+        /// update. Dead peers are waited for as well, and a node without peers collects tombstones only by age. If 0,
+        /// tombstones wait for all peers.
+        size_t tombstone_max_age_ms = 600000;
+
+        /// Delay in milliseconds before the first retry of a failed rpc. It doubles on every retry.
+        size_t retry_backoff_ms = 100;
+
+        /// Max delay in milliseconds between two retries of a failed rpc.
+        size_t retry_max_backoff_ms = 10000;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPOPTIONS_H
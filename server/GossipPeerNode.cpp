@@ -4,9 +4,11 @@
 
 #include "GossipPeerNode.h"
 #include "GossipNode.h"
+#include "GossipSlotCodec.h"
 #include "Gossip.pb.h"
 
 #include <grpcpp/grpcpp.h>
+#include <memory>
 #include <utility>
 
 
@@ -14,55 +16,234 @@ namespace gossip::server {
 
     GossipPeerNode::GossipPeerNode(std::string name, std::string address, SlotVersion version, GossipNode *node)
             : name_(std::move(name)), address_(std::move(address)), version_(version), node_(node),
-              timestamp_(time(nullptr)), alive_(true) {
+              timestamp_(time(nullptr)), alive_(true),
+              detector_(std::chrono::milliseconds(node->options().probe_interval_ms), node->options().phi_window,
+                        std::chrono::milliseconds(node->options().phi_min_stddev_ms)) {
+
+        auto channel = grpc::CreateChannel(address_, grpc::InsecureChannelCredentials());
+        stub_ = Gossip::NewStub(channel);
+        update_stub_ = std::make_unique<grpc::TemplatedGenericStub<grpc::ByteBuffer, pf_gossip::updateResult>>(channel);
+        rpc_queue = node_->completionPool()->assign();
+    }
+
+    GossipPeerNode::~GossipPeerNode() = default;
+
 
-        stub_ = Gossip::NewStub(grpc::CreateChannel(address_, grpc::InsecureChannelCredentials()));
-        async_th_ = std::thread([this] { receiveResult(); });
+    // 发起用的接口，因为这里默认每个结点只会发送自己的slot
+    void GossipPeerNode::pull() {
+        pull(node_->localSlot(), known_version_.load());
     }
 
-    GossipPeerNode::~GossipPeerNode() {
-        rpc_queue.Shutdown();
+    void GossipPeerNode::pull(const GossipSlot *slot, SlotVersion known) {
+
+        // 对方的版本已知并且之后没有无法增量传播的变化时，只需要发送增量
+        bool delta = known > 0 && known >= slot->fullSyncVersion();
+        auto since = delta ? known : 0;
+
+        // 直接从固定的快照编码，不需要复制整个 slot
+        auto snapshot = slot->snapshot();
+        pf_gossip::SlotUpdate header;
+        header.set_name(slot->name());
+        header.set_version(snapshot->version);
+        header.set_delta(delta);
+        header.set_base_version(since);
+        header.add_pass_nodes(node_->NodeName());
 
-        if (async_th_.joinable())
-            async_th_.join();
+        pull(GossipSlotCodec::encode(header, *snapshot, [since](const std::string &, const SlotEntry &entry) {
+            return entry.version > since;
+        }), slot == node_->localSlot());
     }
 
+    void GossipPeerNode::pull(const grpc::ByteBuffer &update, bool local) {
 
-    // 发起用的接口，因为这里默认每个结点只会发送自己的slot
-    void GossipPeerNode::pull(const pf_gossip::SlotUpdate *origin) {
+        auto rpc_call = AsyncClientCall<grpc::ByteBuffer, pf_gossip::updateResult>::acquire(this);
 
-        auto rpc_call = new AsyncClientCall<pf_gossip::SlotUpdate, pf_gossip::updateResult>();
+        // 只增加 slice 的引用计数，不会复制数据
+        *rpc_call->input_ = update;
 
-        if (origin != nullptr) {
-            rpc_call->input_->MergeFrom(*origin);
+        rpc_call->reader_ = update_stub_->PrepareUnaryCall(rpc_call->context(), GossipSlotCodec::kPullMethod,
+                                                           *rpc_call->input_, rpc_queue);
+        rpc_call->cb_ = [rpc_call, local]() {
+            // 记录对方节点所持有的本地 slot 版本，重试可能发送给了其他节点，记录在实际应答的节点上
+            if (local && rpc_call->reply_->version() > 0)
+                rpc_call->owner_->known_version_ = rpc_call->reply_->version();
+        };
 
-        } else {
-            auto slot = node_->localSlot();
+        rpc_call->retry_ = [rpc_call](GossipPeerNode *cli) {
+            rpc_call->reader_ = cli->update_stub_->PrepareUnaryCall(rpc_call->context(), GossipSlotCodec::kPullMethod,
+                                                                    *rpc_call->input_, cli->rpc_queue);
+            rpc_call->start();
+        };
+
+        rpc_call->start();
+
+    }
+
+    void GossipPeerNode::syncDigest(const GossipSlot *slot, std::function<void(bool)> done) {
+
+        auto walk = std::make_shared<DigestWalk>();
+        walk->slot = slot == nullptr ? node_->localSlot() : slot;
+        walk->nodes = {GossipMerkleTree::kRoot};
+        walk->version = walk->slot->version();
+        walk->done = std::move(done);
+
+        digestLevel(std::move(walk));
+    }
+
+    void GossipPeerNode::digestLevel(std::shared_ptr<DigestWalk> walk) {
+
+        // 所有不同的节点都已经比较到叶子节点，发送这些叶子节点范围内的键值对
+        if (walk->nodes.empty()) {
+            digestLeaves(std::move(walk));
+            return;
+        }
+
+        auto [hashes, current] = walk->slot->digest(walk->nodes);
+        if (walk->nodes.size() == 1 && walk->nodes[0] == GossipMerkleTree::kRoot)
+            walk->version = current;
 
-            rpc_call->input_->set_name(slot->name());
-            rpc_call->input_->set_version(slot->version());
+        auto rpc_call = AsyncClientCall<pf_gossip::DigestRequest, pf_gossip::DigestResponse>::acquire(this);
 
-            for (auto &m: slot->messages()) {
-                auto message = rpc_call->input_->add_messages();
-                message->set_key(m.first);
-                message->set_value(m.second);
+        rpc_call->input_->set_name(walk->slot->name());
+        rpc_call->input_->set_version(walk->version);
+        for (size_t i = 0; i < walk->nodes.size(); i++) {
+            auto node = rpc_call->input_->add_nodes();
+            node->set_index(walk->nodes[i]);
+            node->set_hash(hashes[i]);
+        }
+        rpc_call->context()->set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(2));
+
+        rpc_call->reader_ = stub_->PrepareAsyncsyncDigest(rpc_call->context(), *rpc_call->input_, rpc_queue);
+        rpc_call->cb_ = [rpc_call, this, walk]() {
+            // 从根节点开始逐层比较，只继续比较哈希值不同节点的子节点
+            walk->nodes.clear();
+            for (auto index: rpc_call->reply_->differs()) {
+                if (GossipMerkleTree::isLeaf(index)) {
+                    walk->leaves.emplace_back(GossipMerkleTree::leafIndex(index));
+                } else {
+                    walk->nodes.emplace_back(2 * index);
+                    walk->nodes.emplace_back(2 * index + 1);
+                }
             }
+            digestLevel(walk);
+        };
+        rpc_call->fail_ = [walk]() {
+            walk->done(false);
+        };
+
+        rpc_call->start();
+    }
+
+    void GossipPeerNode::digestLeaves(std::shared_ptr<DigestWalk> walk) {
+
+        pf_gossip::SlotUpdate header;
+        header.set_name(walk->slot->name());
+        header.set_version(walk->version);
+        header.add_pass_nodes(node_->NodeName());
+        for (auto leaf: walk->leaves)
+            header.add_leaves(leaf);
+
+        // 两边的键值对完全相同时，只需要让对方更新 slot 版本
+        if (walk->leaves.empty())
+            header.set_delta(true);
+
+        auto rpc_call = AsyncClientCall<grpc::ByteBuffer, pf_gossip::updateResult>::acquire(this);
+
+        *rpc_call->input_ = GossipSlotCodec::encodeLeaves(header, *walk->slot->snapshot(), walk->leaves);
+        rpc_call->context()->set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(2));
+
+        rpc_call->reader_ = update_stub_->PrepareUnaryCall(rpc_call->context(), GossipSlotCodec::kPullMethod,
+                                                           *rpc_call->input_, rpc_queue);
+        rpc_call->cb_ = [rpc_call, this, walk]() {
+            if (walk->slot == node_->localSlot() && rpc_call->reply_->version() > 0)
+                known_version_ = rpc_call->reply_->version();
+            walk->done(true);
+        };
+        rpc_call->fail_ = [walk]() {
+            walk->done(false);
+        };
+
+        rpc_call->start();
+    }
+
+    void GossipPeerNode::syncSlots() {
+
+        auto rpc_call = AsyncClientCall<pf_gossip::SyncRequest, pf_gossip::SyncResponse>::acquire(this);
+
+        rpc_call->input_->set_node_name(node_->NodeName());
+        node_->collectVersions(rpc_call->input_->mutable_slots());
+        node_->collectMembers(rpc_call->input_->mutable_members(), name_);
+
+        // 按照上一轮得知的版本推送对方落后的 slot，第一轮不知道对方的版本，只进行拉取
+        SlotVersions known;
+        {
+            std::lock_guard<std::mutex> lg(versions_mtx_);
+            known = peer_versions_;
         }
+        if (!known.empty())
+            node_->encodeSlots(node_->slotsBehind(name_, known, true), rpc_call->input_->mutable_updates());
 
-        rpc_call->input_->add_pass_nodes(node_->NodeName());
+        rpc_call->reader_ = stub_->PrepareAsyncsyncSlots(rpc_call->context(), *rpc_call->input_, rpc_queue);
+        rpc_call->cb_ = [rpc_call, this]() {
 
-        rpc_call->reader_ = stub_->PrepareAsyncpull(&rpc_call->context_, *rpc_call->input_, &rpc_queue);
-        rpc_call->cb_ = []() {
-            return;
+            beat();
+
+            SlotVersions versions;
+            for (auto &entry: rpc_call->reply_->slots())
+                versions.emplace(entry.name(), entry.version());
+
+            auto local = versions.find(node_->localSlot()->name());
+            if (local != versions.end())
+                known_version_ = local->second;
+
+            node_->handleSyncResponse(name_, *rpc_call->reply_, versions);
+            acknowledge(versions);
+
+            std::lock_guard<std::mutex> lg(versions_mtx_);
+            peer_versions_ = std::move(versions);
         };
 
-        rpc_call->retry_ = [rpc_call](GossipPeerNode *cli) {
-            rpc_call->reader_ = cli->stub_->PrepareAsyncpull(&rpc_call->context_, *rpc_call->input_, &cli->rpc_queue);
-            rpc_call->start();
+        rpc_call->start();
+    }
+
+    void GossipPeerNode::ping(const std::string &target, std::chrono::milliseconds timeout,
+                              std::function<void(bool)> done) {
+
+        auto rpc_call = AsyncClientCall<pf_gossip::PingRequest, pf_gossip::PingResponse>::acquire(this);
+
+        rpc_call->input_->set_node_name(node_->NodeName());
+        rpc_call->input_->set_target(target);
+        rpc_call->input_->set_timeout_ms(timeout.count());
+        node_->collectMembers(rpc_call->input_->mutable_members(), target.empty() ? name_ : target);
+
+        // 间接探测时对方需要再等待目标节点应答，超时后视为没有应答，不进行重试
+        auto wait = target.empty() ? timeout : 2 * timeout;
+        rpc_call->context()->set_deadline(std::chrono::system_clock::now() + wait);
+
+        rpc_call->reader_ = stub_->PrepareAsyncping(rpc_call->context(), *rpc_call->input_, rpc_queue);
+        rpc_call->cb_ = [rpc_call, this, target, done]() {
+            // 间接探测的应答需要等待目标节点，不作为对方的心跳
+            if (target.empty())
+                beat();
+            node_->handleMemberUpdates(rpc_call->reply_->members());
+            done(rpc_call->reply_->ack());
+        };
+        rpc_call->fail_ = [done]() {
+            done(false);
         };
 
         rpc_call->start();
+    }
+
+    void GossipPeerNode::acknowledge(const SlotVersions &versions) {
+        std::lock_guard<std::mutex> lg(versions_mtx_);
+        acked_versions_ = versions;
+    }
 
+    SlotVersion GossipPeerNode::acknowledged(const std::string &slot) const {
+        std::lock_guard<std::mutex> lg(versions_mtx_);
+        auto it = acked_versions_.find(slot);
+        return it == acked_versions_.end() ? 0 : it->second;
     }
 
     std::string GossipPeerNode::search(const std::string &key) {
@@ -84,20 +265,19 @@ namespace gossip::server {
 
     void GossipPeerNode::heartBeat() {
 
-        auto rpc_call = new AsyncClientCall<pf_gossip::NodeVersions, pf_gossip::NodeVersions>();
-
-        auto slot = node_->localSlot();
+        auto rpc_call = AsyncClientCall<pf_gossip::NodeVersions, pf_gossip::NodeVersions>::acquire(this);
 
-        rpc_call->input_->set_node_name(node_->NodeName());
-        rpc_call->input_->set_slot_name(slot->name());
-        rpc_call->input_->set_slot_version(slot->version());
+        node_->collectVersions(rpc_call->input_);
+        node_->collectMembers(rpc_call->input_->mutable_members(), name_);
 
-
-        rpc_call->reader_ = stub_->PrepareAsyncheartBeat(&rpc_call->context_, *rpc_call->input_, &rpc_queue);
+        rpc_call->reader_ = stub_->PrepareAsyncheartBeat(rpc_call->context(), *rpc_call->input_, rpc_queue);
         rpc_call->cb_ = [rpc_call, this]() {
 
-            node_->handleHeartbeatRequest(rpc_call->reply_->node_name(), rpc_call->reply_->slot_name(),
-                                          rpc_call->reply_->slot_version());
+            beat();
+            known_version_ = rpc_call->reply_->slot_version();
+
+            // 对方落后的 slot 由本节点发送，本节点落后的 slot 由对方在收到请求时发送
+            node_->handleHeartbeatRequest(*rpc_call->reply_, nullptr);
 
         };
 
@@ -106,14 +286,14 @@ namespace gossip::server {
 
     void GossipPeerNode::newNodeNotify(const std::string &name, const std::string &address, SlotVersion version) {
 
-        auto rpc_call = new AsyncClientCall<pf_gossip::GossipNodeInfo, pf_gossip::updateResult>();
+        auto rpc_call = AsyncClientCall<pf_gossip::GossipNodeInfo, pf_gossip::updateResult>::acquire(this);
 
         rpc_call->input_->set_name(name);
         rpc_call->input_->set_address(address);
         rpc_call->input_->set_version(version);
 
 
-        rpc_call->reader_ = stub_->PrepareAsyncnewNodeNotify(&rpc_call->context_, *rpc_call->input_, &rpc_queue);
+        rpc_call->reader_ = stub_->PrepareAsyncnewNodeNotify(rpc_call->context(), *rpc_call->input_, rpc_queue);
         rpc_call->cb_ = []() {
             return;
         };
@@ -122,7 +302,7 @@ namespace gossip::server {
     }
 
     void GossipPeerNode::newNodeNotify(const pf_gossip::GossipNodeInfo *origin) {
-        auto rpc_call = new AsyncClientCall<pf_gossip::GossipNodeInfo, pf_gossip::updateResult>();
+        auto rpc_call = AsyncClientCall<pf_gossip::GossipNodeInfo, pf_gossip::updateResult>::acquire(this);
 
         if (origin != nullptr) {
             rpc_call->input_->MergeFrom(*origin);
@@ -130,7 +310,7 @@ namespace gossip::server {
 
         rpc_call->input_->add_pass_nodes(node_->NodeName());
 
-        rpc_call->reader_ = stub_->PrepareAsyncnewNodeNotify(&rpc_call->context_, *rpc_call->input_, &rpc_queue);
+        rpc_call->reader_ = stub_->PrepareAsyncnewNodeNotify(rpc_call->context(), *rpc_call->input_, rpc_queue);
         rpc_call->cb_ = []() {
             return;
         };
@@ -143,14 +323,14 @@ namespace gossip::server {
 
     void
     GossipPeerNode::deleteNodeNotify(const std::string &name, const std::string &address, SlotVersion version) {
-        auto rpc_call = new AsyncClientCall<pf_gossip::GossipNodeInfo, pf_gossip::updateResult>();
+        auto rpc_call = AsyncClientCall<pf_gossip::GossipNodeInfo, pf_gossip::updateResult>::acquire(this);
 
         rpc_call->input_->set_name(name);
         rpc_call->input_->set_address(address);
         rpc_call->input_->set_version(version);
 
 
-        rpc_call->reader_ = stub_->PrepareAsyncdeleteNodeNotify(&rpc_call->context_, *rpc_call->input_, &rpc_queue);
+        rpc_call->reader_ = stub_->PrepareAsyncdeleteNodeNotify(rpc_call->context(), *rpc_call->input_, rpc_queue);
         rpc_call->cb_ = []() {
             return;
         };
@@ -160,7 +340,7 @@ namespace gossip::server {
     }
 
     void GossipPeerNode::deleteNodeNotify(const pf_gossip::GossipNodeInfo *origin) {
-        auto rpc_call = new AsyncClientCall<pf_gossip::GossipNodeInfo, pf_gossip::updateResult>();
+        auto rpc_call = AsyncClientCall<pf_gossip::GossipNodeInfo, pf_gossip::updateResult>::acquire(this);
 
 
         if (origin != nullptr) {
@@ -168,7 +348,7 @@ namespace gossip::server {
         }
 
 
-        rpc_call->reader_ = stub_->PrepareAsyncdeleteNodeNotify(&rpc_call->context_, *rpc_call->input_, &rpc_queue);
+        rpc_call->reader_ = stub_->PrepareAsyncdeleteNodeNotify(rpc_call->context(), *rpc_call->input_, rpc_queue);
         rpc_call->cb_ = []() {
             return;
         };
@@ -197,56 +377,95 @@ namespace gossip::server {
         return response.name();
     }
 
-    void GossipPeerNode::receiveResult() {
-        void *got_tag;
-        bool ok = false;
-
-        // Block until the next result is available in the completion queue "cq".
-        while (rpc_queue.Next(&got_tag, &ok)) {
-            // The tag in this example is the memory location of the call object
-            auto call = static_cast<AsyncClientCall<google::protobuf::Any, google::protobuf::Any> *>(got_tag);
+    void GossipPeerNode::receiveResult(AsyncCall *call) {
 
-            if (call->status_.ok()) {
+        if (call->status_.ok()) {
 
-                updateTimestamp();
-
-                call->cb_();
-
-                // Once we're complete, deallocate the call object.
-                delete call;
+            updateTimestamp();
 
-            } else {
+            call->cb_();
 
-                std::cerr << "PeerNode " << name_ << " " << address_ << std::endl;
-                std::cerr << "RPC failed, reason: " << call->status_.error_code() << std::endl;
+            // Once we're complete, return the call object to its pool.
+            call->release();
 
-                if (call->status_.error_code() == grpc::UNAVAILABLE) {
-                    alive_ = false;
-                }
+        } else {
 
-                // 如果没有绑定retry，那么进行删除
-                if (!call->retry_) {
-                    delete call;
-                } else {
-                    node_->addRetryTask(call);
-                }
+            std::cerr << "PeerNode " << name_ << " " << address_ << std::endl;
+            std::cerr << "RPC failed, reason: " << call->status_.error_code() << std::endl;
 
+            // 对方是否存活由 SWIM 探测判断，单次 rpc 失败只进行重试
+            // 如果没有绑定retry，那么进行删除
+            if (!call->retry_) {
+                if (call->fail_)
+                    call->fail_();
+                call->release();
+            } else {
+                node_->addRetryTask(call);
             }
 
-
         }
     }
 
     template<class Input, class Output>
-    GossipPeerNode::AsyncClientCall<Input, Output>::AsyncClientCall() {
-        input_ = new Input;
-        reply_ = new Output;
+    std::mutex GossipPeerNode::AsyncClientCall<Input, Output>::pool_mtx_;
+
+    template<class Input, class Output>
+    std::vector<GossipPeerNode::AsyncClientCall<Input, Output> *> GossipPeerNode::AsyncClientCall<Input, Output>::pool_;
+
+    template<class Input, class Output>
+    GossipPeerNode::AsyncClientCall<Input, Output>::AsyncClientCall() : arena_([this] {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = block_;
+        options.initial_block_size = kArenaBlockSize;
+        return options;
+    }()) {}
+
+    template<class Input, class Output>
+    GossipPeerNode::AsyncClientCall<Input, Output> *
+    GossipPeerNode::AsyncClientCall<Input, Output>::acquire(GossipPeerNode *owner) {
+        AsyncClientCall *call = nullptr;
+        {
+            std::lock_guard<std::mutex> lg(pool_mtx_);
+            if (!pool_.empty()) {
+                call = pool_.back();
+                pool_.pop_back();
+            }
+        }
+        if (call == nullptr)
+            call = new AsyncClientCall;
+
+        call->owner_ = owner;
+        call->context_.emplace();
+        // 编码好的请求是 grpc::ByteBuffer，不是 protobuf 消息
+        call->input_ = google::protobuf::Arena::Create<Input>(&call->arena_);
+        call->reply_ = google::protobuf::Arena::CreateMessage<Output>(&call->arena_);
+        return call;
     }
 
     template<class Input, class Output>
-    GossipPeerNode::AsyncClientCall<Input, Output>::~AsyncClientCall() {
-        delete input_;
-        delete reply_;
+    void GossipPeerNode::AsyncClientCall<Input, Output>::release() {
+        reader_.reset();
+        context_.reset();
+        status_ = {};
+        cb_ = nullptr;
+        retry_ = nullptr;
+        fail_ = nullptr;
+        owner_ = nullptr;
+        attempts_ = 0;
+
+        // 消息都分配在 arena 上，重置后只保留初始内存块
+        input_ = nullptr;
+        reply_ = nullptr;
+        arena_.Reset();
+
+        {
+            std::lock_guard<std::mutex> lg(pool_mtx_);
+            if (pool_.size() < kPoolSize) {
+                pool_.emplace_back(this);
+                return;
+            }
+        }
+        delete this;
     }
 
     template<class Input, class Output>
@@ -256,7 +475,7 @@ namespace gossip::server {
             return;
         }
         reader_->StartCall();
-        reader_->Finish(reply_, &status_, (void *) this);
+        reader_->Finish(reply_, &status_, static_cast<AsyncCall *>(this));
     }
 
 
@@ -6,9 +6,20 @@
 #define GOSSIP_GOSSIPPEERNODE_H
 
 #include "Gossip.grpc.pb.h"
+#include "GossipPhiDetector.h"
 #include "GossipSlot.h"
+#include <google/protobuf/arena.h>
+#include <grpcpp/generic/generic_stub.h>
 #include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <thread>
+#include <vector>
 
 namespace gossip::server {
 
@@ -29,7 +40,7 @@ namespace gossip::server {
         /// \param node The owner node of this class
         explicit GossipPeerNode(std::string name, std::string address, SlotVersion version, GossipNode *node);
 
-        /// Destructor of GossipPeerNode, it will release thread and grpc channel.
+        /// Destructor of GossipPeerNode, it will release grpc channel. Pending rpc of this peer must have finished.
         ~GossipPeerNode();
 
         /// Get the name of peer node.
@@ -50,12 +61,61 @@ namespace gossip::server {
             return version_;
         }
 
-        /// Async. Send a pull request to connected peer node. The node will check the slot message, if sender has a
-        /// higher version, it will update slot and then propagate pull request.
-        /// If pull request is failed because of rpc disconnection, it will retry.
-        /// \param origin Sender's slot information
-        void pull(const pf_gossip::SlotUpdate *origin);
+        /// Get the version of local slot that peer node is known to have. It is updated by heartbeat and pull
+        /// responses, and 0 means unknown.
+        /// \return Known version of local slot on peer node
+        SlotVersion knownVersion() const {
+            return known_version_;
+        }
 
+        /// Record the versions of all slots reported by peer node in heartbeat or syncSlots, replacing the last
+        /// report.
+        /// \param versions Versions of slots on peer node
+        void acknowledge(const SlotVersions &versions);
+
+        /// Get the version of a slot last reported by peer node. Tombstones not newer than it have reached peer
+        /// node.
+        /// \param slot Slot name
+        /// \return Reported version, 0 if peer node hasn't reported it
+        SlotVersion acknowledged(const std::string &slot) const;
+
+        /// Async. Send local slot to connected peer node. Only K-V pairs changed after the known version of peer
+        /// node will be sent if possible, otherwise the whole slot will be sent. K-V pairs are encoded straight
+        /// from a snapshot of local slot.
+        void pull();
+
+        /// Async. Send a slot to connected peer node. Only K-V pairs changed after the version held by peer node
+        /// will be sent if possible, otherwise the whole slot will be sent.
+        /// \param slot Slot to send, local slot or a copy of another node's slot
+        /// \param known Version of the slot held by peer node, 0 means unknown
+        void pull(const GossipSlot *slot, SlotVersion known);
+
+        /// Async. Send an encoded pull request to connected peer node. The node will check the slot message, if
+        /// sender has a higher version, it will update slot and then propagate pull request.
+        /// If pull request is failed because of rpc disconnection, it will retry.
+        /// \param update Wire bytes of SlotUpdate, which can be shared by many peers without copying
+        /// \param local If update carries local slot, the version replied by peer node is recorded
+        void pull(const grpc::ByteBuffer &update, bool local);
+
+        /// Async. Compare the merkle tree of a slot with peer node level by level, and then send K-V pairs in
+        /// differing leaves to peer node. Every level is an async rpc, so no thread waits for the walk. Only
+        /// differing key ranges are transferred, and deletions are also synchronized.
+        /// \param slot Slot to synchronize, local slot if nullptr
+        /// \param done Called on a polling thread of GossipCompletionPool with whether synchronization succeed
+        void syncDigest(const GossipSlot *slot, std::function<void(bool)> done);
+
+        /// Async. Start a push-pull anti-entropy round with connected peer node in one rpc. The request carries
+        /// the versions of all slots of this node and the slots that peer node was behind on in last round, and
+        /// the response carries the slots that this node is behind on. Slots that peer node is still behind on
+        /// are pulled to it at once.
+        void syncSlots();
+
+        /// Async. Send a SWIM ping to connected peer node, membership changes are piggybacked on the ping and its
+        /// ack. If target is set, peer node is asked to ping target node and reply whether target node acks.
+        /// \param target Name of node to ping indirectly, or empty to ping peer node itself
+        /// \param timeout Time to wait for the ack
+        /// \param done Called with whether an ack is received
+        void ping(const std::string &target, std::chrono::milliseconds timeout, std::function<void(bool)> done);
 
         /// Search message on peer node. if message is found, returns the owner slot of this message
         /// \param key The key of message
@@ -72,7 +132,8 @@ namespace gossip::server {
         /// \return If connection is established, returns {}. Otherwise, returns error information
         std::string establishConnection();
 
-        /// Async. Send a heartbeat request to connected peer node and share slot version.
+        /// Async. Send a heartbeat request to connected peer node and share the versions of all slots. Both nodes
+        /// then send the slots that the other one is behind on.
         void heartBeat();
 
         /// Async. Send a new node notify request to connected peer node. Peer node will check
@@ -105,83 +166,177 @@ namespace gossip::server {
             return timestamp_;
         }
 
-        /// Get alive status of peer node. If a rpc is not response, the peer node will be set not alive.
+        /// Record a heartbeat of peer node. Its interval since last heartbeat is sampled by the phi-accrual failure
+        /// detector. SWIM pings and acks, heartbeats and anti-entropy rounds are heartbeats.
+        void beat() {
+            timestamp_ = time(nullptr);
+            detector_.heartbeat();
+        }
+
+        /// Get the phi-accrual suspicion of peer node. It rises with the time since peer node was last heard,
+        /// relative to its usual heartbeat intervals.
+        /// \return Phi of peer node
+        double phi() const {
+            return detector_.phi();
+        }
+
+        /// Get alive status of peer node. It is set by SWIM failure detection of the owner node.
         /// \return Is peer node alive
         bool isAlive() const {
             return alive_;
         }
 
-        /// Set peer node manually. The alive status will also be updated by this class automatically.
+        /// Set peer node alive when it joins or refutes a suspicion.
+        void setAlive() {
+            alive_ = true;
+        }
+
+        /// Set peer node not alive when it is declared dead.
         void setNotAlive() {
             alive_ = false;
         }
 
+        /// Forward declaration, see below.
+        struct AsyncCall;
+
         /// @brief GRPC Asynchronous invocation class.
-        /// @details Handle the async rpc result in daemon thread. If rpc is succeed, the callback of AsyncClientCall
-        /// will run. Otherwise, the retry function of AsyncClientCall will run.
-        /// @note All AsyncClientCall should be deleted in this function.
-        void receiveResult();
+        /// @details Handle the async rpc result of this peer. It is called by the polling threads of
+        /// GossipCompletionPool. If rpc is succeed, the callback of AsyncClientCall will run. Otherwise, the retry
+        /// function of AsyncClientCall will run.
+        /// @note All AsyncClientCall should be released in this function.
+        /// \param call Finished rpc whose owner is this peer
+        void receiveResult(AsyncCall *call);
+
+        /// Class AsyncCall is the base of all AsyncClientCall and is used as the tag of completion queue, so that
+        /// rpc results can be handled and released without knowing their input and output types.
+        struct AsyncCall {
+            /// The context of rpc, constructed in place for every attempt
+            std::optional<grpc::ClientContext> context_;
+            /// The status of rpc
+            grpc::Status status_;
+            /// function to handle rpc output
+            std::function<void()> cb_ = {};
+            /// retry function
+            std::function<void(GossipPeerNode *)> retry_ = {};
+            /// function to handle rpc failure, only called if rpc is not retried
+            std::function<void()> fail_ = {};
+            /// The peer node that sends this rpc, results are handed to it
+            GossipPeerNode *owner_ = nullptr;
+            /// Number of retries of this rpc
+            int attempts_ = 0;
+
+            /// Destructor of AsyncCall. Release all objects needed in async rpc.
+            virtual ~AsyncCall() = default;
+
+            /// Get the context of current attempt.
+            /// \return The context of rpc
+            grpc::ClientContext *context() {
+                return &*context_;
+            }
+
+            /// Retry async rpc. A grpc::ClientContext can't be reused, so a new one is created.
+            void retry(GossipPeerNode *node) {
+                auto func = retry_;
+                context_.emplace();
+                status_ = {};
+                owner_ = node;
+                attempts_++;
+                func(node);
+            }
+
+            /// Finish this rpc. The call object is returned to its pool and must not be used anymore.
+            virtual void release() = 0;
+        };
 
         /// Class AsyncClientCall is used to handle async rpc request. All objects used in async rpc is managed
-        /// by this class.
+        /// by this class. Call objects are pooled by type, and input and output messages are allocated on an arena
+        /// with an inline initial block, so a steady stream of small rpc doesn't allocate for them.
         /// \tparam Input Input type of async rpc
         /// \tparam Output Output type of async rpc
         template<class Input, class Output>
-        struct AsyncClientCall {
+        struct AsyncClientCall : public AsyncCall {
             /// The input of rpc
-            Input *input_;
+            Input *input_ = nullptr;
             /// The output of rpc
-            Output *reply_;
-            /// The context of rpc
-            grpc::ClientContext context_;
-            /// The status of rpc
-            grpc::Status status_;
+            Output *reply_ = nullptr;
             /// rpc result reader
             std::unique_ptr<grpc::ClientAsyncResponseReader<Output>> reader_;
-            /// function to handle rpc output
-            std::function<void()> cb_ = {};
-            /// retry function
-            std::function<void(GossipPeerNode *)> retry_ = {};
 
-            /// Constructor of AsyncClientCall. Construct all objects needed in async rpc.
-            AsyncClientCall();
+            /// Get a call object from pool, or create one if pool is empty.
+            /// \param owner The peer node that sends this rpc
+            /// \return Call object with empty input and output
+            static AsyncClientCall *acquire(GossipPeerNode *owner);
 
-            /// Destructor of AsyncClientCall. Release all objects needed in async rpc.
-            ~AsyncClientCall();
+            /// Reset this call and return it to pool. It is deleted if pool is full.
+            void release() override;
 
             /// Start async rpc.
             void start();
 
-            /// Retry async rpc.
-            void retry(GossipPeerNode *node) {
-                auto func = retry_;
-                reply_ = {};
-                func(node);
-            }
+        private:
+
+            /// The size of inline arena block.
+            static constexpr size_t kArenaBlockSize = 2048;
+
+            /// Max number of pooled call objects of this type.
+            static constexpr size_t kPoolSize = 64;
+
+            /// Constructor of AsyncClientCall. Use acquire to get a call object.
+            AsyncClientCall();
+
+            alignas(std::max_align_t) char block_[kArenaBlockSize]; // arena 的初始内存块，重置时保留
+            google::protobuf::Arena arena_;
+
+            static std::mutex pool_mtx_;
+            static std::vector<AsyncClientCall *> pool_;    // 空闲的 call 对象
         };
 
     private:
 
-        /// Update the rpc timestamp.
+        /// State of an async merkle tree walk of syncDigest.
+        struct DigestWalk {
+            const GossipSlot *slot;
+            std::vector<int> nodes;     // 本层需要比较的节点
+            std::vector<int> leaves;    // 已经确定不同的叶子节点
+            SlotVersion version;
+            std::function<void(bool)> done;
+        };
+
+        /// Send the digests of current level of a walk, or the K-V pairs of differing leaves after the last level.
+        /// \param walk The merkle tree walk
+        void digestLevel(std::shared_ptr<DigestWalk> walk);
+
+        /// Send the K-V pairs of differing leaves, the last step of a walk.
+        /// \param walk The merkle tree walk
+        void digestLeaves(std::shared_ptr<DigestWalk> walk);
+
+        /// Update the rpc timestamp. A successful rpc proves peer node alive, but is not sampled as a heartbeat.
         void updateTimestamp() {
-            alive_ = true;
             timestamp_ = time(nullptr);
+            detector_.touch();
         }
 
     private:
 
         std::string name_;      // peer_node_name
         std::string address_;    // peer_address
-        bool alive_;    // 对方节点是否存活
+        std::atomic<bool> alive_;    // 对方节点是否存活，由 SWIM 故障检测设置
         time_t timestamp_;  // 上次进行通信的时间戳
+        GossipPhiDetector detector_;    // 心跳间隔的历史，用于计算 phi
 
         // 为什么需要 version_？ 如果一个结点在上线后，又下线了那么可能会出现一些问题
 
         long version_;  // 如果一个结点反复地上下线，那么需要根据version来判断
 
+        std::atomic<SlotVersion> known_version_{0};  // 对方节点所持有的本地 slot 版本，用于增量更新
+
+        mutable std::mutex versions_mtx_;
+        SlotVersions peer_versions_;    // 上一轮 syncSlots 得知的对方各个 slot 的版本
+        SlotVersions acked_versions_;   // 对方最近一次心跳或 syncSlots 报告的各个 slot 的版本，用于回收墓碑
+
         std::unique_ptr<pf_gossip::Gossip::Stub> stub_;
-        grpc::CompletionQueue rpc_queue;
-        std::thread async_th_;
+        std::unique_ptr<grpc::TemplatedGenericStub<grpc::ByteBuffer, pf_gossip::updateResult>> update_stub_;  // 发送编码好的 pull 请求
+        grpc::CompletionQueue *rpc_queue;  // 由 GossipCompletionPool 分配，多个节点共享
 
         GossipNode *node_;
     };
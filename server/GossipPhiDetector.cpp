@@ -0,0 +1,78 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipPhiDetector.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gossip::server {
+
+    namespace {
+
+        double toMillis(GossipPhiDetector::Clock::duration duration) {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+
+    }
+
+    GossipPhiDetector::GossipPhiDetector(Clock::duration first_interval, size_t window, Clock::duration min_stddev)
+            : window_(std::max<size_t>(window, 2)), min_stddev_(toMillis(min_stddev)),
+              last_beat_(Clock::now()), last_seen_(last_beat_) {
+
+        // 以猜测的间隔为均值、四分之一为标准差初始化窗口，与两个样本等价
+        auto mean = toMillis(first_interval);
+        auto stddev = mean / 4;
+        intervals_.reserve(window_);
+        sample(mean - stddev);
+        sample(mean + stddev);
+    }
+
+    void GossipPhiDetector::heartbeat(Clock::time_point now) {
+        std::lock_guard<std::mutex> lg(mtx);
+        if (now > last_beat_)
+            sample(toMillis(now - last_beat_));
+        last_beat_ = now;
+        last_seen_ = std::max(last_seen_, now);
+    }
+
+    void GossipPhiDetector::touch(Clock::time_point now) {
+        std::lock_guard<std::mutex> lg(mtx);
+        last_seen_ = std::max(last_seen_, now);
+    }
+
+    double GossipPhiDetector::phi(Clock::time_point now) const {
+        std::lock_guard<std::mutex> lg(mtx);
+
+        auto elapsed = toMillis(now - last_seen_);
+        if (elapsed <= 0)
+            return 0;
+
+        auto n = static_cast<double>(intervals_.size());
+        auto mean = sum_ / n;
+        auto variance = std::max(squares_ / n - mean * mean, 0.0);
+        auto stddev = std::max(std::sqrt(variance), min_stddev_);
+
+        // 正态分布尾部概率的 logistic 近似，避免计算 erfc 时在尾部下溢
+        auto y = (elapsed - mean) / stddev;
+        auto e = std::exp(-y * (1.5976 + 0.070566 * y * y));
+        auto p = elapsed > mean ? e / (1 + e) : 1 - 1 / (1 + e);
+        return -std::log10(std::max(p, 1e-300));
+    }
+
+    void GossipPhiDetector::sample(double interval) {
+        if (intervals_.size() < window_) {
+            intervals_.emplace_back(interval);
+        } else {
+            auto &oldest = intervals_[next_];
+            sum_ -= oldest;
+            squares_ -= oldest * oldest;
+            oldest = interval;
+            next_ = (next_ + 1) % window_;
+        }
+        sum_ += interval;
+        squares_ += interval * interval;
+    }
+
+}
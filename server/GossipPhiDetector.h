@@ -0,0 +1,68 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPPHIDETECTOR_H
+#define GOSSIP_GOSSIPPHIDETECTOR_H
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace gossip::server {
+
+    /// @brief Phi-accrual failure detector of a peer node.
+    /// @details Class GossipPhiDetector keeps a sliding window of heartbeat intervals of a peer, and turns the time
+    /// since the peer was last heard into a suspicion level phi = -log10(P), where P is the probability that a
+    /// heartbeat interval is that long under a normal distribution of the window. A peer that is always slow or
+    /// irregular gets a wide distribution, so a pause of it raises phi slowly. Other rpc from the peer prove it
+    /// alive and reset the time since it was last heard, but their intervals are not sampled, so bursts of rpc
+    /// don't narrow the distribution. All functions are thread safe.
+    class GossipPhiDetector {
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        /// Constructor of GossipPhiDetector. The window starts with a guess of heartbeat interval, so a peer that
+        /// is never heard is still suspected in time.
+        /// \param first_interval Expected heartbeat interval
+        /// \param window Max number of sampled intervals
+        /// \param min_stddev Min standard deviation of intervals
+        GossipPhiDetector(Clock::duration first_interval, size_t window, Clock::duration min_stddev);
+
+        /// Record a heartbeat, its interval since last heartbeat is sampled.
+        /// \param now Time of heartbeat
+        void heartbeat(Clock::time_point now = Clock::now());
+
+        /// Record that peer is heard without sampling an interval.
+        /// \param now Time when peer is heard
+        void touch(Clock::time_point now = Clock::now());
+
+        /// Get the suspicion level of peer.
+        /// \param now Current time
+        /// \return Phi, 0 if peer was just heard
+        [[nodiscard]] double phi(Clock::time_point now = Clock::now()) const;
+
+    private:
+
+        /// Add an interval to window, replacing the oldest one if window is full. Caller must hold mtx.
+        /// \param interval Interval in milliseconds
+        void sample(double interval);
+
+    private:
+
+        size_t window_;
+        double min_stddev_;     // 毫秒
+
+        mutable std::mutex mtx;
+        std::vector<double> intervals_;     // 环形缓冲区，单位为毫秒
+        size_t next_ = 0;
+        double sum_ = 0, squares_ = 0;
+        Clock::time_point last_beat_;   // 上一次心跳，用于计算间隔
+        Clock::time_point last_seen_;   // 上一次收到对方的任何消息
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPPHIDETECTOR_H
@@ -0,0 +1,44 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipRumorBuffer.h"
+
+#include <algorithm>
+
+namespace gossip::server {
+
+    GossipRumorBuffer::GossipRumorBuffer(std::chrono::milliseconds window, size_t max_writes)
+            : window_(window), max_writes_(std::max<size_t>(max_writes, 1)) {}
+
+    void GossipRumorBuffer::start(SlotVersion base) {
+        if (writes_ > 0)
+            return;
+        base_ = base;
+        deadline_ = Clock::now() + window_;
+    }
+
+    void GossipRumorBuffer::recordPut(const std::string &key, SlotVersion base) {
+        start(base);
+        writes_++;
+        keys_.emplace(key);
+    }
+
+    void GossipRumorBuffer::recordDelete(const std::string &key, SlotVersion base) {
+        // 删除留下的墓碑和写入一样按键发送
+        recordPut(key, base);
+    }
+
+    SlotRumor GossipRumorBuffer::take(const GossipSlot &slot) {
+        SlotRumor rumor;
+        rumor.snapshot = slot.snapshot();
+        rumor.base = base_;
+        rumor.keys.reserve(keys_.size());
+        while (!keys_.empty())
+            rumor.keys.emplace_back(std::move(keys_.extract(keys_.begin()).value()));
+
+        writes_ = 0;
+        return rumor;
+    }
+
+}
@@ -0,0 +1,96 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPRUMORBUFFER_H
+#define GOSSIP_GOSSIPRUMORBUFFER_H
+
+#include "GossipSlot.h"
+
+#include <chrono>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace gossip::server {
+
+    /// @brief Local writes waiting to be gossiped, taken from GossipRumorBuffer.
+    struct SlotRumor {
+        /// Snapshot of local slot when rumor is taken, values of keys are read from it
+        SlotSnapshotPtr snapshot;
+        /// Changed keys, deleted keys are sent as tombstones
+        std::vector<std::string> keys;
+        /// Slot version before the first buffered write
+        SlotVersion base = 0;
+    };
+
+    /// @brief Coalesce local writes into one rumor.
+    /// @details Class GossipRumorBuffer records keys written to local slot since last flush. Keys written many
+    /// times are only sent once with their latest value or tombstone. The buffer is due when its window has passed
+    /// since the first buffered write, or when it holds enough writes. It is not thread safe, the owner must
+    /// serialize local writes, record and take.
+    class GossipRumorBuffer {
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        /// Constructor of GossipRumorBuffer.
+        /// \param window Max time a write waits in buffer. If 0, every write is due immediately
+        /// \param max_writes Number of writes that makes buffer due before its window
+        GossipRumorBuffer(std::chrono::milliseconds window, size_t max_writes);
+
+        /// Record a put of local slot.
+        /// \param key The key written
+        /// \param base Slot version before this write
+        void recordPut(const std::string &key, SlotVersion base);
+
+        /// Record a delete of local slot, the tombstone of key is sent like a put.
+        /// \param key The key deleted
+        /// \param base Slot version before this write
+        void recordDelete(const std::string &key, SlotVersion base);
+
+        /// Check if buffer holds any write.
+        /// \return If buffer is empty
+        [[nodiscard]] bool empty() const {
+            return writes_ == 0;
+        }
+
+        /// Check if buffer should be flushed now.
+        /// \param now Current time
+        /// \return If buffer is due
+        [[nodiscard]] bool due(Clock::time_point now = Clock::now()) const {
+            return !empty() && (writes_ >= max_writes_ || now >= deadline_);
+        }
+
+        /// Get the time when buffer will be due. Only valid if buffer is not empty.
+        /// \return Deadline of buffer
+        [[nodiscard]] Clock::time_point deadline() const {
+            return deadline_;
+        }
+
+        /// Take all buffered writes and clear buffer.
+        /// \param slot Local slot, whose snapshot is pinned in rumor
+        /// \return Buffered rumor
+        SlotRumor take(const GossipSlot &slot);
+
+    private:
+
+        /// Start a new rumor on the first buffered write.
+        /// \param base Slot version before the first write
+        void start(SlotVersion base);
+
+    private:
+
+        std::chrono::milliseconds window_;
+        size_t max_writes_;
+
+        std::unordered_set<std::string> keys_;  // 缓冲期间写入过的键
+        SlotVersion base_ = 0;      // 第一次写入之前的 slot 版本
+        size_t writes_ = 0;         // 缓冲的写入次数
+        Clock::time_point deadline_;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPRUMORBUFFER_H
@@ -0,0 +1,115 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipScheduler.h"
+
+#include <algorithm>
+
+namespace gossip::server {
+
+    GossipScheduler::GossipScheduler(std::chrono::microseconds tick)
+            : tick_(std::max(tick, std::chrono::microseconds(1))), start_(Clock::now()) {}
+
+    uint64_t GossipScheduler::ticks(Clock::duration delay) const {
+        if (delay <= Clock::duration::zero())
+            return 0;
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count();
+        auto tick = std::chrono::duration_cast<std::chrono::nanoseconds>(tick_).count();
+        return (ns + tick - 1) / tick;
+    }
+
+    uint64_t GossipScheduler::now() const {
+        return (Clock::now() - start_) / tick_;
+    }
+
+    GossipScheduler::TaskId GossipScheduler::schedule(Clock::duration delay, Task task) {
+        return add(ticks(delay), 0, std::move(task));
+    }
+
+    GossipScheduler::TaskId GossipScheduler::every(Clock::duration period, Task task) {
+        auto ticks = std::max<uint64_t>(this->ticks(period), 1);
+        return add(ticks, ticks, std::move(task));
+    }
+
+    GossipScheduler::TaskId GossipScheduler::add(uint64_t delay, uint64_t period, Task task) {
+        std::lock_guard<std::mutex> lg(mtx);
+
+        auto id = next_id_++;
+        auto it = wheel_.add(now() + delay, Timer{id, std::move(task), period});
+        timers_.emplace(id, it);
+
+        // 只有新的定时器早于执行线程等待的时间时才需要唤醒
+        if (it->tick < waiting_)
+            cv.notify_one();
+        return id;
+    }
+
+    bool GossipScheduler::cancel(TaskId id) {
+        std::lock_guard<std::mutex> lg(mtx);
+        auto found = timers_.find(id);
+        if (found == timers_.end())
+            return false;
+
+        auto it = found->second;
+        timers_.erase(found);
+
+        // 到期的定时器可能正在执行，由执行线程删除
+        if (it->level == -1) {
+            it->value.cancelled = true;
+            return true;
+        }
+
+        wheel_.erase(it);
+        return true;
+    }
+
+    void GossipScheduler::run() {
+        std::unique_lock<std::mutex> lk(mtx);
+        while (!quit_) {
+
+            wheel_.advance(now());
+
+            if (wheel_.ready().empty()) {
+                // 等待到最早的非空 slot，期间加入更早的定时器时会被唤醒
+                waiting_ = wheel_.nextTick();
+                if (waiting_ == UINT64_MAX)
+                    cv.wait(lk);
+                else
+                    cv.wait_until(lk, start_ + tick_ * waiting_);
+                waiting_ = 0;
+                continue;
+            }
+
+            // 执行期间定时器留在 ready 列表中，其他线程取消时只会标记
+            auto it = wheel_.ready().begin();
+            auto &timer = it->value;
+            if (!timer.cancelled) {
+                lk.unlock();
+                timer.task();
+                lk.lock();
+            }
+
+            if (timer.cancelled || timer.period == 0) {
+                if (!timer.cancelled)
+                    timers_.erase(timer.id);
+                wheel_.erase(it);
+            } else {
+                // 执行落后时不补上错过的周期
+                wheel_.reschedule(it, std::max(it->tick + timer.period, wheel_.current()));
+            }
+        }
+    }
+
+    void GossipScheduler::stop() {
+        std::lock_guard<std::mutex> lg(mtx);
+        quit_ = true;
+        cv.notify_all();
+    }
+
+    size_t GossipScheduler::size() {
+        std::lock_guard<std::mutex> lg(mtx);
+        return timers_.size();
+    }
+
+}
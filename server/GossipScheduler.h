@@ -0,0 +1,120 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPSCHEDULER_H
+#define GOSSIP_GOSSIPSCHEDULER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include "GossipTimerWheel.h"
+
+namespace gossip::server {
+
+    /// @brief Event scheduler based on a hierarchical timer wheel.
+    /// @details Class GossipScheduler runs delayed and periodic tasks on the thread that calls run(). Timers are
+    /// kept in a GossipTimerWheel, so scheduling and cancelling a timer is O(1). The run thread sleeps until the
+    /// earliest non-empty slot, and wakes at once when a task is scheduled from another thread. All functions are
+    /// thread safe.
+    class GossipScheduler {
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        using Task = std::function<void()>;
+
+        /// Id of a scheduled task, never 0.
+        using TaskId = uint64_t;
+
+        /// Constructor of GossipScheduler.
+        /// \param tick Resolution of timer wheel, delays are rounded up to it
+        explicit GossipScheduler(std::chrono::microseconds tick = std::chrono::microseconds(100));
+
+        GossipScheduler(const GossipScheduler &) = delete;
+
+        GossipScheduler &operator=(const GossipScheduler &) = delete;
+
+        /// Run a task once after a delay.
+        /// \param delay Time to wait
+        /// \param task The task to run
+        /// \return Id of task
+        TaskId schedule(Clock::duration delay, Task task);
+
+        /// Run a task periodically. The first run is after one period.
+        /// \param period Time between two runs
+        /// \param task The task to run
+        /// \return Id of task
+        TaskId every(Clock::duration period, Task task);
+
+        /// Run a task as soon as possible.
+        /// \param task The task to run
+        /// \return Id of task
+        TaskId post(Task task) {
+            return schedule(Clock::duration::zero(), std::move(task));
+        }
+
+        /// Cancel a task. A running task completes, but is not run again.
+        /// \param id Id of task
+        /// \return If task is found
+        bool cancel(TaskId id);
+
+        /// Run due tasks on calling thread until stop is called.
+        void run();
+
+        /// Stop running tasks. Tasks not run are dropped when scheduler is destroyed.
+        void stop();
+
+        /// Get the number of scheduled tasks.
+        /// \return The number of scheduled tasks
+        size_t size();
+
+    private:
+
+        /// A scheduled task.
+        struct Timer {
+            TaskId id;
+            Task task;
+            uint64_t period;    // 周期任务的间隔 tick，一次性任务为 0
+            bool cancelled = false;
+        };
+
+        using Wheel = GossipTimerWheel<Timer>;
+
+        /// Convert a delay to ticks, rounded up.
+        /// \param delay Delay from now
+        /// \return Ticks of delay
+        [[nodiscard]] uint64_t ticks(Clock::duration delay) const;
+
+        /// Get the tick of current time.
+        /// \return Tick of current time
+        [[nodiscard]] uint64_t now() const;
+
+        /// Add a timer to scheduler.
+        /// \return Id of timer
+        TaskId add(uint64_t delay, uint64_t period, Task task);
+
+    private:
+
+        std::chrono::microseconds tick_;
+        Clock::time_point start_;
+
+        std::mutex mtx;
+        std::condition_variable cv;
+
+        Wheel wheel_;
+        uint64_t waiting_ = 0;  // 执行线程等待到的 tick，没有等待时为 0
+
+        std::unordered_map<TaskId, Wheel::Handle> timers_;
+        TaskId next_id_ = 1;
+        bool quit_ = false;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPSCHEDULER_H
@@ -3,77 +3,633 @@
 //
 
 #include "GossipSlot.h"
+#include "GossipSlotImage.h"
 
 
 namespace gossip::server{
 
-    SlotVersion GossipSlot::insertOrUpdate(const std::string &key, const std::string &value) {
+    namespace {
+
+        /// An empty snapshot whose stripes are all empty.
+        SlotSnapshotPtr emptySnapshot() {
+            auto empty = std::make_shared<const SlotStripe>();
+            auto snapshot = std::make_shared<SlotSnapshot>();
+            snapshot->stripes.fill(empty);
+            return snapshot;
+        }
+
+        /// Call added(key) for keys only in after and erased(key) for keys only in before, both sorted by key.
+        template<class Added, class Erased>
+        void diffKeys(const SlotStripe &before, const SlotStripe &after, Added &&added, Erased &&erased) {
+            auto a = before.begin(), b = after.begin();
+            while (a != before.end() || b != after.end()) {
+                if (b == after.end() || (a != before.end() && a->first < b->first)) {
+                    erased((a++)->first);
+                } else if (a == before.end() || b->first < a->first) {
+                    added((b++)->first);
+                } else {
+                    ++a, ++b;
+                }
+            }
+        }
+
+    }
+
+    SlotStripe &GossipSlot::Builder::stripe(int index) {
+        if (copies_[index] == nullptr) {
+            copies_[index] = std::make_shared<SlotStripe>(*next_->stripes[index]);
+            next_->stripes[index] = copies_[index];
+        }
+        return *copies_[index];
+    }
+
+    void GossipSlot::Builder::reset(int index, SlotStripe values) {
+        if (keys_ != nullptr) {
+            diffKeys(*next_->stripes[index], values,
+                     [this](const std::string &key) { added_.emplace_back(GossipKeyIndex::hash(key)); },
+                     [this](const std::string &key) { erased_.emplace_back(GossipKeyIndex::hash(key)); });
+        }
+        copies_[index] = std::make_shared<SlotStripe>(std::move(values));
+        next_->stripes[index] = copies_[index];
+        reindex_ = true;
+    }
+
+    SlotIndex *GossipSlot::Builder::mutableIndex() {
+        if (index_ == nullptr && next_->index != nullptr) {
+            index_ = std::make_shared<SlotIndex>(*next_->index);
+            leaves_.assign(index_->leaves.size(), nullptr);
+            next_->index = index_;
+        }
+        return index_.get();
+    }
+
+    SlotIndex::Leaf &GossipSlot::Builder::leaf(size_t index) {
+        if (leaves_[index] == nullptr) {
+            leaves_[index] = std::make_shared<SlotIndex::Leaf>(*index_->leaves[index]);
+            index_->leaves[index] = leaves_[index];
+        }
+        return *leaves_[index];
+    }
+
+    void GossipSlot::Builder::insertKey(const std::string &key) {
+        if (keys_ != nullptr)
+            added_.emplace_back(GossipKeyIndex::hash(key));
+
+        // stripe 被整体替换时，索引在构建快照时重建
+        SlotIndex *index;
+        if (reindex_ || (index = mutableIndex()) == nullptr)
+            return;
+
+        if (index->leaves.empty()) {
+            leaves_.emplace_back(std::make_shared<SlotIndex::Leaf>(1, key));
+            index->leaves.emplace_back(leaves_.back());
+            return;
+        }
+
+        auto i = index->leafOf(key);
+        auto &keys = leaf(i);
+        keys.insert(std::lower_bound(keys.begin(), keys.end(), key), key);
+        if (keys.size() <= SlotIndex::kLeafSize)
+            return;
+
+        // 叶子节点过大时分成两半，后一半成为新的叶子节点
+        auto half = keys.size() / 2;
+        auto split = std::make_shared<SlotIndex::Leaf>(std::make_move_iterator(keys.begin() + half),
+                                                       std::make_move_iterator(keys.end()));
+        keys.resize(half);
+        leaves_.insert(leaves_.begin() + i + 1, split);
+        index->leaves.insert(index->leaves.begin() + i + 1, split);
+    }
+
+    void GossipSlot::Builder::eraseKey(const std::string &key) {
+        if (keys_ != nullptr)
+            erased_.emplace_back(GossipKeyIndex::hash(key));
+
+        SlotIndex *index;
+        if (reindex_ || (index = mutableIndex()) == nullptr || index->leaves.empty())
+            return;
+
+        auto i = index->leafOf(key);
+        auto &current = *index->leaves[i];
+        if (!std::binary_search(current.begin(), current.end(), key))
+            return;
+
+        auto &keys = leaf(i);
+        keys.erase(std::lower_bound(keys.begin(), keys.end(), key));
+        if (keys.empty()) {
+            leaves_.erase(leaves_.begin() + i);
+            index->leaves.erase(index->leaves.begin() + i);
+        }
+    }
+
+    void GossipSlot::Builder::index() {
+        // 每个 stripe 内部已经有序，这里只排序键的指针
+        std::vector<const std::string *> keys;
+        for (auto &stripe: next_->stripes) {
+            for (auto &kv: *stripe)
+                keys.emplace_back(&kv.first);
+        }
+        std::sort(keys.begin(), keys.end(), [](auto a, auto b) { return *a < *b; });
+
+        // 叶子节点不填满，之后插入的键不会马上引起分裂
+        constexpr size_t fill = SlotIndex::kLeafSize * 3 / 4;
+        index_ = std::make_shared<SlotIndex>();
+        leaves_.clear();
+        for (size_t i = 0; i < keys.size(); i += fill) {
+            auto leaf = std::make_shared<SlotIndex::Leaf>();
+            leaf->reserve(std::min(fill, keys.size() - i));
+            for (size_t j = i; j < keys.size() && j < i + fill; j++)
+                leaf->emplace_back(*keys[j]);
+            leaves_.emplace_back(leaf);
+            index_->leaves.emplace_back(std::move(leaf));
+        }
+        next_->index = index_;
+        reindex_ = false;
+    }
+
+    SlotSnapshotPtr GossipSlot::Builder::build(SlotVersion version) {
+        if (reindex_ && next_->index != nullptr)
+            index();
+        next_->version = version;
+        return std::move(next_);
+    }
+
+    SlotScanner::SlotScanner(SlotSnapshotPtr snapshot, const std::string &start, std::string end)
+            : snapshot_(std::move(snapshot)), end_(std::move(end)), now_(GossipClock::millis()) {
+        auto &index = *snapshot_->index;
+        if (index.leaves.empty())
+            return;
+        leaf_ = index.leafOf(start);
+        auto &keys = *index.leaves[leaf_];
+        offset_ = std::lower_bound(keys.begin(), keys.end(), start) - keys.begin();
+    }
+
+    bool SlotScanner::next() {
+        auto &leaves = snapshot_->index->leaves;
+        if (started_)
+            offset_++;
+        started_ = true;
+
+        for (; leaf_ < leaves.size(); leaf_++, offset_ = 0) {
+            auto &keys = *leaves[leaf_];
+            for (; offset_ < keys.size(); offset_++) {
+                auto &key = keys[offset_];
+                if (!end_.empty() && key >= end_) {
+                    leaf_ = leaves.size();
+                    return false;
+                }
+                // 索引只记录键，值与版本在 stripe 中查找
+                auto entry = snapshot_->lookup(key);
+                if (entry == nullptr || entry->deleted || entry->expired(now_))
+                    continue;
+                entry_ = entry;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    GossipSlot::GossipSlot(std::string name, GossipKeyIndex *keys)
+            : name_(std::move(name)), snapshot_(emptySnapshot()), current_(snapshot_.get()), version_(0), keys_(keys) {}
+
+    GossipSlot &GossipSlot::operator=(const GossipSlot &other) {
+        if (this == &other)
+            return *this;
+
+        std::scoped_lock sl(mtx, other.mtx);
+        other.warmLocked();
+        warmLocked();
+        name_ = other.name_;
+
+        // 键索引只记录两个快照之间不同的键
+        std::vector<uint64_t> added, erased;
+        if (keys_ != nullptr) {
+            for (int i = 0; i < kStripes; i++) {
+                diffKeys(*snapshot_->stripes[i], *other.snapshot_->stripes[i],
+                         [&added](const std::string &key) { added.emplace_back(GossipKeyIndex::hash(key)); },
+                         [&erased](const std::string &key) { erased.emplace_back(GossipKeyIndex::hash(key)); });
+            }
+            keys_->add(this, added);
+        }
+
+        // 快照不可修改，两个 slot 可以直接共享
+        publish(other.snapshot_);
+        if (keys_ != nullptr)
+            keys_->remove(this, erased);
+        full_sync_version_ = other.full_sync_version_.load();
+        tree_ = other.tree_;
+        mem_use_ = other.mem_use_.load();
+        tombstones_ = other.tombstones_.load();
+        return *this;
+    }
+
+    void GossipSlot::attach(std::shared_ptr<const GossipSlotImage> image, size_t index) {
         std::lock_guard<std::mutex> lg(mtx);
-        map_[key] = value;
-        version_ = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()).count();
-        mem_use_ += key.size() + value.size();
-        return version_;
+        GossipClock::update(image->version(index));
+
+        version_ = image->version(index);
+        full_sync_version_ = image->fullSyncVersion(index);
+        image_index_ = index;
+        image_ = std::move(image);
+        cold_ = image_.get();
+
+        // 镜像中的键在加载时才加入键索引，在此之前搜索总是查找这个 slot
+        if (keys_ != nullptr)
+            keys_->addCold(this);
     }
 
-    SlotVersion GossipSlot::insertOrUpdate(const std::string &key, const std::string &value, SlotVersion version) {
+    std::shared_ptr<const GossipSlotImage> GossipSlot::image(size_t *index) const {
         std::lock_guard<std::mutex> lg(mtx);
-        if (version < version_)
-            return -1;
-        map_[key] = value;
-        version_ = version;
-        mem_use_ += key.size() + value.size();
-        return version_;
+        *index = image_index_;
+        return image_;
+    }
+
+    void GossipSlot::warm() const {
+        std::lock_guard<std::mutex> lg(mtx);
+        warmLocked();
+    }
+
+    void GossipSlot::warmLocked() const {
+        if (!image_)
+            return;
+
+        // 只是把镜像中的内容加载到内存，slot 的内容与版本不变
+        auto self = const_cast<GossipSlot *>(this);
+        auto &image = *image_;
+        std::array<SlotStripe, kStripes> stripes;
+        size_t mem_use = 0, tombstones = 0;
+        for (size_t i = 0; i < image.size(image_index_); i++) {
+            auto entry = image.entry(image_index_, i);
+            if (!entry)
+                continue;
+            // 镜像中的键值对按键排序，每个 stripe 中也是有序的
+            std::string key(entry->key);
+            self->tree_.toggle(key, entry->version);
+            auto &stripe = stripes[SlotSnapshot::stripeOf(key)];
+            stripe.emplace_back(std::move(key), SlotEntry{std::string(entry->value), entry->version, entry->deleted,
+                                                          entry->expires});
+            mem_use += entry->key.size() + entry->value.size();
+            tombstones += entry->deleted;
+        }
+
+        Builder builder(*snapshot_, keys_);
+        for (int i = 0; i < kStripes; i++)
+            builder.reset(i, std::move(stripes[i]));
+        self->mem_use_ = mem_use;
+        self->tombstones_ = tombstones;
+        self->commit(builder, version_);
+
+        // 已经读取镜像的读者仍然可以使用它，由 GossipEpoch 延迟释放
+        self->cold_ = nullptr;
+        GossipEpoch::retire(std::move(self->image_));
+        if (keys_ != nullptr)
+            keys_->removeCold(self);
+    }
+
+    SlotVersion GossipSlot::nextVersion() const {
+        // 收到的版本都已经推进了时钟，这里取最大值只是为了防止复制来的 slot 版本更大
+        return std::max(GossipClock::now(), version_ + 1);
+    }
+
+    void GossipSlot::publish(SlotSnapshotPtr snapshot) {
+        version_ = snapshot->version;
+        current_ = snapshot.get();
+        // 旧快照可能仍在被读者使用，交给 GossipEpoch 延迟释放
+        std::swap(snapshot_, snapshot);
+        GossipEpoch::retire(std::move(snapshot));
+    }
+
+    void GossipSlot::commit(Builder &builder, SlotVersion version) {
+        if (keys_ != nullptr && !builder.added().empty())
+            keys_->add(this, builder.added());
+        publish(builder.build(version));
+        if (keys_ != nullptr && !builder.erased().empty())
+            keys_->remove(this, builder.erased());
+    }
+
+    void GossipSlot::putEntry(Builder &builder, std::string key, SlotEntry entry, bool force) {
+        auto &stripe = builder.stripe(SlotSnapshot::stripeOf(key));
+        auto it = SlotSnapshot::lowerBound(stripe, key);
+        bool inserted = it == stripe.end() || it->first != key;
+        if (inserted) {
+            it = stripe.emplace(it, std::move(key), SlotEntry{});
+            builder.insertKey(it->first);
+        } else {
+            if (!force && it->second.version >= entry.version)
+                return;
+            tree_.toggle(it->first, it->second.version);
+            tombstones_ -= it->second.deleted;
+        }
+        tombstones_ += entry.deleted;
+        mem_use_ += (inserted ? it->first.size() : 0) + entry.value.size() - it->second.value.size();
+        tree_.toggle(it->first, entry.version);
+        it->second = std::move(entry);
+    }
+
+    SlotStripe::iterator GossipSlot::eraseEntry(Builder &builder, SlotStripe &stripe, SlotStripe::iterator it) {
+        builder.eraseKey(it->first);
+        mem_use_ -= (it->first.size() + it->second.value.size());
+        tombstones_ -= it->second.deleted;
+        tree_.toggle(it->first, it->second.version);
+        return stripe.erase(it);
+    }
+
+    SlotVersion GossipSlot::insertOrUpdate(const std::string &key, const std::string &value, SlotVersion *previous,
+                                           int64_t ttl_ms) {
+        std::lock_guard<std::mutex> lg(mtx);
+        warmLocked();
+
+        if (previous != nullptr)
+            *previous = version_;
+        auto version = nextVersion();
+
+        Builder builder(*snapshot_, keys_);
+        putEntry(builder, key, {value, version, false, SlotEntry::expiration(version, ttl_ms)}, true);
+        commit(builder, version);
+        return version;
     }
 
     SlotVersion GossipSlot::remove(const std::string &key) {
         std::lock_guard<std::mutex> lg(mtx);
+        warmLocked();
 
-        auto it = map_.find(key);
-        if(it == map_.end())
+        if (snapshot_->find(key) == nullptr)
             return -1;
 
-        mem_use_ -= (it->first.size() + it->second.size());
-        map_.erase(it);
-        version_ = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()).count();
-        return version_;
+        // 留下墓碑，删除和写入一样通过增量更新传播
+        auto version = nextVersion();
+        Builder builder(*snapshot_, keys_);
+        putEntry(builder, key, {{}, version, true}, true);
+        commit(builder, version);
+        return version;
     }
 
     SlotVersion GossipSlot::remove(const std::string &key, SlotVersion version) {
+        GossipClock::update(version);
         std::lock_guard<std::mutex> lg(mtx);
+        warmLocked();
 
-        if (version < version_)
+        if (version < version_ || snapshot_->find(key) == nullptr)
             return -1;
 
-        auto it = map_.find(key);
-        if(it == map_.end())
+        Builder builder(*snapshot_, keys_);
+        putEntry(builder, key, {{}, version, true}, true);
+        commit(builder, version);
+        return version;
+    }
+
+    SlotVersion GossipSlot::applyBatch(const SlotBatch &batch, SlotVersion *previous, int *applied) {
+        std::lock_guard<std::mutex> lg(mtx);
+        warmLocked();
+
+        if (previous != nullptr)
+            *previous = version_;
+
+        auto version = nextVersion();
+        int count = 0;
+
+        Builder builder(*snapshot_, keys_);
+        for (auto &operation: batch) {
+            if (!operation.remove) {
+                SlotEntry entry{operation.value, version, false, SlotEntry::expiration(version, operation.ttl_ms)};
+                putEntry(builder, operation.key, std::move(entry), true);
+                count++;
+                continue;
+            }
+
+            auto &stripe = builder.stripe(SlotSnapshot::stripeOf(operation.key));
+            auto it = SlotSnapshot::lowerBound(stripe, operation.key);
+            if (it == stripe.end() || it->first != operation.key || it->second.deleted)
+                continue;
+            putEntry(builder, operation.key, {{}, version, true}, true);
+            count++;
+        }
+
+        if (applied != nullptr)
+            *applied = count;
+        if (count == 0)
             return -1;
 
-        mem_use_ -= (it->first.size() + it->second.size());
-        map_.erase(it);
-        version_ = version;
-        return version_;
+        commit(builder, version);
+        return version;
     }
 
-    SlotVersion GossipSlot::compareAndMergeSlot(SlotValues values, SlotVersion version) {
+    SlotVersion GossipSlot::compareAndMergeSlot(SlotValues values, SlotVersion version, bool delta, SlotVersion base) {
+        // 收到的版本推进本地时钟，之后的本地写入排在它之后
+        GossipClock::update(version);
         std::lock_guard<std::mutex> lg(mtx);
-        if (version < version_)
-            return -1;
-        map_ = std::move(values);
-        return version_;
+        warmLocked();
+
+        Builder builder(*snapshot_, keys_);
+
+        if (!delta) {
+            if (version < version_)
+                return -1;
+
+            // 直接移动哈希表节点，键值对的字符串不会被复制
+            std::array<SlotValues, kStripes> grouped;
+            while (!values.empty()) {
+                auto node = values.extract(values.begin());
+                grouped[SlotSnapshot::stripeOf(node.key())].insert(std::move(node));
+            }
+
+            tree_.clear();
+            size_t mem_use = 0, tombstones = 0;
+            for (int i = 0; i < kStripes; i++) {
+                // 比全量更新版本还新的键值对来自之后的增量更新，需要保留
+                for (auto &[key, entry]: *snapshot_->stripes[i]) {
+                    if (entry.version <= version)
+                        continue;
+                    auto it = grouped[i].find(key);
+                    if (it == grouped[i].end())
+                        grouped[i].emplace(key, entry);
+                    else if (it->second.version < entry.version)
+                        it->second = entry;
+                }
+
+                SlotStripe stripe;
+                stripe.reserve(grouped[i].size());
+                while (!grouped[i].empty()) {
+                    auto node = grouped[i].extract(grouped[i].begin());
+                    mem_use += node.key().size() + node.mapped().value.size();
+                    tombstones += node.mapped().deleted;
+                    tree_.toggle(node.key(), node.mapped().version);
+                    stripe.emplace_back(std::move(node.key()), std::move(node.mapped()));
+                }
+                std::sort(stripe.begin(), stripe.end(), [](auto &a, auto &b) { return a.first < b.first; });
+                builder.reset(i, std::move(stripe));
+            }
+
+            mem_use_ = mem_use;
+            tombstones_ = tombstones;
+            // 全量更新可能删除了某些键值对，之前的版本无法再使用增量更新
+            full_sync_version_ = version;
+            commit(builder, version);
+            return version;
+        }
+
+        // 增量更新逐个比较键值对的版本，旧的键值对不会覆盖新的键值对
+        while (!values.empty()) {
+            auto node = values.extract(values.begin());
+            putEntry(builder, std::move(node.key()), std::move(node.mapped()), false);
+        }
+
+        // 只有已经包含了 base 版本之前的所有变化，才能够更新 slot 版本
+        SlotVersion next = version_;
+        if (base <= version_ && version_ < version)
+            next = version;
+
+        commit(builder, next);
+        return next;
     }
 
-    std::pair<std::string, SlotVersion> GossipSlot::find(const std::string &key) {
+    SlotVersion GossipSlot::mergeLeaves(const std::vector<int> &leaves, SlotValues values, SlotVersion version) {
+        GossipClock::update(version);
         std::lock_guard<std::mutex> lg(mtx);
+        warmLocked();
 
-        auto it = map_.find(key);
-        if (it == map_.end())
-            return {"", 0};
-        return {it->second, version_};
+        std::vector<bool> covered(GossipMerkleTree::kLeaves, false);
+        std::array<bool, kStripes> stripes{};
+        for (auto leaf: leaves) {
+            if (leaf >= 0 && leaf < GossipMerkleTree::kLeaves) {
+                covered[leaf] = true;
+                stripes[leaf % kStripes] = true;
+            }
+        }
+
+        Builder builder(*snapshot_, keys_);
+
+        for (int i = 0; i < kStripes; i++) {
+            if (!stripes[i])
+                continue;
+
+            auto &stripe = builder.stripe(i);
+
+            // 对方没有并且不比对方版本新的键值对已经被删除
+            for (auto it = stripe.begin(); it != stripe.end();) {
+                if (covered[GossipMerkleTree::leafOf(it->first)] && it->second.version <= version &&
+                    values.find(it->first) == values.end()) {
+                    it = eraseEntry(builder, stripe, it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        while (!values.empty()) {
+            auto node = values.extract(values.begin());
+            putEntry(builder, std::move(node.key()), std::move(node.mapped()), false);
+        }
+
+        SlotVersion next = version_;
+        if (next < version) {
+            next = version;
+            full_sync_version_ = version;
+        }
+
+        commit(builder, next);
+        return next;
     }
 
+    size_t GossipSlot::expire(const std::vector<std::pair<std::string, SlotVersion>> &keys, int64_t now) {
+        std::lock_guard<std::mutex> lg(mtx);
+        warmLocked();
 
-}
+        Builder builder(*snapshot_, keys_);
+        size_t expired = 0;
+        for (auto &[key, version]: keys) {
+            auto entry = snapshot_->lookup(key);
+            if (entry == nullptr || entry->deleted || entry->version != version || !entry->expired(now))
+                continue;
+            // 墓碑使用键值对自己的版本，merkle 树的哈希值不变，所有副本得到相同的结果
+            putEntry(builder, key, {{}, version, true}, true);
+            expired++;
+        }
+
+        if (expired > 0)
+            commit(builder, version_);
+        return expired;
+    }
+
+    size_t GossipSlot::collect(SlotVersion horizon) {
+        std::lock_guard<std::mutex> lg(mtx);
+        if (image_ || tombstones_ == 0)
+            return 0;
+
+        auto collectable = [horizon](const std::pair<std::string, SlotEntry> &kv) {
+            return kv.second.deleted && kv.second.version <= horizon;
+        };
+
+        Builder builder(*snapshot_, keys_);
+        size_t collected = 0;
+        SlotVersion newest = 0;
+        for (int i = 0; i < kStripes; i++) {
+            // 只复制有可回收墓碑的 stripe
+            auto &current = *snapshot_->stripes[i];
+            if (std::none_of(current.begin(), current.end(), collectable))
+                continue;
+
+            auto &stripe = builder.stripe(i);
+            for (auto it = stripe.begin(); it != stripe.end();) {
+                if (collectable(*it)) {
+                    newest = std::max(newest, it->second.version);
+                    it = eraseEntry(builder, stripe, it);
+                    collected++;
+                } else {
+                    ++it;
+                }
+            }
+        }
+        if (collected == 0)
+            return 0;
 
+        // 版本低于被回收墓碑的节点无法再通过增量更新得知删除
+        if (full_sync_version_ < newest)
+            full_sync_version_ = newest;
+        commit(builder, version_);
+        return collected;
+    }
+
+    std::pair<std::vector<uint64_t>, SlotVersion> GossipSlot::digest(const std::vector<int> &nodes) const {
+        std::lock_guard<std::mutex> lg(mtx);
+        warmLocked();
+
+        std::vector<uint64_t> hashes;
+        hashes.reserve(nodes.size());
+        for (auto node: nodes)
+            hashes.emplace_back(tree_.hash(node));
+        return {std::move(hashes), version_};
+    }
+
+    SlotSnapshotPtr GossipSlot::indexedSnapshot() {
+        auto current = snapshot();
+        if (current->index != nullptr)
+            return current;
+
+        std::lock_guard<std::mutex> lg(mtx);
+        if (snapshot_->index == nullptr) {
+            // 内容与版本都不变，只是发布一个带有有序索引的快照，之后的写入都会维护它
+            Builder builder(*snapshot_, nullptr);
+            builder.index();
+            publish(builder.build(version_));
+        }
+        return snapshot_;
+    }
 
+    std::pair<std::string, SlotVersion> GossipSlot::find(const std::string &key) const {
+        auto guard = GossipEpoch::pin();
+        // 冷 slot 直接在映射的镜像上查找
+        if (auto image = cold_.load()) {
+            auto entry = image->find(image_index_, key);
+            if (!entry || entry->deleted || (entry->expires != 0 && entry->expires <= GossipClock::millis()))
+                return {"", 0};
+            return {std::string(entry->value), entry->version};
+        }
+        auto entry = current_.load()->find(key);
+        if (entry == nullptr)
+            return {"", 0};
+        return {entry->value, entry->version};
+    }
+
+
+}
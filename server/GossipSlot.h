@@ -5,59 +5,327 @@
 #ifndef GOSSIP_GOSSIPSLOT_H
 #define GOSSIP_GOSSIPSLOT_H
 
+#include "GossipClock.h"
+#include "GossipEpoch.h"
+#include "GossipKeyIndex.h"
+#include "GossipMerkleTree.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <mutex>
+#include <vector>
 
 namespace gossip::server {
 
-    using SlotVersion = long;
-    using SlotValues = std::unordered_map<std::string, std::string>;
+    /// @brief Value of a K-V pair with its own version.
+    /// @details Every K-V pair in GossipSlot records the slot version at which it was last written, so a slot can
+    /// tell which pairs changed since a given version. A delete leaves a tombstone with the version of the delete,
+    /// so it is sent in delta updates like a write, until it is garbage collected.
+    /// A K-V pair written with a TTL expires at the physical time of its version plus the TTL. Every replica gets
+    /// the same expiration from the same version, so each one turns the K-V pair into a tombstone of that version
+    /// by itself, and nothing has to be gossiped for it.
+    struct SlotEntry {
+        /// The value of K-V pair
+        std::string value;
+        /// The slot version when this K-V pair was last written
+        SlotVersion version = 0;
+        /// This K-V pair is a tombstone and its value is empty
+        bool deleted = false;
+        /// Wall clock time in milliseconds when this K-V pair expires, 0 if it never expires
+        int64_t expires = 0;
+
+        /// Check if this K-V pair has expired.
+        /// \param now Wall clock time in milliseconds
+        /// \return If expiration time has passed
+        [[nodiscard]] bool expired(int64_t now) const {
+            return expires != 0 && expires <= now;
+        }
+
+        /// Get the expiration time of a K-V pair written with a TTL.
+        /// \param version Version of K-V pair
+        /// \param ttl_ms TTL in milliseconds, 0 means never expire
+        /// \return Expiration time in milliseconds, 0 if it never expires
+        static int64_t expiration(SlotVersion version, int64_t ttl_ms) {
+            return ttl_ms > 0 ? GossipClock::physical(version) + ttl_ms : 0;
+        }
+    };
+
+    using SlotValues = std::unordered_map<std::string, SlotEntry>;
+
+    /// Versions of slots by slot name.
+    using SlotVersions = std::unordered_map<std::string, SlotVersion>;
+
+    /// @brief A put or delete of a write batch.
+    struct SlotOperation {
+        /// The key of K-V pair
+        std::string key;
+        /// The value of K-V pair, ignored by delete
+        std::string value;
+        /// Delete the K-V pair instead of writing it
+        bool remove = false;
+        /// TTL of the K-V pair in milliseconds, 0 means never expire
+        int64_t ttl_ms = 0;
+    };
+
+    using SlotBatch = std::vector<SlotOperation>;
+
+    /// K-V pairs of a snapshot stripe sorted by key. A stripe only holds tens of K-V pairs, and a sorted vector is
+    /// much cheaper to copy on write than a hash map.
+    using SlotStripe = std::vector<std::pair<std::string, SlotEntry>>;
+
+    /// @brief Keys of a snapshot in order.
+    /// @details SlotIndex is a two level B+ tree: keys are kept in sorted leaves of at most kLeafSize keys, and
+    /// leaves are ordered by their first key. Like stripes, a leaf is never modified after its snapshot is published
+    /// and is shared by later snapshots, so a write copies the array of leaf pointers and only the leaves it changes.
+    /// Only a new key or an erased key changes the index, overwriting a K-V pair or leaving a tombstone doesn't.
+    struct SlotIndex {
+
+        /// Max number of keys of a leaf, a leaf is split in two when it grows beyond it.
+        static constexpr size_t kLeafSize = 512;
+
+        using Leaf = std::vector<std::string>;
+
+        /// Get the leaf that a key belongs to, which is the last leaf whose first key is not greater than it.
+        /// \param key The key
+        /// \return The leaf index, 0 if key is less than all keys
+        [[nodiscard]] size_t leafOf(const std::string &key) const {
+            auto it = std::upper_bound(leaves.begin(), leaves.end(), key,
+                                       [](const std::string &k, const auto &leaf) { return k < leaf->front(); });
+            return it == leaves.begin() ? 0 : it - leaves.begin() - 1;
+        }
+
+        /// Get the end of keys starting with a prefix, which is the smallest key greater than all of them.
+        /// \param prefix The prefix
+        /// \return End of prefix, or empty if there is no upper bound
+        static std::string prefixEnd(std::string prefix) {
+            while (!prefix.empty() && static_cast<unsigned char>(prefix.back()) == 0xff)
+                prefix.pop_back();
+            if (!prefix.empty())
+                prefix.back() = static_cast<char>(prefix.back() + 1);
+            return prefix;
+        }
+
+        std::vector<std::shared_ptr<const Leaf>> leaves;    // 叶子节点都不为空，并且不会再被修改
+    };
+
+    /// @brief Immutable view of all K-V pairs of a GossipSlot at one version.
+    /// @details A snapshot is never modified after it is published, so it can be read by any number of threads
+    /// without locks. K-V pairs are split into stripes by merkle leaf, and a new snapshot shares all stripes that
+    /// are not changed by a write with the previous one. Holding a snapshot keeps it alive, memory is reclaimed
+    /// when the last reader releases it.
+    struct SlotSnapshot : std::enable_shared_from_this<SlotSnapshot> {
+
+        /// The number of stripes of a snapshot.
+        static constexpr int kStripes = GossipMerkleTree::kLeaves;
+
+        /// Get the stripe index of a key. Stripes are chosen by merkle leaf, so all K-V pairs in a leaf are in the
+        /// same stripe.
+        /// \param key The key of K-V pair
+        /// \return The stripe index of key
+        static int stripeOf(const std::string &key) {
+            return GossipMerkleTree::leafOf(key) % kStripes;
+        }
+
+        /// Get the first K-V pair whose key is not less than assigned key in a stripe.
+        /// \param stripe Sorted stripe
+        /// \param key The key of K-V pair
+        /// \return Iterator of K-V pair
+        template<class Stripe>
+        static auto lowerBound(Stripe &stripe, const std::string &key) {
+            return std::lower_bound(stripe.begin(), stripe.end(), key,
+                                    [](const auto &kv, const std::string &k) { return kv.first < k; });
+        }
+
+        /// Get a K-V pair in this snapshot, tombstones and expired K-V pairs are not found.
+        /// \param key The key of K-V pair
+        /// \return Pointer to value and version or nullptr if not found, valid while the snapshot is alive
+        [[nodiscard]] const SlotEntry *find(const std::string &key) const {
+            auto entry = lookup(key);
+            if (entry == nullptr || entry->deleted)
+                return nullptr;
+            // 只有带 TTL 的键值对需要读取时钟
+            return entry->expires != 0 && entry->expired(GossipClock::millis()) ? nullptr : entry;
+        }
+
+        /// Get a K-V pair or tombstone in this snapshot.
+        /// \param key The key of K-V pair
+        /// \return Pointer to value and version or nullptr if not found, valid while the snapshot is alive
+        [[nodiscard]] const SlotEntry *lookup(const std::string &key) const {
+            auto &stripe = *stripes[stripeOf(key)];
+            auto it = lowerBound(stripe, key);
+            return it == stripe.end() || it->first != key ? nullptr : &it->second;
+        }
+
+
+        /// Call func(key, entry) for every K-V pair and tombstone in this snapshot.
+        /// \param func Function to call
+        template<class Func>
+        void forEach(Func &&func) const {
+            for (auto &stripe: stripes) {
+                for (auto &[key, entry]: *stripe)
+                    func(key, entry);
+            }
+        }
+
+        /// Call func(key, entry) for every K-V pair and tombstone in some merkle tree leaves. Only stripes of these
+        /// leaves are visited.
+        /// \param leaves Leaf indexes
+        /// \param func Function to call
+        template<class Func>
+        void forEachInLeaves(const std::vector<int> &leaves, Func &&func) const {
+            std::vector<bool> covered(GossipMerkleTree::kLeaves, false), visit(kStripes, false);
+            for (auto leaf: leaves) {
+                if (leaf >= 0 && leaf < GossipMerkleTree::kLeaves) {
+                    covered[leaf] = true;
+                    visit[leaf % kStripes] = true;
+                }
+            }
+            // 同一个叶子节点的键值对都在同一个 stripe 中
+            for (int i = 0; i < kStripes; i++) {
+                if (!visit[i])
+                    continue;
+                for (auto &[key, entry]: *stripes[i]) {
+                    if (covered[GossipMerkleTree::leafOf(key)])
+                        func(key, entry);
+                }
+            }
+        }
+
+        /// Get the number of K-V pairs in this snapshot, including tombstones.
+        /// \return The number of K-V pairs
+        [[nodiscard]] size_t size() const {
+            size_t size = 0;
+            for (auto &stripe: stripes)
+                size += stripe->size();
+            return size;
+        }
+
+        std::array<std::shared_ptr<const SlotStripe>, kStripes> stripes;    // 每个 stripe 都不会再被修改
+        std::shared_ptr<const SlotIndex> index; // 键的有序索引，slot 第一次被扫描之前为空
+        SlotVersion version = 0;    // 快照对应的 slot 版本
+    };
+
+    using SlotSnapshotPtr = std::shared_ptr<const SlotSnapshot>;
+
+    /// @brief Iterates K-V pairs of a snapshot in key order.
+    /// @details A SlotScanner walks the ordered index of a snapshot and finds every key in its stripe. The snapshot
+    /// is pinned by the scanner, so writes published later are not seen and a scan can be paused and resumed at any
+    /// time. Tombstones and K-V pairs expired when the scanner is created are skipped.
+    class SlotScanner {
+    public:
+
+        /// Constructor of SlotScanner.
+        /// \param snapshot Snapshot to scan, it must have an ordered index
+        /// \param start First key, inclusive
+        /// \param end Last key, exclusive. Empty means no upper bound
+        SlotScanner(SlotSnapshotPtr snapshot, const std::string &start, std::string end);
+
+        /// Move to the next K-V pair in range.
+        /// \return False if there are no more K-V pairs
+        bool next();
+
+        /// Get the key of current K-V pair.
+        /// \return The key, valid while scanner is alive
+        [[nodiscard]] const std::string &key() const {
+            return (*snapshot_->index->leaves[leaf_])[offset_];
+        }
+
+        /// Get the value and version of current K-V pair.
+        /// \return The entry, valid while scanner is alive
+        [[nodiscard]] const SlotEntry &entry() const {
+            return *entry_;
+        }
+
+    private:
+        SlotSnapshotPtr snapshot_;
+        std::string end_;
+        int64_t now_;   // 判断过期使用的时间，整个扫描使用同一个时间
+        size_t leaf_ = 0;
+        size_t offset_ = 0;
+        bool started_ = false;  // next 第一次调用时停留在起始位置
+        const SlotEntry *entry_ = nullptr;
+    };
+
+    class GossipSlotImage;
 
     /// @brief Memory map with different slots and versions.
     /// @details Class GossipSlot stores all K-V pairs generated by certain GossipNode. A GossipSlot only stores data from that GossipNode.
+    /// Reads never take a lock: the current content of a slot is an immutable SlotSnapshot, and readers only load
+    /// the pointer of it inside a GossipEpoch pin. Writers are serialized by a slot level mutex, which also protects
+    /// the merkle tree. A writer copies the stripes it changes, builds a new snapshot, publishes it with one atomic
+    /// store and retires the old one to GossipEpoch.
+    /// A slot restored at warm start is cold: its K-V pairs stay in a mapped GossipSlotImage and single key reads are
+    /// served from the image. It is loaded into memory on the first write, merge, digest or snapshot.
+    /// A slot of a GossipNode reports the keys it adds and erases to the GossipKeyIndex of node: new keys before the
+    /// snapshot holding them is published, erased keys after it, so a search never misses a published key.
     class GossipSlot {
     public:
 
+        /// The number of stripes of a slot.
+        static constexpr int kStripes = SlotSnapshot::kStripes;
+
         /// Construction of GossipSlot, the name of a slot represents a node's name.
         /// \param name Slot name of GossipSlot.
-        explicit GossipSlot(std::string name) : name_(std::move(name)), version_(0) {}
+        /// \param keys Key index that this slot reports its keys to, nullptr if the slot is not indexed
+        explicit GossipSlot(std::string name, GossipKeyIndex *keys = nullptr);
 
-        GossipSlot(const GossipSlot &other) : name_(other.name_), version_(other.version_), map_(other.map_) {}
+        /// Copy a slot. The copy is not indexed.
+        GossipSlot(const GossipSlot &other) : name_(other.name_), current_(nullptr), version_(0) {
+            *this = other;
+        }
+
+        GossipSlot &operator=(const GossipSlot &other);
+
+        /// Serve an empty slot from a mapped image until it is loaded. The slot takes the versions of image.
+        /// \param image Mapped image
+        /// \param index Index of this slot in image
+        void attach(std::shared_ptr<const GossipSlotImage> image, size_t index);
 
-        GossipSlot &operator=(const GossipSlot &other) {
-            name_ = other.name_;
-            version_ = other.version_;
-            map_ = other.map_;
-            return *this;
+        /// Check if this slot is still served from a mapped image.
+        /// \return If slot is cold
+        [[nodiscard]] bool cold() const {
+            return cold_.load() != nullptr;
         }
 
+        /// Get the image of a cold slot.
+        /// \param index Stores the index of this slot in image
+        /// \return Mapped image, or nullptr if slot is loaded
+        std::shared_ptr<const GossipSlotImage> image(size_t *index) const;
+
         /// Insert or update a K-V pair and update version of slot automatically.
         /// \param key The key of K-V pair
         /// \param value The value of K-V pair
+        /// \param previous If not nullptr, stores the slot version before this update
+        /// \param ttl_ms TTL of K-V pair in milliseconds, 0 means never expire
         /// \return Updated slot version
-        SlotVersion insertOrUpdate(const std::string &key, const std::string &value);
-
-        /// Insert or update a K-V pair and set slot version to assigned value. If assigned version value is less than
-        /// current version, the function will do nothing.
-        /// \param key The key of K-V pair
-        /// \param value The value of K-V pair
-        /// \param version Assigned slot version
-        /// \return Assigned slot version if succeed or -1 if failed
-        SlotVersion insertOrUpdate(const std::string &key, const std::string &value, SlotVersion version);
+        SlotVersion insertOrUpdate(const std::string &key, const std::string &value, SlotVersion *previous = nullptr,
+                                   int64_t ttl_ms = 0);
 
-        /// Delete a K-V pair in current slot.
+        /// Delete a K-V pair in current slot. The K-V pair is replaced by a tombstone with the new slot version,
+        /// so peers receive the deletion in delta updates.
         /// \param key The key of K-V pair
         /// \return Updated slot version if succeed or -1 if failed
         SlotVersion remove(const std::string &key);
 
-        /// Delete a K-V pair in current slot and set slot version to assigned value.
+        /// Delete a K-V pair in current slot and set slot version to assigned value, leaving a tombstone.
         /// \param key The key of K-V pair
         /// \param version Assigned slot version
         /// \return Assigned slot version if succeed or -1 if failed
         SlotVersion remove(const std::string &key, SlotVersion version);
 
+        /// Apply puts and deletes in order under one lock. All changed K-V pairs share one new slot version and are
+        /// published as one snapshot. Deletes leave tombstones, and deletes of keys that don't exist are ignored.
+        /// \param batch Operations to apply
+        /// \param previous If not nullptr, stores the slot version before this batch
+        /// \param applied If not nullptr, stores the number of operations that changed the slot
+        /// \return Updated slot version or -1 if nothing is changed
+        SlotVersion applyBatch(const SlotBatch &batch, SlotVersion *previous = nullptr, int *applied = nullptr);
+
         /// Get current version of this slot.
         /// \return Current version
         [[nodiscard]] SlotVersion version() const {
@@ -70,23 +338,80 @@ namespace gossip::server {
             return name_;
         }
 
-        /// Merge this slot with given SlotValues, if assigned version is less than current version, function will do nothing.
+        /// Get the version of latest change that can't be sent as a delta, which is a full update or the newest
+        /// tombstone that is garbage collected. Peers whose version is less than it must receive a full slot update.
+        /// \return Latest full sync version
+        [[nodiscard]] SlotVersion fullSyncVersion() const {
+            return full_sync_version_;
+        }
+
+        /// Merge this slot with given SlotValues. A full update replaces all K-V pairs if assigned version is not
+        /// less than current version. A delta update only contains K-V pairs changed after base version, and it is
+        /// merged in place by comparing the version of every K-V pair. The slot version only moves forward when
+        /// this slot has already seen base version, otherwise some changes may be missing.
         /// \param values New values of this slot
         /// \param version Assigned version
-        /// \return Assigned slot version if succeed or -1 if failed
-        SlotVersion compareAndMergeSlot(SlotValues values, SlotVersion version);
+        /// \param delta Is values a delta update
+        /// \param base The base version of delta update
+        /// \return Slot version after merge or -1 if failed
+        SlotVersion compareAndMergeSlot(SlotValues values, SlotVersion version, bool delta = false,
+                                        SlotVersion base = 0);
+
+        /// Merge this slot with all K-V pairs in some merkle tree leaves. K-V pairs in these leaves that are not in
+        /// values and not newer than assigned version are removed, so deletions are also synchronized. After merge,
+        /// the slot version is set to assigned version if it is larger.
+        /// \param leaves Leaf indexes that values cover
+        /// \param values All K-V pairs in leaves
+        /// \param version Assigned version
+        /// \return Slot version after merge
+        SlotVersion mergeLeaves(const std::vector<int> &leaves, SlotValues values, SlotVersion version);
+
+        /// Turn expired K-V pairs into tombstones of their own versions. Slot version and merkle tree are not
+        /// changed, so replicas that expire at different moments still agree. A K-V pair that has been written
+        /// again since is skipped.
+        /// \param keys Keys with the versions they expire at
+        /// \param now Wall clock time in milliseconds
+        /// \return The number of expired K-V pairs
+        size_t expire(const std::vector<std::pair<std::string, SlotVersion>> &keys, int64_t now);
+
+        /// Garbage collect tombstones that all peers have seen. Peers whose version is less than a collected
+        /// tombstone can't learn the deletion from a delta any more, so full sync version is raised to the newest
+        /// collected tombstone. A cold slot is not loaded, its tombstones are collected after it is loaded.
+        /// \param horizon Tombstones not newer than it are collected
+        /// \return The number of collected tombstones
+        size_t collect(SlotVersion horizon);
+
+        /// Get the number of tombstones in this slot.
+        /// \return The number of tombstones
+        [[nodiscard]] size_t tombstones() const {
+            return tombstones_;
+        }
+
+        /// Get the merkle tree hashes of assigned tree nodes.
+        /// \param nodes Indexes of tree nodes
+        /// \return [hashes of tree nodes, slot version]
+        [[nodiscard]] std::pair<std::vector<uint64_t>, SlotVersion> digest(const std::vector<int> &nodes) const;
 
         /// Get value and version of a K-V pair in this slot.
         /// \param key The key of K-V pair
-        /// \return [value , version] if succeed or ["", 0] if not found
-        std::pair<std::string, SlotVersion> find(const std::string &key);
+        /// \return [value , version] if succeed or ["", 0] if not found, deleted or expired
+        std::pair<std::string, SlotVersion> find(const std::string &key) const;
 
-        /// Get the Copy of K-V pairs in this slot.
-        /// \return Copy of K-V pairs, struct format is std::unordered_map
-        [[nodiscard]] SlotValues messages() const {
-            return map_;
+        /// Pin the current content of this slot. The snapshot doesn't change with later writes, and getting it
+        /// doesn't copy any K-V pair. A cold slot is loaded first.
+        /// \return Current snapshot
+        [[nodiscard]] SlotSnapshotPtr snapshot() const {
+            if (cold())
+                warm();
+            auto guard = GossipEpoch::pin();
+            return current_.load()->shared_from_this();
         }
 
+        /// Pin the current content of this slot with its ordered index. The index is built on the first call, and
+        /// every write after that keeps it up to date, so slots that are never scanned don't pay for it.
+        /// \return Current snapshot with ordered index
+        SlotSnapshotPtr indexedSnapshot();
+
         /// Get approximate memory use of this slot.
         /// \return Approximate memory use
         [[nodiscard]] size_t approximateMemoryUse() const {
@@ -95,11 +420,126 @@ namespace gossip::server {
 
     private:
 
-        std::mutex mtx; // mutex of this slot
+        /// @brief Copy-on-write builder of the next snapshot.
+        /// @details Stripes are copied on first change, unchanged stripes are shared with current snapshot.
+        class Builder {
+        public:
+            /// Constructor of Builder.
+            /// \param current Current snapshot
+            /// \param keys Key index of slot, added and erased keys are recorded if it is not nullptr
+            Builder(const SlotSnapshot &current, GossipKeyIndex *keys)
+                    : next_(std::make_shared<SlotSnapshot>(current)), keys_(keys) {}
+
+            /// Get a writable stripe of next snapshot.
+            /// \param index The stripe index
+            /// \return Writable stripe
+            SlotStripe &stripe(int index);
+
+            /// Replace a stripe of next snapshot. The ordered index is rebuilt when building, and keys that are
+            /// added or erased by replacement are recorded.
+            /// \param index The stripe index
+            /// \param values New K-V pairs of stripe, sorted by key
+            void reset(int index, SlotStripe values);
+
+            /// Add a new key to the ordered index of next snapshot, if the slot has one, and record it.
+            /// \param key The key
+            void insertKey(const std::string &key);
+
+            /// Remove a key from the ordered index of next snapshot, if the slot has one, and record it.
+            /// \param key The key
+            void eraseKey(const std::string &key);
+
+            /// Get the hashes of recorded new keys.
+            /// \return Hashes of keys
+            [[nodiscard]] const std::vector<uint64_t> &added() const {
+                return added_;
+            }
+
+            /// Get the hashes of recorded erased keys.
+            /// \return Hashes of keys
+            [[nodiscard]] const std::vector<uint64_t> &erased() const {
+                return erased_;
+            }
+
+            /// Build an ordered index of all keys for next snapshot.
+            void index();
+
+            /// Finish building with the version of next snapshot.
+            /// \param version The version of next snapshot
+            /// \return Next snapshot
+            SlotSnapshotPtr build(SlotVersion version);
+
+        private:
+
+            /// Get the writable ordered index of next snapshot, it is copied on first change.
+            /// \return Writable index or nullptr if the slot has no ordered index
+            SlotIndex *mutableIndex();
+
+            /// Get a writable leaf of the ordered index of next snapshot.
+            /// \param index The leaf index
+            /// \return Writable leaf
+            SlotIndex::Leaf &leaf(size_t index);
+
+        private:
+            std::shared_ptr<SlotSnapshot> next_;
+            std::array<std::shared_ptr<SlotStripe>, kStripes> copies_;  // 已经复制过的 stripe
+            std::shared_ptr<SlotIndex> index_;  // 已经复制过的有序索引
+            std::vector<std::shared_ptr<SlotIndex::Leaf>> leaves_;  // 与 index_ 的叶子一一对应，已经复制过的叶子
+            bool reindex_ = false;  // stripe 被整体替换，需要重建有序索引
+            GossipKeyIndex *keys_;  // 为空时不记录新增与删除的键
+            std::vector<uint64_t> added_, erased_;  // 新增与删除的键的哈希值
+        };
+
+        /// Load K-V pairs of a cold slot from its image. Loading doesn't change the content of slot, so it is
+        /// allowed in const functions.
+        void warm() const;
+
+        /// Load K-V pairs of a cold slot from its image. Caller must hold slot mutex.
+        void warmLocked() const;
+
+        /// Get a new slot version from hybrid logical clock, it is larger than current version.
+        /// \return New slot version
+        SlotVersion nextVersion() const;
+
+        /// Publish a new snapshot. Caller must hold slot mutex.
+        /// \param snapshot New snapshot
+        void publish(SlotSnapshotPtr snapshot);
+
+        /// Build and publish the next snapshot, and report added and erased keys to key index. Caller must hold
+        /// slot mutex.
+        /// \param builder Builder of next snapshot
+        /// \param version The version of next snapshot
+        void commit(Builder &builder, SlotVersion version);
+
+        /// Insert or replace a K-V pair in next snapshot if it is newer. Caller must hold slot mutex.
+        /// \param builder Builder of next snapshot
+        /// \param key The key of K-V pair
+        /// \param entry The value and version of K-V pair
+        /// \param force Replace K-V pair even if it isn't newer
+        void putEntry(Builder &builder, std::string key, SlotEntry entry, bool force);
+
+        /// Erase a K-V pair or tombstone in a stripe of next snapshot. Caller must hold slot mutex.
+        /// \param builder Builder of next snapshot
+        /// \param stripe The writable stripe of key
+        /// \param it The iterator of K-V pair
+        /// \return The iterator after erased K-V pair
+        SlotStripe::iterator eraseEntry(Builder &builder, SlotStripe &stripe, SlotStripe::iterator it);
+
+    private:
+
+        mutable std::mutex mtx; // 写操作之间的互斥锁，同时保护 merkle 树
         std::string name_;  // name of this slot
-        SlotValues map_;    // K-V pairs of this slot
-        SlotVersion version_;   // version of this slot
-        size_t mem_use_ = 0; // approximate memory use
+        SlotSnapshotPtr snapshot_;   // K-V pairs of this slot, 持有当前快照，受 mtx 保护
+        std::atomic<const SlotSnapshot *> current_; // 读者使用的当前快照指针，与 snapshot_ 相同
+        std::atomic<SlotVersion> version_;   // version of this slot
+        std::atomic<SlotVersion> full_sync_version_{0}; // 全量更新或被回收的墓碑的版本，低于这个版本的节点需要全量更新
+        GossipMerkleTree tree_; // merkle tree of K-V pairs, updated with snapshot_
+        std::atomic<size_t> mem_use_{0}; // approximate memory use
+        std::atomic<size_t> tombstones_{0}; // 墓碑数量
+        std::shared_ptr<const GossipSlotImage> image_;  // 冷启动时映射的镜像，受 mtx 保护，加载后交给 GossipEpoch 释放
+        std::atomic<const GossipSlotImage *> cold_{nullptr};    // 读者使用的镜像指针，与 image_ 相同
+        size_t image_index_ = 0;    // 本 slot 在镜像中的下标
+        GossipKeyIndex *keys_ = nullptr;    // 所属节点的键索引，为空时不报告键的变化
     };
 
 }
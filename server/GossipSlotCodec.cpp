@@ -0,0 +1,163 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipSlotCodec.h"
+
+#include <google/protobuf/io/coded_stream.h>
+
+namespace gossip::server {
+
+    using google::protobuf::io::CodedOutputStream;
+
+    namespace {
+
+        // SlotUpdate.messages 和 Message 各个字段的 tag，见 Gossip.proto
+        constexpr uint32_t kMessagesTag = (3 << 3) | 2;
+        constexpr uint32_t kKeyTag = (1 << 3) | 2;
+        constexpr uint32_t kValueTag = (2 << 3) | 2;
+        constexpr uint32_t kVersionTag = (3 << 3) | 0;
+        constexpr uint32_t kDeletedTag = (4 << 3) | 0;
+        constexpr uint32_t kTtlTag = (5 << 3) | 0;
+
+        /// Get the TTL to encode, the receiver adds it to the physical time of version again.
+        int64_t ttlOf(const SlotEntry &entry) {
+            return entry.expires == 0 ? 0 : entry.expires - GossipClock::physical(entry.version);
+        }
+
+        /// Get encoded size of a length delimited field with one byte tag.
+        size_t bytesFieldSize(const std::string &bytes) {
+            return bytes.empty() ? 0 : 1 + CodedOutputStream::VarintSize32(bytes.size()) + bytes.size();
+        }
+
+        /// Get encoded size of a Message without tag and length.
+        size_t messageSize(const std::string &key, const SlotEntry &entry) {
+            size_t size = bytesFieldSize(key) + bytesFieldSize(entry.value);
+            if (entry.version != 0)
+                size += 1 + CodedOutputStream::VarintSize64(static_cast<uint64_t>(entry.version));
+            if (entry.deleted)
+                size += 2;
+            if (auto ttl = ttlOf(entry); ttl > 0)
+                size += 1 + CodedOutputStream::VarintSize64(static_cast<uint64_t>(ttl));
+            return size;
+        }
+
+        uint8_t *writeBytesField(uint32_t tag, const std::string &bytes, uint8_t *target) {
+            if (bytes.empty())
+                return target;
+            target = CodedOutputStream::WriteTagToArray(tag, target);
+            return CodedOutputStream::WriteStringWithSizeToArray(bytes, target);
+        }
+
+        /// Hand a string to grpc without copying, the string is released with the slice.
+        grpc::ByteBuffer toByteBuffer(std::string *bytes) {
+            grpc::Slice slice(bytes->data(), bytes->size(), [](void *str) {
+                delete static_cast<std::string *>(str);
+            }, bytes);
+            return {&slice, 1};
+        }
+
+    }
+
+    grpc::ByteBuffer GossipSlotCodec::encode(const pf_gossip::SlotUpdate &header, const SlotSnapshot &snapshot,
+                                             const Filter &filter) {
+        auto bytes = new std::string;
+        encode(header, snapshot, filter, bytes);
+        return toByteBuffer(bytes);
+    }
+
+    void GossipSlotCodec::encode(const pf_gossip::SlotUpdate &header, const SlotSnapshot &snapshot,
+                                 const Filter &filter, std::string *bytes) {
+        std::vector<SlotCodecEntry> entries;
+        entries.reserve(snapshot.size());
+        snapshot.forEach([&](const std::string &key, const SlotEntry &entry) {
+            if (!filter || filter(key, entry))
+                entries.emplace_back(&key, &entry);
+        });
+        encode(header, entries, bytes);
+    }
+
+    grpc::ByteBuffer GossipSlotCodec::encodeLeaves(const pf_gossip::SlotUpdate &header, const SlotSnapshot &snapshot,
+                                                   const std::vector<int> &leaves) {
+        std::vector<SlotCodecEntry> entries;
+        snapshot.forEachInLeaves(leaves, [&entries](const std::string &key, const SlotEntry &entry) {
+            entries.emplace_back(&key, &entry);
+        });
+        return encode(header, entries);
+    }
+
+    grpc::ByteBuffer GossipSlotCodec::encodeKeys(const pf_gossip::SlotUpdate &header, const SlotSnapshot &snapshot,
+                                                 const std::vector<std::string> &keys) {
+        std::vector<SlotCodecEntry> entries;
+        entries.reserve(keys.size());
+        for (auto &key: keys) {
+            // 被删除的键以墓碑发送
+            if (auto entry = snapshot.lookup(key))
+                entries.emplace_back(&key, entry);
+        }
+        return encode(header, entries);
+    }
+
+    grpc::ByteBuffer GossipSlotCodec::encode(const pf_gossip::SlotUpdate &update) {
+        return encode(update, std::vector<SlotCodecEntry>{});
+    }
+
+    grpc::ByteBuffer GossipSlotCodec::encode(const pf_gossip::SlotUpdate &header,
+                                             const std::vector<SlotCodecEntry> &entries) {
+        auto bytes = new std::string;
+        encode(header, entries, bytes);
+        return toByteBuffer(bytes);
+    }
+
+    void GossipSlotCodec::encode(const pf_gossip::SlotUpdate &header, const std::vector<SlotCodecEntry> &entries,
+                                 std::string *bytes) {
+
+        // 先计算出准确的长度，键值对只会被写入一次
+        size_t size = header.ByteSizeLong();
+        for (auto [key, entry]: entries) {
+            auto message_size = messageSize(*key, *entry);
+            size += 1 + CodedOutputStream::VarintSize32(message_size) + message_size;
+        }
+
+        bytes->assign(size, '\0');
+        auto target = reinterpret_cast<uint8_t *>(bytes->data());
+        target = header.SerializeWithCachedSizesToArray(target);
+
+        for (auto [k, e]: entries) {
+            auto &key = *k;
+            auto &entry = *e;
+            target = CodedOutputStream::WriteTagToArray(kMessagesTag, target);
+            target = CodedOutputStream::WriteVarint32ToArray(messageSize(key, entry), target);
+            target = writeBytesField(kKeyTag, key, target);
+            target = writeBytesField(kValueTag, entry.value, target);
+            if (entry.version != 0) {
+                target = CodedOutputStream::WriteTagToArray(kVersionTag, target);
+                target = CodedOutputStream::WriteVarint64ToArray(static_cast<uint64_t>(entry.version), target);
+            }
+            if (entry.deleted) {
+                target = CodedOutputStream::WriteTagToArray(kDeletedTag, target);
+                target = CodedOutputStream::WriteVarint32ToArray(1, target);
+            }
+            if (auto ttl = ttlOf(entry); ttl > 0) {
+                target = CodedOutputStream::WriteTagToArray(kTtlTag, target);
+                target = CodedOutputStream::WriteVarint64ToArray(static_cast<uint64_t>(ttl), target);
+            }
+        }
+    }
+
+    SlotValues GossipSlotCodec::decode(pf_gossip::SlotUpdate *update) {
+        SlotValues values;
+        values.reserve(update->messages_size());
+        for (auto &message: *update->mutable_messages()) {
+            // 没有携带版本号的键值对使用 slot 的版本
+            auto version = message.version() > 0 ? message.version() : update->version();
+            // 发送的是 TTL，过期时间由版本重新计算，所有副本相同
+            values.emplace(std::move(*message.mutable_key()),
+                           SlotEntry{std::move(*message.mutable_value()), version, message.deleted(),
+                                     SlotEntry::expiration(version, message.ttl_ms())});
+        }
+        update->clear_messages();
+        return values;
+    }
+
+}
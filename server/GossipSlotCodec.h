@@ -0,0 +1,97 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPSLOTCODEC_H
+#define GOSSIP_GOSSIPSLOTCODEC_H
+
+#include "Gossip.pb.h"
+#include "GossipSlot.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <functional>
+
+namespace gossip::server {
+
+    /// A K-V pair to encode, pointing into a snapshot.
+    using SlotCodecEntry = std::pair<const std::string *, const SlotEntry *>;
+
+    /// @brief Conversion between slot storage and SlotUpdate wire bytes.
+    /// @details K-V pairs are written to wire format straight from a SlotSnapshot, without building a SlotUpdate
+    /// message first, and the encoded bytes are shared by all peers an update is sent to. On the receive side, keys
+    /// and values are moved out of the parsed request, so a K-V pair is only copied when it is parsed.
+    class GossipSlotCodec {
+    public:
+
+        /// Select K-V pairs to encode.
+        using Filter = std::function<bool(const std::string &, const SlotEntry &)>;
+
+        /// Encode a SlotUpdate whose K-V pairs are read from a snapshot.
+        /// \param header SlotUpdate fields other than messages, its messages are also encoded if not empty
+        /// \param snapshot Snapshot that K-V pairs are read from
+        /// \param filter If not empty, only K-V pairs it accepts are encoded
+        /// \return Wire bytes of SlotUpdate
+        static grpc::ByteBuffer encode(const pf_gossip::SlotUpdate &header, const SlotSnapshot &snapshot,
+                                       const Filter &filter = nullptr);
+
+        /// Encode a SlotUpdate whose K-V pairs are read from a snapshot into a string, used when an update is
+        /// embedded in another message.
+        /// \param header SlotUpdate fields other than messages
+        /// \param snapshot Snapshot that K-V pairs are read from
+        /// \param filter If not empty, only K-V pairs it accepts are encoded
+        /// \param bytes Stores wire bytes of SlotUpdate
+        static void encode(const pf_gossip::SlotUpdate &header, const SlotSnapshot &snapshot, const Filter &filter,
+                           std::string *bytes);
+
+        /// Encode K-V pairs in some merkle tree leaves of a snapshot, only stripes of these leaves are visited.
+        /// \param header SlotUpdate fields other than messages
+        /// \param snapshot Snapshot that K-V pairs are read from
+        /// \param leaves Leaf indexes
+        /// \return Wire bytes of SlotUpdate
+        static grpc::ByteBuffer encodeLeaves(const pf_gossip::SlotUpdate &header, const SlotSnapshot &snapshot,
+                                             const std::vector<int> &leaves);
+
+        /// Encode some K-V pairs of a snapshot, deleted keys are encoded as tombstones. Keys that are not in snapshot
+        /// are skipped.
+        /// \param header SlotUpdate fields other than messages
+        /// \param snapshot Snapshot that K-V pairs are read from
+        /// \param keys Keys to encode
+        /// \return Wire bytes of SlotUpdate
+        static grpc::ByteBuffer encodeKeys(const pf_gossip::SlotUpdate &header, const SlotSnapshot &snapshot,
+                                           const std::vector<std::string> &keys);
+
+        /// Encode a SlotUpdate message.
+        /// \param update SlotUpdate message
+        /// \return Wire bytes of SlotUpdate
+        static grpc::ByteBuffer encode(const pf_gossip::SlotUpdate &update);
+
+        /// Move all K-V pairs out of a parsed SlotUpdate. K-V pairs without version use the slot version.
+        /// \param update Parsed SlotUpdate, its messages are left empty
+        /// \return K-V pairs of update
+        static SlotValues decode(pf_gossip::SlotUpdate *update);
+
+        /// Full method name of Gossip.pull, used to send encoded updates.
+        static constexpr const char *kPullMethod = "/pf_gossip.Gossip/pull";
+
+    private:
+
+        /// Encode header and selected K-V pairs.
+        /// \param header SlotUpdate fields other than messages
+        /// \param entries Selected K-V pairs
+        /// \return Wire bytes of SlotUpdate
+        static grpc::ByteBuffer encode(const pf_gossip::SlotUpdate &header,
+                                       const std::vector<SlotCodecEntry> &entries);
+
+        /// Encode header and selected K-V pairs into a string.
+        /// \param header SlotUpdate fields other than messages
+        /// \param entries Selected K-V pairs
+        /// \param bytes Stores wire bytes of SlotUpdate
+        static void encode(const pf_gossip::SlotUpdate &header, const std::vector<SlotCodecEntry> &entries,
+                           std::string *bytes);
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPSLOTCODEC_H
@@ -0,0 +1,334 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipSlotImage.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace gossip::server {
+
+    struct GossipSlotImage::Header {
+        char magic[8];
+        uint32_t format;
+        uint32_t slot_count;
+        uint64_t file_size;
+        uint64_t entries_offset;    // 键值对表的起始位置
+        uint64_t entry_count;
+        uint64_t data_offset;       // 名称、键与值的起始位置
+    };
+
+    struct GossipSlotImage::SlotRecord {
+        uint64_t name_offset;
+        uint64_t name_size;
+        int64_t version;
+        int64_t full_sync_version;
+        uint64_t first_entry;       // 在键值对表中的下标
+        uint64_t entry_count;
+    };
+
+    struct GossipSlotImage::EntryRecord {
+        uint64_t key_offset;
+        uint64_t value_offset;
+        uint32_t key_size;
+        uint32_t value_size;
+        int64_t version;
+        int64_t expires;
+        uint32_t flags;
+        uint32_t reserved;
+    };
+
+    namespace {
+
+        constexpr char kMagic[8] = {'G', 'S', 'I', 'M', 'A', 'G', 'E', '\0'};
+
+        constexpr uint32_t kDeleted = 1;    // 墓碑
+
+        /// Buffered writer of a file descriptor.
+        class FileWriter {
+        public:
+            explicit FileWriter(int fd) : fd_(fd) {
+                buffer_.reserve(kBufferSize);
+            }
+
+            void append(const void *data, size_t size) {
+                if (buffer_.size() + size > kBufferSize)
+                    flush();
+                if (size > kBufferSize) {
+                    write(static_cast<const char *>(data), size);
+                    return;
+                }
+                buffer_.append(static_cast<const char *>(data), size);
+            }
+
+            void flush() {
+                write(buffer_.data(), buffer_.size());
+                buffer_.clear();
+            }
+
+        private:
+            void write(const char *data, size_t size) {
+                while (size > 0) {
+                    auto written = ::write(fd_, data, size);
+                    if (written < 0)
+                        throw std::runtime_error("Slot Image Write Error");
+                    data += written;
+                    size -= static_cast<size_t>(written);
+                }
+            }
+
+            static constexpr size_t kBufferSize = 1 << 20;
+
+            int fd_;
+            std::string buffer_;
+        };
+
+        /// K-V pairs and versions of a slot to write, pointing into a snapshot or an image that is kept alive.
+        struct SlotSource {
+            std::string name;
+            SlotVersion version = 0;
+            SlotVersion full_sync_version = 0;
+            std::vector<GossipSlotImage::Entry> entries;
+            SlotSnapshotPtr snapshot;
+            std::shared_ptr<const GossipSlotImage> image;
+        };
+
+    }
+
+    std::shared_ptr<const GossipSlotImage> GossipSlotImage::open(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return nullptr;
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+            ::close(fd);
+            return nullptr;
+        }
+
+        auto size = static_cast<size_t>(st.st_size);
+        auto data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);    // 映射在关闭文件之后仍然有效
+        if (data == MAP_FAILED)
+            return nullptr;
+
+        std::shared_ptr<const GossipSlotImage> image(new GossipSlotImage(static_cast<const char *>(data), size));
+        if (!image->validate())
+            return nullptr;
+        return image;
+    }
+
+    size_t GossipSlotImage::write(const std::string &path, const std::vector<const GossipSlot *> &slots) {
+        std::vector<SlotSource> sources(slots.size());
+        uint64_t entry_count = 0, data_size = 0;
+
+        for (size_t i = 0; i < slots.size(); i++) {
+            auto &source = sources[i];
+            source.name = slots[i]->name();
+
+            // 仍然从镜像读取的 slot 直接复制镜像中的键值对，不需要加载到内存
+            size_t index;
+            if ((source.image = slots[i]->image(&index))) {
+                source.version = source.image->version(index);
+                source.full_sync_version = source.image->fullSyncVersion(index);
+                for (size_t j = 0; j < source.image->size(index); j++) {
+                    if (auto entry = source.image->entry(index, j))
+                        source.entries.emplace_back(*entry);
+                }
+            } else {
+                source.snapshot = slots[i]->snapshot();
+                source.version = source.snapshot->version;
+                source.full_sync_version = slots[i]->fullSyncVersion();
+                source.snapshot->forEach([&source](const std::string &key, const SlotEntry &entry) {
+                    source.entries.push_back({key, entry.value, entry.version, entry.deleted, entry.expires});
+                });
+                std::sort(source.entries.begin(), source.entries.end(),
+                          [](const Entry &a, const Entry &b) { return a.key < b.key; });
+            }
+
+            entry_count += source.entries.size();
+            data_size += source.name.size();
+            for (auto &entry: source.entries)
+                data_size += entry.key.size() + entry.value.size();
+        }
+
+        Header header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.format = kFormat;
+        header.slot_count = static_cast<uint32_t>(sources.size());
+        header.entries_offset = sizeof(Header) + sources.size() * sizeof(SlotRecord);
+        header.entry_count = entry_count;
+        header.data_offset = header.entries_offset + entry_count * sizeof(EntryRecord);
+        header.file_size = header.data_offset + data_size;
+
+        auto tmp = path + ".tmp";
+        int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+            throw std::runtime_error("Slot Image Open Error");
+
+        try {
+            FileWriter writer(fd);
+            writer.append(&header, sizeof(header));
+
+            // 按照文件中的顺序依次写入各个表，偏移量在写入时累加
+            uint64_t data = header.data_offset, first = 0;
+            for (auto &source: sources) {
+                SlotRecord record{};
+                record.name_offset = data;
+                record.name_size = source.name.size();
+                record.version = source.version;
+                record.full_sync_version = source.full_sync_version;
+                record.first_entry = first;
+                record.entry_count = source.entries.size();
+                writer.append(&record, sizeof(record));
+
+                data += source.name.size();
+                for (auto &entry: source.entries)
+                    data += entry.key.size() + entry.value.size();
+                first += source.entries.size();
+            }
+
+            data = header.data_offset;
+            for (auto &source: sources) {
+                data += source.name.size();
+                for (auto &entry: source.entries) {
+                    EntryRecord record{};
+                    record.key_offset = data;
+                    record.key_size = static_cast<uint32_t>(entry.key.size());
+                    record.value_offset = data + entry.key.size();
+                    record.value_size = static_cast<uint32_t>(entry.value.size());
+                    record.version = entry.version;
+                    record.expires = entry.expires;
+                    record.flags = entry.deleted ? kDeleted : 0;
+                    writer.append(&record, sizeof(record));
+                    data += entry.key.size() + entry.value.size();
+                }
+            }
+
+            for (auto &source: sources) {
+                writer.append(source.name.data(), source.name.size());
+                for (auto &entry: source.entries) {
+                    writer.append(entry.key.data(), entry.key.size());
+                    writer.append(entry.value.data(), entry.value.size());
+                }
+            }
+            writer.flush();
+
+        } catch (std::exception &) {
+            ::close(fd);
+            throw;
+        }
+
+        // 先写入临时文件再重命名，已经映射旧镜像的读者不受影响
+        bool ok = ::fsync(fd) == 0;
+        ::close(fd);
+        if (!ok || ::rename(tmp.c_str(), path.c_str()) != 0)
+            throw std::runtime_error("Slot Image Write Error");
+        return header.file_size;
+    }
+
+    GossipSlotImage::~GossipSlotImage() {
+        ::munmap(const_cast<char *>(data_), size_);
+    }
+
+    size_t GossipSlotImage::slots() const {
+        return header().slot_count;
+    }
+
+    std::string_view GossipSlotImage::name(size_t slot) const {
+        auto &record = slotRecord(slot);
+        return view(record.name_offset, record.name_size).value_or(std::string_view());
+    }
+
+    SlotVersion GossipSlotImage::version(size_t slot) const {
+        return slotRecord(slot).version;
+    }
+
+    SlotVersion GossipSlotImage::fullSyncVersion(size_t slot) const {
+        return slotRecord(slot).full_sync_version;
+    }
+
+    size_t GossipSlotImage::size(size_t slot) const {
+        return slotRecord(slot).entry_count;
+    }
+
+    std::optional<GossipSlotImage::Entry> GossipSlotImage::entry(size_t slot, size_t i) const {
+        auto &record = entryRecord(slot, i);
+        auto key = view(record.key_offset, record.key_size);
+        auto value = view(record.value_offset, record.value_size);
+        if (!key || !value)
+            return {};
+        return Entry{*key, *value, record.version, (record.flags & kDeleted) != 0, record.expires};
+    }
+
+    std::optional<GossipSlotImage::Entry> GossipSlotImage::find(size_t slot, const std::string &key) const {
+        // 键值对表按键排序，直接在映射的文件上二分查找
+        size_t low = 0, high = size(slot);
+        while (low < high) {
+            auto mid = low + (high - low) / 2;
+            auto &record = entryRecord(slot, mid);
+            auto current = view(record.key_offset, record.key_size);
+            if (!current)
+                return {};
+            if (*current < key) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        if (low == size(slot))
+            return {};
+        auto entry = this->entry(slot, low);
+        if (!entry || entry->key != key)
+            return {};
+        return entry;
+    }
+
+    bool GossipSlotImage::validate() const {
+        auto &head = header();
+        if (std::memcmp(head.magic, kMagic, sizeof(kMagic)) != 0 || head.format != kFormat ||
+            head.file_size != size_)
+            return false;
+
+        // 表的范围在打开时检查，键和值的范围在读取时检查
+        auto slots_end = sizeof(Header) + static_cast<uint64_t>(head.slot_count) * sizeof(SlotRecord);
+        if (head.entries_offset != slots_end || head.entry_count > (size_ - slots_end) / sizeof(EntryRecord) ||
+            head.data_offset != head.entries_offset + head.entry_count * sizeof(EntryRecord) ||
+            head.data_offset > size_)
+            return false;
+
+        for (size_t i = 0; i < head.slot_count; i++) {
+            auto &record = slotRecord(i);
+            if (record.first_entry > head.entry_count || record.entry_count > head.entry_count - record.first_entry ||
+                !view(record.name_offset, record.name_size))
+                return false;
+        }
+        return true;
+    }
+
+    const GossipSlotImage::Header &GossipSlotImage::header() const {
+        return *reinterpret_cast<const Header *>(data_);
+    }
+
+    const GossipSlotImage::SlotRecord &GossipSlotImage::slotRecord(size_t slot) const {
+        return reinterpret_cast<const SlotRecord *>(data_ + sizeof(Header))[slot];
+    }
+
+    const GossipSlotImage::EntryRecord &GossipSlotImage::entryRecord(size_t slot, size_t i) const {
+        auto entries = reinterpret_cast<const EntryRecord *>(data_ + header().entries_offset);
+        return entries[slotRecord(slot).first_entry + i];
+    }
+
+    std::optional<std::string_view> GossipSlotImage::view(uint64_t offset, uint64_t size) const {
+        if (offset > size_ || size > size_ - offset)
+            return {};
+        return std::string_view(data_ + offset, size);
+    }
+
+}
@@ -0,0 +1,139 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPSLOTIMAGE_H
+#define GOSSIP_GOSSIPSLOTIMAGE_H
+
+#include "GossipSlot.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gossip::server {
+
+    /// @brief Read-only memory mapped image of many slots, used for warm start.
+    /// @details An image file has a header, a slot table with the name and versions of every slot, an entry table
+    /// with the key, value, version, expiration and tombstone flag of every K-V pair sorted by key inside each slot,
+    /// and then the bytes of all names, keys and values. Every table record has a fixed size, so a K-V pair is
+    /// found by binary search on the mapped file without parsing or copying anything. Integers are stored in
+    /// native byte order, and the format version in header is checked when the file is opened. Files are written
+    /// to a temporary file and renamed, so a mapped image is never modified.
+    class GossipSlotImage {
+    public:
+
+        /// The format version written by this class.
+        static constexpr uint32_t kFormat = 3;
+
+        /// A K-V pair of image, pointing into mapped file.
+        struct Entry {
+            /// The key of K-V pair
+            std::string_view key;
+            /// The value of K-V pair
+            std::string_view value;
+            /// The version of K-V pair
+            SlotVersion version;
+            /// This K-V pair is a tombstone
+            bool deleted;
+            /// Expiration time of K-V pair in milliseconds, 0 if it never expires
+            int64_t expires;
+        };
+
+        /// Map an image file.
+        /// \param path Path of image file
+        /// \return Mapped image, or nullptr if file doesn't exist or is not a valid image of this format
+        static std::shared_ptr<const GossipSlotImage> open(const std::string &path);
+
+        /// Write an image of slots. Cold slots are copied from their images without being loaded.
+        /// \param path Path of image file, replaced atomically
+        /// \param slots Slots to write
+        /// \return Size of image file
+        /// \throw std::runtime_error if file can't be written
+        static size_t write(const std::string &path, const std::vector<const GossipSlot *> &slots);
+
+        ~GossipSlotImage();
+
+        GossipSlotImage(const GossipSlotImage &) = delete;
+
+        GossipSlotImage &operator=(const GossipSlotImage &) = delete;
+
+        /// Get the number of slots in image.
+        /// \return The number of slots
+        [[nodiscard]] size_t slots() const;
+
+        /// Get the name of a slot.
+        /// \param slot Index of slot
+        /// \return Slot name
+        [[nodiscard]] std::string_view name(size_t slot) const;
+
+        /// Get the version of a slot.
+        /// \param slot Index of slot
+        /// \return Slot version
+        [[nodiscard]] SlotVersion version(size_t slot) const;
+
+        /// Get the full sync version of a slot.
+        /// \param slot Index of slot
+        /// \return Full sync version of slot
+        [[nodiscard]] SlotVersion fullSyncVersion(size_t slot) const;
+
+        /// Get the number of K-V pairs of a slot.
+        /// \param slot Index of slot
+        /// \return The number of K-V pairs
+        [[nodiscard]] size_t size(size_t slot) const;
+
+        /// Get a K-V pair of a slot by position, K-V pairs are sorted by key.
+        /// \param slot Index of slot
+        /// \param i Position of K-V pair
+        /// \return K-V pair, empty if the record points out of file
+        [[nodiscard]] std::optional<Entry> entry(size_t slot, size_t i) const;
+
+        /// Find a K-V pair or tombstone of a slot by binary search.
+        /// \param slot Index of slot
+        /// \param key The key of K-V pair
+        /// \return K-V pair or empty if not found
+        [[nodiscard]] std::optional<Entry> find(size_t slot, const std::string &key) const;
+
+        /// Get the size of mapped file.
+        /// \return Size in bytes
+        [[nodiscard]] size_t bytes() const {
+            return size_;
+        }
+
+    private:
+
+        struct Header;
+        struct SlotRecord;
+        struct EntryRecord;
+
+        GossipSlotImage(const char *data, size_t size) : data_(data), size_(size) {}
+
+        /// Check that all tables are inside mapped file.
+        /// \return If image is valid
+        [[nodiscard]] bool validate() const;
+
+        [[nodiscard]] const Header &header() const;
+
+        [[nodiscard]] const SlotRecord &slotRecord(size_t slot) const;
+
+        [[nodiscard]] const EntryRecord &entryRecord(size_t slot, size_t i) const;
+
+        /// Get bytes of mapped file.
+        /// \param offset Offset in file
+        /// \param size The number of bytes
+        /// \return Bytes, empty if out of file
+        [[nodiscard]] std::optional<std::string_view> view(uint64_t offset, uint64_t size) const;
+
+    private:
+
+        const char *data_;  // 只读映射的文件内容
+        size_t size_;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPSLOTIMAGE_H
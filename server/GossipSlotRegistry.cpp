@@ -0,0 +1,64 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipSlotRegistry.h"
+
+namespace gossip::server {
+
+    GossipSlotRegistry::GossipSlotRegistry() {
+        for (auto &shard: shards_) {
+            shard.index = std::make_shared<const SlotIndex>();
+            shard.current = shard.index.get();
+        }
+    }
+
+    GossipSlot *GossipSlotRegistry::find(const std::string &name) const {
+        auto guard = GossipEpoch::pin();
+        auto &index = *shardOf(name).current.load();
+        auto it = index.find(name);
+        return it == index.end() ? nullptr : it->second;
+    }
+
+    std::pair<GossipSlot *, bool> GossipSlotRegistry::findOrCreate(const std::string &name) {
+        if (auto slot = find(name))
+            return {slot, false};
+
+        auto &shard = shardOf(name);
+        std::lock_guard<std::mutex> lg(shard.mtx);
+
+        // 加锁之后再检查一次，其他线程可能已经创建
+        auto it = shard.index->find(name);
+        if (it != shard.index->end())
+            return {it->second, false};
+
+        auto slot = &shard.slots.emplace_back(name, &keys_);
+
+        // 复制索引并发布，读者仍然使用旧索引，不会被阻塞
+        auto index = std::make_shared<SlotIndex>(*shard.index);
+        index->emplace(name, slot);
+        shard.current = index.get();
+        std::shared_ptr<const SlotIndex> retired = std::move(index);
+        std::swap(shard.index, retired);
+        GossipEpoch::retire(std::move(retired));
+
+        return {slot, true};
+    }
+
+    void GossipSlotRegistry::forEach(const std::function<void(const std::string &, GossipSlot &)> &func) const {
+        auto guard = GossipEpoch::pin();
+        for (auto &shard: shards_) {
+            for (auto &[name, slot]: *shard.current.load())
+                func(name, *slot);
+        }
+    }
+
+    size_t GossipSlotRegistry::size() const {
+        auto guard = GossipEpoch::pin();
+        size_t size = 0;
+        for (auto &shard: shards_)
+            size += shard.current.load()->size();
+        return size;
+    }
+
+}
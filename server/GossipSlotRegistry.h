@@ -0,0 +1,94 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPSLOTREGISTRY_H
+#define GOSSIP_GOSSIPSLOTREGISTRY_H
+
+#include "GossipEpoch.h"
+#include "GossipKeyIndex.h"
+#include "GossipSlot.h"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace gossip::server {
+
+    /// @brief Concurrent map from slot name to GossipSlot.
+    /// @details Class GossipSlotRegistry splits slot names into shards. Every shard publishes an immutable name
+    /// index like GossipSlot publishes its snapshot, so lookups and iterations never take a lock, and creating a
+    /// slot only locks the writers of one shard. Slots are never removed, so a GossipSlot pointer returned by the
+    /// registry stays valid until the registry is destroyed. All slots of a registry report their keys to one
+    /// GossipKeyIndex, so the slots holding a key are found without visiting every slot.
+    class GossipSlotRegistry {
+    public:
+
+        /// The number of shards of registry.
+        static constexpr int kShards = 16;
+
+        GossipSlotRegistry();
+
+        GossipSlotRegistry(const GossipSlotRegistry &) = delete;
+
+        GossipSlotRegistry &operator=(const GossipSlotRegistry &) = delete;
+
+        /// Find a slot by name without locking.
+        /// \param name Slot name
+        /// \return Pointer of slot or nullptr if not found
+        [[nodiscard]] GossipSlot *find(const std::string &name) const;
+
+        /// Find a slot by name and create it if not found.
+        /// \param name Slot name
+        /// \return [pointer of slot, is created]
+        std::pair<GossipSlot *, bool> findOrCreate(const std::string &name);
+
+        /// Call func(name, slot) for every slot. Slots created during iteration may be skipped.
+        /// \param func Function to call
+        void forEach(const std::function<void(const std::string &, GossipSlot &)> &func) const;
+
+        /// Get the number of slots.
+        /// \return The number of slots
+        [[nodiscard]] size_t size() const;
+
+        /// Get the key index of all slots.
+        /// \return Key index
+        [[nodiscard]] const GossipKeyIndex &keys() const {
+            return keys_;
+        }
+
+    private:
+
+        using SlotIndex = std::unordered_map<std::string, GossipSlot *>;
+
+        /// Slots whose names are hashed into the same shard.
+        struct Shard {
+            std::mutex mtx;     // 创建 slot 时的互斥锁
+            std::list<GossipSlot> slots;    // 拥有 slot，list 保证地址不会改变
+            std::shared_ptr<const SlotIndex> index;     // 当前索引，受 mtx 保护
+            std::atomic<const SlotIndex *> current{nullptr};    // 读者使用的索引指针，与 index 相同
+        };
+
+        /// Get the shard of a slot name.
+        /// \param name Slot name
+        /// \return The shard of name
+        Shard &shardOf(const std::string &name) const {
+            return shards_[std::hash<std::string>{}(name) % kShards];
+        }
+
+    private:
+
+        GossipKeyIndex keys_;   // 所有 slot 的键索引，需要在 slot 之前构造
+        mutable std::array<Shard, kShards> shards_;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPSLOTREGISTRY_H
@@ -0,0 +1,445 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipStore.h"
+#include "GossipSlotCodec.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace gossip::server {
+
+    namespace {
+
+        constexpr uint32_t kSnapshotMagic = 0x50414e53;     // "SNAP"
+        constexpr uint32_t kSnapshotFormat = 1;
+        constexpr size_t kRecordHeader = 12;    // 4 字节长度 + 8 字节校验和
+        constexpr size_t kSnapshotHeader = 24;  // magic、格式版本、长度与校验和
+
+        // 操作的标记字节
+        constexpr uint8_t kRemove = 1;      // 删除
+        constexpr uint8_t kTtl = 2;         // 之后跟着 8 字节的 TTL
+
+        uint64_t checksum(const char *data, size_t size) {
+            // FNV-1a，只用于发现不完整或损坏的记录
+            uint64_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < size; i++) {
+                hash ^= static_cast<unsigned char>(data[i]);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        void putFixed32(std::string *bytes, uint32_t value) {
+            for (int i = 0; i < 4; i++)
+                bytes->push_back(static_cast<char>(value >> (8 * i)));
+        }
+
+        void putFixed64(std::string *bytes, uint64_t value) {
+            for (int i = 0; i < 8; i++)
+                bytes->push_back(static_cast<char>(value >> (8 * i)));
+        }
+
+        void putString(std::string *bytes, const std::string &value) {
+            putFixed32(bytes, static_cast<uint32_t>(value.size()));
+            bytes->append(value);
+        }
+
+        /// Little endian reader of a record, every read fails once the record is exhausted.
+        class Reader {
+        public:
+            Reader(const char *data, size_t size) : data_(data), size_(size) {}
+
+            bool fixed8(uint8_t *value) {
+                return fixed(value);
+            }
+
+            bool fixed32(uint32_t *value) {
+                return fixed(value);
+            }
+
+            bool fixed64(uint64_t *value) {
+                return fixed(value);
+            }
+
+            bool string(std::string *value) {
+                uint32_t size;
+                if (!fixed32(&size) || size_ - offset_ < size)
+                    return false;
+                value->assign(data_ + offset_, size);
+                offset_ += size;
+                return true;
+            }
+
+        private:
+            template<class T>
+            bool fixed(T *value) {
+                if (size_ - offset_ < sizeof(T))
+                    return false;
+                *value = 0;
+                for (size_t i = 0; i < sizeof(T); i++)
+                    *value |= static_cast<T>(static_cast<unsigned char>(data_[offset_ + i])) << (8 * i);
+                offset_ += sizeof(T);
+                return true;
+            }
+
+            const char *data_;
+            size_t size_;
+            size_t offset_ = 0;
+        };
+
+        /// Start a record payload: version and the number of operations.
+        std::string recordHead(SlotVersion version, size_t operations) {
+            std::string payload;
+            putFixed64(&payload, static_cast<uint64_t>(version));
+            putFixed32(&payload, static_cast<uint32_t>(operations));
+            return payload;
+        }
+
+        void putOperation(std::string *payload, bool remove, const std::string &key, const std::string &value,
+                          int64_t ttl_ms = 0) {
+            uint8_t flags = (remove ? kRemove : 0) | (ttl_ms > 0 ? kTtl : 0);
+            payload->push_back(static_cast<char>(flags));
+            if (ttl_ms > 0)
+                putFixed64(payload, static_cast<uint64_t>(ttl_ms));
+            putString(payload, key);
+            putString(payload, value);
+        }
+
+        bool writeAll(int fd, const char *data, size_t size) {
+            while (size > 0) {
+                auto written = ::write(fd, data, size);
+                if (written < 0)
+                    return false;
+                data += written;
+                size -= static_cast<size_t>(written);
+            }
+            return true;
+        }
+
+        void syncDirectory(const std::string &dir) {
+            int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+            if (fd < 0)
+                return;
+            ::fsync(fd);
+            ::close(fd);
+        }
+
+    }
+
+    GossipStore::GossipStore(std::string dir, std::string name, Durability durability,
+                             std::chrono::milliseconds sync_interval)
+            : dir_(std::move(dir)), name_(std::move(name)), durability_(durability), sync_interval_(sync_interval) {
+
+        std::filesystem::create_directories(dir_);
+
+        // 已有的日志文件只读，新的记录总是写入新的文件
+        auto files = walFiles();
+        file_ = files.empty() ? 1 : files.back() + 1;
+
+        flusher_ = std::thread([this] { flushLoop(); });
+    }
+
+    GossipStore::~GossipStore() {
+        {
+            std::lock_guard<std::mutex> lg(mtx);
+            stop_ = true;
+        }
+        flush_cv_.notify_all();
+        flusher_.join();
+    }
+
+    size_t GossipStore::recover(GossipSlot *slot) {
+        // 逐条写入 slot 会为每条记录发布一个快照，先在哈希表中重放，最后一次性合并
+        SlotValues values;
+        auto after = loadSnapshot(&values);
+        auto version = after;
+
+        size_t records = 0;
+        for (auto file: walFiles())
+            records += replay(walPath(file), &values, &version, after);
+        if (version > 0)
+            slot->compareAndMergeSlot(std::move(values), version);
+        return records;
+    }
+
+    void GossipStore::appendPut(SlotVersion version, const std::string &key, const std::string &value,
+                                int64_t ttl_ms) {
+        auto payload = recordHead(version, 1);
+        putOperation(&payload, false, key, value, ttl_ms);
+        append(payload);
+    }
+
+    void GossipStore::appendDelete(SlotVersion version, const std::string &key) {
+        auto payload = recordHead(version, 1);
+        putOperation(&payload, true, key, {});
+        append(payload);
+    }
+
+    void GossipStore::appendBatch(SlotVersion version, const SlotBatch &batch) {
+        auto payload = recordHead(version, batch.size());
+        for (auto &operation: batch) {
+            if (operation.remove)
+                putOperation(&payload, true, operation.key, {});
+            else
+                putOperation(&payload, false, operation.key, operation.value, operation.ttl_ms);
+        }
+        append(payload);
+    }
+
+    void GossipStore::append(const std::string &payload) {
+        std::string record;
+        record.reserve(kRecordHeader + payload.size());
+        putFixed32(&record, static_cast<uint32_t>(payload.size()));
+        putFixed64(&record, checksum(payload.data(), payload.size()));
+        record.append(payload);
+
+        bool first;
+        {
+            std::lock_guard<std::mutex> lg(mtx);
+            first = pending_.empty();
+            if (first || pending_.back().file != file_)
+                pending_.push_back({file_, {}});
+            pending_.back().bytes.append(record);
+            appended_++;
+            dirty_ = true;
+        }
+        // 第一条记录开始计算批量 fsync 的时间
+        if (first)
+            flush_cv_.notify_all();
+    }
+
+    uint64_t GossipStore::syncs() const {
+        std::lock_guard<std::mutex> lg(mtx);
+        return syncs_;
+    }
+
+    uint64_t GossipStore::appended() const {
+        std::lock_guard<std::mutex> lg(mtx);
+        return appended_;
+    }
+
+    void GossipStore::wait(uint64_t sequence) {
+        if (durability_ == Durability::Async)
+            return;
+
+        std::unique_lock<std::mutex> lk(mtx);
+        if (durability_ == Durability::Sync && sequence > waiting_) {
+            // 立即 fsync，期间追加的其他记录共享这次 fsync
+            waiting_ = sequence;
+            flush_cv_.notify_all();
+        }
+        durable_cv_.wait(lk, [this, sequence] { return durable_ >= sequence || failed_; });
+        if (failed_)
+            throw std::runtime_error("Write Ahead Log Error");
+    }
+
+    uint64_t GossipStore::rotate() {
+        std::lock_guard<std::mutex> lg(mtx);
+        dirty_ = false;
+        return ++file_;
+    }
+
+    bool GossipStore::dirty() const {
+        std::lock_guard<std::mutex> lg(mtx);
+        return dirty_;
+    }
+
+    void GossipStore::checkpoint(const SlotSnapshot &snapshot, uint64_t first) {
+        {
+            // 旧日志文件中的记录写完之后才能删除文件，否则 flusher 会重新创建它
+            std::unique_lock<std::mutex> lk(mtx);
+            auto sequence = appended_;
+            waiting_ = std::max(waiting_, sequence);
+            flush_cv_.notify_all();
+            durable_cv_.wait(lk, [this, sequence] { return durable_ >= sequence || failed_; });
+        }
+
+        pf_gossip::SlotUpdate header;
+        header.set_name(name_);
+        header.set_version(snapshot.version);
+        std::string payload;
+        GossipSlotCodec::encode(header, snapshot, nullptr, &payload);
+
+        std::string bytes;
+        bytes.reserve(kSnapshotHeader + payload.size());
+        putFixed32(&bytes, kSnapshotMagic);
+        putFixed32(&bytes, kSnapshotFormat);
+        putFixed64(&bytes, payload.size());
+        putFixed64(&bytes, checksum(payload.data(), payload.size()));
+        bytes.append(payload);
+
+        // 先写入临时文件再重命名，崩溃时旧的快照仍然完整
+        auto path = dir_ + "/" + name_ + ".snapshot";
+        auto tmp = path + ".tmp";
+        int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+            throw std::runtime_error("Snapshot Open Error");
+        bool ok = writeAll(fd, bytes.data(), bytes.size()) && ::fsync(fd) == 0;
+        ::close(fd);
+        if (!ok || ::rename(tmp.c_str(), path.c_str()) != 0)
+            throw std::runtime_error("Snapshot Write Error");
+        syncDirectory(dir_);
+
+        for (auto file: walFiles()) {
+            if (file < first)
+                std::filesystem::remove(walPath(file));
+        }
+    }
+
+    void GossipStore::flushLoop() {
+        int fd = -1;
+        uint64_t opened = 0;
+
+        std::unique_lock<std::mutex> lk(mtx);
+        while (true) {
+            flush_cv_.wait(lk, [this] { return stop_ || !pending_.empty(); });
+            if (pending_.empty())
+                break;
+
+            // 没有写入者要求立即 fsync 时，等待一个批量周期积累更多的记录
+            if (!stop_ && waiting_ <= durable_)
+                flush_cv_.wait_for(lk, sync_interval_, [this] { return stop_ || waiting_ > durable_; });
+
+            auto batch = std::move(pending_);
+            pending_.clear();
+            auto sequence = appended_;
+            lk.unlock();
+
+            bool ok = true;
+            for (auto &segment: batch) {
+                if (fd < 0 || opened != segment.file) {
+                    // 切换到新的日志文件之前，旧文件中的记录已经 fsync
+                    if (fd >= 0) {
+                        ok = ::fdatasync(fd) == 0 && ok;
+                        ::close(fd);
+                    }
+                    opened = segment.file;
+                    fd = ::open(walPath(opened).c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+                    if (fd < 0) {
+                        ok = false;
+                        continue;
+                    }
+                    syncDirectory(dir_);
+                }
+                ok = writeAll(fd, segment.bytes.data(), segment.bytes.size()) && ok;
+            }
+            if (fd >= 0)
+                ok = ::fdatasync(fd) == 0 && ok;
+
+            lk.lock();
+            if (!ok) {
+                std::cerr << "Write Ahead Log Error: " << walPath(opened) << std::endl;
+                failed_ = true;
+            }
+            durable_ = sequence;
+            syncs_++;
+            durable_cv_.notify_all();
+        }
+
+        if (fd >= 0)
+            ::close(fd);
+    }
+
+    std::string GossipStore::walPath(uint64_t file) const {
+        return dir_ + "/" + name_ + ".wal." + std::to_string(file);
+    }
+
+    std::vector<uint64_t> GossipStore::walFiles() const {
+        std::vector<uint64_t> files;
+        auto prefix = name_ + ".wal.";
+        for (auto &entry: std::filesystem::directory_iterator(dir_)) {
+            auto file = entry.path().filename().string();
+            if (file.compare(0, prefix.size(), prefix) != 0)
+                continue;
+            auto suffix = file.substr(prefix.size());
+            if (!suffix.empty() && std::all_of(suffix.begin(), suffix.end(), ::isdigit))
+                files.emplace_back(std::stoull(suffix));
+        }
+        std::sort(files.begin(), files.end());
+        return files;
+    }
+
+    SlotVersion GossipStore::loadSnapshot(SlotValues *values) {
+        std::ifstream in(dir_ + "/" + name_ + ".snapshot", std::ios::binary);
+        if (!in)
+            return 0;
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        Reader reader(bytes.data(), bytes.size());
+        uint32_t magic, format;
+        uint64_t size, sum;
+        if (!reader.fixed32(&magic) || !reader.fixed32(&format) || !reader.fixed64(&size) ||
+            !reader.fixed64(&sum) || magic != kSnapshotMagic || format != kSnapshotFormat ||
+            bytes.size() - kSnapshotHeader != size || checksum(bytes.data() + kSnapshotHeader, size) != sum)
+            throw std::runtime_error("Invalid Snapshot");
+
+        // 快照损坏时不能只重放日志，否则会静默地丢失数据
+        pf_gossip::SlotUpdate update;
+        if (!update.ParseFromArray(bytes.data() + kSnapshotHeader, static_cast<int>(size)))
+            throw std::runtime_error("Invalid Snapshot");
+
+        *values = GossipSlotCodec::decode(&update);
+        return update.version();
+    }
+
+    size_t GossipStore::replay(const std::string &path, SlotValues *values, SlotVersion *version,
+                               SlotVersion after) {
+        std::ifstream in(path, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        size_t records = 0, offset = 0;
+        while (offset < bytes.size()) {
+            Reader header(bytes.data() + offset, bytes.size() - offset);
+            uint32_t size;
+            uint64_t sum;
+            if (!header.fixed32(&size) || !header.fixed64(&sum) || bytes.size() - offset - kRecordHeader < size ||
+                checksum(bytes.data() + offset + kRecordHeader, size) != sum) {
+                // 崩溃时没有写完的记录，写入者没有得到成功的应答
+                std::cerr << "Truncated Write Ahead Log: " << path << " at " << offset << std::endl;
+                break;
+            }
+
+            Reader reader(bytes.data() + offset + kRecordHeader, size);
+            offset += kRecordHeader + size;
+
+            uint64_t record_version;
+            uint32_t count;
+            if (!reader.fixed64(&record_version) || !reader.fixed32(&count))
+                continue;
+            // 快照已经包含的记录
+            auto current = static_cast<SlotVersion>(record_version);
+            if (current <= after)
+                continue;
+
+            // 同一条记录的所有操作使用同一个版本，按照写入时的顺序重放
+            for (uint32_t i = 0; i < count; i++) {
+                uint8_t flags;
+                uint64_t ttl_ms = 0;
+                std::string key, value;
+                if (!reader.fixed8(&flags) || ((flags & kTtl) && !reader.fixed64(&ttl_ms)) || !reader.string(&key) ||
+                    !reader.string(&value))
+                    break;
+                if (!(flags & kRemove)) {
+                    auto expires = SlotEntry::expiration(current, static_cast<int64_t>(ttl_ms));
+                    (*values)[std::move(key)] = {std::move(value), current, false, expires};
+                    continue;
+                }
+                // 删除只在键存在时生效，留下墓碑
+                auto it = values->find(key);
+                if (it != values->end() && !it->second.deleted)
+                    it->second = {{}, current, true};
+            }
+            *version = std::max(*version, current);
+            records++;
+        }
+        return records;
+    }
+
+}
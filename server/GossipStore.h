@@ -0,0 +1,163 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPSTORE_H
+#define GOSSIP_GOSSIPSTORE_H
+
+#include "GossipOptions.h"
+#include "GossipSlot.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace gossip::server {
+
+    /// @brief Durable store of local slot, made of a write-ahead log and a compacting snapshot.
+    /// @details Every local write is appended to an in-memory buffer as one WAL record, and a flusher thread
+    /// writes all buffered records to the log file with one write and one fdatasync (group commit). Writers
+    /// either wait for the fsync at once (Sync), wait for the next batched fsync (Batched) or don't wait at all
+    /// (Async). A checkpoint switches appends to a new log file, writes a snapshot of local slot at that cut and
+    /// then deletes the older log files. On startup the snapshot is loaded and the remaining log files are
+    /// replayed in order into a map, which is merged into the slot at once. Records are checksummed, and a torn
+    /// record at the end of a log stops the replay.
+    /// Files are named "<node name>.snapshot" and "<node name>.wal.<sequence>" in the data directory.
+    class GossipStore {
+    public:
+
+        using Durability = GossipOptions::Durability;
+
+        /// Constructor of GossipStore, the data directory is created if it doesn't exist. Appends go to a new log
+        /// file after the existing ones.
+        /// \param dir Data directory
+        /// \param name Name of local slot
+        /// \param durability When writes are durable
+        /// \param sync_interval Max delay of a batched fsync
+        GossipStore(std::string dir, std::string name, Durability durability,
+                    std::chrono::milliseconds sync_interval);
+
+        /// Destructor of GossipStore. Buffered records are flushed before the flusher thread exits.
+        ~GossipStore();
+
+        GossipStore(const GossipStore &) = delete;
+
+        GossipStore &operator=(const GossipStore &) = delete;
+
+        /// Rebuild a slot from snapshot and log files. Must be called before any append.
+        /// \param slot Empty slot to rebuild
+        /// \return The number of replayed log records
+        size_t recover(GossipSlot *slot);
+
+        /// Append a put of local slot. The owner must serialize appends in the order of versions.
+        /// \param version Slot version of this write
+        /// \param key The key of K-V pair
+        /// \param value The value of K-V pair
+        /// \param ttl_ms TTL of K-V pair in milliseconds, 0 means never expire
+        void appendPut(SlotVersion version, const std::string &key, const std::string &value, int64_t ttl_ms = 0);
+
+        /// Append a delete of local slot.
+        /// \param version Slot version of this write
+        /// \param key The key of K-V pair
+        void appendDelete(SlotVersion version, const std::string &key);
+
+        /// Append a batch of local slot, all operations share one version.
+        /// \param version Slot version of this batch
+        /// \param batch Operations applied in order
+        void appendBatch(SlotVersion version, const SlotBatch &batch);
+
+        /// Get the number of fsync of log files.
+        /// \return The number of fsync
+        uint64_t syncs() const;
+
+        /// Get the sequence number of the last appended record.
+        /// \return Sequence number, 0 if nothing is appended
+        uint64_t appended() const;
+
+        /// Wait until a record is durable, according to durability of this store. Async store doesn't wait.
+        /// \param sequence Sequence number of record
+        /// \throw std::runtime_error if log file can't be written
+        void wait(uint64_t sequence);
+
+        /// Switch appends to a new log file. Called with appends serialized, together with taking the snapshot
+        /// of the slot, so the new log file only has records after the snapshot.
+        /// \return Sequence of the new log file
+        uint64_t rotate();
+
+        /// Write a snapshot of local slot taken when rotate is called, and delete the log files before it.
+        /// \param snapshot Snapshot of local slot
+        /// \param first Sequence of the first log file to keep, returned by rotate
+        void checkpoint(const SlotSnapshot &snapshot, uint64_t first);
+
+        /// Check if anything is appended since last rotate.
+        /// \return If a checkpoint would compact anything
+        bool dirty() const;
+
+    private:
+
+        /// Records appended to one log file and not written yet.
+        struct Pending {
+            uint64_t file;      // 日志文件序号
+            std::string bytes;  // 编码好的日志记录
+        };
+
+        /// Append an encoded record payload. Caller must not hold mtx.
+        /// \param payload Record payload
+        void append(const std::string &payload);
+
+        /// Write buffered records and fsync, run by flusher thread.
+        void flushLoop();
+
+        /// Get the path of a log file.
+        /// \param file Sequence of log file
+        /// \return Path of log file
+        std::string walPath(uint64_t file) const;
+
+        /// Get sequences of existing log files in ascending order.
+        /// \return Sequences of log files
+        std::vector<uint64_t> walFiles() const;
+
+        /// Load snapshot file.
+        /// \param values Stores K-V pairs of snapshot
+        /// \return Version of snapshot, 0 if there is no snapshot
+        SlotVersion loadSnapshot(SlotValues *values);
+
+        /// Replay one log file, records not newer than snapshot are skipped.
+        /// \param path Path of log file
+        /// \param values K-V pairs to apply records to
+        /// \param version Version of the last applied record, updated by replay
+        /// \param after Version of snapshot
+        /// \return The number of replayed records
+        size_t replay(const std::string &path, SlotValues *values, SlotVersion *version, SlotVersion after);
+
+    private:
+
+        std::string dir_;
+        std::string name_;
+        Durability durability_;
+        std::chrono::milliseconds sync_interval_;
+
+        mutable std::mutex mtx;
+        std::condition_variable flush_cv_;      // 唤醒 flusher
+        std::condition_variable durable_cv_;    // 唤醒等待 fsync 的写入者
+        std::deque<Pending> pending_;   // 按日志文件分组，还没有写入的记录
+        uint64_t file_ = 0;             // 当前追加的日志文件序号
+        uint64_t appended_ = 0;         // 最后追加的记录序号
+        uint64_t durable_ = 0;          // 已经 fsync 的记录序号
+        uint64_t waiting_ = 0;          // Sync 模式下等待 fsync 的最大记录序号
+        uint64_t syncs_ = 0;            // fsync 次数
+        bool dirty_ = false;            // 上次 rotate 之后有新的记录
+        bool failed_ = false;           // 日志文件写入失败
+        bool stop_ = false;
+        std::thread flusher_;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPSTORE_H
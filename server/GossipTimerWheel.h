@@ -0,0 +1,250 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPTIMERWHEEL_H
+#define GOSSIP_GOSSIPTIMERWHEEL_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <list>
+
+namespace gossip::server {
+
+    /// @brief Hierarchical timer wheel of items due at a tick.
+    /// @details Class GossipTimerWheel keeps items in 4 levels of 64 slots by their tick, level l covers
+    /// 64^(l+1) ticks, and items further than that wait in an overflow list. Adding, moving and erasing an item is
+    /// O(1). An item is moved down one level when the wheel reaches its slot, and into the ready list when it
+    /// reaches level 0. Items only move between lists by splice, so the handle of an item stays valid until it
+    /// is erased. Ticks are counted by the owner, GossipScheduler counts them on steady clock and
+    /// GossipExpiryWheel on wall clock. It is not thread safe, the owner must serialize all calls.
+    /// \tparam T Payload of items
+    template<class T>
+    class GossipTimerWheel {
+    public:
+
+        /// An item of wheel.
+        struct Node {
+            /// Payload of item
+            T value;
+            /// The tick when item is due
+            uint64_t tick;
+            /// Level of item, kLevels means overflow list and -1 means ready list
+            int level = 0;
+            /// Slot of item in its level
+            int slot = 0;
+        };
+
+        using List = std::list<Node>;
+
+        /// Handle of an item, valid until the item is erased or taken.
+        using Handle = typename List::iterator;
+
+        /// Constructor of GossipTimerWheel.
+        /// \param current The first tick to process, items before it are ready at once
+        explicit GossipTimerWheel(uint64_t current = 0) : current_(current) {}
+
+        GossipTimerWheel(const GossipTimerWheel &) = delete;
+
+        GossipTimerWheel &operator=(const GossipTimerWheel &) = delete;
+
+        /// Add an item to wheel.
+        /// \param tick The tick when item is due
+        /// \param value Payload of item
+        /// \return Handle of item
+        Handle add(uint64_t tick, T value) {
+            // 先放入 ready_ 再移动到所在的 slot
+            auto it = ready_.insert(ready_.end(), Node{std::move(value), tick});
+            place(ready_, it);
+            size_++;
+            return it;
+        }
+
+        /// Move an item to another tick, its handle stays valid.
+        /// \param it Handle of item
+        /// \param tick The new tick when item is due
+        void reschedule(Handle it, uint64_t tick) {
+            auto level = it->level, slot = it->slot;
+            auto &from = listOf(*it);
+            it->tick = tick;
+            place(from, it);
+            release(from, level, slot);
+        }
+
+        /// Erase an item from wheel.
+        /// \param it Handle of item
+        void erase(Handle it) {
+            auto level = it->level, slot = it->slot;
+            auto &from = listOf(*it);
+            from.erase(it);
+            release(from, level, slot);
+            size_--;
+        }
+
+        /// Advance wheel to a tick and move all items due by it into ready list.
+        /// \param target The tick of current time
+        void advance(uint64_t target) {
+            while (current_ <= target) {
+
+                // 跳过中间的空 slot
+                auto next = nextTick();
+                if (next > target) {
+                    current_ = target + 1;
+                    return;
+                }
+                current_ = next;
+
+                // 从高层到低层，下放起始于当前 tick 的 slot
+                if ((current_ & ((1ull << (kSlotBits * kLevels)) - 1)) == 0)
+                    cascade(overflow_);
+                for (int level = kLevels - 1; level > 0; level--) {
+                    auto shift = kSlotBits * level;
+                    if ((current_ & ((1ull << shift) - 1)) != 0)
+                        continue;
+                    auto slot = (current_ >> shift) & (kSlots - 1);
+                    cascade(wheel_[level][slot]);
+                    occupied_[level] &= ~(1ull << slot);
+                }
+
+                auto slot = current_ & (kSlots - 1);
+                for (auto &node: wheel_[0][slot])
+                    node.level = -1;
+                ready_.splice(ready_.end(), wheel_[0][slot]);
+                occupied_[0] &= ~(1ull << slot);
+
+                current_++;
+            }
+        }
+
+        /// Get the items that are due, in the order they became due. They stay in wheel until erased or taken.
+        /// \return Ready list
+        List &ready() {
+            return ready_;
+        }
+
+        /// Take all ready items out of wheel, their handles are no longer valid.
+        /// \return Ready items
+        List takeReady() {
+            List ready;
+            ready.splice(ready.end(), ready_);
+            size_ -= ready.size();
+            return ready;
+        }
+
+        /// Get the earliest tick that may have items. Slots before it are empty.
+        /// \return Earliest tick or UINT64_MAX if wheel is empty
+        [[nodiscard]] uint64_t nextTick() const {
+            uint64_t next = UINT64_MAX;
+
+            for (int level = 0; level < kLevels; level++) {
+                auto shift = kSlotBits * level;
+                auto digit = (current_ >> shift) & (kSlots - 1);
+                auto mask = occupied_[level] & (~0ull << digit);
+                if (mask == 0)
+                    continue;
+
+                // 高层的 slot 在其起始 tick 被下放
+                auto base = (current_ >> (shift + kSlotBits)) << (shift + kSlotBits);
+                auto tick = base + (static_cast<uint64_t>(__builtin_ctzll(mask)) << shift);
+                next = std::min(next, std::max(tick, current_));
+            }
+
+            if (!overflow_.empty()) {
+                constexpr int shift = kSlotBits * kLevels;
+                next = std::min<uint64_t>(next, ((current_ + (1ull << shift) - 1) >> shift) << shift);
+            }
+            return next;
+        }
+
+        /// Get the next tick to process. Items added before it are ready at once.
+        /// \return Next tick to process
+        [[nodiscard]] uint64_t current() const {
+            return current_;
+        }
+
+        /// Get the number of items in wheel, ready items included.
+        /// \return The number of items
+        [[nodiscard]] size_t size() const {
+            return size_;
+        }
+
+    private:
+
+        static constexpr int kLevels = 4;
+        static constexpr int kSlotBits = 6;
+        static constexpr int kSlots = 1 << kSlotBits;
+
+        /// Get the list holding an item.
+        /// \param node The item
+        /// \return List holding item
+        List &listOf(const Node &node) {
+            if (node.level == -1)
+                return ready_;
+            if (node.level == kLevels)
+                return overflow_;
+            return wheel_[node.level][node.slot];
+        }
+
+        /// Clear the occupied bit of a slot after an item left it, if it is empty.
+        /// \param from List the item left
+        /// \param level Level of list
+        /// \param slot Slot of list
+        void release(const List &from, int level, int slot) {
+            if (from.empty() && level >= 0 && level < kLevels)
+                occupied_[level] &= ~(1ull << slot);
+        }
+
+        /// Move an item from a list into the slot of its tick. Items whose tick has passed are put into ready_.
+        /// \param from List holding the item
+        /// \param it Handle of item
+        void place(List &from, Handle it) {
+            auto tick = it->tick;
+
+            // 已经越过的 tick 不会再被处理，直接放入 ready_
+            if (tick < current_) {
+                it->level = -1;
+                ready_.splice(ready_.end(), from, it);
+                return;
+            }
+
+            // 选择与当前 tick 高位相同的最低一层，这样所在的 slot 一定还没有被处理
+            int level = 0;
+            while (level < kLevels && (tick >> (kSlotBits * (level + 1))) != (current_ >> (kSlotBits * (level + 1))))
+                level++;
+
+            it->level = level;
+            if (level == kLevels) {
+                overflow_.splice(overflow_.end(), from, it);
+                return;
+            }
+
+            it->slot = static_cast<int>((tick >> (kSlotBits * level)) & (kSlots - 1));
+            wheel_[level][it->slot].splice(wheel_[level][it->slot].end(), from, it);
+            occupied_[level] |= 1ull << it->slot;
+        }
+
+        /// Move the items of a list down to the slots of their ticks.
+        /// \param list List to cascade
+        void cascade(List &list) {
+            // overflow_ 中的项可能重新回到 overflow_，先全部取出
+            List nodes;
+            nodes.splice(nodes.end(), list);
+            while (!nodes.empty())
+                place(nodes, nodes.begin());
+        }
+
+    private:
+
+        std::array<std::array<List, kSlots>, kLevels> wheel_;
+        std::array<uint64_t, kLevels> occupied_{};   // 每一层非空 slot 的位图
+        List overflow_;     // 超出最高层范围的项
+        List ready_;        // 已经到期，等待处理的项
+        uint64_t current_;  // 下一个要处理的 tick
+        size_t size_ = 0;
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPTIMERWHEEL_H
@@ -0,0 +1,59 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPARENAALLOCATOR_H
+#define GOSSIP_GOSSIPARENAALLOCATOR_H
+
+#include <google/protobuf/arena.h>
+#include <grpcpp/support/message_allocator.h>
+#include <cstddef>
+
+namespace gossip::server::service {
+
+    /// @brief Allocate request and response of a callback rpc on one protobuf arena.
+    /// @details Every rpc gets a holder with an inline initial block, and the request, response and all their
+    /// fields are allocated on it. Small messages don't touch the heap except for the holder itself, and
+    /// everything is freed at once when the rpc finishes.
+    /// \tparam Request Request type of rpc
+    /// \tparam Response Response type of rpc
+    /// \tparam BlockSize Size of inline initial block
+    template<class Request, class Response, size_t BlockSize = 1024>
+    class GossipArenaAllocator : public grpc::MessageAllocator<Request, Response> {
+    public:
+
+        grpc::MessageHolder<Request, Response> *AllocateMessages() override {
+            return new Holder;
+        }
+
+    private:
+
+        class Holder : public grpc::MessageHolder<Request, Response> {
+        public:
+            Holder() : arena_(options(block_)) {
+                this->set_request(google::protobuf::Arena::CreateMessage<Request>(&arena_));
+                this->set_response(google::protobuf::Arena::CreateMessage<Response>(&arena_));
+            }
+
+            void Release() override {
+                delete this;
+            }
+
+        private:
+
+            static google::protobuf::ArenaOptions options(char *block) {
+                google::protobuf::ArenaOptions options;
+                options.initial_block = block;
+                options.initial_block_size = BlockSize;
+                return options;
+            }
+
+            alignas(alignof(std::max_align_t)) char block_[BlockSize]; // arena 的初始内存块
+            google::protobuf::Arena arena_;
+        };
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPARENAALLOCATOR_H
@@ -0,0 +1,101 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipCallbackService.h"
+
+namespace gossip::server::service {
+
+    // GossipService 的处理函数不使用 ServerContext，因此传入 nullptr
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::inlineCall(::grpc::CallbackServerContext *context,
+                                      const std::function<::grpc::Status()> &handler) {
+        auto reactor = context->DefaultReactor();
+        reactor->Finish(handler());
+        return reactor;
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::deferredCall(::grpc::CallbackServerContext *context,
+                                        std::function<::grpc::Status()> handler) {
+        auto reactor = context->DefaultReactor();
+        auto queued = executor_.submit([reactor, handler = std::move(handler)] {
+            reactor->Finish(handler());
+        });
+
+        // 队列已满时直接拒绝，对方节点会稍后重试
+        if (!queued)
+            reactor->Finish({grpc::StatusCode::RESOURCE_EXHAUSTED, "Handler Queue Full"});
+        return reactor;
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::search(::grpc::CallbackServerContext *context, const ::pf_gossip::Message *request,
+                                  ::pf_gossip::SearchResult *response) {
+        return inlineCall(context, [=] { return handler_.search(nullptr, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::pull(::grpc::CallbackServerContext *context, const ::pf_gossip::SlotUpdate *request,
+                                ::pf_gossip::updateResult *response) {
+        return deferredCall(context, [=] { return handler_.pull(nullptr, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::syncDigest(::grpc::CallbackServerContext *context, const ::pf_gossip::DigestRequest *request,
+                                      ::pf_gossip::DigestResponse *response) {
+        // 比较摘要可能需要加载冷 slot，不能占用回调线程
+        return deferredCall(context, [=] { return handler_.syncDigest(nullptr, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::syncSlots(::grpc::CallbackServerContext *context, const ::pf_gossip::SyncRequest *request,
+                                     ::pf_gossip::SyncResponse *response) {
+        return deferredCall(context, [=] { return handler_.syncSlots(nullptr, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::ping(::grpc::CallbackServerContext *context, const ::pf_gossip::PingRequest *request,
+                                ::pf_gossip::PingResponse *response) {
+        // 间接探测在目标节点应答之后才结束，不占用回调线程和执行器的线程
+        auto reactor = context->DefaultReactor();
+        handler_.asyncPing(request, response, [reactor](const grpc::Status &status) { reactor->Finish(status); });
+        return reactor;
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::echo(::grpc::CallbackServerContext *context, const ::pf_gossip::Message *request,
+                                ::pf_gossip::Message *response) {
+        return inlineCall(context, [=] { return handler_.echo(nullptr, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::EstablishConnection(::grpc::CallbackServerContext *context,
+                                               const ::pf_gossip::GossipNodeInfo *request,
+                                               ::pf_gossip::GossipNodeInfo *response) {
+        return deferredCall(context, [=] { return handler_.EstablishConnection(nullptr, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::heartBeat(::grpc::CallbackServerContext *context, const ::pf_gossip::NodeVersions *request,
+                                     ::pf_gossip::NodeVersions *response) {
+        // 心跳需要遍历所有 slot 的版本
+        return deferredCall(context, [=] { return handler_.heartBeat(nullptr, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::newNodeNotify(::grpc::CallbackServerContext *context,
+                                         const ::pf_gossip::GossipNodeInfo *request,
+                                         ::pf_gossip::updateResult *response) {
+        return deferredCall(context, [=] { return handler_.newNodeNotify(nullptr, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCallbackService::deleteNodeNotify(::grpc::CallbackServerContext *context,
+                                            const ::pf_gossip::GossipNodeInfo *request,
+                                            ::pf_gossip::updateResult *response) {
+        return deferredCall(context, [=] { return handler_.deleteNodeNotify(nullptr, request, response); });
+    }
+
+}
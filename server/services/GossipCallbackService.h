@@ -0,0 +1,94 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPCALLBACKSERVICE_H
+#define GOSSIP_GOSSIPCALLBACKSERVICE_H
+
+#include "Gossip.grpc.pb.h"
+#include "GossipService.h"
+#include "../GossipExecutor.h"
+
+#include <functional>
+
+
+namespace gossip::server::service {
+
+    /// @brief GRPC callback interface to handle other gossip node's request.
+    /// @details Class GossipCallbackService implements pf_gossip::Gossip with grpc callback API, so an in-flight
+    /// rpc doesn't hold a grpc thread. Cheap requests are handled on the grpc callback thread directly. Requests
+    /// that merge slots, compare digests, walk all slot versions or connect peers are handed to a bounded
+    /// GossipExecutor, and are rejected with RESOURCE_EXHAUSTED when its queue is full. Request handling is shared
+    /// with GossipService. This class must be owned by a Class GossipNode impl.
+    class GossipCallbackService : public pf_gossip::Gossip::CallbackService {
+
+    public:
+        /// Constructor of GossipCallbackService.
+        /// \param node The owner of this class
+        /// \param threads Number of handler threads
+        /// \param queue_size Max number of queued requests
+        GossipCallbackService(GossipNode *node, size_t threads, size_t queue_size)
+                : handler_(node), executor_(threads, queue_size) {
+
+        }
+
+        ::grpc::ServerUnaryReactor *search(::grpc::CallbackServerContext *context, const ::pf_gossip::Message *request,
+                                           ::pf_gossip::SearchResult *response) override;
+
+        ::grpc::ServerUnaryReactor *pull(::grpc::CallbackServerContext *context, const ::pf_gossip::SlotUpdate *request,
+                                         ::pf_gossip::updateResult *response) override;
+
+        ::grpc::ServerUnaryReactor *syncDigest(::grpc::CallbackServerContext *context,
+                                               const ::pf_gossip::DigestRequest *request,
+                                               ::pf_gossip::DigestResponse *response) override;
+
+        ::grpc::ServerUnaryReactor *syncSlots(::grpc::CallbackServerContext *context,
+                                              const ::pf_gossip::SyncRequest *request,
+                                              ::pf_gossip::SyncResponse *response) override;
+
+        ::grpc::ServerUnaryReactor *ping(::grpc::CallbackServerContext *context, const ::pf_gossip::PingRequest *request,
+                                         ::pf_gossip::PingResponse *response) override;
+
+        ::grpc::ServerUnaryReactor *echo(::grpc::CallbackServerContext *context, const ::pf_gossip::Message *request,
+                                         ::pf_gossip::Message *response) override;
+
+        ::grpc::ServerUnaryReactor *EstablishConnection(::grpc::CallbackServerContext *context,
+                                                        const ::pf_gossip::GossipNodeInfo *request,
+                                                        ::pf_gossip::GossipNodeInfo *response) override;
+
+        ::grpc::ServerUnaryReactor *heartBeat(::grpc::CallbackServerContext *context,
+                                              const ::pf_gossip::NodeVersions *request,
+                                              ::pf_gossip::NodeVersions *response) override;
+
+        ::grpc::ServerUnaryReactor *newNodeNotify(::grpc::CallbackServerContext *context,
+                                                  const ::pf_gossip::GossipNodeInfo *request,
+                                                  ::pf_gossip::updateResult *response) override;
+
+        ::grpc::ServerUnaryReactor *deleteNodeNotify(::grpc::CallbackServerContext *context,
+                                                     const ::pf_gossip::GossipNodeInfo *request,
+                                                     ::pf_gossip::updateResult *response) override;
+
+    private:
+
+        /// Handle a request on grpc callback thread.
+        /// \param context The grpc context
+        /// \param handler Request handler
+        /// \return Finished reactor
+        static ::grpc::ServerUnaryReactor *inlineCall(::grpc::CallbackServerContext *context,
+                                                      const std::function<::grpc::Status()> &handler);
+
+        /// Handle a request on executor. Reactor is finished when handler returns.
+        /// \param context The grpc context
+        /// \param handler Request handler
+        /// \return Reactor of rpc
+        ::grpc::ServerUnaryReactor *deferredCall(::grpc::CallbackServerContext *context,
+                                                 std::function<::grpc::Status()> handler);
+
+    private:
+        GossipService handler_; // 与同步模型共用请求处理逻辑
+        GossipExecutor executor_;   // 处理耗时请求的有界线程池，析构时需要先于 handler_ 结束
+    };
+}
+
+
+#endif //GOSSIP_GOSSIPCALLBACKSERVICE_H
@@ -0,0 +1,174 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "GossipCliCallbackService.h"
+
+namespace gossip::server::service {
+
+    namespace {
+
+        /// Reactor writing messages of a GossipCliScan one by one, the next message is filled after last one is sent.
+        class ScanReactor final : public ::grpc::ServerWriteReactor<pf_gossip_cli::ScanResult> {
+        public:
+            ScanReactor(const ::grpc::Status &status, std::unique_ptr<GossipCliScan> scan) : scan_(std::move(scan)) {
+                if (!status.ok()) {
+                    Finish(status);
+                    return;
+                }
+                next();
+            }
+
+            void OnWriteDone(bool ok) override {
+                if (!ok) {
+                    Finish({grpc::StatusCode::CANCELLED, "Stream Closed"});
+                    return;
+                }
+                next();
+            }
+
+            void OnDone() override {
+                delete this;
+            }
+
+        private:
+            void next() {
+                chunk_.Clear();
+                if (scan_->fill(&chunk_))
+                    StartWriteAndFinish(&chunk_, ::grpc::WriteOptions(), ::grpc::Status::OK);
+                else
+                    StartWrite(&chunk_);
+            }
+
+            std::unique_ptr<GossipCliScan> scan_;
+            pf_gossip_cli::ScanResult chunk_;   // 写入完成之前必须保持有效
+        };
+
+    }
+
+    GossipCliCallbackService::GossipCliCallbackService(GossipNode *node, size_t threads, size_t queue_size)
+            : handler_(node), executor_(threads, queue_size) {
+        SetMessageAllocatorFor_addMessage(&add_allocator_);
+        SetMessageAllocatorFor_addMessages(&batch_allocator_);
+        SetMessageAllocatorFor_deleteMessage(&delete_allocator_);
+        SetMessageAllocatorFor_getMessage(&get_allocator_);
+        SetMessageAllocatorFor_getMessages(&multi_get_allocator_);
+        SetMessageAllocatorFor_searchMessage(&search_allocator_);
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::inlineCall(::grpc::CallbackServerContext *context,
+                                         const std::function<::grpc::Status()> &handler) {
+        auto reactor = context->DefaultReactor();
+        reactor->Finish(handler());
+        return reactor;
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::deferredCall(::grpc::CallbackServerContext *context,
+                                           std::function<::grpc::Status()> handler) {
+        auto reactor = context->DefaultReactor();
+        auto queued = executor_.submit([reactor, handler = std::move(handler)] {
+            reactor->Finish(handler());
+        });
+
+        if (!queued)
+            reactor->Finish({grpc::StatusCode::RESOURCE_EXHAUSTED, "Handler Queue Full"});
+        return reactor;
+    }
+
+    ::grpc::ServerWriteReactor<::pf_gossip_cli::ScanResult> *
+    GossipCliCallbackService::streamCall(const ::grpc::Status &status, std::unique_ptr<GossipCliScan> scan) {
+        return new ScanReactor(status, std::move(scan));
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::echo(::grpc::CallbackServerContext *context, const ::pf_gossip_cli::Echo *request,
+                                   ::pf_gossip_cli::Echo *response) {
+        return inlineCall(context, [=] { return handler_.handleEcho(context, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::addMessage(::grpc::CallbackServerContext *context, const ::pf_gossip::Message *request,
+                                         ::pf_gossip_cli::Echo *response) {
+        return deferredCall(context, [=] { return handler_.handleAddMessage(context, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::addMessages(::grpc::CallbackServerContext *context,
+                                          const ::pf_gossip_cli::WriteBatch *request,
+                                          ::pf_gossip_cli::WriteResult *response) {
+        return deferredCall(context, [=] { return handler_.handleAddMessages(context, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::deleteMessage(::grpc::CallbackServerContext *context,
+                                            const ::pf_gossip_cli::Key *request, ::pf_gossip_cli::Echo *response) {
+        return deferredCall(context, [=] { return handler_.handleDeleteMessage(context, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::getMessage(::grpc::CallbackServerContext *context, const ::pf_gossip_cli::Key *request,
+                                         ::pf_gossip::Message *response) {
+        // 读操作不加锁，直接在回调线程处理
+        return inlineCall(context, [=] { return handler_.handleGetMessage(context, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::getMessages(::grpc::CallbackServerContext *context,
+                                          const ::pf_gossip_cli::KeyList *request,
+                                          ::pf_gossip::SearchResult *response) {
+        return inlineCall(context, [=] { return handler_.handleGetMessages(context, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::searchMessage(::grpc::CallbackServerContext *context,
+                                            const ::pf_gossip_cli::SearchInfo *request,
+                                            ::pf_gossip::SearchResult *response) {
+        return inlineCall(context, [=] { return handler_.handleSearchMessage(context, request, response); });
+    }
+
+    ::grpc::ServerWriteReactor<::pf_gossip_cli::ScanResult> *
+    GossipCliCallbackService::scanPrefix(::grpc::CallbackServerContext *context,
+                                         const ::pf_gossip_cli::PrefixScan *request) {
+        // 扫描只读取快照，与读操作一样在回调线程处理
+        std::unique_ptr<GossipCliScan> scan;
+        auto status = handler_.handleScanPrefix(context, request, &scan);
+        return streamCall(status, std::move(scan));
+    }
+
+    ::grpc::ServerWriteReactor<::pf_gossip_cli::ScanResult> *
+    GossipCliCallbackService::scanRange(::grpc::CallbackServerContext *context,
+                                        const ::pf_gossip_cli::RangeScan *request) {
+        std::unique_ptr<GossipCliScan> scan;
+        auto status = handler_.handleScanRange(context, request, &scan);
+        return streamCall(status, std::move(scan));
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::getGossipNetwork(::grpc::CallbackServerContext *context,
+                                               const ::google::protobuf::Any *request,
+                                               ::pf_gossip_cli::JsonValue *response) {
+        return inlineCall(context, [=] { return handler_.handleGetGossipNetwork(context, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::getNodeStatus(::grpc::CallbackServerContext *context,
+                                            const ::google::protobuf::Any *request,
+                                            ::pf_gossip_cli::JsonValue *response) {
+        return deferredCall(context, [=] { return handler_.handleGetNodeStatus(context, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::connect(::grpc::CallbackServerContext *context, const ::pf_gossip_cli::Url *request,
+                                      ::pf_gossip_cli::Echo *response) {
+        return deferredCall(context, [=] { return handler_.handleConnect(context, request, response); });
+    }
+
+    ::grpc::ServerUnaryReactor *
+    GossipCliCallbackService::shutdown(::grpc::CallbackServerContext *context, const ::google::protobuf::Any *request,
+                                       ::pf_gossip_cli::Echo *response) {
+        return deferredCall(context, [=] { return handler_.handleShutdown(context, request, response); });
+    }
+
+}
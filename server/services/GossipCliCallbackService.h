@@ -0,0 +1,120 @@
+//
+// Created by agent on 2026/10/18.
+//
+
+#ifndef GOSSIP_GOSSIPCLICALLBACKSERVICE_H
+#define GOSSIP_GOSSIPCLICALLBACKSERVICE_H
+
+#include "GossipCli.grpc.pb.h"
+#include "GossipCli.pb.h"
+#include "GossipCliService.h"
+#include "GossipArenaAllocator.h"
+#include "../GossipExecutor.h"
+
+#include <functional>
+
+namespace gossip::server::service {
+
+    /// @brief GRPC callback interface to handle client's request.
+    /// @details Class GossipCliCallbackService implements pf_gossip_cli::GossipClient with grpc callback API.
+    /// Requests and responses of CRUD rpc are allocated on protobuf arenas. Reads and echo are handled on the grpc
+    /// callback thread, other requests are handed to a fixed GossipExecutor and are rejected with
+    /// RESOURCE_EXHAUSTED when its queue is full. Request handling is shared with GossipCliService. This class
+    /// must be owned by a Class GossipNode impl.
+    class GossipCliCallbackService final : public pf_gossip_cli::GossipClient::CallbackService {
+    public:
+
+        /// Constructor of GossipCliCallbackService.
+        /// \param node The owner of this class
+        /// \param threads Number of handler threads
+        /// \param queue_size Max number of queued requests
+        GossipCliCallbackService(GossipNode *node, size_t threads, size_t queue_size);
+
+        ::grpc::ServerUnaryReactor *echo(::grpc::CallbackServerContext *context, const ::pf_gossip_cli::Echo *request,
+                                         ::pf_gossip_cli::Echo *response) override;
+
+        ::grpc::ServerUnaryReactor *addMessage(::grpc::CallbackServerContext *context,
+                                               const ::pf_gossip::Message *request,
+                                               ::pf_gossip_cli::Echo *response) override;
+
+        ::grpc::ServerUnaryReactor *addMessages(::grpc::CallbackServerContext *context,
+                                                const ::pf_gossip_cli::WriteBatch *request,
+                                                ::pf_gossip_cli::WriteResult *response) override;
+
+        ::grpc::ServerUnaryReactor *deleteMessage(::grpc::CallbackServerContext *context,
+                                                  const ::pf_gossip_cli::Key *request,
+                                                  ::pf_gossip_cli::Echo *response) override;
+
+        ::grpc::ServerUnaryReactor *getMessage(::grpc::CallbackServerContext *context,
+                                               const ::pf_gossip_cli::Key *request,
+                                               ::pf_gossip::Message *response) override;
+
+        ::grpc::ServerUnaryReactor *getMessages(::grpc::CallbackServerContext *context,
+                                                const ::pf_gossip_cli::KeyList *request,
+                                                ::pf_gossip::SearchResult *response) override;
+
+        ::grpc::ServerUnaryReactor *searchMessage(::grpc::CallbackServerContext *context,
+                                                  const ::pf_gossip_cli::SearchInfo *request,
+                                                  ::pf_gossip::SearchResult *response) override;
+
+        ::grpc::ServerWriteReactor<::pf_gossip_cli::ScanResult> *
+        scanPrefix(::grpc::CallbackServerContext *context, const ::pf_gossip_cli::PrefixScan *request) override;
+
+        ::grpc::ServerWriteReactor<::pf_gossip_cli::ScanResult> *
+        scanRange(::grpc::CallbackServerContext *context, const ::pf_gossip_cli::RangeScan *request) override;
+
+        ::grpc::ServerUnaryReactor *getGossipNetwork(::grpc::CallbackServerContext *context,
+                                                     const ::google::protobuf::Any *request,
+                                                     ::pf_gossip_cli::JsonValue *response) override;
+
+        ::grpc::ServerUnaryReactor *getNodeStatus(::grpc::CallbackServerContext *context,
+                                                  const ::google::protobuf::Any *request,
+                                                  ::pf_gossip_cli::JsonValue *response) override;
+
+        ::grpc::ServerUnaryReactor *connect(::grpc::CallbackServerContext *context, const ::pf_gossip_cli::Url *request,
+                                            ::pf_gossip_cli::Echo *response) override;
+
+        ::grpc::ServerUnaryReactor *shutdown(::grpc::CallbackServerContext *context,
+                                             const ::google::protobuf::Any *request,
+                                             ::pf_gossip_cli::Echo *response) override;
+
+    private:
+
+        /// Handle a request on grpc callback thread.
+        /// \param context The grpc context
+        /// \param handler Request handler
+        /// \return Finished reactor
+        static ::grpc::ServerUnaryReactor *inlineCall(::grpc::CallbackServerContext *context,
+                                                      const std::function<::grpc::Status()> &handler);
+
+        /// Handle a request on executor. Reactor is finished when handler returns.
+        /// \param context The grpc context
+        /// \param handler Request handler
+        /// \return Reactor of rpc
+        ::grpc::ServerUnaryReactor *deferredCall(::grpc::CallbackServerContext *context,
+                                                 std::function<::grpc::Status()> handler);
+
+        /// Stream an opened scan on grpc callback thread, one message is written at a time.
+        /// \param status Status of opening the scan, the rpc is finished with it if not ok
+        /// \param scan Opened scan
+        /// \return Reactor of rpc, deletes itself when rpc is done
+        static ::grpc::ServerWriteReactor<::pf_gossip_cli::ScanResult> *
+        streamCall(const ::grpc::Status &status, std::unique_ptr<GossipCliScan> scan);
+
+    private:
+        GossipCliService handler_;  // 与同步模型共用请求处理逻辑
+
+        GossipArenaAllocator<pf_gossip::Message, pf_gossip_cli::Echo> add_allocator_;
+        GossipArenaAllocator<pf_gossip_cli::WriteBatch, pf_gossip_cli::WriteResult> batch_allocator_;
+        GossipArenaAllocator<pf_gossip_cli::Key, pf_gossip_cli::Echo> delete_allocator_;
+        GossipArenaAllocator<pf_gossip_cli::Key, pf_gossip::Message> get_allocator_;
+        GossipArenaAllocator<pf_gossip_cli::KeyList, pf_gossip::SearchResult, 4096> multi_get_allocator_;
+        GossipArenaAllocator<pf_gossip_cli::SearchInfo, pf_gossip::SearchResult> search_allocator_;
+
+        GossipExecutor executor_;   // 处理耗时请求的线程池，析构时需要先于 handler_ 结束
+    };
+
+}
+
+
+#endif //GOSSIP_GOSSIPCLICALLBACKSERVICE_H
@@ -7,11 +7,42 @@
 
 namespace gossip::server::service {
 
+    GossipCliScan::GossipCliScan(std::unique_ptr<SlotScanner> scanner, std::string owner, size_t limit,
+                                 size_t chunk_size)
+            : scanner_(std::move(scanner)), owner_(std::move(owner)), remaining_(limit == 0 ? SIZE_MAX : limit),
+              chunk_size_(std::max<size_t>(chunk_size, 1)) {
+        // scanner 停留在第一个键值对上，没有键值对时扫描直接结束
+        if (scanner_ && !scanner_->next())
+            scanner_.reset();
+    }
+
+    GossipCliScan::~GossipCliScan() = default;
+
+    bool GossipCliScan::fill(pf_gossip_cli::ScanResult *chunk) {
+        for (size_t count = 0; scanner_ && count < chunk_size_; count++) {
+            auto message = chunk->add_message();
+            message->set_key(scanner_->key());
+            message->set_value(scanner_->entry().value);
+            message->set_owner(owner_);
+            message->set_version(scanner_->entry().version);
+
+            if (--remaining_ == 0) {
+                // 达到 limit 之后还有键值对时，返回最后一个键作为继续标记
+                if (scanner_->next())
+                    chunk->set_continuation(message->key());
+                scanner_.reset();
+            } else if (!scanner_->next()) {
+                scanner_.reset();
+            }
+        }
+        return scanner_ == nullptr;
+    }
+
     GossipCliService::GossipCliService(GossipNode *node) : node_(node) {
 
     }
 
-    ::grpc::Status GossipCliService::echo(::grpc::ServerContext *context, const ::pf_gossip_cli::Echo *request,
+    ::grpc::Status GossipCliService::handleEcho(::grpc::ServerContextBase *context, const ::pf_gossip_cli::Echo *request,
                                           ::pf_gossip_cli::Echo *response) {
 
         // 如果没有设置 token 则不需要进行验证
@@ -48,7 +79,7 @@ namespace gossip::server::service {
     }
 
 
-    ::grpc::Status GossipCliService::addMessage(::grpc::ServerContext *context, const ::pf_gossip::Message *request,
+    ::grpc::Status GossipCliService::handleAddMessage(::grpc::ServerContextBase *context, const ::pf_gossip::Message *request,
                                                 ::pf_gossip_cli::Echo *response) try {
 
         if(request->key().empty()){
@@ -60,7 +91,7 @@ namespace gossip::server::service {
         }
 
 
-        auto version = node_->insertOrUpdateMessage(request->key(), request->value());
+        auto version = node_->insertOrUpdateMessage(request->key(), request->value(), request->ttl_ms());
 
         response->set_succeed(version != -1);
 
@@ -72,7 +103,41 @@ namespace gossip::server::service {
         return {grpc::StatusCode::ABORTED, "Exception Threw"};
     }
 
-    ::grpc::Status GossipCliService::deleteMessage(::grpc::ServerContext *context, const ::pf_gossip_cli::Key *request,
+    ::grpc::Status GossipCliService::handleAddMessages(::grpc::ServerContextBase *context,
+                                                       const ::pf_gossip_cli::WriteBatch *request,
+                                                       ::pf_gossip_cli::WriteResult *response) try {
+
+        if(!IsTokenMatched(context->client_metadata())){
+            return {grpc::StatusCode::FAILED_PRECONDITION,"Token Not Matched"};
+        }
+
+        SlotBatch batch;
+        batch.reserve(request->operations_size());
+        for (auto &operation: request->operations()) {
+            if (operation.key().empty()) {
+                return {grpc::StatusCode::INVALID_ARGUMENT, "Empty Key"};
+            }
+            batch.push_back({operation.key(), operation.value(), operation.remove(), operation.ttl_ms()});
+        }
+
+        int applied = 0;
+        auto version = node_->writeMessages(batch, &applied);
+
+        response->set_succeed(version != -1);
+        response->set_version(version);
+        response->set_applied(applied);
+        if (version == -1)
+            response->set_message("Nothing Changed");
+
+        return grpc::Status::OK;
+
+    } catch (std::exception &exception) {
+
+        std::cerr << exception.what() << std::endl;
+        return {grpc::StatusCode::ABORTED, "Exception Threw"};
+    }
+
+    ::grpc::Status GossipCliService::handleDeleteMessage(::grpc::ServerContextBase *context, const ::pf_gossip_cli::Key *request,
                                                    ::pf_gossip_cli::Echo *response) try {
 
         if(request->content().empty()){
@@ -96,7 +161,7 @@ namespace gossip::server::service {
         return {grpc::StatusCode::ABORTED, "Exception Threw"};
     }
 
-    ::grpc::Status GossipCliService::getMessage(::grpc::ServerContext *context, const ::pf_gossip_cli::Key *request,
+    ::grpc::Status GossipCliService::handleGetMessage(::grpc::ServerContextBase *context, const ::pf_gossip_cli::Key *request,
                                                 ::pf_gossip::Message *response) try {
 
         if(request->content().empty()){
@@ -120,8 +185,32 @@ namespace gossip::server::service {
         return {grpc::StatusCode::ABORTED, "Exception Threw"};
     }
 
+    ::grpc::Status GossipCliService::handleGetMessages(::grpc::ServerContextBase *context,
+                                                       const ::pf_gossip_cli::KeyList *request,
+                                                       ::pf_gossip::SearchResult *response) try {
+
+        for (auto &key: request->keys()) {
+            if (key.key().empty()) {
+                return {grpc::StatusCode::INVALID_ARGUMENT, "Empty Key"};
+            }
+        }
+
+        if(!IsTokenMatched(context->client_metadata())){
+            return {grpc::StatusCode::FAILED_PRECONDITION,"Token Not Matched"};
+        }
+
+        node_->getMessages(*request, response);
+
+        return grpc::Status::OK;
+
+    } catch (std::exception &exception) {
+
+        std::cerr << exception.what() << std::endl;
+        return {grpc::StatusCode::ABORTED, "Exception Threw"};
+    }
+
     ::grpc::Status
-    GossipCliService::searchMessage(::grpc::ServerContext *context, const ::pf_gossip_cli::SearchInfo *request,
+    GossipCliService::handleSearchMessage(::grpc::ServerContextBase *context, const ::pf_gossip_cli::SearchInfo *request,
                                     ::pf_gossip::SearchResult *response) try {
 
         if(request->key().empty()){
@@ -145,8 +234,55 @@ namespace gossip::server::service {
     }
 
 
+    ::grpc::Status GossipCliService::handleScanPrefix(::grpc::ServerContextBase *context,
+                                                      const ::pf_gossip_cli::PrefixScan *request,
+                                                      std::unique_ptr<GossipCliScan> *scan) try {
+
+        if (request->limit() < 0) {
+            return {grpc::StatusCode::INVALID_ARGUMENT, "Negative Limit"};
+        }
+
+        if(!IsTokenMatched(context->client_metadata())){
+            return {grpc::StatusCode::FAILED_PRECONDITION,"Token Not Matched"};
+        }
+
+        openScan(request->owner(), request->prefix(), SlotIndex::prefixEnd(request->prefix()), request->limit(),
+                 request->continuation(), scan);
+
+        return grpc::Status::OK;
+
+    } catch (std::exception &exception) {
+
+        std::cerr << exception.what() << std::endl;
+        return {grpc::StatusCode::ABORTED, "Exception Threw"};
+    }
+
+    ::grpc::Status GossipCliService::handleScanRange(::grpc::ServerContextBase *context,
+                                                     const ::pf_gossip_cli::RangeScan *request,
+                                                     std::unique_ptr<GossipCliScan> *scan) try {
+
+        if (request->limit() < 0) {
+            return {grpc::StatusCode::INVALID_ARGUMENT, "Negative Limit"};
+        }
+
+        if(!IsTokenMatched(context->client_metadata())){
+            return {grpc::StatusCode::FAILED_PRECONDITION,"Token Not Matched"};
+        }
+
+        openScan(request->owner(), request->start(), request->end(), request->limit(), request->continuation(),
+                 scan);
+
+        return grpc::Status::OK;
+
+    } catch (std::exception &exception) {
+
+        std::cerr << exception.what() << std::endl;
+        return {grpc::StatusCode::ABORTED, "Exception Threw"};
+    }
+
+
     ::grpc::Status
-    GossipCliService::getGossipNetwork(::grpc::ServerContext *context, const ::google::protobuf::Any *request,
+    GossipCliService::handleGetGossipNetwork(::grpc::ServerContextBase *context, const ::google::protobuf::Any *request,
                                        ::pf_gossip_cli::JsonValue *response) try {
 
 
@@ -159,7 +295,7 @@ namespace gossip::server::service {
     }
 
     ::grpc::Status
-    GossipCliService::getNodeStatus(::grpc::ServerContext *context, const ::google::protobuf::Any *request,
+    GossipCliService::handleGetNodeStatus(::grpc::ServerContextBase *context, const ::google::protobuf::Any *request,
                                     ::pf_gossip_cli::JsonValue *response) try{
 
         if(!IsTokenMatched(context->client_metadata())){
@@ -179,7 +315,7 @@ namespace gossip::server::service {
     }
 
 
-    ::grpc::Status GossipCliService::connect(::grpc::ServerContext *context, const ::pf_gossip_cli::Url *request,
+    ::grpc::Status GossipCliService::handleConnect(::grpc::ServerContextBase *context, const ::pf_gossip_cli::Url *request,
                                              ::pf_gossip_cli::Echo *response) try {
 
         if(!IsTokenMatched(context->client_metadata())){
@@ -201,7 +337,7 @@ namespace gossip::server::service {
         return {grpc::StatusCode::ABORTED, "Exception Threw"};
     }
 
-    ::grpc::Status GossipCliService::shutdown(::grpc::ServerContext *context, const ::google::protobuf::Any *request,
+    ::grpc::Status GossipCliService::handleShutdown(::grpc::ServerContextBase *context, const ::google::protobuf::Any *request,
                                               ::pf_gossip_cli::Echo *response) try {
 
         if(!IsTokenMatched(context->client_metadata())){
@@ -234,7 +370,34 @@ namespace gossip::server::service {
         return true;
     }
 
+    void GossipCliService::openScan(const std::string &owner, std::string start, std::string end, int limit,
+                                    const std::string &continuation, std::unique_ptr<GossipCliScan> *scan) {
+        // 继续标记是上一次返回的最后一个键，从紧跟它的键开始
+        if (!continuation.empty())
+            start = std::max(std::move(start), continuation + '\0');
 
+        auto scanner = node_->scanMessages(owner, start, std::move(end));
+        *scan = std::make_unique<GossipCliScan>(std::move(scanner), owner.empty() ? node_->NodeName() : owner,
+                                                static_cast<size_t>(limit), node_->options().scan_chunk_size);
+    }
+
+    ::grpc::Status GossipCliService::stream(GossipCliScan *scan,
+                                            ::grpc::ServerWriter<::pf_gossip_cli::ScanResult> *writer) try {
+        pf_gossip_cli::ScanResult chunk;
+        bool last = false;
+        while (!last) {
+            chunk.Clear();
+            last = scan->fill(&chunk);
+            if (!writer->Write(chunk))
+                return {grpc::StatusCode::CANCELLED, "Stream Closed"};
+        }
+        return grpc::Status::OK;
+
+    } catch (std::exception &exception) {
+
+        std::cerr << exception.what() << std::endl;
+        return {grpc::StatusCode::ABORTED, "Exception Threw"};
+    }
 
 
 }
@@ -8,18 +8,49 @@
 #include "GossipCli.grpc.pb.h"
 #include "GossipCli.pb.h"
 
+#include <memory>
+
 namespace gossip::server{
 
     class GossipNode;
+    class SlotScanner;
 
 }
 
 namespace gossip::server::service {
 
+    /// @brief A streaming scan of a gossip client.
+    /// @details Class GossipCliScan cuts the K-V pairs of a SlotScanner into ScanResult messages of bounded size, so
+    /// both service models stream a scan in the same way and never build one huge response.
+    class GossipCliScan {
+    public:
+
+        /// Constructor of GossipCliScan.
+        /// \param scanner Scanner of K-V pairs, nullptr if the slot doesn't exist
+        /// \param owner Name of scanned slot
+        /// \param limit Max number of K-V pairs, 0 means no limit
+        /// \param chunk_size Max number of K-V pairs in one message
+        GossipCliScan(std::unique_ptr<SlotScanner> scanner, std::string owner, size_t limit, size_t chunk_size);
+
+        ~GossipCliScan();
+
+        /// Fill the next message of scan.
+        /// \param chunk Empty message to fill
+        /// \return If chunk is the last message
+        bool fill(pf_gossip_cli::ScanResult *chunk);
+
+    private:
+        std::unique_ptr<SlotScanner> scanner_;  // 扫描结束后为空
+        std::string owner_;
+        size_t remaining_;  // 还可以返回的键值对数量
+        size_t chunk_size_;
+    };
+
 
     /// @brief GRPC interface to handle client's request.
     /// @details Class GossipCliService is derived from pf_gossip_cli::GossipClient::Service and defines its functions.
-    /// This class must be owned by a Class GossipNode impl.
+    /// Requests are handled by handleXXX functions, which take the context base class so that
+    /// GossipCliCallbackService can share them. This class must be owned by a Class GossipNode impl.
     class GossipCliService final : public pf_gossip_cli::GossipClient::Service {
     public:
 
@@ -32,8 +63,8 @@ namespace gossip::server::service {
         /// \param request The request of rpc
         /// \param response The response of rpc
         /// \return The status of rpc
-        ::grpc::Status echo(::grpc::ServerContext *context, const ::pf_gossip_cli::Echo *request,
-                            ::pf_gossip_cli::Echo *response) override;
+        ::grpc::Status handleEcho(::grpc::ServerContextBase *context, const ::pf_gossip_cli::Echo *request,
+                                  ::pf_gossip_cli::Echo *response);
 
         // CRUD request Interface From a gossip client.
 
@@ -42,48 +73,80 @@ namespace gossip::server::service {
         /// \param request The request of rpc
         /// \param response The response of rpc
         /// \return The status of rpc
-        ::grpc::Status addMessage(::grpc::ServerContext *context, const ::pf_gossip::Message *request,
-                                  ::pf_gossip_cli::Echo *response) override;
+        ::grpc::Status handleAddMessage(::grpc::ServerContextBase *context, const ::pf_gossip::Message *request,
+                                        ::pf_gossip_cli::Echo *response);
+
+        /// Receive and handle batch Create, Update and Delete request from a gossip client.
+        /// \param context The grpc context
+        /// \param request The request of rpc
+        /// \param response The response of rpc
+        /// \return The status of rpc
+        ::grpc::Status handleAddMessages(::grpc::ServerContextBase *context, const ::pf_gossip_cli::WriteBatch *request,
+                                         ::pf_gossip_cli::WriteResult *response);
 
         /// Receive and handle Delete request from a gossip client.
         /// \param context The grpc context
         /// \param request The request of rpc
         /// \param response The response of rpc
         /// \return The status of rpc
-        ::grpc::Status deleteMessage(::grpc::ServerContext *context, const ::pf_gossip_cli::Key *request,
-                                     ::pf_gossip_cli::Echo *response) override;
+        ::grpc::Status handleDeleteMessage(::grpc::ServerContextBase *context, const ::pf_gossip_cli::Key *request,
+                                           ::pf_gossip_cli::Echo *response);
 
         /// Receive and handle Read request from a gossip client.
         /// \param context The grpc context
         /// \param request The request of rpc
         /// \param response The response of rpc
         /// \return The status of rpc
-        ::grpc::Status getMessage(::grpc::ServerContext *context, const ::pf_gossip_cli::Key *request,
-                                  ::pf_gossip::Message *response) override;
+        ::grpc::Status handleGetMessage(::grpc::ServerContextBase *context, const ::pf_gossip_cli::Key *request,
+                                        ::pf_gossip::Message *response);
+
+        /// Receive and handle multi Read request from a gossip client.
+        /// \param context The grpc context
+        /// \param request The request of rpc
+        /// \param response The response of rpc
+        /// \return The status of rpc
+        ::grpc::Status handleGetMessages(::grpc::ServerContextBase *context, const ::pf_gossip_cli::KeyList *request,
+                                         ::pf_gossip::SearchResult *response);
 
         /// Receive and handle Read request from a gossip client.
         /// \param context The grpc context
         /// \param request The request of rpc
         /// \param response The response of rpc
         /// \return The status of rpc
-        ::grpc::Status searchMessage(::grpc::ServerContext *context, const ::pf_gossip_cli::SearchInfo *request,
-                                     ::pf_gossip::SearchResult *response) override;
+        ::grpc::Status handleSearchMessage(::grpc::ServerContextBase *context, const ::pf_gossip_cli::SearchInfo *request,
+                                           ::pf_gossip::SearchResult *response);
+
+        /// Receive and open an ordered scan of keys with a prefix from a gossip client.
+        /// \param context The grpc context
+        /// \param request The request of rpc
+        /// \param scan Stores opened scan if succeed
+        /// \return The status of rpc
+        ::grpc::Status handleScanPrefix(::grpc::ServerContextBase *context, const ::pf_gossip_cli::PrefixScan *request,
+                                        std::unique_ptr<GossipCliScan> *scan);
+
+        /// Receive and open an ordered scan of a key range from a gossip client.
+        /// \param context The grpc context
+        /// \param request The request of rpc
+        /// \param scan Stores opened scan if succeed
+        /// \return The status of rpc
+        ::grpc::Status handleScanRange(::grpc::ServerContextBase *context, const ::pf_gossip_cli::RangeScan *request,
+                                       std::unique_ptr<GossipCliScan> *scan);
 
         /// Receive and handle node status request from a gossip client.
         /// \param context The grpc context
         /// \param request The request of rpc
         /// \param response The response of rpc
         /// \return The status of rpc
-        ::grpc::Status getNodeStatus(::grpc::ServerContext *context, const ::google::protobuf::Any *request,
-                                     ::pf_gossip_cli::JsonValue *response) override;
+        ::grpc::Status handleGetNodeStatus(::grpc::ServerContextBase *context, const ::google::protobuf::Any *request,
+                                           ::pf_gossip_cli::JsonValue *response);
 
         /// Receive and handle node network status from a gossip client.
         /// \param context The grpc context
         /// \param request The request of rpc
         /// \param response The response of rpc
         /// \return The status of rpc
-        ::grpc::Status getGossipNetwork(::grpc::ServerContext *context, const ::google::protobuf::Any *request,
-                                        ::pf_gossip_cli::JsonValue *response) override;
+        ::grpc::Status handleGetGossipNetwork(::grpc::ServerContextBase *context, const ::google::protobuf::Any *request,
+                                              ::pf_gossip_cli::JsonValue *response);
 
         // Commands Interface From a gossip client.
 
@@ -92,16 +155,87 @@ namespace gossip::server::service {
         /// \param request The request of rpc
         /// \param response The response of rpc
         /// \return The status of rpc
-        ::grpc::Status connect(::grpc::ServerContext *context, const ::pf_gossip_cli::Url *request,
-                               ::pf_gossip_cli::Echo *response) override;
+        ::grpc::Status handleConnect(::grpc::ServerContextBase *context, const ::pf_gossip_cli::Url *request,
+                                     ::pf_gossip_cli::Echo *response);
 
         /// Receive and handle shutdown commands from a gossip client.
         /// \param context The grpc context
         /// \param request The request of rpc
         /// \param response The response of rpc
         /// \return The status of rpc
+        ::grpc::Status handleShutdown(::grpc::ServerContextBase *context, const ::google::protobuf::Any *request,
+                                      ::pf_gossip_cli::Echo *response);
+
+        // Sync model entries, forward to the handlers above.
+
+        ::grpc::Status echo(::grpc::ServerContext *context, const ::pf_gossip_cli::Echo *request,
+                            ::pf_gossip_cli::Echo *response) override {
+            return handleEcho(context, request, response);
+        }
+
+        ::grpc::Status addMessage(::grpc::ServerContext *context, const ::pf_gossip::Message *request,
+                                  ::pf_gossip_cli::Echo *response) override {
+            return handleAddMessage(context, request, response);
+        }
+
+        ::grpc::Status addMessages(::grpc::ServerContext *context, const ::pf_gossip_cli::WriteBatch *request,
+                                   ::pf_gossip_cli::WriteResult *response) override {
+            return handleAddMessages(context, request, response);
+        }
+
+        ::grpc::Status deleteMessage(::grpc::ServerContext *context, const ::pf_gossip_cli::Key *request,
+                                     ::pf_gossip_cli::Echo *response) override {
+            return handleDeleteMessage(context, request, response);
+        }
+
+        ::grpc::Status getMessage(::grpc::ServerContext *context, const ::pf_gossip_cli::Key *request,
+                                  ::pf_gossip::Message *response) override {
+            return handleGetMessage(context, request, response);
+        }
+
+        ::grpc::Status getMessages(::grpc::ServerContext *context, const ::pf_gossip_cli::KeyList *request,
+                                   ::pf_gossip::SearchResult *response) override {
+            return handleGetMessages(context, request, response);
+        }
+
+        ::grpc::Status searchMessage(::grpc::ServerContext *context, const ::pf_gossip_cli::SearchInfo *request,
+                                     ::pf_gossip::SearchResult *response) override {
+            return handleSearchMessage(context, request, response);
+        }
+
+        ::grpc::Status scanPrefix(::grpc::ServerContext *context, const ::pf_gossip_cli::PrefixScan *request,
+                                  ::grpc::ServerWriter<::pf_gossip_cli::ScanResult> *writer) override {
+            std::unique_ptr<GossipCliScan> scan;
+            auto status = handleScanPrefix(context, request, &scan);
+            return status.ok() ? stream(scan.get(), writer) : status;
+        }
+
+        ::grpc::Status scanRange(::grpc::ServerContext *context, const ::pf_gossip_cli::RangeScan *request,
+                                 ::grpc::ServerWriter<::pf_gossip_cli::ScanResult> *writer) override {
+            std::unique_ptr<GossipCliScan> scan;
+            auto status = handleScanRange(context, request, &scan);
+            return status.ok() ? stream(scan.get(), writer) : status;
+        }
+
+        ::grpc::Status getNodeStatus(::grpc::ServerContext *context, const ::google::protobuf::Any *request,
+                                     ::pf_gossip_cli::JsonValue *response) override {
+            return handleGetNodeStatus(context, request, response);
+        }
+
+        ::grpc::Status getGossipNetwork(::grpc::ServerContext *context, const ::google::protobuf::Any *request,
+                                        ::pf_gossip_cli::JsonValue *response) override {
+            return handleGetGossipNetwork(context, request, response);
+        }
+
+        ::grpc::Status connect(::grpc::ServerContext *context, const ::pf_gossip_cli::Url *request,
+                               ::pf_gossip_cli::Echo *response) override {
+            return handleConnect(context, request, response);
+        }
+
         ::grpc::Status shutdown(::grpc::ServerContext *context, const ::google::protobuf::Any *request,
-                                ::pf_gossip_cli::Echo *response) override;
+                                ::pf_gossip_cli::Echo *response) override {
+            return handleShutdown(context, request, response);
+        }
 
     private:
 
@@ -110,6 +244,22 @@ namespace gossip::server::service {
         /// \return Is token matched
         bool IsTokenMatched(const std::multimap<grpc::string_ref, grpc::string_ref> &metadata);
 
+        /// Open a scan over a key range of a slot.
+        /// \param owner Name of slot, empty means local slot
+        /// \param start First key, inclusive
+        /// \param end Last key, exclusive. Empty means no upper bound
+        /// \param limit Max number of K-V pairs, 0 means no limit
+        /// \param continuation Continuation token of last scan, scan starts after it
+        /// \param scan Stores opened scan
+        void openScan(const std::string &owner, std::string start, std::string end, int limit,
+                      const std::string &continuation, std::unique_ptr<GossipCliScan> *scan);
+
+        /// Write all messages of a scan to a sync stream.
+        /// \param scan Opened scan
+        /// \param writer The grpc stream
+        /// \return The status of rpc
+        static ::grpc::Status stream(GossipCliScan *scan, ::grpc::ServerWriter<::pf_gossip_cli::ScanResult> *writer);
+
     private:
 
         GossipNode *node_; // the owner of this class
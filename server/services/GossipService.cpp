@@ -5,6 +5,8 @@
 #include "GossipService.h"
 #include "../GossipNode.h"
 
+#include <future>
+
 namespace gossip::server::service {
 
 
@@ -25,23 +27,44 @@ namespace gossip::server::service {
             return {grpc::StatusCode::INVALID_ARGUMENT, "Empty NodeName"};
         }
 
-        SlotValues values;
-        values.reserve(request->messages_size());
-        for (int i = 0; i < request->messages_size(); i++) {
-            auto &message = request->messages(i);
-            values.emplace(message.key(), message.value());
+        // 请求只在本次调用中使用，键值对可以直接移动到 slot 中，不需要再复制
+        auto update = const_cast<::pf_gossip::SlotUpdate *>(request);
+        auto succeed = update->messages_size();
+
+        auto version = node_->handlePullRequest(update);
+
+        response->set_version(version);
+        response->set_succeed(succeed);
+
+        return grpc::Status::OK;
+
+    } catch (std::exception &exception) {
+
+        std::cerr << exception.what() << std::endl;
+        return {grpc::StatusCode::ABORTED, "Exception Threw"};
+    }
+
+    ::grpc::Status GossipService::syncDigest(::grpc::ServerContext *context, const ::pf_gossip::DigestRequest *request,
+                                             ::pf_gossip::DigestResponse *response) try {
+
+        if (request->name().empty()) {
+            return {grpc::StatusCode::INVALID_ARGUMENT, "Empty NodeName"};
         }
 
-        std::vector<std::string> nodes;
-        nodes.reserve(request->pass_nodes_size());
-        for (int i = 0; i < request->pass_nodes_size(); i++) {
-            nodes.emplace_back(request->pass_nodes(i));
+        std::vector<int> nodes, differs;
+        std::vector<uint64_t> hashes;
+        nodes.reserve(request->nodes_size());
+        hashes.reserve(request->nodes_size());
+        for (auto &node: request->nodes()) {
+            nodes.emplace_back(node.index());
+            hashes.emplace_back(node.hash());
         }
 
-        auto version = node_->handlePullRequest(request->name(), values, request->version(), request);
+        auto version = node_->handleDigestRequest(request->name(), nodes, hashes, &differs);
 
         response->set_version(version);
-        response->set_succeed(request->messages_size());
+        for (auto index: differs)
+            response->add_differs(index);
 
         return grpc::Status::OK;
 
@@ -51,6 +74,53 @@ namespace gossip::server::service {
         return {grpc::StatusCode::ABORTED, "Exception Threw"};
     }
 
+    ::grpc::Status GossipService::syncSlots(::grpc::ServerContext *context, const ::pf_gossip::SyncRequest *request,
+                                            ::pf_gossip::SyncResponse *response) try {
+
+        if (request->node_name().empty()) {
+            return {grpc::StatusCode::INVALID_ARGUMENT, "Empty NodeName"};
+        }
+
+        node_->handleSyncRequest(*request, response);
+
+        return grpc::Status::OK;
+
+    } catch (std::exception &exception) {
+
+        std::cerr << exception.what() << std::endl;
+        return {grpc::StatusCode::ABORTED, "Exception Threw"};
+    }
+
+    ::grpc::Status GossipService::ping(::grpc::ServerContext *context, const ::pf_gossip::PingRequest *request,
+                                       ::pf_gossip::PingResponse *response) try {
+
+        // 同步模型中每个 rpc 本来就占用一个线程，等待间接探测的结果
+        std::promise<grpc::Status> finished;
+        asyncPing(request, response, [&finished](const grpc::Status &status) { finished.set_value(status); });
+        return finished.get_future().get();
+
+    } catch (std::exception &exception) {
+
+        std::cerr << exception.what() << std::endl;
+        return {grpc::StatusCode::ABORTED, "Exception Threw"};
+    }
+
+    void GossipService::asyncPing(const ::pf_gossip::PingRequest *request, ::pf_gossip::PingResponse *response,
+                                  const std::function<void(const ::grpc::Status &)> &done) try {
+
+        if (request->node_name().empty()) {
+            done({grpc::StatusCode::INVALID_ARGUMENT, "Empty NodeName"});
+            return;
+        }
+
+        node_->handlePing(*request, response, [done] { done(grpc::Status::OK); });
+
+    } catch (std::exception &exception) {
+
+        std::cerr << exception.what() << std::endl;
+        done({grpc::StatusCode::ABORTED, "Exception Threw"});
+    }
+
     ::grpc::Status GossipService::echo(::grpc::ServerContext *context, const ::pf_gossip::Message *request,
                                        ::pf_gossip::Message *response) try {
 
@@ -82,7 +152,7 @@ namespace gossip::server::service {
 
         response->set_name(node_->NodeName());
         response->set_version(node_->localSlot()->version());
-        response->set_address(request->address());  // FIXME
+        response->set_address(node_->internalAddress());
 
         return grpc::Status::OK;
     } catch (std::exception &exception) {
@@ -99,12 +169,8 @@ namespace gossip::server::service {
             return {grpc::StatusCode::INVALID_ARGUMENT, "Empty NodeName"};
         }
 
-        auto this_version = node_->handleHeartbeatRequest(request->node_name(), request->slot_name(),
-                                                          request->slot_version());
-
-        response->set_node_name(node_->NodeName());
-        response->set_slot_name(request->slot_name());
-        response->set_slot_version(this_version);
+        // 回复本节点所有 slot 的版本，对方据此发送本节点落后的 slot
+        node_->handleHeartbeatRequest(*request, response);
 
         return grpc::Status::OK;
     } catch (std::exception &exception) {
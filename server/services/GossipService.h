@@ -7,6 +7,8 @@
 
 #include "Gossip.grpc.pb.h"
 
+#include <functional>
+
 
 namespace gossip::server {
 
@@ -45,6 +47,38 @@ namespace gossip::server::service {
         ::grpc::Status pull(::grpc::ServerContext *context, const ::pf_gossip::SlotUpdate *request,
                             ::pf_gossip::updateResult *response) override;
 
+        /// Receive and handle merkle digest request from a gossip node.
+        /// \param context The grpc context
+        /// \param request The request of rpc
+        /// \param response The response of rpc
+        /// \return The status of rpc
+        ::grpc::Status syncDigest(::grpc::ServerContext *context, const ::pf_gossip::DigestRequest *request,
+                                  ::pf_gossip::DigestResponse *response) override;
+
+        /// Receive and handle push-pull anti-entropy request from a gossip node.
+        /// \param context The grpc context
+        /// \param request The request of rpc
+        /// \param response The response of rpc
+        /// \return The status of rpc
+        ::grpc::Status syncSlots(::grpc::ServerContext *context, const ::pf_gossip::SyncRequest *request,
+                                 ::pf_gossip::SyncResponse *response) override;
+
+        /// Receive and handle SWIM ping from a gossip node.
+        /// \param context The grpc context
+        /// \param request The request of rpc
+        /// \param response The response of rpc
+        /// \return The status of rpc
+        ::grpc::Status ping(::grpc::ServerContext *context, const ::pf_gossip::PingRequest *request,
+                            ::pf_gossip::PingResponse *response) override;
+
+        /// Receive and handle SWIM ping from a gossip node without blocking. An indirect ping is finished when
+        /// target node acks or times out.
+        /// \param request The request of rpc
+        /// \param response The response of rpc
+        /// \param done Called with the status of rpc once response is ready
+        void asyncPing(const ::pf_gossip::PingRequest *request, ::pf_gossip::PingResponse *response,
+                       const std::function<void(const ::grpc::Status &)> &done);
+
         /// Receive and handle echo request from a gossip node.
         /// \param context The grpc context
         /// \param request The request of rpc